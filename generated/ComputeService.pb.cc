@@ -14,14 +14,19 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
 namespace compute {
 }  // namespace compute
-static constexpr ::PROTOBUF_NAMESPACE_ID::Metadata* file_level_metadata_ComputeService_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_ComputeService_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_ComputeService_2eproto = nullptr;
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_ComputeService_2eproto::offsets[1] = {};
-static constexpr ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema* schemas = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::Message* const* file_default_instances = nullptr;
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_ComputeService_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ComputeService_2eproto = nullptr;
+const uint32_t TableStruct_ComputeService_2eproto::offsets[1] = {};
+static constexpr ::_pbi::MigrationSchema* schemas = nullptr;
+static constexpr ::_pb::Message* const* file_default_instances = nullptr;
 
 const char descriptor_table_protodef_ComputeService_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\024ComputeService.proto\022\007compute\032\020data_ty"
@@ -29,22 +34,24 @@ const char descriptor_table_protodef_ComputeService_2eproto[] PROTOBUF_SECTION_V
   "m\022\023.data_types.Command\032\031.data_types.Serv"
   "erMessage(\0010\001b\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_ComputeService_2eproto_deps[1] = {
+static const ::_pbi::DescriptorTable* const descriptor_table_ComputeService_2eproto_deps[1] = {
   &::descriptor_table_data_5ftypes_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_ComputeService_2eproto_sccs[1] = {
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_ComputeService_2eproto_once;
-static bool descriptor_table_ComputeService_2eproto_initialized = false;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ComputeService_2eproto = {
-  &descriptor_table_ComputeService_2eproto_initialized, descriptor_table_protodef_ComputeService_2eproto, "ComputeService.proto", 141,
-  &descriptor_table_ComputeService_2eproto_once, descriptor_table_ComputeService_2eproto_sccs, descriptor_table_ComputeService_2eproto_deps, 0, 1,
-  schemas, file_default_instances, TableStruct_ComputeService_2eproto::offsets,
-  file_level_metadata_ComputeService_2eproto, 0, file_level_enum_descriptors_ComputeService_2eproto, file_level_service_descriptors_ComputeService_2eproto,
+static ::_pbi::once_flag descriptor_table_ComputeService_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ComputeService_2eproto = {
+    false, false, 141, descriptor_table_protodef_ComputeService_2eproto,
+    "ComputeService.proto",
+    &descriptor_table_ComputeService_2eproto_once, descriptor_table_ComputeService_2eproto_deps, 1, 0,
+    schemas, file_default_instances, TableStruct_ComputeService_2eproto::offsets,
+    nullptr, file_level_enum_descriptors_ComputeService_2eproto,
+    file_level_service_descriptors_ComputeService_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ComputeService_2eproto_getter() {
+  return &descriptor_table_ComputeService_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_ComputeService_2eproto = (  ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_ComputeService_2eproto), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ComputeService_2eproto(&descriptor_table_ComputeService_2eproto);
 namespace compute {
 
 // @@protoc_insertion_point(namespace_scope)
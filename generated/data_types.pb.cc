@@ -14,447 +14,641 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_data_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_CameraFrame_data_5ftypes_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_data_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_ConfigRequest_data_5ftypes_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_data_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ConfigResponse_data_5ftypes_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_data_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ControlAction_data_5ftypes_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_data_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_DetectionResult_data_5ftypes_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_data_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_DeviceStatus_data_5ftypes_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_data_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Heartbeat_data_5ftypes_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_FloatValue_google_2fprotobuf_2fwrappers_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2ftimestamp_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Timestamp_google_2fprotobuf_2ftimestamp_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UInt32Value_google_2fprotobuf_2fwrappers_2eproto;
-namespace data_types {
-class CameraFrameDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<CameraFrame> _instance;
-} _CameraFrame_default_instance_;
-class BoundingBoxDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<BoundingBox> _instance;
-} _BoundingBox_default_instance_;
-class DetectionResultDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<DetectionResult> _instance;
-} _DetectionResult_default_instance_;
-class DeviceStatusDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<DeviceStatus> _instance;
-} _DeviceStatus_default_instance_;
-class CommandDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Command> _instance;
-  const ::data_types::ConfigRequest* config_request_;
-  const ::data_types::ControlAction* control_action_;
-  const ::data_types::Heartbeat* heartbeat_;
-  const ::data_types::DetectionResult* detection_result_;
-  const ::data_types::CameraFrame* camera_frame_;
-} _Command_default_instance_;
-class ConfigRequestDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ConfigRequest> _instance;
-} _ConfigRequest_default_instance_;
-class ControlActionDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ControlAction> _instance;
-} _ControlAction_default_instance_;
-class HeartbeatDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Heartbeat> _instance;
-} _Heartbeat_default_instance_;
-class ServerMessageDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ServerMessage> _instance;
-  const ::data_types::CameraFrame* camera_frame_;
-  const ::data_types::DetectionResult* detection_result_;
-  const ::data_types::DeviceStatus* device_status_;
-  const ::data_types::ConfigResponse* config_response_;
-} _ServerMessage_default_instance_;
-class ClientMessageDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ClientMessage> _instance;
-  const ::data_types::DeviceStatus* device_status_;
-  const ::data_types::ConfigResponse* config_response_;
-} _ClientMessage_default_instance_;
-class ConfigResponseDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ConfigResponse> _instance;
-} _ConfigResponse_default_instance_;
-}  // namespace data_types
-static void InitDefaultsscc_info_BoundingBox_data_5ftypes_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::data_types::_BoundingBox_default_instance_;
-    new (ptr) ::data_types::BoundingBox();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::data_types::BoundingBox::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_BoundingBox_data_5ftypes_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_BoundingBox_data_5ftypes_2eproto}, {}};
-
-static void InitDefaultsscc_info_CameraFrame_data_5ftypes_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::data_types::_CameraFrame_default_instance_;
-    new (ptr) ::data_types::CameraFrame();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::data_types::CameraFrame::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_CameraFrame_data_5ftypes_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_CameraFrame_data_5ftypes_2eproto}, {
-      &scc_info_Timestamp_google_2fprotobuf_2ftimestamp_2eproto.base,}};
-
-static void InitDefaultsscc_info_ClientMessage_data_5ftypes_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::data_types::_ClientMessage_default_instance_;
-    new (ptr) ::data_types::ClientMessage();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::data_types::ClientMessage::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_ClientMessage_data_5ftypes_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, 0, InitDefaultsscc_info_ClientMessage_data_5ftypes_2eproto}, {
-      &scc_info_DeviceStatus_data_5ftypes_2eproto.base,
-      &scc_info_ConfigResponse_data_5ftypes_2eproto.base,}};
-
-static void InitDefaultsscc_info_Command_data_5ftypes_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::data_types::_Command_default_instance_;
-    new (ptr) ::data_types::Command();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::data_types::Command::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<5> scc_info_Command_data_5ftypes_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 5, 0, InitDefaultsscc_info_Command_data_5ftypes_2eproto}, {
-      &scc_info_ConfigRequest_data_5ftypes_2eproto.base,
-      &scc_info_ControlAction_data_5ftypes_2eproto.base,
-      &scc_info_Heartbeat_data_5ftypes_2eproto.base,
-      &scc_info_DetectionResult_data_5ftypes_2eproto.base,
-      &scc_info_CameraFrame_data_5ftypes_2eproto.base,}};
-
-static void InitDefaultsscc_info_ConfigRequest_data_5ftypes_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::data_types::_ConfigRequest_default_instance_;
-    new (ptr) ::data_types::ConfigRequest();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::data_types::ConfigRequest::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_ConfigRequest_data_5ftypes_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, 0, InitDefaultsscc_info_ConfigRequest_data_5ftypes_2eproto}, {
-      &scc_info_FloatValue_google_2fprotobuf_2fwrappers_2eproto.base,
-      &scc_info_UInt32Value_google_2fprotobuf_2fwrappers_2eproto.base,}};
-
-static void InitDefaultsscc_info_ConfigResponse_data_5ftypes_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::data_types::_ConfigResponse_default_instance_;
-    new (ptr) ::data_types::ConfigResponse();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::data_types::ConfigResponse::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ConfigResponse_data_5ftypes_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_ConfigResponse_data_5ftypes_2eproto}, {}};
-
-static void InitDefaultsscc_info_ControlAction_data_5ftypes_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::data_types::_ControlAction_default_instance_;
-    new (ptr) ::data_types::ControlAction();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::data_types::ControlAction::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ControlAction_data_5ftypes_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_ControlAction_data_5ftypes_2eproto}, {}};
-
-static void InitDefaultsscc_info_DetectionResult_data_5ftypes_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::data_types::_DetectionResult_default_instance_;
-    new (ptr) ::data_types::DetectionResult();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::data_types::DetectionResult::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_DetectionResult_data_5ftypes_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_DetectionResult_data_5ftypes_2eproto}, {
-      &scc_info_Timestamp_google_2fprotobuf_2ftimestamp_2eproto.base,}};
-
-static void InitDefaultsscc_info_DeviceStatus_data_5ftypes_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::data_types::_DeviceStatus_default_instance_;
-    new (ptr) ::data_types::DeviceStatus();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::data_types::DeviceStatus::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_DeviceStatus_data_5ftypes_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_DeviceStatus_data_5ftypes_2eproto}, {}};
-
-static void InitDefaultsscc_info_Heartbeat_data_5ftypes_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::data_types::_Heartbeat_default_instance_;
-    new (ptr) ::data_types::Heartbeat();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::data_types::Heartbeat::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Heartbeat_data_5ftypes_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_Heartbeat_data_5ftypes_2eproto}, {
-      &scc_info_Timestamp_google_2fprotobuf_2ftimestamp_2eproto.base,}};
 
-static void InitDefaultsscc_info_ServerMessage_data_5ftypes_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
+PROTOBUF_PRAGMA_INIT_SEG
 
-  {
-    void* ptr = &::data_types::_ServerMessage_default_instance_;
-    new (ptr) ::data_types::ServerMessage();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::data_types::ServerMessage::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<4> scc_info_ServerMessage_data_5ftypes_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 4, 0, InitDefaultsscc_info_ServerMessage_data_5ftypes_2eproto}, {
-      &scc_info_CameraFrame_data_5ftypes_2eproto.base,
-      &scc_info_DetectionResult_data_5ftypes_2eproto.base,
-      &scc_info_DeviceStatus_data_5ftypes_2eproto.base,
-      &scc_info_ConfigResponse_data_5ftypes_2eproto.base,}};
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_data_5ftypes_2eproto[11];
-static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_data_5ftypes_2eproto[2];
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_data_5ftypes_2eproto = nullptr;
+namespace data_types {
+PROTOBUF_CONSTEXPR CameraFrame::CameraFrame(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.image_data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.format_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.timestamp_)*/nullptr
+  , /*decltype(_impl_.width_)*/0u
+  , /*decltype(_impl_.height_)*/0u
+  , /*decltype(_impl_.frame_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.low_priority_)*/false
+  , /*decltype(_impl_.camera_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CameraFrameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CameraFrameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CameraFrameDefaultTypeInternal() {}
+  union {
+    CameraFrame _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CameraFrameDefaultTypeInternal _CameraFrame_default_instance_;
+PROTOBUF_CONSTEXPR BoundingBox::BoundingBox(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.label_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.x_min_)*/0u
+  , /*decltype(_impl_.y_min_)*/0u
+  , /*decltype(_impl_.x_max_)*/0u
+  , /*decltype(_impl_.y_max_)*/0u
+  , /*decltype(_impl_.confidence_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BoundingBoxDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BoundingBoxDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BoundingBoxDefaultTypeInternal() {}
+  union {
+    BoundingBox _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BoundingBoxDefaultTypeInternal _BoundingBox_default_instance_;
+PROTOBUF_CONSTEXPR InstanceMask::InstanceMask(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.counts_)*/{}
+  , /*decltype(_impl_._counts_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.label_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.detection_index_)*/0u
+  , /*decltype(_impl_.x_min_)*/0
+  , /*decltype(_impl_.y_min_)*/0
+  , /*decltype(_impl_.x_max_)*/0
+  , /*decltype(_impl_.y_max_)*/0
+  , /*decltype(_impl_.width_)*/0u
+  , /*decltype(_impl_.height_)*/0u
+  , /*decltype(_impl_.score_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InstanceMaskDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InstanceMaskDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InstanceMaskDefaultTypeInternal() {}
+  union {
+    InstanceMask _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InstanceMaskDefaultTypeInternal _InstanceMask_default_instance_;
+PROTOBUF_CONSTEXPR DetectionResult::DetectionResult(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.masks_)*/{}
+  , /*decltype(_impl_.json_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.backend_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.frame_timestamp_)*/nullptr
+  , /*decltype(_impl_.frame_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.camera_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DetectionResultDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DetectionResultDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DetectionResultDefaultTypeInternal() {}
+  union {
+    DetectionResult _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DetectionResultDefaultTypeInternal _DetectionResult_default_instance_;
+PROTOBUF_CONSTEXPR DeviceStatus::DeviceStatus(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.device_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.firmware_version_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.profile_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.profile_reason_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.state_)*/0
+  , /*decltype(_impl_.cpu_temperature_c_)*/0
+  , /*decltype(_impl_.frame_rate_fps_)*/0u
+  , /*decltype(_impl_.processing_latency_ms_)*/0u
+  , /*decltype(_impl_.is_sleeping_)*/false
+  , /*decltype(_impl_.profile_auto_)*/false
+  , /*decltype(_impl_.battery_percent_)*/0
+  , /*decltype(_impl_.active_streams_)*/0u
+  , /*decltype(_impl_.jpeg_quality_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DeviceStatusDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DeviceStatusDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DeviceStatusDefaultTypeInternal() {}
+  union {
+    DeviceStatus _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeviceStatusDefaultTypeInternal _DeviceStatus_default_instance_;
+PROTOBUF_CONSTEXPR Command::Command(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.command_type_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct CommandDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CommandDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CommandDefaultTypeInternal() {}
+  union {
+    Command _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommandDefaultTypeInternal _Command_default_instance_;
+PROTOBUF_CONSTEXPR Capabilities::Capabilities(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.frame_formats_)*/{}
+  , /*decltype(_impl_.result_encodings_)*/{}
+  , /*decltype(_impl_.compression_)*/{}
+  , /*decltype(_impl_.protocol_version_)*/0u
+  , /*decltype(_impl_.result_batch_)*/false
+  , /*decltype(_impl_.chunked_frames_)*/false
+  , /*decltype(_impl_.max_chunk_bytes_)*/0u
+  , /*decltype(_impl_.max_inflight_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CapabilitiesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CapabilitiesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CapabilitiesDefaultTypeInternal() {}
+  union {
+    Capabilities _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CapabilitiesDefaultTypeInternal _Capabilities_default_instance_;
+PROTOBUF_CONSTEXPR SessionConfig::SessionConfig(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.frame_format_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.result_encoding_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.compression_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.protocol_version_)*/0u
+  , /*decltype(_impl_.result_batch_)*/false
+  , /*decltype(_impl_.chunked_frames_)*/false
+  , /*decltype(_impl_.chunk_bytes_)*/0u
+  , /*decltype(_impl_.max_inflight_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SessionConfigDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SessionConfigDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SessionConfigDefaultTypeInternal() {}
+  union {
+    SessionConfig _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SessionConfigDefaultTypeInternal _SessionConfig_default_instance_;
+PROTOBUF_CONSTEXPR FrameHeader::FrameHeader(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.frame_)*/nullptr
+  , /*decltype(_impl_.total_size_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FrameHeaderDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FrameHeaderDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FrameHeaderDefaultTypeInternal() {}
+  union {
+    FrameHeader _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FrameHeaderDefaultTypeInternal _FrameHeader_default_instance_;
+PROTOBUF_CONSTEXPR FrameChunk::FrameChunk(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.frame_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.offset_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FrameChunkDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FrameChunkDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FrameChunkDefaultTypeInternal() {}
+  union {
+    FrameChunk _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FrameChunkDefaultTypeInternal _FrameChunk_default_instance_;
+PROTOBUF_CONSTEXPR ConfigRequest::ConfigRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.profile_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.detection_threshold_)*/nullptr
+  , /*decltype(_impl_.sleep_timeout_sec_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ConfigRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConfigRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConfigRequestDefaultTypeInternal() {}
+  union {
+    ConfigRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConfigRequestDefaultTypeInternal _ConfigRequest_default_instance_;
+PROTOBUF_CONSTEXPR ControlAction::ControlAction(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.profile_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.action_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ControlActionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ControlActionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ControlActionDefaultTypeInternal() {}
+  union {
+    ControlAction _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ControlActionDefaultTypeInternal _ControlAction_default_instance_;
+PROTOBUF_CONSTEXPR Heartbeat::Heartbeat(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.timestamp_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HeartbeatDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HeartbeatDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HeartbeatDefaultTypeInternal() {}
+  union {
+    Heartbeat _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HeartbeatDefaultTypeInternal _Heartbeat_default_instance_;
+PROTOBUF_CONSTEXPR ServerMessage::ServerMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.message_type_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ServerMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerMessageDefaultTypeInternal() {}
+  union {
+    ServerMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerMessageDefaultTypeInternal _ServerMessage_default_instance_;
+PROTOBUF_CONSTEXPR ResultBatch::ResultBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.results_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ResultBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResultBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResultBatchDefaultTypeInternal() {}
+  union {
+    ResultBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResultBatchDefaultTypeInternal _ResultBatch_default_instance_;
+PROTOBUF_CONSTEXPR ClientMessage::ClientMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.message_type_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ClientMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ClientMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ClientMessageDefaultTypeInternal() {}
+  union {
+    ClientMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ClientMessageDefaultTypeInternal _ClientMessage_default_instance_;
+PROTOBUF_CONSTEXPR ConfigResponse::ConfigResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ConfigResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConfigResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConfigResponseDefaultTypeInternal() {}
+  union {
+    ConfigResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConfigResponseDefaultTypeInternal _ConfigResponse_default_instance_;
+}  // namespace data_types
+static ::_pb::Metadata file_level_metadata_data_5ftypes_2eproto[17];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_data_5ftypes_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_data_5ftypes_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_data_5ftypes_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_data_5ftypes_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::data_types::CameraFrame, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::data_types::CameraFrame, image_data_),
-  PROTOBUF_FIELD_OFFSET(::data_types::CameraFrame, width_),
-  PROTOBUF_FIELD_OFFSET(::data_types::CameraFrame, height_),
-  PROTOBUF_FIELD_OFFSET(::data_types::CameraFrame, timestamp_),
-  PROTOBUF_FIELD_OFFSET(::data_types::CameraFrame, format_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::data_types::CameraFrame, _impl_.image_data_),
+  PROTOBUF_FIELD_OFFSET(::data_types::CameraFrame, _impl_.width_),
+  PROTOBUF_FIELD_OFFSET(::data_types::CameraFrame, _impl_.height_),
+  PROTOBUF_FIELD_OFFSET(::data_types::CameraFrame, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::data_types::CameraFrame, _impl_.format_),
+  PROTOBUF_FIELD_OFFSET(::data_types::CameraFrame, _impl_.frame_id_),
+  PROTOBUF_FIELD_OFFSET(::data_types::CameraFrame, _impl_.low_priority_),
+  PROTOBUF_FIELD_OFFSET(::data_types::CameraFrame, _impl_.camera_id_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::data_types::BoundingBox, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::data_types::BoundingBox, x_min_),
-  PROTOBUF_FIELD_OFFSET(::data_types::BoundingBox, y_min_),
-  PROTOBUF_FIELD_OFFSET(::data_types::BoundingBox, x_max_),
-  PROTOBUF_FIELD_OFFSET(::data_types::BoundingBox, y_max_),
-  PROTOBUF_FIELD_OFFSET(::data_types::BoundingBox, label_),
-  PROTOBUF_FIELD_OFFSET(::data_types::BoundingBox, confidence_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::data_types::BoundingBox, _impl_.x_min_),
+  PROTOBUF_FIELD_OFFSET(::data_types::BoundingBox, _impl_.y_min_),
+  PROTOBUF_FIELD_OFFSET(::data_types::BoundingBox, _impl_.x_max_),
+  PROTOBUF_FIELD_OFFSET(::data_types::BoundingBox, _impl_.y_max_),
+  PROTOBUF_FIELD_OFFSET(::data_types::BoundingBox, _impl_.label_),
+  PROTOBUF_FIELD_OFFSET(::data_types::BoundingBox, _impl_.confidence_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::data_types::InstanceMask, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::data_types::InstanceMask, _impl_.detection_index_),
+  PROTOBUF_FIELD_OFFSET(::data_types::InstanceMask, _impl_.x_min_),
+  PROTOBUF_FIELD_OFFSET(::data_types::InstanceMask, _impl_.y_min_),
+  PROTOBUF_FIELD_OFFSET(::data_types::InstanceMask, _impl_.x_max_),
+  PROTOBUF_FIELD_OFFSET(::data_types::InstanceMask, _impl_.y_max_),
+  PROTOBUF_FIELD_OFFSET(::data_types::InstanceMask, _impl_.width_),
+  PROTOBUF_FIELD_OFFSET(::data_types::InstanceMask, _impl_.height_),
+  PROTOBUF_FIELD_OFFSET(::data_types::InstanceMask, _impl_.counts_),
+  PROTOBUF_FIELD_OFFSET(::data_types::InstanceMask, _impl_.label_),
+  PROTOBUF_FIELD_OFFSET(::data_types::InstanceMask, _impl_.score_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::data_types::DetectionResult, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::data_types::DetectionResult, frame_timestamp_),
-  PROTOBUF_FIELD_OFFSET(::data_types::DetectionResult, json_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::data_types::DetectionResult, _impl_.frame_timestamp_),
+  PROTOBUF_FIELD_OFFSET(::data_types::DetectionResult, _impl_.json_),
+  PROTOBUF_FIELD_OFFSET(::data_types::DetectionResult, _impl_.frame_id_),
+  PROTOBUF_FIELD_OFFSET(::data_types::DetectionResult, _impl_.masks_),
+  PROTOBUF_FIELD_OFFSET(::data_types::DetectionResult, _impl_.backend_),
+  PROTOBUF_FIELD_OFFSET(::data_types::DetectionResult, _impl_.camera_id_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::data_types::DeviceStatus, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::data_types::DeviceStatus, device_id_),
-  PROTOBUF_FIELD_OFFSET(::data_types::DeviceStatus, state_),
-  PROTOBUF_FIELD_OFFSET(::data_types::DeviceStatus, cpu_temperature_c_),
-  PROTOBUF_FIELD_OFFSET(::data_types::DeviceStatus, frame_rate_fps_),
-  PROTOBUF_FIELD_OFFSET(::data_types::DeviceStatus, processing_latency_ms_),
-  PROTOBUF_FIELD_OFFSET(::data_types::DeviceStatus, firmware_version_),
-  PROTOBUF_FIELD_OFFSET(::data_types::DeviceStatus, is_sleeping_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::data_types::DeviceStatus, _impl_.device_id_),
+  PROTOBUF_FIELD_OFFSET(::data_types::DeviceStatus, _impl_.state_),
+  PROTOBUF_FIELD_OFFSET(::data_types::DeviceStatus, _impl_.cpu_temperature_c_),
+  PROTOBUF_FIELD_OFFSET(::data_types::DeviceStatus, _impl_.frame_rate_fps_),
+  PROTOBUF_FIELD_OFFSET(::data_types::DeviceStatus, _impl_.processing_latency_ms_),
+  PROTOBUF_FIELD_OFFSET(::data_types::DeviceStatus, _impl_.firmware_version_),
+  PROTOBUF_FIELD_OFFSET(::data_types::DeviceStatus, _impl_.is_sleeping_),
+  PROTOBUF_FIELD_OFFSET(::data_types::DeviceStatus, _impl_.profile_),
+  PROTOBUF_FIELD_OFFSET(::data_types::DeviceStatus, _impl_.profile_auto_),
+  PROTOBUF_FIELD_OFFSET(::data_types::DeviceStatus, _impl_.profile_reason_),
+  PROTOBUF_FIELD_OFFSET(::data_types::DeviceStatus, _impl_.battery_percent_),
+  PROTOBUF_FIELD_OFFSET(::data_types::DeviceStatus, _impl_.active_streams_),
+  PROTOBUF_FIELD_OFFSET(::data_types::DeviceStatus, _impl_.jpeg_quality_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::data_types::Command, _internal_metadata_),
   ~0u,  // no _extensions_
-  PROTOBUF_FIELD_OFFSET(::data_types::Command, _oneof_case_[0]),
+  PROTOBUF_FIELD_OFFSET(::data_types::Command, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::data_types::Command, _impl_.command_type_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::data_types::Capabilities, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::data_types::Capabilities, _impl_.protocol_version_),
+  PROTOBUF_FIELD_OFFSET(::data_types::Capabilities, _impl_.frame_formats_),
+  PROTOBUF_FIELD_OFFSET(::data_types::Capabilities, _impl_.result_encodings_),
+  PROTOBUF_FIELD_OFFSET(::data_types::Capabilities, _impl_.result_batch_),
+  PROTOBUF_FIELD_OFFSET(::data_types::Capabilities, _impl_.chunked_frames_),
+  PROTOBUF_FIELD_OFFSET(::data_types::Capabilities, _impl_.max_chunk_bytes_),
+  PROTOBUF_FIELD_OFFSET(::data_types::Capabilities, _impl_.max_inflight_),
+  PROTOBUF_FIELD_OFFSET(::data_types::Capabilities, _impl_.compression_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::data_types::SessionConfig, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::data_types::SessionConfig, _impl_.protocol_version_),
+  PROTOBUF_FIELD_OFFSET(::data_types::SessionConfig, _impl_.frame_format_),
+  PROTOBUF_FIELD_OFFSET(::data_types::SessionConfig, _impl_.result_encoding_),
+  PROTOBUF_FIELD_OFFSET(::data_types::SessionConfig, _impl_.result_batch_),
+  PROTOBUF_FIELD_OFFSET(::data_types::SessionConfig, _impl_.chunked_frames_),
+  PROTOBUF_FIELD_OFFSET(::data_types::SessionConfig, _impl_.chunk_bytes_),
+  PROTOBUF_FIELD_OFFSET(::data_types::SessionConfig, _impl_.max_inflight_),
+  PROTOBUF_FIELD_OFFSET(::data_types::SessionConfig, _impl_.compression_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::data_types::FrameHeader, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::data_types::FrameHeader, _impl_.frame_),
+  PROTOBUF_FIELD_OFFSET(::data_types::FrameHeader, _impl_.total_size_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::data_types::FrameChunk, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  offsetof(::data_types::CommandDefaultTypeInternal, config_request_),
-  offsetof(::data_types::CommandDefaultTypeInternal, control_action_),
-  offsetof(::data_types::CommandDefaultTypeInternal, heartbeat_),
-  offsetof(::data_types::CommandDefaultTypeInternal, detection_result_),
-  offsetof(::data_types::CommandDefaultTypeInternal, camera_frame_),
-  PROTOBUF_FIELD_OFFSET(::data_types::Command, command_type_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::data_types::FrameChunk, _impl_.frame_id_),
+  PROTOBUF_FIELD_OFFSET(::data_types::FrameChunk, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::data_types::FrameChunk, _impl_.data_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::data_types::ConfigRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::data_types::ConfigRequest, detection_threshold_),
-  PROTOBUF_FIELD_OFFSET(::data_types::ConfigRequest, sleep_timeout_sec_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::data_types::ConfigRequest, _impl_.detection_threshold_),
+  PROTOBUF_FIELD_OFFSET(::data_types::ConfigRequest, _impl_.sleep_timeout_sec_),
+  PROTOBUF_FIELD_OFFSET(::data_types::ConfigRequest, _impl_.profile_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::data_types::ControlAction, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::data_types::ControlAction, action_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::data_types::ControlAction, _impl_.action_),
+  PROTOBUF_FIELD_OFFSET(::data_types::ControlAction, _impl_.profile_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::data_types::Heartbeat, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::data_types::Heartbeat, timestamp_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::data_types::Heartbeat, _impl_.timestamp_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::data_types::ServerMessage, _internal_metadata_),
   ~0u,  // no _extensions_
-  PROTOBUF_FIELD_OFFSET(::data_types::ServerMessage, _oneof_case_[0]),
+  PROTOBUF_FIELD_OFFSET(::data_types::ServerMessage, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::data_types::ServerMessage, _impl_.message_type_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::data_types::ResultBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  offsetof(::data_types::ServerMessageDefaultTypeInternal, camera_frame_),
-  offsetof(::data_types::ServerMessageDefaultTypeInternal, detection_result_),
-  offsetof(::data_types::ServerMessageDefaultTypeInternal, device_status_),
-  offsetof(::data_types::ServerMessageDefaultTypeInternal, config_response_),
-  PROTOBUF_FIELD_OFFSET(::data_types::ServerMessage, message_type_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::data_types::ResultBatch, _impl_.results_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::data_types::ClientMessage, _internal_metadata_),
   ~0u,  // no _extensions_
-  PROTOBUF_FIELD_OFFSET(::data_types::ClientMessage, _oneof_case_[0]),
+  PROTOBUF_FIELD_OFFSET(::data_types::ClientMessage, _impl_._oneof_case_[0]),
   ~0u,  // no _weak_field_map_
-  offsetof(::data_types::ClientMessageDefaultTypeInternal, device_status_),
-  offsetof(::data_types::ClientMessageDefaultTypeInternal, config_response_),
-  PROTOBUF_FIELD_OFFSET(::data_types::ClientMessage, message_type_),
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::data_types::ClientMessage, _impl_.message_type_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::data_types::ConfigResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::data_types::ConfigResponse, success_),
-  PROTOBUF_FIELD_OFFSET(::data_types::ConfigResponse, message_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::data_types::ConfigResponse, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::data_types::ConfigResponse, _impl_.message_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::data_types::CameraFrame)},
-  { 10, -1, sizeof(::data_types::BoundingBox)},
-  { 21, -1, sizeof(::data_types::DetectionResult)},
-  { 28, -1, sizeof(::data_types::DeviceStatus)},
-  { 40, -1, sizeof(::data_types::Command)},
-  { 51, -1, sizeof(::data_types::ConfigRequest)},
-  { 58, -1, sizeof(::data_types::ControlAction)},
-  { 64, -1, sizeof(::data_types::Heartbeat)},
-  { 70, -1, sizeof(::data_types::ServerMessage)},
-  { 80, -1, sizeof(::data_types::ClientMessage)},
-  { 88, -1, sizeof(::data_types::ConfigResponse)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::data_types::CameraFrame)},
+  { 14, -1, -1, sizeof(::data_types::BoundingBox)},
+  { 26, -1, -1, sizeof(::data_types::InstanceMask)},
+  { 42, -1, -1, sizeof(::data_types::DetectionResult)},
+  { 54, -1, -1, sizeof(::data_types::DeviceStatus)},
+  { 73, -1, -1, sizeof(::data_types::Command)},
+  { 88, -1, -1, sizeof(::data_types::Capabilities)},
+  { 102, -1, -1, sizeof(::data_types::SessionConfig)},
+  { 116, -1, -1, sizeof(::data_types::FrameHeader)},
+  { 124, -1, -1, sizeof(::data_types::FrameChunk)},
+  { 133, -1, -1, sizeof(::data_types::ConfigRequest)},
+  { 142, -1, -1, sizeof(::data_types::ControlAction)},
+  { 150, -1, -1, sizeof(::data_types::Heartbeat)},
+  { 157, -1, -1, sizeof(::data_types::ServerMessage)},
+  { 171, -1, -1, sizeof(::data_types::ResultBatch)},
+  { 178, -1, -1, sizeof(::data_types::ClientMessage)},
+  { 187, -1, -1, sizeof(::data_types::ConfigResponse)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::data_types::_CameraFrame_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::data_types::_BoundingBox_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::data_types::_DetectionResult_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::data_types::_DeviceStatus_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::data_types::_Command_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::data_types::_ConfigRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::data_types::_ControlAction_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::data_types::_Heartbeat_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::data_types::_ServerMessage_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::data_types::_ClientMessage_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::data_types::_ConfigResponse_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::data_types::_CameraFrame_default_instance_._instance,
+  &::data_types::_BoundingBox_default_instance_._instance,
+  &::data_types::_InstanceMask_default_instance_._instance,
+  &::data_types::_DetectionResult_default_instance_._instance,
+  &::data_types::_DeviceStatus_default_instance_._instance,
+  &::data_types::_Command_default_instance_._instance,
+  &::data_types::_Capabilities_default_instance_._instance,
+  &::data_types::_SessionConfig_default_instance_._instance,
+  &::data_types::_FrameHeader_default_instance_._instance,
+  &::data_types::_FrameChunk_default_instance_._instance,
+  &::data_types::_ConfigRequest_default_instance_._instance,
+  &::data_types::_ControlAction_default_instance_._instance,
+  &::data_types::_Heartbeat_default_instance_._instance,
+  &::data_types::_ServerMessage_default_instance_._instance,
+  &::data_types::_ResultBatch_default_instance_._instance,
+  &::data_types::_ClientMessage_default_instance_._instance,
+  &::data_types::_ConfigResponse_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_data_5ftypes_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\020data_types.proto\022\ndata_types\032\037google/p"
   "rotobuf/timestamp.proto\032\036google/protobuf"
-  "/wrappers.proto\"\177\n\013CameraFrame\022\022\n\nimage_"
-  "data\030\001 \001(\014\022\r\n\005width\030\002 \001(\r\022\016\n\006height\030\003 \001("
-  "\r\022-\n\ttimestamp\030\004 \001(\0132\032.google.protobuf.T"
-  "imestamp\022\016\n\006format\030\005 \001(\t\"l\n\013BoundingBox\022"
-  "\r\n\005x_min\030\001 \001(\r\022\r\n\005y_min\030\002 \001(\r\022\r\n\005x_max\030\003"
-  " \001(\r\022\r\n\005y_max\030\004 \001(\r\022\r\n\005label\030\005 \001(\t\022\022\n\nco"
-  "nfidence\030\006 \001(\002\"T\n\017DetectionResult\0223\n\017fra"
+  "/wrappers.proto\"\272\001\n\013CameraFrame\022\022\n\nimage"
+  "_data\030\001 \001(\014\022\r\n\005width\030\002 \001(\r\022\016\n\006height\030\003 \001"
+  "(\r\022-\n\ttimestamp\030\004 \001(\0132\032.google.protobuf."
+  "Timestamp\022\016\n\006format\030\005 \001(\t\022\020\n\010frame_id\030\006 "
+  "\001(\004\022\024\n\014low_priority\030\007 \001(\010\022\021\n\tcamera_id\030\010"
+  " \001(\r\"l\n\013BoundingBox\022\r\n\005x_min\030\001 \001(\r\022\r\n\005y_"
+  "min\030\002 \001(\r\022\r\n\005x_max\030\003 \001(\r\022\r\n\005y_max\030\004 \001(\r\022"
+  "\r\n\005label\030\005 \001(\t\022\022\n\nconfidence\030\006 \001(\002\"\260\001\n\014I"
+  "nstanceMask\022\027\n\017detection_index\030\001 \001(\r\022\r\n\005"
+  "x_min\030\002 \001(\002\022\r\n\005y_min\030\003 \001(\002\022\r\n\005x_max\030\004 \001("
+  "\002\022\r\n\005y_max\030\005 \001(\002\022\r\n\005width\030\006 \001(\r\022\016\n\006heigh"
+  "t\030\007 \001(\r\022\016\n\006counts\030\010 \003(\r\022\r\n\005label\030\t \001(\t\022\r"
+  "\n\005score\030\n \001(\002\"\263\001\n\017DetectionResult\0223\n\017fra"
   "me_timestamp\030\001 \001(\0132\032.google.protobuf.Tim"
-  "estamp\022\014\n\004json\030\002 \001(\t\"\265\002\n\014DeviceStatus\022\021\n"
-  "\tdevice_id\030\001 \001(\t\0227\n\005state\030\002 \001(\0162(.data_t"
-  "ypes.DeviceStatus.ConnectionState\022\031\n\021cpu"
-  "_temperature_c\030\003 \001(\002\022\026\n\016frame_rate_fps\030\004"
-  " \001(\r\022\035\n\025processing_latency_ms\030\005 \001(\r\022\030\n\020f"
-  "irmware_version\030\006 \001(\t\022\023\n\013is_sleeping\030\007 \001"
-  "(\010\"X\n\017ConnectionState\022\020\n\014DISCONNECTED\020\000\022"
-  "\017\n\013BLE_PAIRING\020\001\022\022\n\016WLAN_CONNECTED\020\002\022\016\n\n"
-  "GRPC_READY\020\003\"\231\002\n\007Command\0223\n\016config_reque"
-  "st\030\001 \001(\0132\031.data_types.ConfigRequestH\000\0223\n"
-  "\016control_action\030\002 \001(\0132\031.data_types.Contr"
-  "olActionH\000\022*\n\theartbeat\030\003 \001(\0132\025.data_typ"
-  "es.HeartbeatH\000\0227\n\020detection_result\030\004 \001(\013"
-  "2\033.data_types.DetectionResultH\000\022/\n\014camer"
-  "a_frame\030\005 \001(\0132\027.data_types.CameraFrameH\000"
-  "B\016\n\014command_type\"\202\001\n\rConfigRequest\0228\n\023de"
-  "tection_threshold\030\001 \001(\0132\033.google.protobu"
-  "f.FloatValue\0227\n\021sleep_timeout_sec\030\002 \001(\0132"
-  "\034.google.protobuf.UInt32Value\"\210\001\n\rContro"
-  "lAction\0224\n\006action\030\001 \001(\0162$.data_types.Con"
-  "trolAction.ActionType\"A\n\nActionType\022\n\n\006R"
-  "EBOOT\020\000\022\023\n\017START_STREAMING\020\001\022\022\n\016STOP_STR"
-  "EAMING\020\002\":\n\tHeartbeat\022-\n\ttimestamp\030\001 \001(\013"
-  "2\032.google.protobuf.Timestamp\"\363\001\n\rServerM"
-  "essage\022/\n\014camera_frame\030\001 \001(\0132\027.data_type"
-  "s.CameraFrameH\000\0227\n\020detection_result\030\002 \001("
-  "\0132\033.data_types.DetectionResultH\000\0221\n\rdevi"
-  "ce_status\030\003 \001(\0132\030.data_types.DeviceStatu"
-  "sH\000\0225\n\017config_response\030\004 \001(\0132\032.data_type"
-  "s.ConfigResponseH\000B\016\n\014message_type\"\211\001\n\rC"
-  "lientMessage\0221\n\rdevice_status\030\001 \001(\0132\030.da"
-  "ta_types.DeviceStatusH\000\0225\n\017config_respon"
-  "se\030\002 \001(\0132\032.data_types.ConfigResponseH\000B\016"
-  "\n\014message_type\"2\n\016ConfigResponse\022\017\n\007succ"
-  "ess\030\001 \001(\010\022\017\n\007message\030\002 \001(\tb\006proto3"
+  "estamp\022\014\n\004json\030\002 \001(\t\022\020\n\010frame_id\030\003 \001(\004\022\'"
+  "\n\005masks\030\004 \003(\0132\030.data_types.InstanceMask\022"
+  "\017\n\007backend\030\005 \001(\t\022\021\n\tcamera_id\030\006 \001(\r\"\273\003\n\014"
+  "DeviceStatus\022\021\n\tdevice_id\030\001 \001(\t\0227\n\005state"
+  "\030\002 \001(\0162(.data_types.DeviceStatus.Connect"
+  "ionState\022\031\n\021cpu_temperature_c\030\003 \001(\002\022\026\n\016f"
+  "rame_rate_fps\030\004 \001(\r\022\035\n\025processing_latenc"
+  "y_ms\030\005 \001(\r\022\030\n\020firmware_version\030\006 \001(\t\022\023\n\013"
+  "is_sleeping\030\007 \001(\010\022\017\n\007profile\030\010 \001(\t\022\024\n\014pr"
+  "ofile_auto\030\t \001(\010\022\026\n\016profile_reason\030\n \001(\t"
+  "\022\027\n\017battery_percent\030\013 \001(\002\022\026\n\016active_stre"
+  "ams\030\014 \001(\r\022\024\n\014jpeg_quality\030\r \001(\r\"X\n\017Conne"
+  "ctionState\022\020\n\014DISCONNECTED\020\000\022\017\n\013BLE_PAIR"
+  "ING\020\001\022\022\n\016WLAN_CONNECTED\020\002\022\016\n\nGRPC_READY\020"
+  "\003\"\244\003\n\007Command\0223\n\016config_request\030\001 \001(\0132\031."
+  "data_types.ConfigRequestH\000\0223\n\016control_ac"
+  "tion\030\002 \001(\0132\031.data_types.ControlActionH\000\022"
+  "*\n\theartbeat\030\003 \001(\0132\025.data_types.Heartbea"
+  "tH\000\0227\n\020detection_result\030\004 \001(\0132\033.data_typ"
+  "es.DetectionResultH\000\022/\n\014camera_frame\030\005 \001"
+  "(\0132\027.data_types.CameraFrameH\000\022/\n\014frame_h"
+  "eader\030\006 \001(\0132\027.data_types.FrameHeaderH\000\022-"
+  "\n\013frame_chunk\030\007 \001(\0132\026.data_types.FrameCh"
+  "unkH\000\022)\n\005hello\030\010 \001(\0132\030.data_types.Capabi"
+  "litiesH\000B\016\n\014command_type\"\313\001\n\014Capabilitie"
+  "s\022\030\n\020protocol_version\030\001 \001(\r\022\025\n\rframe_for"
+  "mats\030\002 \003(\t\022\030\n\020result_encodings\030\003 \003(\t\022\024\n\014"
+  "result_batch\030\004 \001(\010\022\026\n\016chunked_frames\030\005 \001"
+  "(\010\022\027\n\017max_chunk_bytes\030\006 \001(\r\022\024\n\014max_infli"
+  "ght\030\007 \001(\r\022\023\n\013compression\030\010 \003(\t\"\306\001\n\rSessi"
+  "onConfig\022\030\n\020protocol_version\030\001 \001(\r\022\024\n\014fr"
+  "ame_format\030\002 \001(\t\022\027\n\017result_encoding\030\003 \001("
+  "\t\022\024\n\014result_batch\030\004 \001(\010\022\026\n\016chunked_frame"
+  "s\030\005 \001(\010\022\023\n\013chunk_bytes\030\006 \001(\r\022\024\n\014max_infl"
+  "ight\030\007 \001(\r\022\023\n\013compression\030\010 \001(\t\"I\n\013Frame"
+  "Header\022&\n\005frame\030\001 \001(\0132\027.data_types.Camer"
+  "aFrame\022\022\n\ntotal_size\030\002 \001(\004\"<\n\nFrameChunk"
+  "\022\020\n\010frame_id\030\001 \001(\004\022\016\n\006offset\030\002 \001(\004\022\014\n\004da"
+  "ta\030\003 \001(\014\"\223\001\n\rConfigRequest\0228\n\023detection_"
+  "threshold\030\001 \001(\0132\033.google.protobuf.FloatV"
+  "alue\0227\n\021sleep_timeout_sec\030\002 \001(\0132\034.google"
+  ".protobuf.UInt32Value\022\017\n\007profile\030\003 \001(\t\"\252"
+  "\001\n\rControlAction\0224\n\006action\030\001 \001(\0162$.data_"
+  "types.ControlAction.ActionType\022\017\n\007profil"
+  "e\030\002 \001(\t\"R\n\nActionType\022\n\n\006REBOOT\020\000\022\023\n\017STA"
+  "RT_STREAMING\020\001\022\022\n\016STOP_STREAMING\020\002\022\017\n\013SE"
+  "T_PROFILE\020\003\":\n\tHeartbeat\022-\n\ttimestamp\030\001 "
+  "\001(\0132\032.google.protobuf.Timestamp\"\205\003\n\rServ"
+  "erMessage\022/\n\014camera_frame\030\001 \001(\0132\027.data_t"
+  "ypes.CameraFrameH\000\0227\n\020detection_result\030\002"
+  " \001(\0132\033.data_types.DetectionResultH\000\0221\n\rd"
+  "evice_status\030\003 \001(\0132\030.data_types.DeviceSt"
+  "atusH\000\0225\n\017config_response\030\004 \001(\0132\032.data_t"
+  "ypes.ConfigResponseH\000\022*\n\theartbeat\030\005 \001(\013"
+  "2\025.data_types.HeartbeatH\000\022/\n\014result_batc"
+  "h\030\006 \001(\0132\027.data_types.ResultBatchH\000\0223\n\016se"
+  "ssion_config\030\007 \001(\0132\031.data_types.SessionC"
+  "onfigH\000B\016\n\014message_type\";\n\013ResultBatch\022,"
+  "\n\007results\030\001 \003(\0132\033.data_types.DetectionRe"
+  "sult\"\211\001\n\rClientMessage\0221\n\rdevice_status\030"
+  "\001 \001(\0132\030.data_types.DeviceStatusH\000\0225\n\017con"
+  "fig_response\030\002 \001(\0132\032.data_types.ConfigRe"
+  "sponseH\000B\016\n\014message_type\"2\n\016ConfigRespon"
+  "se\022\017\n\007success\030\001 \001(\010\022\017\n\007message\030\002 \001(\tb\006pr"
+  "oto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_data_5ftypes_2eproto_deps[2] = {
+static const ::_pbi::DescriptorTable* const descriptor_table_data_5ftypes_2eproto_deps[2] = {
   &::descriptor_table_google_2fprotobuf_2ftimestamp_2eproto,
   &::descriptor_table_google_2fprotobuf_2fwrappers_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_data_5ftypes_2eproto_sccs[11] = {
-  &scc_info_BoundingBox_data_5ftypes_2eproto.base,
-  &scc_info_CameraFrame_data_5ftypes_2eproto.base,
-  &scc_info_ClientMessage_data_5ftypes_2eproto.base,
-  &scc_info_Command_data_5ftypes_2eproto.base,
-  &scc_info_ConfigRequest_data_5ftypes_2eproto.base,
-  &scc_info_ConfigResponse_data_5ftypes_2eproto.base,
-  &scc_info_ControlAction_data_5ftypes_2eproto.base,
-  &scc_info_DetectionResult_data_5ftypes_2eproto.base,
-  &scc_info_DeviceStatus_data_5ftypes_2eproto.base,
-  &scc_info_Heartbeat_data_5ftypes_2eproto.base,
-  &scc_info_ServerMessage_data_5ftypes_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_data_5ftypes_2eproto_once;
-static bool descriptor_table_data_5ftypes_2eproto_initialized = false;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_data_5ftypes_2eproto = {
-  &descriptor_table_data_5ftypes_2eproto_initialized, descriptor_table_protodef_data_5ftypes_2eproto, "data_types.proto", 1794,
-  &descriptor_table_data_5ftypes_2eproto_once, descriptor_table_data_5ftypes_2eproto_sccs, descriptor_table_data_5ftypes_2eproto_deps, 11, 2,
-  schemas, file_default_instances, TableStruct_data_5ftypes_2eproto::offsets,
-  file_level_metadata_data_5ftypes_2eproto, 11, file_level_enum_descriptors_data_5ftypes_2eproto, file_level_service_descriptors_data_5ftypes_2eproto,
+static ::_pbi::once_flag descriptor_table_data_5ftypes_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_data_5ftypes_2eproto = {
+    false, false, 3204, descriptor_table_protodef_data_5ftypes_2eproto,
+    "data_types.proto",
+    &descriptor_table_data_5ftypes_2eproto_once, descriptor_table_data_5ftypes_2eproto_deps, 2, 17,
+    schemas, file_default_instances, TableStruct_data_5ftypes_2eproto::offsets,
+    file_level_metadata_data_5ftypes_2eproto, file_level_enum_descriptors_data_5ftypes_2eproto,
+    file_level_service_descriptors_data_5ftypes_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_data_5ftypes_2eproto_getter() {
+  return &descriptor_table_data_5ftypes_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_data_5ftypes_2eproto = (  ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_data_5ftypes_2eproto), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_data_5ftypes_2eproto(&descriptor_table_data_5ftypes_2eproto);
 namespace data_types {
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DeviceStatus_ConnectionState_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_data_5ftypes_2eproto);
@@ -472,7 +666,7 @@ bool DeviceStatus_ConnectionState_IsValid(int value) {
   }
 }
 
-#if (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 constexpr DeviceStatus_ConnectionState DeviceStatus::DISCONNECTED;
 constexpr DeviceStatus_ConnectionState DeviceStatus::BLE_PAIRING;
 constexpr DeviceStatus_ConnectionState DeviceStatus::WLAN_CONNECTED;
@@ -480,7 +674,7 @@ constexpr DeviceStatus_ConnectionState DeviceStatus::GRPC_READY;
 constexpr DeviceStatus_ConnectionState DeviceStatus::ConnectionState_MIN;
 constexpr DeviceStatus_ConnectionState DeviceStatus::ConnectionState_MAX;
 constexpr int DeviceStatus::ConnectionState_ARRAYSIZE;
-#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ControlAction_ActionType_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_data_5ftypes_2eproto);
   return file_level_enum_descriptors_data_5ftypes_2eproto[1];
@@ -490,216 +684,278 @@ bool ControlAction_ActionType_IsValid(int value) {
     case 0:
     case 1:
     case 2:
+    case 3:
       return true;
     default:
       return false;
   }
 }
 
-#if (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 constexpr ControlAction_ActionType ControlAction::REBOOT;
 constexpr ControlAction_ActionType ControlAction::START_STREAMING;
 constexpr ControlAction_ActionType ControlAction::STOP_STREAMING;
+constexpr ControlAction_ActionType ControlAction::SET_PROFILE;
 constexpr ControlAction_ActionType ControlAction::ActionType_MIN;
 constexpr ControlAction_ActionType ControlAction::ActionType_MAX;
 constexpr int ControlAction::ActionType_ARRAYSIZE;
-#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
 // ===================================================================
 
-void CameraFrame::InitAsDefaultInstance() {
-  ::data_types::_CameraFrame_default_instance_._instance.get_mutable()->timestamp_ = const_cast< PROTOBUF_NAMESPACE_ID::Timestamp*>(
-      PROTOBUF_NAMESPACE_ID::Timestamp::internal_default_instance());
-}
 class CameraFrame::_Internal {
  public:
-  static const PROTOBUF_NAMESPACE_ID::Timestamp& timestamp(const CameraFrame* msg);
+  static const ::PROTOBUF_NAMESPACE_ID::Timestamp& timestamp(const CameraFrame* msg);
 };
 
-const PROTOBUF_NAMESPACE_ID::Timestamp&
+const ::PROTOBUF_NAMESPACE_ID::Timestamp&
 CameraFrame::_Internal::timestamp(const CameraFrame* msg) {
-  return *msg->timestamp_;
+  return *msg->_impl_.timestamp_;
 }
 void CameraFrame::clear_timestamp() {
-  if (GetArenaNoVirtual() == nullptr && timestamp_ != nullptr) {
-    delete timestamp_;
+  if (GetArenaForAllocation() == nullptr && _impl_.timestamp_ != nullptr) {
+    delete _impl_.timestamp_;
   }
-  timestamp_ = nullptr;
+  _impl_.timestamp_ = nullptr;
 }
-CameraFrame::CameraFrame()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:data_types.CameraFrame)
+CameraFrame::CameraFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:data_types.CameraFrame)
 }
 CameraFrame::CameraFrame(const CameraFrame& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  image_data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CameraFrame* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.image_data_){}
+    , decltype(_impl_.format_){}
+    , decltype(_impl_.timestamp_){nullptr}
+    , decltype(_impl_.width_){}
+    , decltype(_impl_.height_){}
+    , decltype(_impl_.frame_id_){}
+    , decltype(_impl_.low_priority_){}
+    , decltype(_impl_.camera_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.image_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.image_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_image_data().empty()) {
-    image_data_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.image_data_);
+    _this->_impl_.image_data_.Set(from._internal_image_data(), 
+      _this->GetArenaForAllocation());
   }
-  format_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.format_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.format_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_format().empty()) {
-    format_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.format_);
+    _this->_impl_.format_.Set(from._internal_format(), 
+      _this->GetArenaForAllocation());
   }
   if (from._internal_has_timestamp()) {
-    timestamp_ = new PROTOBUF_NAMESPACE_ID::Timestamp(*from.timestamp_);
-  } else {
-    timestamp_ = nullptr;
+    _this->_impl_.timestamp_ = new ::PROTOBUF_NAMESPACE_ID::Timestamp(*from._impl_.timestamp_);
   }
-  ::memcpy(&width_, &from.width_,
-    static_cast<size_t>(reinterpret_cast<char*>(&height_) -
-    reinterpret_cast<char*>(&width_)) + sizeof(height_));
+  ::memcpy(&_impl_.width_, &from._impl_.width_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.camera_id_) -
+    reinterpret_cast<char*>(&_impl_.width_)) + sizeof(_impl_.camera_id_));
   // @@protoc_insertion_point(copy_constructor:data_types.CameraFrame)
 }
 
-void CameraFrame::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_CameraFrame_data_5ftypes_2eproto.base);
-  image_data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  format_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&timestamp_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&height_) -
-      reinterpret_cast<char*>(&timestamp_)) + sizeof(height_));
+inline void CameraFrame::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.image_data_){}
+    , decltype(_impl_.format_){}
+    , decltype(_impl_.timestamp_){nullptr}
+    , decltype(_impl_.width_){0u}
+    , decltype(_impl_.height_){0u}
+    , decltype(_impl_.frame_id_){uint64_t{0u}}
+    , decltype(_impl_.low_priority_){false}
+    , decltype(_impl_.camera_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.image_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.image_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.format_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.format_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 CameraFrame::~CameraFrame() {
   // @@protoc_insertion_point(destructor:data_types.CameraFrame)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void CameraFrame::SharedDtor() {
-  image_data_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  format_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete timestamp_;
+inline void CameraFrame::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.image_data_.Destroy();
+  _impl_.format_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.timestamp_;
 }
 
 void CameraFrame::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const CameraFrame& CameraFrame::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_CameraFrame_data_5ftypes_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void CameraFrame::Clear() {
 // @@protoc_insertion_point(message_clear_start:data_types.CameraFrame)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  image_data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  format_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == nullptr && timestamp_ != nullptr) {
-    delete timestamp_;
+  _impl_.image_data_.ClearToEmpty();
+  _impl_.format_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.timestamp_ != nullptr) {
+    delete _impl_.timestamp_;
   }
-  timestamp_ = nullptr;
-  ::memset(&width_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&height_) -
-      reinterpret_cast<char*>(&width_)) + sizeof(height_));
-  _internal_metadata_.Clear();
+  _impl_.timestamp_ = nullptr;
+  ::memset(&_impl_.width_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.camera_id_) -
+      reinterpret_cast<char*>(&_impl_.width_)) + sizeof(_impl_.camera_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* CameraFrame::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* CameraFrame::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // bytes image_data = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_image_data();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // uint32 width = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // uint32 height = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .google.protobuf.Timestamp timestamp = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           ptr = ctx->ParseMessage(_internal_mutable_timestamp(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // string format = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
           auto str = _internal_mutable_format();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "data_types.CameraFrame.format"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "data_types.CameraFrame.format"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 frame_id = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.frame_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // bool low_priority = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.low_priority_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // uint32 camera_id = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.camera_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* CameraFrame::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* CameraFrame::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:data_types.CameraFrame)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes image_data = 1;
-  if (this->image_data().size() > 0) {
+  if (!this->_internal_image_data().empty()) {
     target = stream->WriteBytesMaybeAliased(
         1, this->_internal_image_data(), target);
   }
 
   // uint32 width = 2;
-  if (this->width() != 0) {
+  if (this->_internal_width() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_width(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_width(), target);
   }
 
   // uint32 height = 3;
-  if (this->height() != 0) {
+  if (this->_internal_height() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(3, this->_internal_height(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_height(), target);
   }
 
   // .google.protobuf.Timestamp timestamp = 4;
-  if (this->has_timestamp()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_timestamp()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        4, _Internal::timestamp(this), target, stream);
+      InternalWriteMessage(4, _Internal::timestamp(this),
+        _Internal::timestamp(this).GetCachedSize(), target, stream);
   }
 
   // string format = 5;
-  if (this->format().size() > 0) {
+  if (!this->_internal_format().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_format().data(), static_cast<int>(this->_internal_format().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -708,9 +964,27 @@ failure:
         5, this->_internal_format(), target);
   }
 
+  // uint64 frame_id = 6;
+  if (this->_internal_frame_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_frame_id(), target);
+  }
+
+  // bool low_priority = 7;
+  if (this->_internal_low_priority() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_low_priority(), target);
+  }
+
+  // uint32 camera_id = 8;
+  if (this->_internal_camera_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_camera_id(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:data_types.CameraFrame)
   return target;
@@ -720,100 +994,100 @@ size_t CameraFrame::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:data_types.CameraFrame)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // bytes image_data = 1;
-  if (this->image_data().size() > 0) {
+  if (!this->_internal_image_data().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_image_data());
   }
 
   // string format = 5;
-  if (this->format().size() > 0) {
+  if (!this->_internal_format().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_format());
   }
 
   // .google.protobuf.Timestamp timestamp = 4;
-  if (this->has_timestamp()) {
+  if (this->_internal_has_timestamp()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *timestamp_);
+        *_impl_.timestamp_);
   }
 
   // uint32 width = 2;
-  if (this->width() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_width());
+  if (this->_internal_width() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_width());
   }
 
   // uint32 height = 3;
-  if (this->height() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_height());
+  if (this->_internal_height() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_height());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // uint64 frame_id = 6;
+  if (this->_internal_frame_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_frame_id());
+  }
+
+  // bool low_priority = 7;
+  if (this->_internal_low_priority() != 0) {
+    total_size += 1 + 1;
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void CameraFrame::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:data_types.CameraFrame)
-  GOOGLE_DCHECK_NE(&from, this);
-  const CameraFrame* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<CameraFrame>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:data_types.CameraFrame)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:data_types.CameraFrame)
-    MergeFrom(*source);
+  // uint32 camera_id = 8;
+  if (this->_internal_camera_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_camera_id());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CameraFrame::MergeFrom(const CameraFrame& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:data_types.CameraFrame)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CameraFrame::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CameraFrame::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CameraFrame::GetClassData() const { return &_class_data_; }
 
-  if (from.image_data().size() > 0) {
 
-    image_data_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.image_data_);
-  }
-  if (from.format().size() > 0) {
+void CameraFrame::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CameraFrame*>(&to_msg);
+  auto& from = static_cast<const CameraFrame&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:data_types.CameraFrame)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    format_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.format_);
+  if (!from._internal_image_data().empty()) {
+    _this->_internal_set_image_data(from._internal_image_data());
+  }
+  if (!from._internal_format().empty()) {
+    _this->_internal_set_format(from._internal_format());
   }
-  if (from.has_timestamp()) {
-    _internal_mutable_timestamp()->PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(from._internal_timestamp());
+  if (from._internal_has_timestamp()) {
+    _this->_internal_mutable_timestamp()->::PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(
+        from._internal_timestamp());
   }
-  if (from.width() != 0) {
-    _internal_set_width(from._internal_width());
+  if (from._internal_width() != 0) {
+    _this->_internal_set_width(from._internal_width());
   }
-  if (from.height() != 0) {
-    _internal_set_height(from._internal_height());
+  if (from._internal_height() != 0) {
+    _this->_internal_set_height(from._internal_height());
   }
-}
-
-void CameraFrame::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:data_types.CameraFrame)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_frame_id() != 0) {
+    _this->_internal_set_frame_id(from._internal_frame_id());
+  }
+  if (from._internal_low_priority() != 0) {
+    _this->_internal_set_low_priority(from._internal_low_priority());
+  }
+  if (from._internal_camera_id() != 0) {
+    _this->_internal_set_camera_id(from._internal_camera_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void CameraFrame::CopyFrom(const CameraFrame& from) {
@@ -829,190 +1103,231 @@ bool CameraFrame::IsInitialized() const {
 
 void CameraFrame::InternalSwap(CameraFrame* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  image_data_.Swap(&other->image_data_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  format_.Swap(&other->format_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(timestamp_, other->timestamp_);
-  swap(width_, other->width_);
-  swap(height_, other->height_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.image_data_, lhs_arena,
+      &other->_impl_.image_data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.format_, lhs_arena,
+      &other->_impl_.format_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CameraFrame, _impl_.camera_id_)
+      + sizeof(CameraFrame::_impl_.camera_id_)
+      - PROTOBUF_FIELD_OFFSET(CameraFrame, _impl_.timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.timestamp_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata CameraFrame::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_data_5ftypes_2eproto_getter, &descriptor_table_data_5ftypes_2eproto_once,
+      file_level_metadata_data_5ftypes_2eproto[0]);
 }
 
-
 // ===================================================================
 
-void BoundingBox::InitAsDefaultInstance() {
-}
 class BoundingBox::_Internal {
  public:
 };
 
-BoundingBox::BoundingBox()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:data_types.BoundingBox)
+BoundingBox::BoundingBox(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:data_types.BoundingBox)
 }
 BoundingBox::BoundingBox(const BoundingBox& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  label_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BoundingBox* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.label_){}
+    , decltype(_impl_.x_min_){}
+    , decltype(_impl_.y_min_){}
+    , decltype(_impl_.x_max_){}
+    , decltype(_impl_.y_max_){}
+    , decltype(_impl_.confidence_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.label_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.label_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_label().empty()) {
-    label_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.label_);
+    _this->_impl_.label_.Set(from._internal_label(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&x_min_, &from.x_min_,
-    static_cast<size_t>(reinterpret_cast<char*>(&confidence_) -
-    reinterpret_cast<char*>(&x_min_)) + sizeof(confidence_));
+  ::memcpy(&_impl_.x_min_, &from._impl_.x_min_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.confidence_) -
+    reinterpret_cast<char*>(&_impl_.x_min_)) + sizeof(_impl_.confidence_));
   // @@protoc_insertion_point(copy_constructor:data_types.BoundingBox)
 }
 
-void BoundingBox::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_BoundingBox_data_5ftypes_2eproto.base);
-  label_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&x_min_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&confidence_) -
-      reinterpret_cast<char*>(&x_min_)) + sizeof(confidence_));
+inline void BoundingBox::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.label_){}
+    , decltype(_impl_.x_min_){0u}
+    , decltype(_impl_.y_min_){0u}
+    , decltype(_impl_.x_max_){0u}
+    , decltype(_impl_.y_max_){0u}
+    , decltype(_impl_.confidence_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.label_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.label_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 BoundingBox::~BoundingBox() {
   // @@protoc_insertion_point(destructor:data_types.BoundingBox)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void BoundingBox::SharedDtor() {
-  label_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void BoundingBox::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.label_.Destroy();
 }
 
 void BoundingBox::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const BoundingBox& BoundingBox::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_BoundingBox_data_5ftypes_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void BoundingBox::Clear() {
 // @@protoc_insertion_point(message_clear_start:data_types.BoundingBox)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  label_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&x_min_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&confidence_) -
-      reinterpret_cast<char*>(&x_min_)) + sizeof(confidence_));
-  _internal_metadata_.Clear();
+  _impl_.label_.ClearToEmpty();
+  ::memset(&_impl_.x_min_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.confidence_) -
+      reinterpret_cast<char*>(&_impl_.x_min_)) + sizeof(_impl_.confidence_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* BoundingBox::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* BoundingBox::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // uint32 x_min = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          x_min_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.x_min_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // uint32 y_min = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          y_min_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.y_min_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // uint32 x_max = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          x_max_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.x_max_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // uint32 y_max = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          y_max_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.y_max_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // string label = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
           auto str = _internal_mutable_label();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "data_types.BoundingBox.label"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "data_types.BoundingBox.label"));
+        } else
+          goto handle_unusual;
         continue;
       // float confidence = 6;
       case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 53)) {
-          confidence_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          _impl_.confidence_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* BoundingBox::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* BoundingBox::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:data_types.BoundingBox)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 x_min = 1;
-  if (this->x_min() != 0) {
+  if (this->_internal_x_min() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(1, this->_internal_x_min(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_x_min(), target);
   }
 
   // uint32 y_min = 2;
-  if (this->y_min() != 0) {
+  if (this->_internal_y_min() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_y_min(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_y_min(), target);
   }
 
   // uint32 x_max = 3;
-  if (this->x_max() != 0) {
+  if (this->_internal_x_max() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(3, this->_internal_x_max(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_x_max(), target);
   }
 
   // uint32 y_max = 4;
-  if (this->y_max() != 0) {
+  if (this->_internal_y_max() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(4, this->_internal_y_max(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_y_max(), target);
   }
 
   // string label = 5;
-  if (this->label().size() > 0) {
+  if (!this->_internal_label().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_label().data(), static_cast<int>(this->_internal_label().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1022,14 +1337,18 @@ failure:
   }
 
   // float confidence = 6;
-  if (!(this->confidence() <= 0 && this->confidence() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_confidence = this->_internal_confidence();
+  uint32_t raw_confidence;
+  memcpy(&raw_confidence, &tmp_confidence, sizeof(tmp_confidence));
+  if (raw_confidence != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(6, this->_internal_confidence(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(6, this->_internal_confidence(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:data_types.BoundingBox)
   return target;
@@ -1039,107 +1358,87 @@ size_t BoundingBox::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:data_types.BoundingBox)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string label = 5;
-  if (this->label().size() > 0) {
+  if (!this->_internal_label().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_label());
   }
 
   // uint32 x_min = 1;
-  if (this->x_min() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_x_min());
+  if (this->_internal_x_min() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_x_min());
   }
 
   // uint32 y_min = 2;
-  if (this->y_min() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_y_min());
+  if (this->_internal_y_min() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_y_min());
   }
 
   // uint32 x_max = 3;
-  if (this->x_max() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_x_max());
+  if (this->_internal_x_max() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_x_max());
   }
 
   // uint32 y_max = 4;
-  if (this->y_max() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_y_max());
+  if (this->_internal_y_max() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_y_max());
   }
 
   // float confidence = 6;
-  if (!(this->confidence() <= 0 && this->confidence() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_confidence = this->_internal_confidence();
+  uint32_t raw_confidence;
+  memcpy(&raw_confidence, &tmp_confidence, sizeof(tmp_confidence));
+  if (raw_confidence != 0) {
     total_size += 1 + 4;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void BoundingBox::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:data_types.BoundingBox)
-  GOOGLE_DCHECK_NE(&from, this);
-  const BoundingBox* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<BoundingBox>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:data_types.BoundingBox)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:data_types.BoundingBox)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BoundingBox::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BoundingBox::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BoundingBox::GetClassData() const { return &_class_data_; }
 
-void BoundingBox::MergeFrom(const BoundingBox& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:data_types.BoundingBox)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.label().size() > 0) {
+void BoundingBox::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BoundingBox*>(&to_msg);
+  auto& from = static_cast<const BoundingBox&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:data_types.BoundingBox)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    label_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.label_);
+  if (!from._internal_label().empty()) {
+    _this->_internal_set_label(from._internal_label());
   }
-  if (from.x_min() != 0) {
-    _internal_set_x_min(from._internal_x_min());
+  if (from._internal_x_min() != 0) {
+    _this->_internal_set_x_min(from._internal_x_min());
   }
-  if (from.y_min() != 0) {
-    _internal_set_y_min(from._internal_y_min());
+  if (from._internal_y_min() != 0) {
+    _this->_internal_set_y_min(from._internal_y_min());
   }
-  if (from.x_max() != 0) {
-    _internal_set_x_max(from._internal_x_max());
+  if (from._internal_x_max() != 0) {
+    _this->_internal_set_x_max(from._internal_x_max());
   }
-  if (from.y_max() != 0) {
-    _internal_set_y_max(from._internal_y_max());
+  if (from._internal_y_max() != 0) {
+    _this->_internal_set_y_max(from._internal_y_max());
   }
-  if (!(from.confidence() <= 0 && from.confidence() >= 0)) {
-    _internal_set_confidence(from._internal_confidence());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_confidence = from._internal_confidence();
+  uint32_t raw_confidence;
+  memcpy(&raw_confidence, &tmp_confidence, sizeof(tmp_confidence));
+  if (raw_confidence != 0) {
+    _this->_internal_set_confidence(from._internal_confidence());
   }
-}
-
-void BoundingBox::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:data_types.BoundingBox)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void BoundingBox::CopyFrom(const BoundingBox& from) {
@@ -1155,172 +1454,802 @@ bool BoundingBox::IsInitialized() const {
 
 void BoundingBox::InternalSwap(BoundingBox* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  label_.Swap(&other->label_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(x_min_, other->x_min_);
-  swap(y_min_, other->y_min_);
-  swap(x_max_, other->x_max_);
-  swap(y_max_, other->y_max_);
-  swap(confidence_, other->confidence_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.label_, lhs_arena,
+      &other->_impl_.label_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BoundingBox, _impl_.confidence_)
+      + sizeof(BoundingBox::_impl_.confidence_)
+      - PROTOBUF_FIELD_OFFSET(BoundingBox, _impl_.x_min_)>(
+          reinterpret_cast<char*>(&_impl_.x_min_),
+          reinterpret_cast<char*>(&other->_impl_.x_min_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata BoundingBox::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_data_5ftypes_2eproto_getter, &descriptor_table_data_5ftypes_2eproto_once,
+      file_level_metadata_data_5ftypes_2eproto[1]);
 }
 
-
 // ===================================================================
 
-void DetectionResult::InitAsDefaultInstance() {
-  ::data_types::_DetectionResult_default_instance_._instance.get_mutable()->frame_timestamp_ = const_cast< PROTOBUF_NAMESPACE_ID::Timestamp*>(
-      PROTOBUF_NAMESPACE_ID::Timestamp::internal_default_instance());
-}
-class DetectionResult::_Internal {
+class InstanceMask::_Internal {
  public:
-  static const PROTOBUF_NAMESPACE_ID::Timestamp& frame_timestamp(const DetectionResult* msg);
 };
 
-const PROTOBUF_NAMESPACE_ID::Timestamp&
-DetectionResult::_Internal::frame_timestamp(const DetectionResult* msg) {
-  return *msg->frame_timestamp_;
-}
-void DetectionResult::clear_frame_timestamp() {
-  if (GetArenaNoVirtual() == nullptr && frame_timestamp_ != nullptr) {
-    delete frame_timestamp_;
-  }
-  frame_timestamp_ = nullptr;
-}
-DetectionResult::DetectionResult()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:data_types.DetectionResult)
-}
-DetectionResult::DetectionResult(const DetectionResult& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  json_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_json().empty()) {
-    json_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.json_);
-  }
-  if (from._internal_has_frame_timestamp()) {
-    frame_timestamp_ = new PROTOBUF_NAMESPACE_ID::Timestamp(*from.frame_timestamp_);
-  } else {
-    frame_timestamp_ = nullptr;
+InstanceMask::InstanceMask(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:data_types.InstanceMask)
+}
+InstanceMask::InstanceMask(const InstanceMask& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  InstanceMask* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.counts_){from._impl_.counts_}
+    , /*decltype(_impl_._counts_cached_byte_size_)*/{0}
+    , decltype(_impl_.label_){}
+    , decltype(_impl_.detection_index_){}
+    , decltype(_impl_.x_min_){}
+    , decltype(_impl_.y_min_){}
+    , decltype(_impl_.x_max_){}
+    , decltype(_impl_.y_max_){}
+    , decltype(_impl_.width_){}
+    , decltype(_impl_.height_){}
+    , decltype(_impl_.score_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.label_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.label_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_label().empty()) {
+    _this->_impl_.label_.Set(from._internal_label(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.detection_index_, &from._impl_.detection_index_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.score_) -
+    reinterpret_cast<char*>(&_impl_.detection_index_)) + sizeof(_impl_.score_));
+  // @@protoc_insertion_point(copy_constructor:data_types.InstanceMask)
+}
+
+inline void InstanceMask::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.counts_){arena}
+    , /*decltype(_impl_._counts_cached_byte_size_)*/{0}
+    , decltype(_impl_.label_){}
+    , decltype(_impl_.detection_index_){0u}
+    , decltype(_impl_.x_min_){0}
+    , decltype(_impl_.y_min_){0}
+    , decltype(_impl_.x_max_){0}
+    , decltype(_impl_.y_max_){0}
+    , decltype(_impl_.width_){0u}
+    , decltype(_impl_.height_){0u}
+    , decltype(_impl_.score_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.label_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.label_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+InstanceMask::~InstanceMask() {
+  // @@protoc_insertion_point(destructor:data_types.InstanceMask)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  // @@protoc_insertion_point(copy_constructor:data_types.DetectionResult)
-}
-
-void DetectionResult::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_DetectionResult_data_5ftypes_2eproto.base);
-  json_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  frame_timestamp_ = nullptr;
-}
-
-DetectionResult::~DetectionResult() {
-  // @@protoc_insertion_point(destructor:data_types.DetectionResult)
   SharedDtor();
 }
 
-void DetectionResult::SharedDtor() {
-  json_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete frame_timestamp_;
+inline void InstanceMask::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.counts_.~RepeatedField();
+  _impl_.label_.Destroy();
 }
 
-void DetectionResult::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void InstanceMask::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-const DetectionResult& DetectionResult::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_DetectionResult_data_5ftypes_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void DetectionResult::Clear() {
-// @@protoc_insertion_point(message_clear_start:data_types.DetectionResult)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void InstanceMask::Clear() {
+// @@protoc_insertion_point(message_clear_start:data_types.InstanceMask)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  json_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == nullptr && frame_timestamp_ != nullptr) {
-    delete frame_timestamp_;
-  }
-  frame_timestamp_ = nullptr;
-  _internal_metadata_.Clear();
+  _impl_.counts_.Clear();
+  _impl_.label_.ClearToEmpty();
+  ::memset(&_impl_.detection_index_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.score_) -
+      reinterpret_cast<char*>(&_impl_.detection_index_)) + sizeof(_impl_.score_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* DetectionResult::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* InstanceMask::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .google.protobuf.Timestamp frame_timestamp = 1;
+      // uint32 detection_index = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_frame_timestamp(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.detection_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // string json = 2;
+      // float x_min = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          auto str = _internal_mutable_json();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "data_types.DetectionResult.json"));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.x_min_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float y_min = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.y_min_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float x_max = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _impl_.x_max_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float y_max = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _impl_.y_max_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 width = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // uint32 height = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // repeated uint32 counts = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_counts(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 64) {
+          _internal_add_counts(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string label = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_label();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "data_types.InstanceMask.label"));
+        } else
+          goto handle_unusual;
+        continue;
+      // float score = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 85)) {
+          _impl_.score_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* DetectionResult::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:data_types.DetectionResult)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* InstanceMask::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:data_types.InstanceMask)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .google.protobuf.Timestamp frame_timestamp = 1;
-  if (this->has_frame_timestamp()) {
+  // uint32 detection_index = 1;
+  if (this->_internal_detection_index() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::frame_timestamp(this), target, stream);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_detection_index(), target);
   }
 
-  // string json = 2;
-  if (this->json().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_json().data(), static_cast<int>(this->_internal_json().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+  // float x_min = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x_min = this->_internal_x_min();
+  uint32_t raw_x_min;
+  memcpy(&raw_x_min, &tmp_x_min, sizeof(tmp_x_min));
+  if (raw_x_min != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_x_min(), target);
+  }
+
+  // float y_min = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y_min = this->_internal_y_min();
+  uint32_t raw_y_min;
+  memcpy(&raw_y_min, &tmp_y_min, sizeof(tmp_y_min));
+  if (raw_y_min != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_y_min(), target);
+  }
+
+  // float x_max = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x_max = this->_internal_x_max();
+  uint32_t raw_x_max;
+  memcpy(&raw_x_max, &tmp_x_max, sizeof(tmp_x_max));
+  if (raw_x_max != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_x_max(), target);
+  }
+
+  // float y_max = 5;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y_max = this->_internal_y_max();
+  uint32_t raw_y_max;
+  memcpy(&raw_y_max, &tmp_y_max, sizeof(tmp_y_max));
+  if (raw_y_max != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_y_max(), target);
+  }
+
+  // uint32 width = 6;
+  if (this->_internal_width() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_width(), target);
+  }
+
+  // uint32 height = 7;
+  if (this->_internal_height() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_height(), target);
+  }
+
+  // repeated uint32 counts = 8;
+  {
+    int byte_size = _impl_._counts_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          8, _internal_counts(), byte_size, target);
+    }
+  }
+
+  // string label = 9;
+  if (!this->_internal_label().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_label().data(), static_cast<int>(this->_internal_label().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "data_types.InstanceMask.label");
+    target = stream->WriteStringMaybeAliased(
+        9, this->_internal_label(), target);
+  }
+
+  // float score = 10;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_score = this->_internal_score();
+  uint32_t raw_score;
+  memcpy(&raw_score, &tmp_score, sizeof(tmp_score));
+  if (raw_score != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(10, this->_internal_score(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:data_types.InstanceMask)
+  return target;
+}
+
+size_t InstanceMask::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:data_types.InstanceMask)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 counts = 8;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.counts_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._counts_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // string label = 9;
+  if (!this->_internal_label().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_label());
+  }
+
+  // uint32 detection_index = 1;
+  if (this->_internal_detection_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_detection_index());
+  }
+
+  // float x_min = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x_min = this->_internal_x_min();
+  uint32_t raw_x_min;
+  memcpy(&raw_x_min, &tmp_x_min, sizeof(tmp_x_min));
+  if (raw_x_min != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float y_min = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y_min = this->_internal_y_min();
+  uint32_t raw_y_min;
+  memcpy(&raw_y_min, &tmp_y_min, sizeof(tmp_y_min));
+  if (raw_y_min != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float x_max = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x_max = this->_internal_x_max();
+  uint32_t raw_x_max;
+  memcpy(&raw_x_max, &tmp_x_max, sizeof(tmp_x_max));
+  if (raw_x_max != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float y_max = 5;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y_max = this->_internal_y_max();
+  uint32_t raw_y_max;
+  memcpy(&raw_y_max, &tmp_y_max, sizeof(tmp_y_max));
+  if (raw_y_max != 0) {
+    total_size += 1 + 4;
+  }
+
+  // uint32 width = 6;
+  if (this->_internal_width() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_width());
+  }
+
+  // uint32 height = 7;
+  if (this->_internal_height() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_height());
+  }
+
+  // float score = 10;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_score = this->_internal_score();
+  uint32_t raw_score;
+  memcpy(&raw_score, &tmp_score, sizeof(tmp_score));
+  if (raw_score != 0) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InstanceMask::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    InstanceMask::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InstanceMask::GetClassData() const { return &_class_data_; }
+
+
+void InstanceMask::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InstanceMask*>(&to_msg);
+  auto& from = static_cast<const InstanceMask&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:data_types.InstanceMask)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.counts_.MergeFrom(from._impl_.counts_);
+  if (!from._internal_label().empty()) {
+    _this->_internal_set_label(from._internal_label());
+  }
+  if (from._internal_detection_index() != 0) {
+    _this->_internal_set_detection_index(from._internal_detection_index());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x_min = from._internal_x_min();
+  uint32_t raw_x_min;
+  memcpy(&raw_x_min, &tmp_x_min, sizeof(tmp_x_min));
+  if (raw_x_min != 0) {
+    _this->_internal_set_x_min(from._internal_x_min());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y_min = from._internal_y_min();
+  uint32_t raw_y_min;
+  memcpy(&raw_y_min, &tmp_y_min, sizeof(tmp_y_min));
+  if (raw_y_min != 0) {
+    _this->_internal_set_y_min(from._internal_y_min());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x_max = from._internal_x_max();
+  uint32_t raw_x_max;
+  memcpy(&raw_x_max, &tmp_x_max, sizeof(tmp_x_max));
+  if (raw_x_max != 0) {
+    _this->_internal_set_x_max(from._internal_x_max());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y_max = from._internal_y_max();
+  uint32_t raw_y_max;
+  memcpy(&raw_y_max, &tmp_y_max, sizeof(tmp_y_max));
+  if (raw_y_max != 0) {
+    _this->_internal_set_y_max(from._internal_y_max());
+  }
+  if (from._internal_width() != 0) {
+    _this->_internal_set_width(from._internal_width());
+  }
+  if (from._internal_height() != 0) {
+    _this->_internal_set_height(from._internal_height());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_score = from._internal_score();
+  uint32_t raw_score;
+  memcpy(&raw_score, &tmp_score, sizeof(tmp_score));
+  if (raw_score != 0) {
+    _this->_internal_set_score(from._internal_score());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void InstanceMask::CopyFrom(const InstanceMask& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:data_types.InstanceMask)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InstanceMask::IsInitialized() const {
+  return true;
+}
+
+void InstanceMask::InternalSwap(InstanceMask* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.counts_.InternalSwap(&other->_impl_.counts_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.label_, lhs_arena,
+      &other->_impl_.label_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(InstanceMask, _impl_.score_)
+      + sizeof(InstanceMask::_impl_.score_)
+      - PROTOBUF_FIELD_OFFSET(InstanceMask, _impl_.detection_index_)>(
+          reinterpret_cast<char*>(&_impl_.detection_index_),
+          reinterpret_cast<char*>(&other->_impl_.detection_index_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata InstanceMask::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_data_5ftypes_2eproto_getter, &descriptor_table_data_5ftypes_2eproto_once,
+      file_level_metadata_data_5ftypes_2eproto[2]);
+}
+
+// ===================================================================
+
+class DetectionResult::_Internal {
+ public:
+  static const ::PROTOBUF_NAMESPACE_ID::Timestamp& frame_timestamp(const DetectionResult* msg);
+};
+
+const ::PROTOBUF_NAMESPACE_ID::Timestamp&
+DetectionResult::_Internal::frame_timestamp(const DetectionResult* msg) {
+  return *msg->_impl_.frame_timestamp_;
+}
+void DetectionResult::clear_frame_timestamp() {
+  if (GetArenaForAllocation() == nullptr && _impl_.frame_timestamp_ != nullptr) {
+    delete _impl_.frame_timestamp_;
+  }
+  _impl_.frame_timestamp_ = nullptr;
+}
+DetectionResult::DetectionResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:data_types.DetectionResult)
+}
+DetectionResult::DetectionResult(const DetectionResult& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DetectionResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.masks_){from._impl_.masks_}
+    , decltype(_impl_.json_){}
+    , decltype(_impl_.backend_){}
+    , decltype(_impl_.frame_timestamp_){nullptr}
+    , decltype(_impl_.frame_id_){}
+    , decltype(_impl_.camera_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.json_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.json_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_json().empty()) {
+    _this->_impl_.json_.Set(from._internal_json(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.backend_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.backend_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_backend().empty()) {
+    _this->_impl_.backend_.Set(from._internal_backend(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_frame_timestamp()) {
+    _this->_impl_.frame_timestamp_ = new ::PROTOBUF_NAMESPACE_ID::Timestamp(*from._impl_.frame_timestamp_);
+  }
+  ::memcpy(&_impl_.frame_id_, &from._impl_.frame_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.camera_id_) -
+    reinterpret_cast<char*>(&_impl_.frame_id_)) + sizeof(_impl_.camera_id_));
+  // @@protoc_insertion_point(copy_constructor:data_types.DetectionResult)
+}
+
+inline void DetectionResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.masks_){arena}
+    , decltype(_impl_.json_){}
+    , decltype(_impl_.backend_){}
+    , decltype(_impl_.frame_timestamp_){nullptr}
+    , decltype(_impl_.frame_id_){uint64_t{0u}}
+    , decltype(_impl_.camera_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.json_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.json_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.backend_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.backend_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DetectionResult::~DetectionResult() {
+  // @@protoc_insertion_point(destructor:data_types.DetectionResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DetectionResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.masks_.~RepeatedPtrField();
+  _impl_.json_.Destroy();
+  _impl_.backend_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.frame_timestamp_;
+}
+
+void DetectionResult::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DetectionResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:data_types.DetectionResult)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.masks_.Clear();
+  _impl_.json_.ClearToEmpty();
+  _impl_.backend_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.frame_timestamp_ != nullptr) {
+    delete _impl_.frame_timestamp_;
+  }
+  _impl_.frame_timestamp_ = nullptr;
+  ::memset(&_impl_.frame_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.camera_id_) -
+      reinterpret_cast<char*>(&_impl_.frame_id_)) + sizeof(_impl_.camera_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DetectionResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .google.protobuf.Timestamp frame_timestamp = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_frame_timestamp(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string json = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_json();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "data_types.DetectionResult.json"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 frame_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.frame_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .data_types.InstanceMask masks = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_masks(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string backend = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_backend();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "data_types.DetectionResult.backend"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 camera_id = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.camera_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DetectionResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:data_types.DetectionResult)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.Timestamp frame_timestamp = 1;
+  if (this->_internal_has_frame_timestamp()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::frame_timestamp(this),
+        _Internal::frame_timestamp(this).GetCachedSize(), target, stream);
+  }
+
+  // string json = 2;
+  if (!this->_internal_json().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_json().data(), static_cast<int>(this->_internal_json().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "data_types.DetectionResult.json");
     target = stream->WriteStringMaybeAliased(
         2, this->_internal_json(), target);
   }
 
+  // uint64 frame_id = 3;
+  if (this->_internal_frame_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_frame_id(), target);
+  }
+
+  // repeated .data_types.InstanceMask masks = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_masks_size()); i < n; i++) {
+    const auto& repfield = this->_internal_masks(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // string backend = 5;
+  if (!this->_internal_backend().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_backend().data(), static_cast<int>(this->_internal_backend().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "data_types.DetectionResult.backend");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_backend(), target);
+  }
+
+  // uint32 camera_id = 6;
+  if (this->_internal_camera_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_camera_id(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:data_types.DetectionResult)
   return target;
@@ -1330,69 +2259,84 @@ size_t DetectionResult::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:data_types.DetectionResult)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // repeated .data_types.InstanceMask masks = 4;
+  total_size += 1UL * this->_internal_masks_size();
+  for (const auto& msg : this->_impl_.masks_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
   // string json = 2;
-  if (this->json().size() > 0) {
+  if (!this->_internal_json().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_json());
   }
 
+  // string backend = 5;
+  if (!this->_internal_backend().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_backend());
+  }
+
   // .google.protobuf.Timestamp frame_timestamp = 1;
-  if (this->has_frame_timestamp()) {
+  if (this->_internal_has_frame_timestamp()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *frame_timestamp_);
+        *_impl_.frame_timestamp_);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // uint64 frame_id = 3;
+  if (this->_internal_frame_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_frame_id());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void DetectionResult::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:data_types.DetectionResult)
-  GOOGLE_DCHECK_NE(&from, this);
-  const DetectionResult* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<DetectionResult>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:data_types.DetectionResult)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:data_types.DetectionResult)
-    MergeFrom(*source);
+  // uint32 camera_id = 6;
+  if (this->_internal_camera_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_camera_id());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void DetectionResult::MergeFrom(const DetectionResult& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:data_types.DetectionResult)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DetectionResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DetectionResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DetectionResult::GetClassData() const { return &_class_data_; }
 
-  if (from.json().size() > 0) {
 
-    json_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.json_);
+void DetectionResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DetectionResult*>(&to_msg);
+  auto& from = static_cast<const DetectionResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:data_types.DetectionResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.masks_.MergeFrom(from._impl_.masks_);
+  if (!from._internal_json().empty()) {
+    _this->_internal_set_json(from._internal_json());
   }
-  if (from.has_frame_timestamp()) {
-    _internal_mutable_frame_timestamp()->PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(from._internal_frame_timestamp());
+  if (!from._internal_backend().empty()) {
+    _this->_internal_set_backend(from._internal_backend());
   }
-}
-
-void DetectionResult::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:data_types.DetectionResult)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_has_frame_timestamp()) {
+    _this->_internal_mutable_frame_timestamp()->::PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(
+        from._internal_frame_timestamp());
+  }
+  if (from._internal_frame_id() != 0) {
+    _this->_internal_set_frame_id(from._internal_frame_id());
+  }
+  if (from._internal_camera_id() != 0) {
+    _this->_internal_set_camera_id(from._internal_camera_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void DetectionResult::CopyFrom(const DetectionResult& from) {
@@ -1408,179 +2352,327 @@ bool DetectionResult::IsInitialized() const {
 
 void DetectionResult::InternalSwap(DetectionResult* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  json_.Swap(&other->json_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(frame_timestamp_, other->frame_timestamp_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.masks_.InternalSwap(&other->_impl_.masks_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.json_, lhs_arena,
+      &other->_impl_.json_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.backend_, lhs_arena,
+      &other->_impl_.backend_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DetectionResult, _impl_.camera_id_)
+      + sizeof(DetectionResult::_impl_.camera_id_)
+      - PROTOBUF_FIELD_OFFSET(DetectionResult, _impl_.frame_timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.frame_timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.frame_timestamp_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata DetectionResult::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_data_5ftypes_2eproto_getter, &descriptor_table_data_5ftypes_2eproto_once,
+      file_level_metadata_data_5ftypes_2eproto[3]);
 }
 
-
 // ===================================================================
 
-void DeviceStatus::InitAsDefaultInstance() {
-}
 class DeviceStatus::_Internal {
  public:
 };
 
-DeviceStatus::DeviceStatus()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:data_types.DeviceStatus)
+DeviceStatus::DeviceStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:data_types.DeviceStatus)
 }
 DeviceStatus::DeviceStatus(const DeviceStatus& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  device_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DeviceStatus* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.device_id_){}
+    , decltype(_impl_.firmware_version_){}
+    , decltype(_impl_.profile_){}
+    , decltype(_impl_.profile_reason_){}
+    , decltype(_impl_.state_){}
+    , decltype(_impl_.cpu_temperature_c_){}
+    , decltype(_impl_.frame_rate_fps_){}
+    , decltype(_impl_.processing_latency_ms_){}
+    , decltype(_impl_.is_sleeping_){}
+    , decltype(_impl_.profile_auto_){}
+    , decltype(_impl_.battery_percent_){}
+    , decltype(_impl_.active_streams_){}
+    , decltype(_impl_.jpeg_quality_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.device_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.device_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_device_id().empty()) {
-    device_id_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.device_id_);
+    _this->_impl_.device_id_.Set(from._internal_device_id(), 
+      _this->GetArenaForAllocation());
   }
-  firmware_version_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.firmware_version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.firmware_version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_firmware_version().empty()) {
-    firmware_version_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.firmware_version_);
-  }
-  ::memcpy(&state_, &from.state_,
-    static_cast<size_t>(reinterpret_cast<char*>(&is_sleeping_) -
-    reinterpret_cast<char*>(&state_)) + sizeof(is_sleeping_));
+    _this->_impl_.firmware_version_.Set(from._internal_firmware_version(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.profile_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.profile_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_profile().empty()) {
+    _this->_impl_.profile_.Set(from._internal_profile(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.profile_reason_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.profile_reason_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_profile_reason().empty()) {
+    _this->_impl_.profile_reason_.Set(from._internal_profile_reason(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.state_, &from._impl_.state_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.jpeg_quality_) -
+    reinterpret_cast<char*>(&_impl_.state_)) + sizeof(_impl_.jpeg_quality_));
   // @@protoc_insertion_point(copy_constructor:data_types.DeviceStatus)
 }
 
-void DeviceStatus::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_DeviceStatus_data_5ftypes_2eproto.base);
-  device_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  firmware_version_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&state_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&is_sleeping_) -
-      reinterpret_cast<char*>(&state_)) + sizeof(is_sleeping_));
+inline void DeviceStatus::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.device_id_){}
+    , decltype(_impl_.firmware_version_){}
+    , decltype(_impl_.profile_){}
+    , decltype(_impl_.profile_reason_){}
+    , decltype(_impl_.state_){0}
+    , decltype(_impl_.cpu_temperature_c_){0}
+    , decltype(_impl_.frame_rate_fps_){0u}
+    , decltype(_impl_.processing_latency_ms_){0u}
+    , decltype(_impl_.is_sleeping_){false}
+    , decltype(_impl_.profile_auto_){false}
+    , decltype(_impl_.battery_percent_){0}
+    , decltype(_impl_.active_streams_){0u}
+    , decltype(_impl_.jpeg_quality_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.device_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.device_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.firmware_version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.firmware_version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.profile_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.profile_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.profile_reason_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.profile_reason_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 DeviceStatus::~DeviceStatus() {
   // @@protoc_insertion_point(destructor:data_types.DeviceStatus)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void DeviceStatus::SharedDtor() {
-  device_id_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  firmware_version_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void DeviceStatus::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.device_id_.Destroy();
+  _impl_.firmware_version_.Destroy();
+  _impl_.profile_.Destroy();
+  _impl_.profile_reason_.Destroy();
 }
 
 void DeviceStatus::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const DeviceStatus& DeviceStatus::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_DeviceStatus_data_5ftypes_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void DeviceStatus::Clear() {
 // @@protoc_insertion_point(message_clear_start:data_types.DeviceStatus)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  device_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  firmware_version_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&state_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&is_sleeping_) -
-      reinterpret_cast<char*>(&state_)) + sizeof(is_sleeping_));
-  _internal_metadata_.Clear();
+  _impl_.device_id_.ClearToEmpty();
+  _impl_.firmware_version_.ClearToEmpty();
+  _impl_.profile_.ClearToEmpty();
+  _impl_.profile_reason_.ClearToEmpty();
+  ::memset(&_impl_.state_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.jpeg_quality_) -
+      reinterpret_cast<char*>(&_impl_.state_)) + sizeof(_impl_.jpeg_quality_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* DeviceStatus::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* DeviceStatus::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string device_id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_device_id();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "data_types.DeviceStatus.device_id"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "data_types.DeviceStatus.device_id"));
+        } else
+          goto handle_unusual;
         continue;
       // .data_types.DeviceStatus.ConnectionState state = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
           _internal_set_state(static_cast<::data_types::DeviceStatus_ConnectionState>(val));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // float cpu_temperature_c = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 29)) {
-          cpu_temperature_c_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.cpu_temperature_c_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // uint32 frame_rate_fps = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          frame_rate_fps_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.frame_rate_fps_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // uint32 processing_latency_ms = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
-          processing_latency_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.processing_latency_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // string firmware_version = 6;
       case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
           auto str = _internal_mutable_firmware_version();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "data_types.DeviceStatus.firmware_version"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "data_types.DeviceStatus.firmware_version"));
+        } else
+          goto handle_unusual;
         continue;
       // bool is_sleeping = 7;
       case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
-          is_sleeping_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.is_sleeping_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // string profile = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_profile();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "data_types.DeviceStatus.profile"));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // bool profile_auto = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.profile_auto_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string profile_reason = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_profile_reason();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "data_types.DeviceStatus.profile_reason"));
+        } else
+          goto handle_unusual;
+        continue;
+      // float battery_percent = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 93)) {
+          _impl_.battery_percent_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 active_streams = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.active_streams_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 jpeg_quality = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _impl_.jpeg_quality_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* DeviceStatus::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* DeviceStatus::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:data_types.DeviceStatus)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string device_id = 1;
-  if (this->device_id().size() > 0) {
+  if (!this->_internal_device_id().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_device_id().data(), static_cast<int>(this->_internal_device_id().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1590,32 +2682,36 @@ failure:
   }
 
   // .data_types.DeviceStatus.ConnectionState state = 2;
-  if (this->state() != 0) {
+  if (this->_internal_state() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       2, this->_internal_state(), target);
   }
 
   // float cpu_temperature_c = 3;
-  if (!(this->cpu_temperature_c() <= 0 && this->cpu_temperature_c() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_cpu_temperature_c = this->_internal_cpu_temperature_c();
+  uint32_t raw_cpu_temperature_c;
+  memcpy(&raw_cpu_temperature_c, &tmp_cpu_temperature_c, sizeof(tmp_cpu_temperature_c));
+  if (raw_cpu_temperature_c != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(3, this->_internal_cpu_temperature_c(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_cpu_temperature_c(), target);
   }
 
   // uint32 frame_rate_fps = 4;
-  if (this->frame_rate_fps() != 0) {
+  if (this->_internal_frame_rate_fps() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(4, this->_internal_frame_rate_fps(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_frame_rate_fps(), target);
   }
 
   // uint32 processing_latency_ms = 5;
-  if (this->processing_latency_ms() != 0) {
+  if (this->_internal_processing_latency_ms() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(5, this->_internal_processing_latency_ms(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_processing_latency_ms(), target);
   }
 
   // string firmware_version = 6;
-  if (this->firmware_version().size() > 0) {
+  if (!this->_internal_firmware_version().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_firmware_version().data(), static_cast<int>(this->_internal_firmware_version().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1625,14 +2721,62 @@ failure:
   }
 
   // bool is_sleeping = 7;
-  if (this->is_sleeping() != 0) {
+  if (this->_internal_is_sleeping() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_is_sleeping(), target);
+  }
+
+  // string profile = 8;
+  if (!this->_internal_profile().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_profile().data(), static_cast<int>(this->_internal_profile().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "data_types.DeviceStatus.profile");
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_profile(), target);
+  }
+
+  // bool profile_auto = 9;
+  if (this->_internal_profile_auto() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(9, this->_internal_profile_auto(), target);
+  }
+
+  // string profile_reason = 10;
+  if (!this->_internal_profile_reason().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_profile_reason().data(), static_cast<int>(this->_internal_profile_reason().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "data_types.DeviceStatus.profile_reason");
+    target = stream->WriteStringMaybeAliased(
+        10, this->_internal_profile_reason(), target);
+  }
+
+  // float battery_percent = 11;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_battery_percent = this->_internal_battery_percent();
+  uint32_t raw_battery_percent;
+  memcpy(&raw_battery_percent, &tmp_battery_percent, sizeof(tmp_battery_percent));
+  if (raw_battery_percent != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(11, this->_internal_battery_percent(), target);
+  }
+
+  // uint32 active_streams = 12;
+  if (this->_internal_active_streams() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(7, this->_internal_is_sleeping(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(12, this->_internal_active_streams(), target);
+  }
+
+  // uint32 jpeg_quality = 13;
+  if (this->_internal_jpeg_quality() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(13, this->_internal_jpeg_quality(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:data_types.DeviceStatus)
   return target;
@@ -1642,115 +2786,158 @@ size_t DeviceStatus::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:data_types.DeviceStatus)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string device_id = 1;
-  if (this->device_id().size() > 0) {
+  if (!this->_internal_device_id().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_device_id());
   }
 
   // string firmware_version = 6;
-  if (this->firmware_version().size() > 0) {
+  if (!this->_internal_firmware_version().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_firmware_version());
   }
 
-  // .data_types.DeviceStatus.ConnectionState state = 2;
-  if (this->state() != 0) {
+  // string profile = 8;
+  if (!this->_internal_profile().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_state());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_profile());
+  }
+
+  // string profile_reason = 10;
+  if (!this->_internal_profile_reason().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_profile_reason());
+  }
+
+  // .data_types.DeviceStatus.ConnectionState state = 2;
+  if (this->_internal_state() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_state());
   }
 
   // float cpu_temperature_c = 3;
-  if (!(this->cpu_temperature_c() <= 0 && this->cpu_temperature_c() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_cpu_temperature_c = this->_internal_cpu_temperature_c();
+  uint32_t raw_cpu_temperature_c;
+  memcpy(&raw_cpu_temperature_c, &tmp_cpu_temperature_c, sizeof(tmp_cpu_temperature_c));
+  if (raw_cpu_temperature_c != 0) {
     total_size += 1 + 4;
   }
 
   // uint32 frame_rate_fps = 4;
-  if (this->frame_rate_fps() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_frame_rate_fps());
+  if (this->_internal_frame_rate_fps() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_frame_rate_fps());
   }
 
   // uint32 processing_latency_ms = 5;
-  if (this->processing_latency_ms() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_processing_latency_ms());
+  if (this->_internal_processing_latency_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_processing_latency_ms());
   }
 
   // bool is_sleeping = 7;
-  if (this->is_sleeping() != 0) {
+  if (this->_internal_is_sleeping() != 0) {
     total_size += 1 + 1;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // bool profile_auto = 9;
+  if (this->_internal_profile_auto() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // float battery_percent = 11;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_battery_percent = this->_internal_battery_percent();
+  uint32_t raw_battery_percent;
+  memcpy(&raw_battery_percent, &tmp_battery_percent, sizeof(tmp_battery_percent));
+  if (raw_battery_percent != 0) {
+    total_size += 1 + 4;
+  }
+
+  // uint32 active_streams = 12;
+  if (this->_internal_active_streams() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_active_streams());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void DeviceStatus::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:data_types.DeviceStatus)
-  GOOGLE_DCHECK_NE(&from, this);
-  const DeviceStatus* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<DeviceStatus>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:data_types.DeviceStatus)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:data_types.DeviceStatus)
-    MergeFrom(*source);
+  // uint32 jpeg_quality = 13;
+  if (this->_internal_jpeg_quality() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_jpeg_quality());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void DeviceStatus::MergeFrom(const DeviceStatus& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:data_types.DeviceStatus)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DeviceStatus::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DeviceStatus::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DeviceStatus::GetClassData() const { return &_class_data_; }
 
-  if (from.device_id().size() > 0) {
 
-    device_id_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.device_id_);
-  }
-  if (from.firmware_version().size() > 0) {
+void DeviceStatus::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DeviceStatus*>(&to_msg);
+  auto& from = static_cast<const DeviceStatus&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:data_types.DeviceStatus)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    firmware_version_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.firmware_version_);
+  if (!from._internal_device_id().empty()) {
+    _this->_internal_set_device_id(from._internal_device_id());
   }
-  if (from.state() != 0) {
-    _internal_set_state(from._internal_state());
+  if (!from._internal_firmware_version().empty()) {
+    _this->_internal_set_firmware_version(from._internal_firmware_version());
   }
-  if (!(from.cpu_temperature_c() <= 0 && from.cpu_temperature_c() >= 0)) {
-    _internal_set_cpu_temperature_c(from._internal_cpu_temperature_c());
+  if (!from._internal_profile().empty()) {
+    _this->_internal_set_profile(from._internal_profile());
   }
-  if (from.frame_rate_fps() != 0) {
-    _internal_set_frame_rate_fps(from._internal_frame_rate_fps());
+  if (!from._internal_profile_reason().empty()) {
+    _this->_internal_set_profile_reason(from._internal_profile_reason());
   }
-  if (from.processing_latency_ms() != 0) {
-    _internal_set_processing_latency_ms(from._internal_processing_latency_ms());
+  if (from._internal_state() != 0) {
+    _this->_internal_set_state(from._internal_state());
   }
-  if (from.is_sleeping() != 0) {
-    _internal_set_is_sleeping(from._internal_is_sleeping());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_cpu_temperature_c = from._internal_cpu_temperature_c();
+  uint32_t raw_cpu_temperature_c;
+  memcpy(&raw_cpu_temperature_c, &tmp_cpu_temperature_c, sizeof(tmp_cpu_temperature_c));
+  if (raw_cpu_temperature_c != 0) {
+    _this->_internal_set_cpu_temperature_c(from._internal_cpu_temperature_c());
   }
-}
-
-void DeviceStatus::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:data_types.DeviceStatus)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_frame_rate_fps() != 0) {
+    _this->_internal_set_frame_rate_fps(from._internal_frame_rate_fps());
+  }
+  if (from._internal_processing_latency_ms() != 0) {
+    _this->_internal_set_processing_latency_ms(from._internal_processing_latency_ms());
+  }
+  if (from._internal_is_sleeping() != 0) {
+    _this->_internal_set_is_sleeping(from._internal_is_sleeping());
+  }
+  if (from._internal_profile_auto() != 0) {
+    _this->_internal_set_profile_auto(from._internal_profile_auto());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_battery_percent = from._internal_battery_percent();
+  uint32_t raw_battery_percent;
+  memcpy(&raw_battery_percent, &tmp_battery_percent, sizeof(tmp_battery_percent));
+  if (raw_battery_percent != 0) {
+    _this->_internal_set_battery_percent(from._internal_battery_percent());
+  }
+  if (from._internal_active_streams() != 0) {
+    _this->_internal_set_active_streams(from._internal_active_streams());
+  }
+  if (from._internal_jpeg_quality() != 0) {
+    _this->_internal_set_jpeg_quality(from._internal_jpeg_quality());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void DeviceStatus::CopyFrom(const DeviceStatus& from) {
@@ -1766,37 +2953,41 @@ bool DeviceStatus::IsInitialized() const {
 
 void DeviceStatus::InternalSwap(DeviceStatus* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  device_id_.Swap(&other->device_id_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  firmware_version_.Swap(&other->firmware_version_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(state_, other->state_);
-  swap(cpu_temperature_c_, other->cpu_temperature_c_);
-  swap(frame_rate_fps_, other->frame_rate_fps_);
-  swap(processing_latency_ms_, other->processing_latency_ms_);
-  swap(is_sleeping_, other->is_sleeping_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.device_id_, lhs_arena,
+      &other->_impl_.device_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.firmware_version_, lhs_arena,
+      &other->_impl_.firmware_version_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.profile_, lhs_arena,
+      &other->_impl_.profile_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.profile_reason_, lhs_arena,
+      &other->_impl_.profile_reason_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DeviceStatus, _impl_.jpeg_quality_)
+      + sizeof(DeviceStatus::_impl_.jpeg_quality_)
+      - PROTOBUF_FIELD_OFFSET(DeviceStatus, _impl_.state_)>(
+          reinterpret_cast<char*>(&_impl_.state_),
+          reinterpret_cast<char*>(&other->_impl_.state_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata DeviceStatus::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_data_5ftypes_2eproto_getter, &descriptor_table_data_5ftypes_2eproto_once,
+      file_level_metadata_data_5ftypes_2eproto[4]);
 }
 
-
 // ===================================================================
 
-void Command::InitAsDefaultInstance() {
-  ::data_types::_Command_default_instance_.config_request_ = const_cast< ::data_types::ConfigRequest*>(
-      ::data_types::ConfigRequest::internal_default_instance());
-  ::data_types::_Command_default_instance_.control_action_ = const_cast< ::data_types::ControlAction*>(
-      ::data_types::ControlAction::internal_default_instance());
-  ::data_types::_Command_default_instance_.heartbeat_ = const_cast< ::data_types::Heartbeat*>(
-      ::data_types::Heartbeat::internal_default_instance());
-  ::data_types::_Command_default_instance_.detection_result_ = const_cast< ::data_types::DetectionResult*>(
-      ::data_types::DetectionResult::internal_default_instance());
-  ::data_types::_Command_default_instance_.camera_frame_ = const_cast< ::data_types::CameraFrame*>(
-      ::data_types::CameraFrame::internal_default_instance());
-}
 class Command::_Internal {
  public:
   static const ::data_types::ConfigRequest& config_request(const Command* msg);
@@ -1804,619 +2995,2170 @@ class Command::_Internal {
   static const ::data_types::Heartbeat& heartbeat(const Command* msg);
   static const ::data_types::DetectionResult& detection_result(const Command* msg);
   static const ::data_types::CameraFrame& camera_frame(const Command* msg);
+  static const ::data_types::FrameHeader& frame_header(const Command* msg);
+  static const ::data_types::FrameChunk& frame_chunk(const Command* msg);
+  static const ::data_types::Capabilities& hello(const Command* msg);
 };
 
 const ::data_types::ConfigRequest&
 Command::_Internal::config_request(const Command* msg) {
-  return *msg->command_type_.config_request_;
+  return *msg->_impl_.command_type_.config_request_;
 }
 const ::data_types::ControlAction&
 Command::_Internal::control_action(const Command* msg) {
-  return *msg->command_type_.control_action_;
+  return *msg->_impl_.command_type_.control_action_;
 }
 const ::data_types::Heartbeat&
 Command::_Internal::heartbeat(const Command* msg) {
-  return *msg->command_type_.heartbeat_;
+  return *msg->_impl_.command_type_.heartbeat_;
 }
 const ::data_types::DetectionResult&
 Command::_Internal::detection_result(const Command* msg) {
-  return *msg->command_type_.detection_result_;
+  return *msg->_impl_.command_type_.detection_result_;
 }
 const ::data_types::CameraFrame&
 Command::_Internal::camera_frame(const Command* msg) {
-  return *msg->command_type_.camera_frame_;
+  return *msg->_impl_.command_type_.camera_frame_;
+}
+const ::data_types::FrameHeader&
+Command::_Internal::frame_header(const Command* msg) {
+  return *msg->_impl_.command_type_.frame_header_;
+}
+const ::data_types::FrameChunk&
+Command::_Internal::frame_chunk(const Command* msg) {
+  return *msg->_impl_.command_type_.frame_chunk_;
+}
+const ::data_types::Capabilities&
+Command::_Internal::hello(const Command* msg) {
+  return *msg->_impl_.command_type_.hello_;
 }
 void Command::set_allocated_config_request(::data_types::ConfigRequest* config_request) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_command_type();
   if (config_request) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(config_request);
     if (message_arena != submessage_arena) {
       config_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, config_request, submessage_arena);
     }
     set_has_config_request();
-    command_type_.config_request_ = config_request;
+    _impl_.command_type_.config_request_ = config_request;
   }
   // @@protoc_insertion_point(field_set_allocated:data_types.Command.config_request)
 }
 void Command::set_allocated_control_action(::data_types::ControlAction* control_action) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_command_type();
   if (control_action) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(control_action);
     if (message_arena != submessage_arena) {
       control_action = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, control_action, submessage_arena);
     }
     set_has_control_action();
-    command_type_.control_action_ = control_action;
+    _impl_.command_type_.control_action_ = control_action;
   }
   // @@protoc_insertion_point(field_set_allocated:data_types.Command.control_action)
 }
 void Command::set_allocated_heartbeat(::data_types::Heartbeat* heartbeat) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_command_type();
   if (heartbeat) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(heartbeat);
     if (message_arena != submessage_arena) {
       heartbeat = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, heartbeat, submessage_arena);
     }
     set_has_heartbeat();
-    command_type_.heartbeat_ = heartbeat;
+    _impl_.command_type_.heartbeat_ = heartbeat;
   }
   // @@protoc_insertion_point(field_set_allocated:data_types.Command.heartbeat)
 }
 void Command::set_allocated_detection_result(::data_types::DetectionResult* detection_result) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_command_type();
   if (detection_result) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(detection_result);
     if (message_arena != submessage_arena) {
       detection_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, detection_result, submessage_arena);
     }
     set_has_detection_result();
-    command_type_.detection_result_ = detection_result;
+    _impl_.command_type_.detection_result_ = detection_result;
   }
   // @@protoc_insertion_point(field_set_allocated:data_types.Command.detection_result)
 }
 void Command::set_allocated_camera_frame(::data_types::CameraFrame* camera_frame) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_command_type();
   if (camera_frame) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(camera_frame);
     if (message_arena != submessage_arena) {
       camera_frame = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, camera_frame, submessage_arena);
     }
     set_has_camera_frame();
-    command_type_.camera_frame_ = camera_frame;
+    _impl_.command_type_.camera_frame_ = camera_frame;
   }
   // @@protoc_insertion_point(field_set_allocated:data_types.Command.camera_frame)
 }
-Command::Command()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:data_types.Command)
+void Command::set_allocated_frame_header(::data_types::FrameHeader* frame_header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_command_type();
+  if (frame_header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(frame_header);
+    if (message_arena != submessage_arena) {
+      frame_header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, frame_header, submessage_arena);
+    }
+    set_has_frame_header();
+    _impl_.command_type_.frame_header_ = frame_header;
+  }
+  // @@protoc_insertion_point(field_set_allocated:data_types.Command.frame_header)
+}
+void Command::set_allocated_frame_chunk(::data_types::FrameChunk* frame_chunk) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_command_type();
+  if (frame_chunk) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(frame_chunk);
+    if (message_arena != submessage_arena) {
+      frame_chunk = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, frame_chunk, submessage_arena);
+    }
+    set_has_frame_chunk();
+    _impl_.command_type_.frame_chunk_ = frame_chunk;
+  }
+  // @@protoc_insertion_point(field_set_allocated:data_types.Command.frame_chunk)
+}
+void Command::set_allocated_hello(::data_types::Capabilities* hello) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_command_type();
+  if (hello) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(hello);
+    if (message_arena != submessage_arena) {
+      hello = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, hello, submessage_arena);
+    }
+    set_has_hello();
+    _impl_.command_type_.hello_ = hello;
+  }
+  // @@protoc_insertion_point(field_set_allocated:data_types.Command.hello)
+}
+Command::Command(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:data_types.Command)
 }
 Command::Command(const Command& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Command* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.command_type_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   clear_has_command_type();
   switch (from.command_type_case()) {
     case kConfigRequest: {
-      _internal_mutable_config_request()->::data_types::ConfigRequest::MergeFrom(from._internal_config_request());
+      _this->_internal_mutable_config_request()->::data_types::ConfigRequest::MergeFrom(
+          from._internal_config_request());
+      break;
+    }
+    case kControlAction: {
+      _this->_internal_mutable_control_action()->::data_types::ControlAction::MergeFrom(
+          from._internal_control_action());
+      break;
+    }
+    case kHeartbeat: {
+      _this->_internal_mutable_heartbeat()->::data_types::Heartbeat::MergeFrom(
+          from._internal_heartbeat());
+      break;
+    }
+    case kDetectionResult: {
+      _this->_internal_mutable_detection_result()->::data_types::DetectionResult::MergeFrom(
+          from._internal_detection_result());
+      break;
+    }
+    case kCameraFrame: {
+      _this->_internal_mutable_camera_frame()->::data_types::CameraFrame::MergeFrom(
+          from._internal_camera_frame());
+      break;
+    }
+    case kFrameHeader: {
+      _this->_internal_mutable_frame_header()->::data_types::FrameHeader::MergeFrom(
+          from._internal_frame_header());
+      break;
+    }
+    case kFrameChunk: {
+      _this->_internal_mutable_frame_chunk()->::data_types::FrameChunk::MergeFrom(
+          from._internal_frame_chunk());
+      break;
+    }
+    case kHello: {
+      _this->_internal_mutable_hello()->::data_types::Capabilities::MergeFrom(
+          from._internal_hello());
+      break;
+    }
+    case COMMAND_TYPE_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:data_types.Command)
+}
+
+inline void Command::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.command_type_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_command_type();
+}
+
+Command::~Command() {
+  // @@protoc_insertion_point(destructor:data_types.Command)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Command::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_command_type()) {
+    clear_command_type();
+  }
+}
+
+void Command::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Command::clear_command_type() {
+// @@protoc_insertion_point(one_of_clear_start:data_types.Command)
+  switch (command_type_case()) {
+    case kConfigRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.command_type_.config_request_;
+      }
       break;
     }
     case kControlAction: {
-      _internal_mutable_control_action()->::data_types::ControlAction::MergeFrom(from._internal_control_action());
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.command_type_.control_action_;
+      }
       break;
     }
     case kHeartbeat: {
-      _internal_mutable_heartbeat()->::data_types::Heartbeat::MergeFrom(from._internal_heartbeat());
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.command_type_.heartbeat_;
+      }
       break;
     }
     case kDetectionResult: {
-      _internal_mutable_detection_result()->::data_types::DetectionResult::MergeFrom(from._internal_detection_result());
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.command_type_.detection_result_;
+      }
       break;
     }
     case kCameraFrame: {
-      _internal_mutable_camera_frame()->::data_types::CameraFrame::MergeFrom(from._internal_camera_frame());
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.command_type_.camera_frame_;
+      }
+      break;
+    }
+    case kFrameHeader: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.command_type_.frame_header_;
+      }
+      break;
+    }
+    case kFrameChunk: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.command_type_.frame_chunk_;
+      }
+      break;
+    }
+    case kHello: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.command_type_.hello_;
+      }
       break;
     }
     case COMMAND_TYPE_NOT_SET: {
       break;
     }
   }
-  // @@protoc_insertion_point(copy_constructor:data_types.Command)
+  _impl_._oneof_case_[0] = COMMAND_TYPE_NOT_SET;
+}
+
+
+void Command::Clear() {
+// @@protoc_insertion_point(message_clear_start:data_types.Command)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_command_type();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Command::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .data_types.ConfigRequest config_request = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_config_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .data_types.ControlAction control_action = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_control_action(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .data_types.Heartbeat heartbeat = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_heartbeat(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .data_types.DetectionResult detection_result = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_detection_result(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .data_types.CameraFrame camera_frame = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_camera_frame(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .data_types.FrameHeader frame_header = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_frame_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .data_types.FrameChunk frame_chunk = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_frame_chunk(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .data_types.Capabilities hello = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_hello(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Command::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:data_types.Command)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .data_types.ConfigRequest config_request = 1;
+  if (_internal_has_config_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::config_request(this),
+        _Internal::config_request(this).GetCachedSize(), target, stream);
+  }
+
+  // .data_types.ControlAction control_action = 2;
+  if (_internal_has_control_action()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::control_action(this),
+        _Internal::control_action(this).GetCachedSize(), target, stream);
+  }
+
+  // .data_types.Heartbeat heartbeat = 3;
+  if (_internal_has_heartbeat()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::heartbeat(this),
+        _Internal::heartbeat(this).GetCachedSize(), target, stream);
+  }
+
+  // .data_types.DetectionResult detection_result = 4;
+  if (_internal_has_detection_result()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::detection_result(this),
+        _Internal::detection_result(this).GetCachedSize(), target, stream);
+  }
+
+  // .data_types.CameraFrame camera_frame = 5;
+  if (_internal_has_camera_frame()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::camera_frame(this),
+        _Internal::camera_frame(this).GetCachedSize(), target, stream);
+  }
+
+  // .data_types.FrameHeader frame_header = 6;
+  if (_internal_has_frame_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::frame_header(this),
+        _Internal::frame_header(this).GetCachedSize(), target, stream);
+  }
+
+  // .data_types.FrameChunk frame_chunk = 7;
+  if (_internal_has_frame_chunk()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::frame_chunk(this),
+        _Internal::frame_chunk(this).GetCachedSize(), target, stream);
+  }
+
+  // .data_types.Capabilities hello = 8;
+  if (_internal_has_hello()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::hello(this),
+        _Internal::hello(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:data_types.Command)
+  return target;
+}
+
+size_t Command::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:data_types.Command)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (command_type_case()) {
+    // .data_types.ConfigRequest config_request = 1;
+    case kConfigRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.command_type_.config_request_);
+      break;
+    }
+    // .data_types.ControlAction control_action = 2;
+    case kControlAction: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.command_type_.control_action_);
+      break;
+    }
+    // .data_types.Heartbeat heartbeat = 3;
+    case kHeartbeat: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.command_type_.heartbeat_);
+      break;
+    }
+    // .data_types.DetectionResult detection_result = 4;
+    case kDetectionResult: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.command_type_.detection_result_);
+      break;
+    }
+    // .data_types.CameraFrame camera_frame = 5;
+    case kCameraFrame: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.command_type_.camera_frame_);
+      break;
+    }
+    // .data_types.FrameHeader frame_header = 6;
+    case kFrameHeader: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.command_type_.frame_header_);
+      break;
+    }
+    // .data_types.FrameChunk frame_chunk = 7;
+    case kFrameChunk: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.command_type_.frame_chunk_);
+      break;
+    }
+    // .data_types.Capabilities hello = 8;
+    case kHello: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.command_type_.hello_);
+      break;
+    }
+    case COMMAND_TYPE_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Command::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Command::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Command::GetClassData() const { return &_class_data_; }
+
+
+void Command::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Command*>(&to_msg);
+  auto& from = static_cast<const Command&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:data_types.Command)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.command_type_case()) {
+    case kConfigRequest: {
+      _this->_internal_mutable_config_request()->::data_types::ConfigRequest::MergeFrom(
+          from._internal_config_request());
+      break;
+    }
+    case kControlAction: {
+      _this->_internal_mutable_control_action()->::data_types::ControlAction::MergeFrom(
+          from._internal_control_action());
+      break;
+    }
+    case kHeartbeat: {
+      _this->_internal_mutable_heartbeat()->::data_types::Heartbeat::MergeFrom(
+          from._internal_heartbeat());
+      break;
+    }
+    case kDetectionResult: {
+      _this->_internal_mutable_detection_result()->::data_types::DetectionResult::MergeFrom(
+          from._internal_detection_result());
+      break;
+    }
+    case kCameraFrame: {
+      _this->_internal_mutable_camera_frame()->::data_types::CameraFrame::MergeFrom(
+          from._internal_camera_frame());
+      break;
+    }
+    case kFrameHeader: {
+      _this->_internal_mutable_frame_header()->::data_types::FrameHeader::MergeFrom(
+          from._internal_frame_header());
+      break;
+    }
+    case kFrameChunk: {
+      _this->_internal_mutable_frame_chunk()->::data_types::FrameChunk::MergeFrom(
+          from._internal_frame_chunk());
+      break;
+    }
+    case kHello: {
+      _this->_internal_mutable_hello()->::data_types::Capabilities::MergeFrom(
+          from._internal_hello());
+      break;
+    }
+    case COMMAND_TYPE_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Command::CopyFrom(const Command& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:data_types.Command)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Command::IsInitialized() const {
+  return true;
+}
+
+void Command::InternalSwap(Command* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.command_type_, other->_impl_.command_type_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Command::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_data_5ftypes_2eproto_getter, &descriptor_table_data_5ftypes_2eproto_once,
+      file_level_metadata_data_5ftypes_2eproto[5]);
+}
+
+// ===================================================================
+
+class Capabilities::_Internal {
+ public:
+};
+
+Capabilities::Capabilities(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:data_types.Capabilities)
+}
+Capabilities::Capabilities(const Capabilities& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Capabilities* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frame_formats_){from._impl_.frame_formats_}
+    , decltype(_impl_.result_encodings_){from._impl_.result_encodings_}
+    , decltype(_impl_.compression_){from._impl_.compression_}
+    , decltype(_impl_.protocol_version_){}
+    , decltype(_impl_.result_batch_){}
+    , decltype(_impl_.chunked_frames_){}
+    , decltype(_impl_.max_chunk_bytes_){}
+    , decltype(_impl_.max_inflight_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.protocol_version_, &from._impl_.protocol_version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_inflight_) -
+    reinterpret_cast<char*>(&_impl_.protocol_version_)) + sizeof(_impl_.max_inflight_));
+  // @@protoc_insertion_point(copy_constructor:data_types.Capabilities)
+}
+
+inline void Capabilities::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frame_formats_){arena}
+    , decltype(_impl_.result_encodings_){arena}
+    , decltype(_impl_.compression_){arena}
+    , decltype(_impl_.protocol_version_){0u}
+    , decltype(_impl_.result_batch_){false}
+    , decltype(_impl_.chunked_frames_){false}
+    , decltype(_impl_.max_chunk_bytes_){0u}
+    , decltype(_impl_.max_inflight_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Capabilities::~Capabilities() {
+  // @@protoc_insertion_point(destructor:data_types.Capabilities)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Capabilities::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.frame_formats_.~RepeatedPtrField();
+  _impl_.result_encodings_.~RepeatedPtrField();
+  _impl_.compression_.~RepeatedPtrField();
+}
+
+void Capabilities::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Capabilities::Clear() {
+// @@protoc_insertion_point(message_clear_start:data_types.Capabilities)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.frame_formats_.Clear();
+  _impl_.result_encodings_.Clear();
+  _impl_.compression_.Clear();
+  ::memset(&_impl_.protocol_version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_inflight_) -
+      reinterpret_cast<char*>(&_impl_.protocol_version_)) + sizeof(_impl_.max_inflight_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Capabilities::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 protocol_version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.protocol_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string frame_formats = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_frame_formats();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "data_types.Capabilities.frame_formats"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string result_encodings = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_result_encodings();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "data_types.Capabilities.result_encodings"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool result_batch = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.result_batch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool chunked_frames = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.chunked_frames_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 max_chunk_bytes = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.max_chunk_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 max_inflight = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.max_inflight_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string compression = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_compression();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "data_types.Capabilities.compression"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Capabilities::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:data_types.Capabilities)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 protocol_version = 1;
+  if (this->_internal_protocol_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_protocol_version(), target);
+  }
+
+  // repeated string frame_formats = 2;
+  for (int i = 0, n = this->_internal_frame_formats_size(); i < n; i++) {
+    const auto& s = this->_internal_frame_formats(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "data_types.Capabilities.frame_formats");
+    target = stream->WriteString(2, s, target);
+  }
+
+  // repeated string result_encodings = 3;
+  for (int i = 0, n = this->_internal_result_encodings_size(); i < n; i++) {
+    const auto& s = this->_internal_result_encodings(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "data_types.Capabilities.result_encodings");
+    target = stream->WriteString(3, s, target);
+  }
+
+  // bool result_batch = 4;
+  if (this->_internal_result_batch() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_result_batch(), target);
+  }
+
+  // bool chunked_frames = 5;
+  if (this->_internal_chunked_frames() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_chunked_frames(), target);
+  }
+
+  // uint32 max_chunk_bytes = 6;
+  if (this->_internal_max_chunk_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_max_chunk_bytes(), target);
+  }
+
+  // uint32 max_inflight = 7;
+  if (this->_internal_max_inflight() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_max_inflight(), target);
+  }
+
+  // repeated string compression = 8;
+  for (int i = 0, n = this->_internal_compression_size(); i < n; i++) {
+    const auto& s = this->_internal_compression(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "data_types.Capabilities.compression");
+    target = stream->WriteString(8, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:data_types.Capabilities)
+  return target;
+}
+
+size_t Capabilities::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:data_types.Capabilities)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string frame_formats = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.frame_formats_.size());
+  for (int i = 0, n = _impl_.frame_formats_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.frame_formats_.Get(i));
+  }
+
+  // repeated string result_encodings = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.result_encodings_.size());
+  for (int i = 0, n = _impl_.result_encodings_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.result_encodings_.Get(i));
+  }
+
+  // repeated string compression = 8;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.compression_.size());
+  for (int i = 0, n = _impl_.compression_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.compression_.Get(i));
+  }
+
+  // uint32 protocol_version = 1;
+  if (this->_internal_protocol_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_protocol_version());
+  }
+
+  // bool result_batch = 4;
+  if (this->_internal_result_batch() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool chunked_frames = 5;
+  if (this->_internal_chunked_frames() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 max_chunk_bytes = 6;
+  if (this->_internal_max_chunk_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_max_chunk_bytes());
+  }
+
+  // uint32 max_inflight = 7;
+  if (this->_internal_max_inflight() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_max_inflight());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Capabilities::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Capabilities::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Capabilities::GetClassData() const { return &_class_data_; }
+
+
+void Capabilities::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Capabilities*>(&to_msg);
+  auto& from = static_cast<const Capabilities&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:data_types.Capabilities)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.frame_formats_.MergeFrom(from._impl_.frame_formats_);
+  _this->_impl_.result_encodings_.MergeFrom(from._impl_.result_encodings_);
+  _this->_impl_.compression_.MergeFrom(from._impl_.compression_);
+  if (from._internal_protocol_version() != 0) {
+    _this->_internal_set_protocol_version(from._internal_protocol_version());
+  }
+  if (from._internal_result_batch() != 0) {
+    _this->_internal_set_result_batch(from._internal_result_batch());
+  }
+  if (from._internal_chunked_frames() != 0) {
+    _this->_internal_set_chunked_frames(from._internal_chunked_frames());
+  }
+  if (from._internal_max_chunk_bytes() != 0) {
+    _this->_internal_set_max_chunk_bytes(from._internal_max_chunk_bytes());
+  }
+  if (from._internal_max_inflight() != 0) {
+    _this->_internal_set_max_inflight(from._internal_max_inflight());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Capabilities::CopyFrom(const Capabilities& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:data_types.Capabilities)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Capabilities::IsInitialized() const {
+  return true;
+}
+
+void Capabilities::InternalSwap(Capabilities* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.frame_formats_.InternalSwap(&other->_impl_.frame_formats_);
+  _impl_.result_encodings_.InternalSwap(&other->_impl_.result_encodings_);
+  _impl_.compression_.InternalSwap(&other->_impl_.compression_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Capabilities, _impl_.max_inflight_)
+      + sizeof(Capabilities::_impl_.max_inflight_)
+      - PROTOBUF_FIELD_OFFSET(Capabilities, _impl_.protocol_version_)>(
+          reinterpret_cast<char*>(&_impl_.protocol_version_),
+          reinterpret_cast<char*>(&other->_impl_.protocol_version_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Capabilities::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_data_5ftypes_2eproto_getter, &descriptor_table_data_5ftypes_2eproto_once,
+      file_level_metadata_data_5ftypes_2eproto[6]);
+}
+
+// ===================================================================
+
+class SessionConfig::_Internal {
+ public:
+};
+
+SessionConfig::SessionConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:data_types.SessionConfig)
+}
+SessionConfig::SessionConfig(const SessionConfig& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SessionConfig* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frame_format_){}
+    , decltype(_impl_.result_encoding_){}
+    , decltype(_impl_.compression_){}
+    , decltype(_impl_.protocol_version_){}
+    , decltype(_impl_.result_batch_){}
+    , decltype(_impl_.chunked_frames_){}
+    , decltype(_impl_.chunk_bytes_){}
+    , decltype(_impl_.max_inflight_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.frame_format_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.frame_format_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_frame_format().empty()) {
+    _this->_impl_.frame_format_.Set(from._internal_frame_format(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.result_encoding_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.result_encoding_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_result_encoding().empty()) {
+    _this->_impl_.result_encoding_.Set(from._internal_result_encoding(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.compression_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.compression_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_compression().empty()) {
+    _this->_impl_.compression_.Set(from._internal_compression(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.protocol_version_, &from._impl_.protocol_version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_inflight_) -
+    reinterpret_cast<char*>(&_impl_.protocol_version_)) + sizeof(_impl_.max_inflight_));
+  // @@protoc_insertion_point(copy_constructor:data_types.SessionConfig)
+}
+
+inline void SessionConfig::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frame_format_){}
+    , decltype(_impl_.result_encoding_){}
+    , decltype(_impl_.compression_){}
+    , decltype(_impl_.protocol_version_){0u}
+    , decltype(_impl_.result_batch_){false}
+    , decltype(_impl_.chunked_frames_){false}
+    , decltype(_impl_.chunk_bytes_){0u}
+    , decltype(_impl_.max_inflight_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.frame_format_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.frame_format_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.result_encoding_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.result_encoding_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.compression_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.compression_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SessionConfig::~SessionConfig() {
+  // @@protoc_insertion_point(destructor:data_types.SessionConfig)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SessionConfig::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.frame_format_.Destroy();
+  _impl_.result_encoding_.Destroy();
+  _impl_.compression_.Destroy();
+}
+
+void SessionConfig::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SessionConfig::Clear() {
+// @@protoc_insertion_point(message_clear_start:data_types.SessionConfig)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.frame_format_.ClearToEmpty();
+  _impl_.result_encoding_.ClearToEmpty();
+  _impl_.compression_.ClearToEmpty();
+  ::memset(&_impl_.protocol_version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_inflight_) -
+      reinterpret_cast<char*>(&_impl_.protocol_version_)) + sizeof(_impl_.max_inflight_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SessionConfig::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 protocol_version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.protocol_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string frame_format = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_frame_format();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "data_types.SessionConfig.frame_format"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string result_encoding = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_result_encoding();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "data_types.SessionConfig.result_encoding"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool result_batch = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.result_batch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool chunked_frames = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.chunked_frames_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 chunk_bytes = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.chunk_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 max_inflight = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.max_inflight_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string compression = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_compression();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "data_types.SessionConfig.compression"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SessionConfig::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:data_types.SessionConfig)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 protocol_version = 1;
+  if (this->_internal_protocol_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_protocol_version(), target);
+  }
+
+  // string frame_format = 2;
+  if (!this->_internal_frame_format().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_frame_format().data(), static_cast<int>(this->_internal_frame_format().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "data_types.SessionConfig.frame_format");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_frame_format(), target);
+  }
+
+  // string result_encoding = 3;
+  if (!this->_internal_result_encoding().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_result_encoding().data(), static_cast<int>(this->_internal_result_encoding().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "data_types.SessionConfig.result_encoding");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_result_encoding(), target);
+  }
+
+  // bool result_batch = 4;
+  if (this->_internal_result_batch() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_result_batch(), target);
+  }
+
+  // bool chunked_frames = 5;
+  if (this->_internal_chunked_frames() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_chunked_frames(), target);
+  }
+
+  // uint32 chunk_bytes = 6;
+  if (this->_internal_chunk_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_chunk_bytes(), target);
+  }
+
+  // uint32 max_inflight = 7;
+  if (this->_internal_max_inflight() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_max_inflight(), target);
+  }
+
+  // string compression = 8;
+  if (!this->_internal_compression().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_compression().data(), static_cast<int>(this->_internal_compression().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "data_types.SessionConfig.compression");
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_compression(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:data_types.SessionConfig)
+  return target;
+}
+
+size_t SessionConfig::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:data_types.SessionConfig)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string frame_format = 2;
+  if (!this->_internal_frame_format().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_frame_format());
+  }
+
+  // string result_encoding = 3;
+  if (!this->_internal_result_encoding().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_result_encoding());
+  }
+
+  // string compression = 8;
+  if (!this->_internal_compression().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_compression());
+  }
+
+  // uint32 protocol_version = 1;
+  if (this->_internal_protocol_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_protocol_version());
+  }
+
+  // bool result_batch = 4;
+  if (this->_internal_result_batch() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool chunked_frames = 5;
+  if (this->_internal_chunked_frames() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 chunk_bytes = 6;
+  if (this->_internal_chunk_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_chunk_bytes());
+  }
+
+  // uint32 max_inflight = 7;
+  if (this->_internal_max_inflight() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_max_inflight());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SessionConfig::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SessionConfig::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SessionConfig::GetClassData() const { return &_class_data_; }
+
+
+void SessionConfig::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SessionConfig*>(&to_msg);
+  auto& from = static_cast<const SessionConfig&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:data_types.SessionConfig)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_frame_format().empty()) {
+    _this->_internal_set_frame_format(from._internal_frame_format());
+  }
+  if (!from._internal_result_encoding().empty()) {
+    _this->_internal_set_result_encoding(from._internal_result_encoding());
+  }
+  if (!from._internal_compression().empty()) {
+    _this->_internal_set_compression(from._internal_compression());
+  }
+  if (from._internal_protocol_version() != 0) {
+    _this->_internal_set_protocol_version(from._internal_protocol_version());
+  }
+  if (from._internal_result_batch() != 0) {
+    _this->_internal_set_result_batch(from._internal_result_batch());
+  }
+  if (from._internal_chunked_frames() != 0) {
+    _this->_internal_set_chunked_frames(from._internal_chunked_frames());
+  }
+  if (from._internal_chunk_bytes() != 0) {
+    _this->_internal_set_chunk_bytes(from._internal_chunk_bytes());
+  }
+  if (from._internal_max_inflight() != 0) {
+    _this->_internal_set_max_inflight(from._internal_max_inflight());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SessionConfig::CopyFrom(const SessionConfig& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:data_types.SessionConfig)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SessionConfig::IsInitialized() const {
+  return true;
+}
+
+void SessionConfig::InternalSwap(SessionConfig* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.frame_format_, lhs_arena,
+      &other->_impl_.frame_format_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.result_encoding_, lhs_arena,
+      &other->_impl_.result_encoding_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.compression_, lhs_arena,
+      &other->_impl_.compression_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SessionConfig, _impl_.max_inflight_)
+      + sizeof(SessionConfig::_impl_.max_inflight_)
+      - PROTOBUF_FIELD_OFFSET(SessionConfig, _impl_.protocol_version_)>(
+          reinterpret_cast<char*>(&_impl_.protocol_version_),
+          reinterpret_cast<char*>(&other->_impl_.protocol_version_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SessionConfig::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_data_5ftypes_2eproto_getter, &descriptor_table_data_5ftypes_2eproto_once,
+      file_level_metadata_data_5ftypes_2eproto[7]);
+}
+
+// ===================================================================
+
+class FrameHeader::_Internal {
+ public:
+  static const ::data_types::CameraFrame& frame(const FrameHeader* msg);
+};
+
+const ::data_types::CameraFrame&
+FrameHeader::_Internal::frame(const FrameHeader* msg) {
+  return *msg->_impl_.frame_;
+}
+FrameHeader::FrameHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:data_types.FrameHeader)
+}
+FrameHeader::FrameHeader(const FrameHeader& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FrameHeader* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frame_){nullptr}
+    , decltype(_impl_.total_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_frame()) {
+    _this->_impl_.frame_ = new ::data_types::CameraFrame(*from._impl_.frame_);
+  }
+  _this->_impl_.total_size_ = from._impl_.total_size_;
+  // @@protoc_insertion_point(copy_constructor:data_types.FrameHeader)
+}
+
+inline void FrameHeader::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frame_){nullptr}
+    , decltype(_impl_.total_size_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+FrameHeader::~FrameHeader() {
+  // @@protoc_insertion_point(destructor:data_types.FrameHeader)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FrameHeader::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.frame_;
+}
+
+void FrameHeader::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FrameHeader::Clear() {
+// @@protoc_insertion_point(message_clear_start:data_types.FrameHeader)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.frame_ != nullptr) {
+    delete _impl_.frame_;
+  }
+  _impl_.frame_ = nullptr;
+  _impl_.total_size_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FrameHeader::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .data_types.CameraFrame frame = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_frame(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 total_size = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.total_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FrameHeader::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:data_types.FrameHeader)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .data_types.CameraFrame frame = 1;
+  if (this->_internal_has_frame()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::frame(this),
+        _Internal::frame(this).GetCachedSize(), target, stream);
+  }
+
+  // uint64 total_size = 2;
+  if (this->_internal_total_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_total_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:data_types.FrameHeader)
+  return target;
 }
 
-void Command::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Command_data_5ftypes_2eproto.base);
-  clear_has_command_type();
-}
+size_t FrameHeader::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:data_types.FrameHeader)
+  size_t total_size = 0;
 
-Command::~Command() {
-  // @@protoc_insertion_point(destructor:data_types.Command)
-  SharedDtor();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .data_types.CameraFrame frame = 1;
+  if (this->_internal_has_frame()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.frame_);
+  }
+
+  // uint64 total_size = 2;
+  if (this->_internal_total_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_total_size());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Command::SharedDtor() {
-  if (has_command_type()) {
-    clear_command_type();
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FrameHeader::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FrameHeader::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FrameHeader::GetClassData() const { return &_class_data_; }
+
+
+void FrameHeader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FrameHeader*>(&to_msg);
+  auto& from = static_cast<const FrameHeader&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:data_types.FrameHeader)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_frame()) {
+    _this->_internal_mutable_frame()->::data_types::CameraFrame::MergeFrom(
+        from._internal_frame());
   }
+  if (from._internal_total_size() != 0) {
+    _this->_internal_set_total_size(from._internal_total_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Command::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void FrameHeader::CopyFrom(const FrameHeader& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:data_types.FrameHeader)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FrameHeader::IsInitialized() const {
+  return true;
 }
-const Command& Command::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Command_data_5ftypes_2eproto.base);
-  return *internal_default_instance();
+
+void FrameHeader::InternalSwap(FrameHeader* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FrameHeader, _impl_.total_size_)
+      + sizeof(FrameHeader::_impl_.total_size_)
+      - PROTOBUF_FIELD_OFFSET(FrameHeader, _impl_.frame_)>(
+          reinterpret_cast<char*>(&_impl_.frame_),
+          reinterpret_cast<char*>(&other->_impl_.frame_));
 }
 
+::PROTOBUF_NAMESPACE_ID::Metadata FrameHeader::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_data_5ftypes_2eproto_getter, &descriptor_table_data_5ftypes_2eproto_once,
+      file_level_metadata_data_5ftypes_2eproto[8]);
+}
 
-void Command::clear_command_type() {
-// @@protoc_insertion_point(one_of_clear_start:data_types.Command)
-  switch (command_type_case()) {
-    case kConfigRequest: {
-      delete command_type_.config_request_;
-      break;
-    }
-    case kControlAction: {
-      delete command_type_.control_action_;
-      break;
-    }
-    case kHeartbeat: {
-      delete command_type_.heartbeat_;
-      break;
-    }
-    case kDetectionResult: {
-      delete command_type_.detection_result_;
-      break;
-    }
-    case kCameraFrame: {
-      delete command_type_.camera_frame_;
-      break;
-    }
-    case COMMAND_TYPE_NOT_SET: {
-      break;
-    }
+// ===================================================================
+
+class FrameChunk::_Internal {
+ public:
+};
+
+FrameChunk::FrameChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:data_types.FrameChunk)
+}
+FrameChunk::FrameChunk(const FrameChunk& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FrameChunk* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.frame_id_){}
+    , decltype(_impl_.offset_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.frame_id_, &from._impl_.frame_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.offset_) -
+    reinterpret_cast<char*>(&_impl_.frame_id_)) + sizeof(_impl_.offset_));
+  // @@protoc_insertion_point(copy_constructor:data_types.FrameChunk)
+}
+
+inline void FrameChunk::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.frame_id_){uint64_t{0u}}
+    , decltype(_impl_.offset_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+FrameChunk::~FrameChunk() {
+  // @@protoc_insertion_point(destructor:data_types.FrameChunk)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  _oneof_case_[0] = COMMAND_TYPE_NOT_SET;
+  SharedDtor();
 }
 
+inline void FrameChunk::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
+}
 
-void Command::Clear() {
-// @@protoc_insertion_point(message_clear_start:data_types.Command)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void FrameChunk::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FrameChunk::Clear() {
+// @@protoc_insertion_point(message_clear_start:data_types.FrameChunk)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  clear_command_type();
-  _internal_metadata_.Clear();
+  _impl_.data_.ClearToEmpty();
+  ::memset(&_impl_.frame_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.offset_) -
+      reinterpret_cast<char*>(&_impl_.frame_id_)) + sizeof(_impl_.offset_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Command::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* FrameChunk::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .data_types.ConfigRequest config_request = 1;
+      // uint64 frame_id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_config_request(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.frame_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // .data_types.ControlAction control_action = 2;
+      // uint64 offset = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_control_action(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // .data_types.Heartbeat heartbeat = 3;
+      // bytes data = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          ptr = ctx->ParseMessage(_internal_mutable_heartbeat(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .data_types.DetectionResult detection_result = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
-          ptr = ctx->ParseMessage(_internal_mutable_detection_result(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .data_types.CameraFrame camera_frame = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
-          ptr = ctx->ParseMessage(_internal_mutable_camera_frame(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Command::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:data_types.Command)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* FrameChunk::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:data_types.FrameChunk)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .data_types.ConfigRequest config_request = 1;
-  if (_internal_has_config_request()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::config_request(this), target, stream);
-  }
-
-  // .data_types.ControlAction control_action = 2;
-  if (_internal_has_control_action()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::control_action(this), target, stream);
-  }
-
-  // .data_types.Heartbeat heartbeat = 3;
-  if (_internal_has_heartbeat()) {
+  // uint64 frame_id = 1;
+  if (this->_internal_frame_id() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        3, _Internal::heartbeat(this), target, stream);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_frame_id(), target);
   }
 
-  // .data_types.DetectionResult detection_result = 4;
-  if (_internal_has_detection_result()) {
+  // uint64 offset = 2;
+  if (this->_internal_offset() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        4, _Internal::detection_result(this), target, stream);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_offset(), target);
   }
 
-  // .data_types.CameraFrame camera_frame = 5;
-  if (_internal_has_camera_frame()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        5, _Internal::camera_frame(this), target, stream);
+  // bytes data = 3;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_data(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:data_types.Command)
+  // @@protoc_insertion_point(serialize_to_array_end:data_types.FrameChunk)
   return target;
 }
 
-size_t Command::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:data_types.Command)
+size_t FrameChunk::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:data_types.FrameChunk)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  switch (command_type_case()) {
-    // .data_types.ConfigRequest config_request = 1;
-    case kConfigRequest: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *command_type_.config_request_);
-      break;
-    }
-    // .data_types.ControlAction control_action = 2;
-    case kControlAction: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *command_type_.control_action_);
-      break;
-    }
-    // .data_types.Heartbeat heartbeat = 3;
-    case kHeartbeat: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *command_type_.heartbeat_);
-      break;
-    }
-    // .data_types.DetectionResult detection_result = 4;
-    case kDetectionResult: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *command_type_.detection_result_);
-      break;
-    }
-    // .data_types.CameraFrame camera_frame = 5;
-    case kCameraFrame: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *command_type_.camera_frame_);
-      break;
-    }
-    case COMMAND_TYPE_NOT_SET: {
-      break;
-    }
+  // bytes data = 3;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+
+  // uint64 frame_id = 1;
+  if (this->_internal_frame_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_frame_id());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void Command::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:data_types.Command)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Command* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Command>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:data_types.Command)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:data_types.Command)
-    MergeFrom(*source);
+  // uint64 offset = 2;
+  if (this->_internal_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_offset());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Command::MergeFrom(const Command& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:data_types.Command)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FrameChunk::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FrameChunk::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FrameChunk::GetClassData() const { return &_class_data_; }
+
+
+void FrameChunk::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FrameChunk*>(&to_msg);
+  auto& from = static_cast<const FrameChunk&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:data_types.FrameChunk)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  switch (from.command_type_case()) {
-    case kConfigRequest: {
-      _internal_mutable_config_request()->::data_types::ConfigRequest::MergeFrom(from._internal_config_request());
-      break;
-    }
-    case kControlAction: {
-      _internal_mutable_control_action()->::data_types::ControlAction::MergeFrom(from._internal_control_action());
-      break;
-    }
-    case kHeartbeat: {
-      _internal_mutable_heartbeat()->::data_types::Heartbeat::MergeFrom(from._internal_heartbeat());
-      break;
-    }
-    case kDetectionResult: {
-      _internal_mutable_detection_result()->::data_types::DetectionResult::MergeFrom(from._internal_detection_result());
-      break;
-    }
-    case kCameraFrame: {
-      _internal_mutable_camera_frame()->::data_types::CameraFrame::MergeFrom(from._internal_camera_frame());
-      break;
-    }
-    case COMMAND_TYPE_NOT_SET: {
-      break;
-    }
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
   }
+  if (from._internal_frame_id() != 0) {
+    _this->_internal_set_frame_id(from._internal_frame_id());
+  }
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Command::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:data_types.Command)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Command::CopyFrom(const Command& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:data_types.Command)
+void FrameChunk::CopyFrom(const FrameChunk& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:data_types.FrameChunk)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Command::IsInitialized() const {
+bool FrameChunk::IsInitialized() const {
   return true;
 }
 
-void Command::InternalSwap(Command* other) {
+void FrameChunk::InternalSwap(FrameChunk* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(command_type_, other->command_type_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Command::GetMetadata() const {
-  return GetMetadataStatic();
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FrameChunk, _impl_.offset_)
+      + sizeof(FrameChunk::_impl_.offset_)
+      - PROTOBUF_FIELD_OFFSET(FrameChunk, _impl_.frame_id_)>(
+          reinterpret_cast<char*>(&_impl_.frame_id_),
+          reinterpret_cast<char*>(&other->_impl_.frame_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FrameChunk::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_data_5ftypes_2eproto_getter, &descriptor_table_data_5ftypes_2eproto_once,
+      file_level_metadata_data_5ftypes_2eproto[9]);
 }
 
-
 // ===================================================================
 
-void ConfigRequest::InitAsDefaultInstance() {
-  ::data_types::_ConfigRequest_default_instance_._instance.get_mutable()->detection_threshold_ = const_cast< PROTOBUF_NAMESPACE_ID::FloatValue*>(
-      PROTOBUF_NAMESPACE_ID::FloatValue::internal_default_instance());
-  ::data_types::_ConfigRequest_default_instance_._instance.get_mutable()->sleep_timeout_sec_ = const_cast< PROTOBUF_NAMESPACE_ID::UInt32Value*>(
-      PROTOBUF_NAMESPACE_ID::UInt32Value::internal_default_instance());
-}
 class ConfigRequest::_Internal {
  public:
-  static const PROTOBUF_NAMESPACE_ID::FloatValue& detection_threshold(const ConfigRequest* msg);
-  static const PROTOBUF_NAMESPACE_ID::UInt32Value& sleep_timeout_sec(const ConfigRequest* msg);
+  static const ::PROTOBUF_NAMESPACE_ID::FloatValue& detection_threshold(const ConfigRequest* msg);
+  static const ::PROTOBUF_NAMESPACE_ID::UInt32Value& sleep_timeout_sec(const ConfigRequest* msg);
 };
 
-const PROTOBUF_NAMESPACE_ID::FloatValue&
+const ::PROTOBUF_NAMESPACE_ID::FloatValue&
 ConfigRequest::_Internal::detection_threshold(const ConfigRequest* msg) {
-  return *msg->detection_threshold_;
+  return *msg->_impl_.detection_threshold_;
 }
-const PROTOBUF_NAMESPACE_ID::UInt32Value&
+const ::PROTOBUF_NAMESPACE_ID::UInt32Value&
 ConfigRequest::_Internal::sleep_timeout_sec(const ConfigRequest* msg) {
-  return *msg->sleep_timeout_sec_;
+  return *msg->_impl_.sleep_timeout_sec_;
 }
 void ConfigRequest::clear_detection_threshold() {
-  if (GetArenaNoVirtual() == nullptr && detection_threshold_ != nullptr) {
-    delete detection_threshold_;
+  if (GetArenaForAllocation() == nullptr && _impl_.detection_threshold_ != nullptr) {
+    delete _impl_.detection_threshold_;
   }
-  detection_threshold_ = nullptr;
+  _impl_.detection_threshold_ = nullptr;
 }
 void ConfigRequest::clear_sleep_timeout_sec() {
-  if (GetArenaNoVirtual() == nullptr && sleep_timeout_sec_ != nullptr) {
-    delete sleep_timeout_sec_;
+  if (GetArenaForAllocation() == nullptr && _impl_.sleep_timeout_sec_ != nullptr) {
+    delete _impl_.sleep_timeout_sec_;
   }
-  sleep_timeout_sec_ = nullptr;
+  _impl_.sleep_timeout_sec_ = nullptr;
 }
-ConfigRequest::ConfigRequest()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:data_types.ConfigRequest)
+ConfigRequest::ConfigRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:data_types.ConfigRequest)
 }
 ConfigRequest::ConfigRequest(const ConfigRequest& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ConfigRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.profile_){}
+    , decltype(_impl_.detection_threshold_){nullptr}
+    , decltype(_impl_.sleep_timeout_sec_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.profile_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.profile_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_profile().empty()) {
+    _this->_impl_.profile_.Set(from._internal_profile(), 
+      _this->GetArenaForAllocation());
+  }
   if (from._internal_has_detection_threshold()) {
-    detection_threshold_ = new PROTOBUF_NAMESPACE_ID::FloatValue(*from.detection_threshold_);
-  } else {
-    detection_threshold_ = nullptr;
+    _this->_impl_.detection_threshold_ = new ::PROTOBUF_NAMESPACE_ID::FloatValue(*from._impl_.detection_threshold_);
   }
   if (from._internal_has_sleep_timeout_sec()) {
-    sleep_timeout_sec_ = new PROTOBUF_NAMESPACE_ID::UInt32Value(*from.sleep_timeout_sec_);
-  } else {
-    sleep_timeout_sec_ = nullptr;
+    _this->_impl_.sleep_timeout_sec_ = new ::PROTOBUF_NAMESPACE_ID::UInt32Value(*from._impl_.sleep_timeout_sec_);
   }
   // @@protoc_insertion_point(copy_constructor:data_types.ConfigRequest)
 }
 
-void ConfigRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ConfigRequest_data_5ftypes_2eproto.base);
-  ::memset(&detection_threshold_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&sleep_timeout_sec_) -
-      reinterpret_cast<char*>(&detection_threshold_)) + sizeof(sleep_timeout_sec_));
+inline void ConfigRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.profile_){}
+    , decltype(_impl_.detection_threshold_){nullptr}
+    , decltype(_impl_.sleep_timeout_sec_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.profile_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.profile_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 ConfigRequest::~ConfigRequest() {
   // @@protoc_insertion_point(destructor:data_types.ConfigRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ConfigRequest::SharedDtor() {
-  if (this != internal_default_instance()) delete detection_threshold_;
-  if (this != internal_default_instance()) delete sleep_timeout_sec_;
+inline void ConfigRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.profile_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.detection_threshold_;
+  if (this != internal_default_instance()) delete _impl_.sleep_timeout_sec_;
 }
 
 void ConfigRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ConfigRequest& ConfigRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ConfigRequest_data_5ftypes_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void ConfigRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:data_types.ConfigRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == nullptr && detection_threshold_ != nullptr) {
-    delete detection_threshold_;
+  _impl_.profile_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.detection_threshold_ != nullptr) {
+    delete _impl_.detection_threshold_;
   }
-  detection_threshold_ = nullptr;
-  if (GetArenaNoVirtual() == nullptr && sleep_timeout_sec_ != nullptr) {
-    delete sleep_timeout_sec_;
+  _impl_.detection_threshold_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.sleep_timeout_sec_ != nullptr) {
+    delete _impl_.sleep_timeout_sec_;
   }
-  sleep_timeout_sec_ = nullptr;
-  _internal_metadata_.Clear();
+  _impl_.sleep_timeout_sec_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ConfigRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ConfigRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .google.protobuf.FloatValue detection_threshold = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ctx->ParseMessage(_internal_mutable_detection_threshold(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .google.protobuf.UInt32Value sleep_timeout_sec = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr = ctx->ParseMessage(_internal_mutable_sleep_timeout_sec(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // string profile = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_profile();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "data_types.ConfigRequest.profile"));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* ConfigRequest::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* ConfigRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:data_types.ConfigRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .google.protobuf.FloatValue detection_threshold = 1;
-  if (this->has_detection_threshold()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_detection_threshold()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::detection_threshold(this), target, stream);
+      InternalWriteMessage(1, _Internal::detection_threshold(this),
+        _Internal::detection_threshold(this).GetCachedSize(), target, stream);
   }
 
   // .google.protobuf.UInt32Value sleep_timeout_sec = 2;
-  if (this->has_sleep_timeout_sec()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_sleep_timeout_sec()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::sleep_timeout_sec(this), target, stream);
+      InternalWriteMessage(2, _Internal::sleep_timeout_sec(this),
+        _Internal::sleep_timeout_sec(this).GetCachedSize(), target, stream);
+  }
+
+  // string profile = 3;
+  if (!this->_internal_profile().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_profile().data(), static_cast<int>(this->_internal_profile().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "data_types.ConfigRequest.profile");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_profile(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:data_types.ConfigRequest)
   return target;
@@ -2426,68 +5168,61 @@ size_t ConfigRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:data_types.ConfigRequest)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // string profile = 3;
+  if (!this->_internal_profile().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_profile());
+  }
+
   // .google.protobuf.FloatValue detection_threshold = 1;
-  if (this->has_detection_threshold()) {
+  if (this->_internal_has_detection_threshold()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *detection_threshold_);
+        *_impl_.detection_threshold_);
   }
 
   // .google.protobuf.UInt32Value sleep_timeout_sec = 2;
-  if (this->has_sleep_timeout_sec()) {
+  if (this->_internal_has_sleep_timeout_sec()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *sleep_timeout_sec_);
+        *_impl_.sleep_timeout_sec_);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ConfigRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:data_types.ConfigRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ConfigRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ConfigRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:data_types.ConfigRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:data_types.ConfigRequest)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConfigRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ConfigRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConfigRequest::GetClassData() const { return &_class_data_; }
 
-void ConfigRequest::MergeFrom(const ConfigRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:data_types.ConfigRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void ConfigRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ConfigRequest*>(&to_msg);
+  auto& from = static_cast<const ConfigRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:data_types.ConfigRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_detection_threshold()) {
-    _internal_mutable_detection_threshold()->PROTOBUF_NAMESPACE_ID::FloatValue::MergeFrom(from._internal_detection_threshold());
+  if (!from._internal_profile().empty()) {
+    _this->_internal_set_profile(from._internal_profile());
   }
-  if (from.has_sleep_timeout_sec()) {
-    _internal_mutable_sleep_timeout_sec()->PROTOBUF_NAMESPACE_ID::UInt32Value::MergeFrom(from._internal_sleep_timeout_sec());
+  if (from._internal_has_detection_threshold()) {
+    _this->_internal_mutable_detection_threshold()->::PROTOBUF_NAMESPACE_ID::FloatValue::MergeFrom(
+        from._internal_detection_threshold());
   }
-}
-
-void ConfigRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:data_types.ConfigRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_has_sleep_timeout_sec()) {
+    _this->_internal_mutable_sleep_timeout_sec()->::PROTOBUF_NAMESPACE_ID::UInt32Value::MergeFrom(
+        from._internal_sleep_timeout_sec());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ConfigRequest::CopyFrom(const ConfigRequest& from) {
@@ -2503,119 +5238,178 @@ bool ConfigRequest::IsInitialized() const {
 
 void ConfigRequest::InternalSwap(ConfigRequest* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(detection_threshold_, other->detection_threshold_);
-  swap(sleep_timeout_sec_, other->sleep_timeout_sec_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.profile_, lhs_arena,
+      &other->_impl_.profile_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ConfigRequest, _impl_.sleep_timeout_sec_)
+      + sizeof(ConfigRequest::_impl_.sleep_timeout_sec_)
+      - PROTOBUF_FIELD_OFFSET(ConfigRequest, _impl_.detection_threshold_)>(
+          reinterpret_cast<char*>(&_impl_.detection_threshold_),
+          reinterpret_cast<char*>(&other->_impl_.detection_threshold_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata ConfigRequest::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_data_5ftypes_2eproto_getter, &descriptor_table_data_5ftypes_2eproto_once,
+      file_level_metadata_data_5ftypes_2eproto[10]);
 }
 
-
 // ===================================================================
 
-void ControlAction::InitAsDefaultInstance() {
-}
 class ControlAction::_Internal {
  public:
 };
 
-ControlAction::ControlAction()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:data_types.ControlAction)
+ControlAction::ControlAction(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:data_types.ControlAction)
 }
 ControlAction::ControlAction(const ControlAction& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  action_ = from.action_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ControlAction* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.profile_){}
+    , decltype(_impl_.action_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.profile_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.profile_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_profile().empty()) {
+    _this->_impl_.profile_.Set(from._internal_profile(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.action_ = from._impl_.action_;
   // @@protoc_insertion_point(copy_constructor:data_types.ControlAction)
 }
 
-void ControlAction::SharedCtor() {
-  action_ = 0;
+inline void ControlAction::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.profile_){}
+    , decltype(_impl_.action_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.profile_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.profile_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 ControlAction::~ControlAction() {
   // @@protoc_insertion_point(destructor:data_types.ControlAction)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ControlAction::SharedDtor() {
+inline void ControlAction::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.profile_.Destroy();
 }
 
 void ControlAction::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ControlAction& ControlAction::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ControlAction_data_5ftypes_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void ControlAction::Clear() {
 // @@protoc_insertion_point(message_clear_start:data_types.ControlAction)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  action_ = 0;
-  _internal_metadata_.Clear();
+  _impl_.profile_.ClearToEmpty();
+  _impl_.action_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ControlAction::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ControlAction::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .data_types.ControlAction.ActionType action = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
           _internal_set_action(static_cast<::data_types::ControlAction_ActionType>(val));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // string profile = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_profile();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "data_types.ControlAction.profile"));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* ControlAction::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* ControlAction::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:data_types.ControlAction)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .data_types.ControlAction.ActionType action = 1;
-  if (this->action() != 0) {
+  if (this->_internal_action() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       1, this->_internal_action(), target);
   }
 
+  // string profile = 2;
+  if (!this->_internal_profile().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_profile().data(), static_cast<int>(this->_internal_profile().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "data_types.ControlAction.profile");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_profile(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:data_types.ControlAction)
   return target;
@@ -2625,57 +5419,48 @@ size_t ControlAction::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:data_types.ControlAction)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .data_types.ControlAction.ActionType action = 1;
-  if (this->action() != 0) {
+  // string profile = 2;
+  if (!this->_internal_profile().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_action());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_profile());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // .data_types.ControlAction.ActionType action = 1;
+  if (this->_internal_action() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_action());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void ControlAction::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:data_types.ControlAction)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ControlAction* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ControlAction>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:data_types.ControlAction)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:data_types.ControlAction)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ControlAction::MergeFrom(const ControlAction& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:data_types.ControlAction)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ControlAction::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ControlAction::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ControlAction::GetClassData() const { return &_class_data_; }
 
-  if (from.action() != 0) {
-    _internal_set_action(from._internal_action());
-  }
-}
 
-void ControlAction::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:data_types.ControlAction)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void ControlAction::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ControlAction*>(&to_msg);
+  auto& from = static_cast<const ControlAction&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:data_types.ControlAction)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_profile().empty()) {
+    _this->_internal_set_profile(from._internal_profile());
+  }
+  if (from._internal_action() != 0) {
+    _this->_internal_set_action(from._internal_action());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ControlAction::CopyFrom(const ControlAction& from) {
@@ -2691,140 +5476,153 @@ bool ControlAction::IsInitialized() const {
 
 void ControlAction::InternalSwap(ControlAction* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(action_, other->action_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.profile_, lhs_arena,
+      &other->_impl_.profile_, rhs_arena
+  );
+  swap(_impl_.action_, other->_impl_.action_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata ControlAction::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_data_5ftypes_2eproto_getter, &descriptor_table_data_5ftypes_2eproto_once,
+      file_level_metadata_data_5ftypes_2eproto[11]);
 }
 
-
 // ===================================================================
 
-void Heartbeat::InitAsDefaultInstance() {
-  ::data_types::_Heartbeat_default_instance_._instance.get_mutable()->timestamp_ = const_cast< PROTOBUF_NAMESPACE_ID::Timestamp*>(
-      PROTOBUF_NAMESPACE_ID::Timestamp::internal_default_instance());
-}
 class Heartbeat::_Internal {
  public:
-  static const PROTOBUF_NAMESPACE_ID::Timestamp& timestamp(const Heartbeat* msg);
+  static const ::PROTOBUF_NAMESPACE_ID::Timestamp& timestamp(const Heartbeat* msg);
 };
 
-const PROTOBUF_NAMESPACE_ID::Timestamp&
+const ::PROTOBUF_NAMESPACE_ID::Timestamp&
 Heartbeat::_Internal::timestamp(const Heartbeat* msg) {
-  return *msg->timestamp_;
+  return *msg->_impl_.timestamp_;
 }
 void Heartbeat::clear_timestamp() {
-  if (GetArenaNoVirtual() == nullptr && timestamp_ != nullptr) {
-    delete timestamp_;
+  if (GetArenaForAllocation() == nullptr && _impl_.timestamp_ != nullptr) {
+    delete _impl_.timestamp_;
   }
-  timestamp_ = nullptr;
+  _impl_.timestamp_ = nullptr;
 }
-Heartbeat::Heartbeat()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:data_types.Heartbeat)
+Heartbeat::Heartbeat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:data_types.Heartbeat)
 }
 Heartbeat::Heartbeat(const Heartbeat& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Heartbeat* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.timestamp_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_timestamp()) {
-    timestamp_ = new PROTOBUF_NAMESPACE_ID::Timestamp(*from.timestamp_);
-  } else {
-    timestamp_ = nullptr;
+    _this->_impl_.timestamp_ = new ::PROTOBUF_NAMESPACE_ID::Timestamp(*from._impl_.timestamp_);
   }
   // @@protoc_insertion_point(copy_constructor:data_types.Heartbeat)
 }
 
-void Heartbeat::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Heartbeat_data_5ftypes_2eproto.base);
-  timestamp_ = nullptr;
+inline void Heartbeat::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.timestamp_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Heartbeat::~Heartbeat() {
   // @@protoc_insertion_point(destructor:data_types.Heartbeat)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Heartbeat::SharedDtor() {
-  if (this != internal_default_instance()) delete timestamp_;
+inline void Heartbeat::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.timestamp_;
 }
 
 void Heartbeat::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Heartbeat& Heartbeat::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Heartbeat_data_5ftypes_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void Heartbeat::Clear() {
 // @@protoc_insertion_point(message_clear_start:data_types.Heartbeat)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == nullptr && timestamp_ != nullptr) {
-    delete timestamp_;
+  if (GetArenaForAllocation() == nullptr && _impl_.timestamp_ != nullptr) {
+    delete _impl_.timestamp_;
   }
-  timestamp_ = nullptr;
-  _internal_metadata_.Clear();
+  _impl_.timestamp_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Heartbeat::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Heartbeat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .google.protobuf.Timestamp timestamp = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ctx->ParseMessage(_internal_mutable_timestamp(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Heartbeat::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Heartbeat::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:data_types.Heartbeat)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .google.protobuf.Timestamp timestamp = 1;
-  if (this->has_timestamp()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_timestamp()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::timestamp(this), target, stream);
+      InternalWriteMessage(1, _Internal::timestamp(this),
+        _Internal::timestamp(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:data_types.Heartbeat)
   return target;
@@ -2834,58 +5632,40 @@ size_t Heartbeat::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:data_types.Heartbeat)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // .google.protobuf.Timestamp timestamp = 1;
-  if (this->has_timestamp()) {
+  if (this->_internal_has_timestamp()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *timestamp_);
+        *_impl_.timestamp_);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Heartbeat::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:data_types.Heartbeat)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Heartbeat* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Heartbeat>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:data_types.Heartbeat)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:data_types.Heartbeat)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Heartbeat::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Heartbeat::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Heartbeat::GetClassData() const { return &_class_data_; }
 
-void Heartbeat::MergeFrom(const Heartbeat& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:data_types.Heartbeat)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void Heartbeat::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Heartbeat*>(&to_msg);
+  auto& from = static_cast<const Heartbeat&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:data_types.Heartbeat)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_timestamp()) {
-    _internal_mutable_timestamp()->PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(from._internal_timestamp());
+  if (from._internal_has_timestamp()) {
+    _this->_internal_mutable_timestamp()->::PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(
+        from._internal_timestamp());
   }
-}
-
-void Heartbeat::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:data_types.Heartbeat)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Heartbeat::CopyFrom(const Heartbeat& from) {
@@ -2901,132 +5681,212 @@ bool Heartbeat::IsInitialized() const {
 
 void Heartbeat::InternalSwap(Heartbeat* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(timestamp_, other->timestamp_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.timestamp_, other->_impl_.timestamp_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Heartbeat::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_data_5ftypes_2eproto_getter, &descriptor_table_data_5ftypes_2eproto_once,
+      file_level_metadata_data_5ftypes_2eproto[12]);
 }
 
-
 // ===================================================================
 
-void ServerMessage::InitAsDefaultInstance() {
-  ::data_types::_ServerMessage_default_instance_.camera_frame_ = const_cast< ::data_types::CameraFrame*>(
-      ::data_types::CameraFrame::internal_default_instance());
-  ::data_types::_ServerMessage_default_instance_.detection_result_ = const_cast< ::data_types::DetectionResult*>(
-      ::data_types::DetectionResult::internal_default_instance());
-  ::data_types::_ServerMessage_default_instance_.device_status_ = const_cast< ::data_types::DeviceStatus*>(
-      ::data_types::DeviceStatus::internal_default_instance());
-  ::data_types::_ServerMessage_default_instance_.config_response_ = const_cast< ::data_types::ConfigResponse*>(
-      ::data_types::ConfigResponse::internal_default_instance());
-}
 class ServerMessage::_Internal {
  public:
   static const ::data_types::CameraFrame& camera_frame(const ServerMessage* msg);
   static const ::data_types::DetectionResult& detection_result(const ServerMessage* msg);
   static const ::data_types::DeviceStatus& device_status(const ServerMessage* msg);
   static const ::data_types::ConfigResponse& config_response(const ServerMessage* msg);
+  static const ::data_types::Heartbeat& heartbeat(const ServerMessage* msg);
+  static const ::data_types::ResultBatch& result_batch(const ServerMessage* msg);
+  static const ::data_types::SessionConfig& session_config(const ServerMessage* msg);
 };
 
 const ::data_types::CameraFrame&
 ServerMessage::_Internal::camera_frame(const ServerMessage* msg) {
-  return *msg->message_type_.camera_frame_;
+  return *msg->_impl_.message_type_.camera_frame_;
 }
 const ::data_types::DetectionResult&
 ServerMessage::_Internal::detection_result(const ServerMessage* msg) {
-  return *msg->message_type_.detection_result_;
+  return *msg->_impl_.message_type_.detection_result_;
 }
 const ::data_types::DeviceStatus&
 ServerMessage::_Internal::device_status(const ServerMessage* msg) {
-  return *msg->message_type_.device_status_;
+  return *msg->_impl_.message_type_.device_status_;
 }
 const ::data_types::ConfigResponse&
 ServerMessage::_Internal::config_response(const ServerMessage* msg) {
-  return *msg->message_type_.config_response_;
+  return *msg->_impl_.message_type_.config_response_;
+}
+const ::data_types::Heartbeat&
+ServerMessage::_Internal::heartbeat(const ServerMessage* msg) {
+  return *msg->_impl_.message_type_.heartbeat_;
+}
+const ::data_types::ResultBatch&
+ServerMessage::_Internal::result_batch(const ServerMessage* msg) {
+  return *msg->_impl_.message_type_.result_batch_;
+}
+const ::data_types::SessionConfig&
+ServerMessage::_Internal::session_config(const ServerMessage* msg) {
+  return *msg->_impl_.message_type_.session_config_;
 }
 void ServerMessage::set_allocated_camera_frame(::data_types::CameraFrame* camera_frame) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_message_type();
   if (camera_frame) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(camera_frame);
     if (message_arena != submessage_arena) {
       camera_frame = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, camera_frame, submessage_arena);
     }
     set_has_camera_frame();
-    message_type_.camera_frame_ = camera_frame;
+    _impl_.message_type_.camera_frame_ = camera_frame;
   }
   // @@protoc_insertion_point(field_set_allocated:data_types.ServerMessage.camera_frame)
 }
 void ServerMessage::set_allocated_detection_result(::data_types::DetectionResult* detection_result) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_message_type();
   if (detection_result) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(detection_result);
     if (message_arena != submessage_arena) {
       detection_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, detection_result, submessage_arena);
     }
     set_has_detection_result();
-    message_type_.detection_result_ = detection_result;
+    _impl_.message_type_.detection_result_ = detection_result;
   }
   // @@protoc_insertion_point(field_set_allocated:data_types.ServerMessage.detection_result)
 }
 void ServerMessage::set_allocated_device_status(::data_types::DeviceStatus* device_status) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_message_type();
   if (device_status) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(device_status);
     if (message_arena != submessage_arena) {
       device_status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, device_status, submessage_arena);
     }
     set_has_device_status();
-    message_type_.device_status_ = device_status;
+    _impl_.message_type_.device_status_ = device_status;
   }
   // @@protoc_insertion_point(field_set_allocated:data_types.ServerMessage.device_status)
 }
 void ServerMessage::set_allocated_config_response(::data_types::ConfigResponse* config_response) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_message_type();
   if (config_response) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(config_response);
     if (message_arena != submessage_arena) {
       config_response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, config_response, submessage_arena);
     }
     set_has_config_response();
-    message_type_.config_response_ = config_response;
+    _impl_.message_type_.config_response_ = config_response;
   }
   // @@protoc_insertion_point(field_set_allocated:data_types.ServerMessage.config_response)
 }
-ServerMessage::ServerMessage()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:data_types.ServerMessage)
+void ServerMessage::set_allocated_heartbeat(::data_types::Heartbeat* heartbeat) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_message_type();
+  if (heartbeat) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(heartbeat);
+    if (message_arena != submessage_arena) {
+      heartbeat = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, heartbeat, submessage_arena);
+    }
+    set_has_heartbeat();
+    _impl_.message_type_.heartbeat_ = heartbeat;
+  }
+  // @@protoc_insertion_point(field_set_allocated:data_types.ServerMessage.heartbeat)
+}
+void ServerMessage::set_allocated_result_batch(::data_types::ResultBatch* result_batch) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_message_type();
+  if (result_batch) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(result_batch);
+    if (message_arena != submessage_arena) {
+      result_batch = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, result_batch, submessage_arena);
+    }
+    set_has_result_batch();
+    _impl_.message_type_.result_batch_ = result_batch;
+  }
+  // @@protoc_insertion_point(field_set_allocated:data_types.ServerMessage.result_batch)
+}
+void ServerMessage::set_allocated_session_config(::data_types::SessionConfig* session_config) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_message_type();
+  if (session_config) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(session_config);
+    if (message_arena != submessage_arena) {
+      session_config = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, session_config, submessage_arena);
+    }
+    set_has_session_config();
+    _impl_.message_type_.session_config_ = session_config;
+  }
+  // @@protoc_insertion_point(field_set_allocated:data_types.ServerMessage.session_config)
+}
+ServerMessage::ServerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:data_types.ServerMessage)
 }
 ServerMessage::ServerMessage(const ServerMessage& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_type_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   clear_has_message_type();
   switch (from.message_type_case()) {
     case kCameraFrame: {
-      _internal_mutable_camera_frame()->::data_types::CameraFrame::MergeFrom(from._internal_camera_frame());
+      _this->_internal_mutable_camera_frame()->::data_types::CameraFrame::MergeFrom(
+          from._internal_camera_frame());
       break;
     }
     case kDetectionResult: {
-      _internal_mutable_detection_result()->::data_types::DetectionResult::MergeFrom(from._internal_detection_result());
+      _this->_internal_mutable_detection_result()->::data_types::DetectionResult::MergeFrom(
+          from._internal_detection_result());
       break;
     }
     case kDeviceStatus: {
-      _internal_mutable_device_status()->::data_types::DeviceStatus::MergeFrom(from._internal_device_status());
+      _this->_internal_mutable_device_status()->::data_types::DeviceStatus::MergeFrom(
+          from._internal_device_status());
       break;
     }
     case kConfigResponse: {
-      _internal_mutable_config_response()->::data_types::ConfigResponse::MergeFrom(from._internal_config_response());
+      _this->_internal_mutable_config_response()->::data_types::ConfigResponse::MergeFrom(
+          from._internal_config_response());
+      break;
+    }
+    case kHeartbeat: {
+      _this->_internal_mutable_heartbeat()->::data_types::Heartbeat::MergeFrom(
+          from._internal_heartbeat());
+      break;
+    }
+    case kResultBatch: {
+      _this->_internal_mutable_result_batch()->::data_types::ResultBatch::MergeFrom(
+          from._internal_result_batch());
+      break;
+    }
+    case kSessionConfig: {
+      _this->_internal_mutable_session_config()->::data_types::SessionConfig::MergeFrom(
+          from._internal_session_config());
       break;
     }
     case MESSAGE_TYPE_NOT_SET: {
@@ -3036,164 +5896,244 @@ ServerMessage::ServerMessage(const ServerMessage& from)
   // @@protoc_insertion_point(copy_constructor:data_types.ServerMessage)
 }
 
-void ServerMessage::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ServerMessage_data_5ftypes_2eproto.base);
+inline void ServerMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_type_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
   clear_has_message_type();
 }
 
 ServerMessage::~ServerMessage() {
   // @@protoc_insertion_point(destructor:data_types.ServerMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ServerMessage::SharedDtor() {
+inline void ServerMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   if (has_message_type()) {
     clear_message_type();
   }
 }
 
 void ServerMessage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ServerMessage& ServerMessage::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ServerMessage_data_5ftypes_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void ServerMessage::clear_message_type() {
 // @@protoc_insertion_point(one_of_clear_start:data_types.ServerMessage)
   switch (message_type_case()) {
     case kCameraFrame: {
-      delete message_type_.camera_frame_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.message_type_.camera_frame_;
+      }
       break;
     }
     case kDetectionResult: {
-      delete message_type_.detection_result_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.message_type_.detection_result_;
+      }
       break;
     }
     case kDeviceStatus: {
-      delete message_type_.device_status_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.message_type_.device_status_;
+      }
       break;
     }
     case kConfigResponse: {
-      delete message_type_.config_response_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.message_type_.config_response_;
+      }
+      break;
+    }
+    case kHeartbeat: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.message_type_.heartbeat_;
+      }
+      break;
+    }
+    case kResultBatch: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.message_type_.result_batch_;
+      }
+      break;
+    }
+    case kSessionConfig: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.message_type_.session_config_;
+      }
       break;
     }
     case MESSAGE_TYPE_NOT_SET: {
       break;
     }
   }
-  _oneof_case_[0] = MESSAGE_TYPE_NOT_SET;
+  _impl_._oneof_case_[0] = MESSAGE_TYPE_NOT_SET;
 }
 
 
 void ServerMessage::Clear() {
 // @@protoc_insertion_point(message_clear_start:data_types.ServerMessage)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   clear_message_type();
-  _internal_metadata_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ServerMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ServerMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .data_types.CameraFrame camera_frame = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ctx->ParseMessage(_internal_mutable_camera_frame(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .data_types.DetectionResult detection_result = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr = ctx->ParseMessage(_internal_mutable_detection_result(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .data_types.DeviceStatus device_status = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           ptr = ctx->ParseMessage(_internal_mutable_device_status(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .data_types.ConfigResponse config_response = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           ptr = ctx->ParseMessage(_internal_mutable_config_response(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // .data_types.Heartbeat heartbeat = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_heartbeat(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // .data_types.ResultBatch result_batch = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_result_batch(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .data_types.SessionConfig session_config = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_session_config(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* ServerMessage::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* ServerMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:data_types.ServerMessage)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .data_types.CameraFrame camera_frame = 1;
   if (_internal_has_camera_frame()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::camera_frame(this), target, stream);
+      InternalWriteMessage(1, _Internal::camera_frame(this),
+        _Internal::camera_frame(this).GetCachedSize(), target, stream);
   }
 
   // .data_types.DetectionResult detection_result = 2;
   if (_internal_has_detection_result()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::detection_result(this), target, stream);
+      InternalWriteMessage(2, _Internal::detection_result(this),
+        _Internal::detection_result(this).GetCachedSize(), target, stream);
   }
 
   // .data_types.DeviceStatus device_status = 3;
   if (_internal_has_device_status()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        3, _Internal::device_status(this), target, stream);
+      InternalWriteMessage(3, _Internal::device_status(this),
+        _Internal::device_status(this).GetCachedSize(), target, stream);
   }
 
   // .data_types.ConfigResponse config_response = 4;
   if (_internal_has_config_response()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        4, _Internal::config_response(this), target, stream);
+      InternalWriteMessage(4, _Internal::config_response(this),
+        _Internal::config_response(this).GetCachedSize(), target, stream);
+  }
+
+  // .data_types.Heartbeat heartbeat = 5;
+  if (_internal_has_heartbeat()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::heartbeat(this),
+        _Internal::heartbeat(this).GetCachedSize(), target, stream);
+  }
+
+  // .data_types.ResultBatch result_batch = 6;
+  if (_internal_has_result_batch()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::result_batch(this),
+        _Internal::result_batch(this).GetCachedSize(), target, stream);
+  }
+
+  // .data_types.SessionConfig session_config = 7;
+  if (_internal_has_session_config()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::session_config(this),
+        _Internal::session_config(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:data_types.ServerMessage)
   return target;
@@ -3203,7 +6143,7 @@ size_t ServerMessage::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:data_types.ServerMessage)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
@@ -3212,93 +6152,114 @@ size_t ServerMessage::ByteSizeLong() const {
     case kCameraFrame: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *message_type_.camera_frame_);
+          *_impl_.message_type_.camera_frame_);
       break;
     }
     // .data_types.DetectionResult detection_result = 2;
     case kDetectionResult: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *message_type_.detection_result_);
+          *_impl_.message_type_.detection_result_);
       break;
     }
     // .data_types.DeviceStatus device_status = 3;
     case kDeviceStatus: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *message_type_.device_status_);
+          *_impl_.message_type_.device_status_);
       break;
     }
     // .data_types.ConfigResponse config_response = 4;
     case kConfigResponse: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *message_type_.config_response_);
+          *_impl_.message_type_.config_response_);
+      break;
+    }
+    // .data_types.Heartbeat heartbeat = 5;
+    case kHeartbeat: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.message_type_.heartbeat_);
+      break;
+    }
+    // .data_types.ResultBatch result_batch = 6;
+    case kResultBatch: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.message_type_.result_batch_);
+      break;
+    }
+    // .data_types.SessionConfig session_config = 7;
+    case kSessionConfig: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.message_type_.session_config_);
       break;
     }
     case MESSAGE_TYPE_NOT_SET: {
       break;
     }
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ServerMessage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:data_types.ServerMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ServerMessage* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ServerMessage>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:data_types.ServerMessage)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:data_types.ServerMessage)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerMessage::GetClassData() const { return &_class_data_; }
+
 
-void ServerMessage::MergeFrom(const ServerMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:data_types.ServerMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void ServerMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerMessage*>(&to_msg);
+  auto& from = static_cast<const ServerMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:data_types.ServerMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   switch (from.message_type_case()) {
     case kCameraFrame: {
-      _internal_mutable_camera_frame()->::data_types::CameraFrame::MergeFrom(from._internal_camera_frame());
+      _this->_internal_mutable_camera_frame()->::data_types::CameraFrame::MergeFrom(
+          from._internal_camera_frame());
       break;
     }
     case kDetectionResult: {
-      _internal_mutable_detection_result()->::data_types::DetectionResult::MergeFrom(from._internal_detection_result());
+      _this->_internal_mutable_detection_result()->::data_types::DetectionResult::MergeFrom(
+          from._internal_detection_result());
       break;
     }
     case kDeviceStatus: {
-      _internal_mutable_device_status()->::data_types::DeviceStatus::MergeFrom(from._internal_device_status());
+      _this->_internal_mutable_device_status()->::data_types::DeviceStatus::MergeFrom(
+          from._internal_device_status());
       break;
     }
     case kConfigResponse: {
-      _internal_mutable_config_response()->::data_types::ConfigResponse::MergeFrom(from._internal_config_response());
+      _this->_internal_mutable_config_response()->::data_types::ConfigResponse::MergeFrom(
+          from._internal_config_response());
+      break;
+    }
+    case kHeartbeat: {
+      _this->_internal_mutable_heartbeat()->::data_types::Heartbeat::MergeFrom(
+          from._internal_heartbeat());
+      break;
+    }
+    case kResultBatch: {
+      _this->_internal_mutable_result_batch()->::data_types::ResultBatch::MergeFrom(
+          from._internal_result_batch());
+      break;
+    }
+    case kSessionConfig: {
+      _this->_internal_mutable_session_config()->::data_types::SessionConfig::MergeFrom(
+          from._internal_session_config());
       break;
     }
     case MESSAGE_TYPE_NOT_SET: {
       break;
     }
   }
-}
-
-void ServerMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:data_types.ServerMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ServerMessage::CopyFrom(const ServerMessage& from) {
@@ -3314,24 +6275,204 @@ bool ServerMessage::IsInitialized() const {
 
 void ServerMessage::InternalSwap(ServerMessage* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(message_type_, other->message_type_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.message_type_, other->_impl_.message_type_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata ServerMessage::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_data_5ftypes_2eproto_getter, &descriptor_table_data_5ftypes_2eproto_once,
+      file_level_metadata_data_5ftypes_2eproto[13]);
 }
 
-
 // ===================================================================
 
-void ClientMessage::InitAsDefaultInstance() {
-  ::data_types::_ClientMessage_default_instance_.device_status_ = const_cast< ::data_types::DeviceStatus*>(
-      ::data_types::DeviceStatus::internal_default_instance());
-  ::data_types::_ClientMessage_default_instance_.config_response_ = const_cast< ::data_types::ConfigResponse*>(
-      ::data_types::ConfigResponse::internal_default_instance());
+class ResultBatch::_Internal {
+ public:
+};
+
+ResultBatch::ResultBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:data_types.ResultBatch)
+}
+ResultBatch::ResultBatch(const ResultBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ResultBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){from._impl_.results_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:data_types.ResultBatch)
+}
+
+inline void ResultBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ResultBatch::~ResultBatch() {
+  // @@protoc_insertion_point(destructor:data_types.ResultBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ResultBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.results_.~RepeatedPtrField();
+}
+
+void ResultBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ResultBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:data_types.ResultBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.results_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ResultBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .data_types.DetectionResult results = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_results(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ResultBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:data_types.ResultBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .data_types.DetectionResult results = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_results_size()); i < n; i++) {
+    const auto& repfield = this->_internal_results(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:data_types.ResultBatch)
+  return target;
+}
+
+size_t ResultBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:data_types.ResultBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .data_types.DetectionResult results = 1;
+  total_size += 1UL * this->_internal_results_size();
+  for (const auto& msg : this->_impl_.results_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResultBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ResultBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResultBatch::GetClassData() const { return &_class_data_; }
+
+
+void ResultBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ResultBatch*>(&to_msg);
+  auto& from = static_cast<const ResultBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:data_types.ResultBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.results_.MergeFrom(from._impl_.results_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ResultBatch::CopyFrom(const ResultBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:data_types.ResultBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ResultBatch::IsInitialized() const {
+  return true;
+}
+
+void ResultBatch::InternalSwap(ResultBatch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.results_.InternalSwap(&other->_impl_.results_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ResultBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_data_5ftypes_2eproto_getter, &descriptor_table_data_5ftypes_2eproto_once,
+      file_level_metadata_data_5ftypes_2eproto[14]);
 }
+
+// ===================================================================
+
 class ClientMessage::_Internal {
  public:
   static const ::data_types::DeviceStatus& device_status(const ClientMessage* msg);
@@ -3340,57 +6481,67 @@ class ClientMessage::_Internal {
 
 const ::data_types::DeviceStatus&
 ClientMessage::_Internal::device_status(const ClientMessage* msg) {
-  return *msg->message_type_.device_status_;
+  return *msg->_impl_.message_type_.device_status_;
 }
 const ::data_types::ConfigResponse&
 ClientMessage::_Internal::config_response(const ClientMessage* msg) {
-  return *msg->message_type_.config_response_;
+  return *msg->_impl_.message_type_.config_response_;
 }
 void ClientMessage::set_allocated_device_status(::data_types::DeviceStatus* device_status) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_message_type();
   if (device_status) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(device_status);
     if (message_arena != submessage_arena) {
       device_status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, device_status, submessage_arena);
     }
     set_has_device_status();
-    message_type_.device_status_ = device_status;
+    _impl_.message_type_.device_status_ = device_status;
   }
   // @@protoc_insertion_point(field_set_allocated:data_types.ClientMessage.device_status)
 }
 void ClientMessage::set_allocated_config_response(::data_types::ConfigResponse* config_response) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_message_type();
   if (config_response) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(config_response);
     if (message_arena != submessage_arena) {
       config_response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, config_response, submessage_arena);
     }
     set_has_config_response();
-    message_type_.config_response_ = config_response;
+    _impl_.message_type_.config_response_ = config_response;
   }
   // @@protoc_insertion_point(field_set_allocated:data_types.ClientMessage.config_response)
 }
-ClientMessage::ClientMessage()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:data_types.ClientMessage)
+ClientMessage::ClientMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:data_types.ClientMessage)
 }
 ClientMessage::ClientMessage(const ClientMessage& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ClientMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_type_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   clear_has_message_type();
   switch (from.message_type_case()) {
     case kDeviceStatus: {
-      _internal_mutable_device_status()->::data_types::DeviceStatus::MergeFrom(from._internal_device_status());
+      _this->_internal_mutable_device_status()->::data_types::DeviceStatus::MergeFrom(
+          from._internal_device_status());
       break;
     }
     case kConfigResponse: {
-      _internal_mutable_config_response()->::data_types::ConfigResponse::MergeFrom(from._internal_config_response());
+      _this->_internal_mutable_config_response()->::data_types::ConfigResponse::MergeFrom(
+          from._internal_config_response());
       break;
     }
     case MESSAGE_TYPE_NOT_SET: {
@@ -3400,126 +6551,139 @@ ClientMessage::ClientMessage(const ClientMessage& from)
   // @@protoc_insertion_point(copy_constructor:data_types.ClientMessage)
 }
 
-void ClientMessage::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ClientMessage_data_5ftypes_2eproto.base);
+inline void ClientMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_type_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
   clear_has_message_type();
 }
 
 ClientMessage::~ClientMessage() {
   // @@protoc_insertion_point(destructor:data_types.ClientMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ClientMessage::SharedDtor() {
+inline void ClientMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   if (has_message_type()) {
     clear_message_type();
   }
 }
 
 void ClientMessage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ClientMessage& ClientMessage::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ClientMessage_data_5ftypes_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void ClientMessage::clear_message_type() {
 // @@protoc_insertion_point(one_of_clear_start:data_types.ClientMessage)
   switch (message_type_case()) {
     case kDeviceStatus: {
-      delete message_type_.device_status_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.message_type_.device_status_;
+      }
       break;
     }
     case kConfigResponse: {
-      delete message_type_.config_response_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.message_type_.config_response_;
+      }
       break;
     }
     case MESSAGE_TYPE_NOT_SET: {
       break;
     }
   }
-  _oneof_case_[0] = MESSAGE_TYPE_NOT_SET;
+  _impl_._oneof_case_[0] = MESSAGE_TYPE_NOT_SET;
 }
 
 
 void ClientMessage::Clear() {
 // @@protoc_insertion_point(message_clear_start:data_types.ClientMessage)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   clear_message_type();
-  _internal_metadata_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ClientMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ClientMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .data_types.DeviceStatus device_status = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ctx->ParseMessage(_internal_mutable_device_status(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .data_types.ConfigResponse config_response = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr = ctx->ParseMessage(_internal_mutable_config_response(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* ClientMessage::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* ClientMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:data_types.ClientMessage)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .data_types.DeviceStatus device_status = 1;
   if (_internal_has_device_status()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::device_status(this), target, stream);
+      InternalWriteMessage(1, _Internal::device_status(this),
+        _Internal::device_status(this).GetCachedSize(), target, stream);
   }
 
   // .data_types.ConfigResponse config_response = 2;
   if (_internal_has_config_response()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::config_response(this), target, stream);
+      InternalWriteMessage(2, _Internal::config_response(this),
+        _Internal::config_response(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:data_types.ClientMessage)
   return target;
@@ -3529,7 +6693,7 @@ size_t ClientMessage::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:data_types.ClientMessage)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
@@ -3538,71 +6702,54 @@ size_t ClientMessage::ByteSizeLong() const {
     case kDeviceStatus: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *message_type_.device_status_);
+          *_impl_.message_type_.device_status_);
       break;
     }
     // .data_types.ConfigResponse config_response = 2;
     case kConfigResponse: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *message_type_.config_response_);
+          *_impl_.message_type_.config_response_);
       break;
     }
     case MESSAGE_TYPE_NOT_SET: {
       break;
     }
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ClientMessage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:data_types.ClientMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ClientMessage* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ClientMessage>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:data_types.ClientMessage)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:data_types.ClientMessage)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClientMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ClientMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClientMessage::GetClassData() const { return &_class_data_; }
 
-void ClientMessage::MergeFrom(const ClientMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:data_types.ClientMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void ClientMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ClientMessage*>(&to_msg);
+  auto& from = static_cast<const ClientMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:data_types.ClientMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   switch (from.message_type_case()) {
     case kDeviceStatus: {
-      _internal_mutable_device_status()->::data_types::DeviceStatus::MergeFrom(from._internal_device_status());
+      _this->_internal_mutable_device_status()->::data_types::DeviceStatus::MergeFrom(
+          from._internal_device_status());
       break;
     }
     case kConfigResponse: {
-      _internal_mutable_config_response()->::data_types::ConfigResponse::MergeFrom(from._internal_config_response());
+      _this->_internal_mutable_config_response()->::data_types::ConfigResponse::MergeFrom(
+          from._internal_config_response());
       break;
     }
     case MESSAGE_TYPE_NOT_SET: {
       break;
     }
   }
-}
-
-void ClientMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:data_types.ClientMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ClientMessage::CopyFrom(const ClientMessage& from) {
@@ -3618,133 +6765,155 @@ bool ClientMessage::IsInitialized() const {
 
 void ClientMessage::InternalSwap(ClientMessage* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(message_type_, other->message_type_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.message_type_, other->_impl_.message_type_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata ClientMessage::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_data_5ftypes_2eproto_getter, &descriptor_table_data_5ftypes_2eproto_once,
+      file_level_metadata_data_5ftypes_2eproto[15]);
 }
 
-
 // ===================================================================
 
-void ConfigResponse::InitAsDefaultInstance() {
-}
 class ConfigResponse::_Internal {
  public:
 };
 
-ConfigResponse::ConfigResponse()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:data_types.ConfigResponse)
+ConfigResponse::ConfigResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:data_types.ConfigResponse)
 }
 ConfigResponse::ConfigResponse(const ConfigResponse& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  message_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ConfigResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){}
+    , decltype(_impl_.success_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_message().empty()) {
-    message_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.message_);
+    _this->_impl_.message_.Set(from._internal_message(), 
+      _this->GetArenaForAllocation());
   }
-  success_ = from.success_;
+  _this->_impl_.success_ = from._impl_.success_;
   // @@protoc_insertion_point(copy_constructor:data_types.ConfigResponse)
 }
 
-void ConfigResponse::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ConfigResponse_data_5ftypes_2eproto.base);
-  message_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  success_ = false;
+inline void ConfigResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){}
+    , decltype(_impl_.success_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 ConfigResponse::~ConfigResponse() {
   // @@protoc_insertion_point(destructor:data_types.ConfigResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ConfigResponse::SharedDtor() {
-  message_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void ConfigResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_.Destroy();
 }
 
 void ConfigResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ConfigResponse& ConfigResponse::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ConfigResponse_data_5ftypes_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void ConfigResponse::Clear() {
 // @@protoc_insertion_point(message_clear_start:data_types.ConfigResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  message_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  success_ = false;
-  _internal_metadata_.Clear();
+  _impl_.message_.ClearToEmpty();
+  _impl_.success_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ConfigResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ConfigResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // bool success = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // string message = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_message();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "data_types.ConfigResponse.message"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+          CHK_(::_pbi::VerifyUTF8(str, "data_types.ConfigResponse.message"));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* ConfigResponse::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* ConfigResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:data_types.ConfigResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bool success = 1;
-  if (this->success() != 0) {
+  if (this->_internal_success() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
   }
 
   // string message = 2;
-  if (this->message().size() > 0) {
+  if (!this->_internal_message().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -3754,8 +6923,8 @@ failure:
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:data_types.ConfigResponse)
   return target;
@@ -3765,67 +6934,47 @@ size_t ConfigResponse::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:data_types.ConfigResponse)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string message = 2;
-  if (this->message().size() > 0) {
+  if (!this->_internal_message().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_message());
   }
 
   // bool success = 1;
-  if (this->success() != 0) {
+  if (this->_internal_success() != 0) {
     total_size += 1 + 1;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ConfigResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:data_types.ConfigResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ConfigResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ConfigResponse>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:data_types.ConfigResponse)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:data_types.ConfigResponse)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConfigResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ConfigResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConfigResponse::GetClassData() const { return &_class_data_; }
 
-void ConfigResponse::MergeFrom(const ConfigResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:data_types.ConfigResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.message().size() > 0) {
+void ConfigResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ConfigResponse*>(&to_msg);
+  auto& from = static_cast<const ConfigResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:data_types.ConfigResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    message_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.message_);
+  if (!from._internal_message().empty()) {
+    _this->_internal_set_message(from._internal_message());
   }
-  if (from.success() != 0) {
-    _internal_set_success(from._internal_success());
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
   }
-}
-
-void ConfigResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:data_types.ConfigResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ConfigResponse::CopyFrom(const ConfigResponse& from) {
@@ -3841,52 +6990,92 @@ bool ConfigResponse::IsInitialized() const {
 
 void ConfigResponse::InternalSwap(ConfigResponse* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  message_.Swap(&other->message_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(success_, other->success_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
+  );
+  swap(_impl_.success_, other->_impl_.success_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata ConfigResponse::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_data_5ftypes_2eproto_getter, &descriptor_table_data_5ftypes_2eproto_once,
+      file_level_metadata_data_5ftypes_2eproto[16]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace data_types
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::data_types::CameraFrame* Arena::CreateMaybeMessage< ::data_types::CameraFrame >(Arena* arena) {
-  return Arena::CreateInternal< ::data_types::CameraFrame >(arena);
+template<> PROTOBUF_NOINLINE ::data_types::CameraFrame*
+Arena::CreateMaybeMessage< ::data_types::CameraFrame >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::data_types::CameraFrame >(arena);
+}
+template<> PROTOBUF_NOINLINE ::data_types::BoundingBox*
+Arena::CreateMaybeMessage< ::data_types::BoundingBox >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::data_types::BoundingBox >(arena);
+}
+template<> PROTOBUF_NOINLINE ::data_types::InstanceMask*
+Arena::CreateMaybeMessage< ::data_types::InstanceMask >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::data_types::InstanceMask >(arena);
+}
+template<> PROTOBUF_NOINLINE ::data_types::DetectionResult*
+Arena::CreateMaybeMessage< ::data_types::DetectionResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::data_types::DetectionResult >(arena);
+}
+template<> PROTOBUF_NOINLINE ::data_types::DeviceStatus*
+Arena::CreateMaybeMessage< ::data_types::DeviceStatus >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::data_types::DeviceStatus >(arena);
+}
+template<> PROTOBUF_NOINLINE ::data_types::Command*
+Arena::CreateMaybeMessage< ::data_types::Command >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::data_types::Command >(arena);
+}
+template<> PROTOBUF_NOINLINE ::data_types::Capabilities*
+Arena::CreateMaybeMessage< ::data_types::Capabilities >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::data_types::Capabilities >(arena);
 }
-template<> PROTOBUF_NOINLINE ::data_types::BoundingBox* Arena::CreateMaybeMessage< ::data_types::BoundingBox >(Arena* arena) {
-  return Arena::CreateInternal< ::data_types::BoundingBox >(arena);
+template<> PROTOBUF_NOINLINE ::data_types::SessionConfig*
+Arena::CreateMaybeMessage< ::data_types::SessionConfig >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::data_types::SessionConfig >(arena);
 }
-template<> PROTOBUF_NOINLINE ::data_types::DetectionResult* Arena::CreateMaybeMessage< ::data_types::DetectionResult >(Arena* arena) {
-  return Arena::CreateInternal< ::data_types::DetectionResult >(arena);
+template<> PROTOBUF_NOINLINE ::data_types::FrameHeader*
+Arena::CreateMaybeMessage< ::data_types::FrameHeader >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::data_types::FrameHeader >(arena);
 }
-template<> PROTOBUF_NOINLINE ::data_types::DeviceStatus* Arena::CreateMaybeMessage< ::data_types::DeviceStatus >(Arena* arena) {
-  return Arena::CreateInternal< ::data_types::DeviceStatus >(arena);
+template<> PROTOBUF_NOINLINE ::data_types::FrameChunk*
+Arena::CreateMaybeMessage< ::data_types::FrameChunk >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::data_types::FrameChunk >(arena);
 }
-template<> PROTOBUF_NOINLINE ::data_types::Command* Arena::CreateMaybeMessage< ::data_types::Command >(Arena* arena) {
-  return Arena::CreateInternal< ::data_types::Command >(arena);
+template<> PROTOBUF_NOINLINE ::data_types::ConfigRequest*
+Arena::CreateMaybeMessage< ::data_types::ConfigRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::data_types::ConfigRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::data_types::ConfigRequest* Arena::CreateMaybeMessage< ::data_types::ConfigRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::data_types::ConfigRequest >(arena);
+template<> PROTOBUF_NOINLINE ::data_types::ControlAction*
+Arena::CreateMaybeMessage< ::data_types::ControlAction >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::data_types::ControlAction >(arena);
 }
-template<> PROTOBUF_NOINLINE ::data_types::ControlAction* Arena::CreateMaybeMessage< ::data_types::ControlAction >(Arena* arena) {
-  return Arena::CreateInternal< ::data_types::ControlAction >(arena);
+template<> PROTOBUF_NOINLINE ::data_types::Heartbeat*
+Arena::CreateMaybeMessage< ::data_types::Heartbeat >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::data_types::Heartbeat >(arena);
 }
-template<> PROTOBUF_NOINLINE ::data_types::Heartbeat* Arena::CreateMaybeMessage< ::data_types::Heartbeat >(Arena* arena) {
-  return Arena::CreateInternal< ::data_types::Heartbeat >(arena);
+template<> PROTOBUF_NOINLINE ::data_types::ServerMessage*
+Arena::CreateMaybeMessage< ::data_types::ServerMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::data_types::ServerMessage >(arena);
 }
-template<> PROTOBUF_NOINLINE ::data_types::ServerMessage* Arena::CreateMaybeMessage< ::data_types::ServerMessage >(Arena* arena) {
-  return Arena::CreateInternal< ::data_types::ServerMessage >(arena);
+template<> PROTOBUF_NOINLINE ::data_types::ResultBatch*
+Arena::CreateMaybeMessage< ::data_types::ResultBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::data_types::ResultBatch >(arena);
 }
-template<> PROTOBUF_NOINLINE ::data_types::ClientMessage* Arena::CreateMaybeMessage< ::data_types::ClientMessage >(Arena* arena) {
-  return Arena::CreateInternal< ::data_types::ClientMessage >(arena);
+template<> PROTOBUF_NOINLINE ::data_types::ClientMessage*
+Arena::CreateMaybeMessage< ::data_types::ClientMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::data_types::ClientMessage >(arena);
 }
-template<> PROTOBUF_NOINLINE ::data_types::ConfigResponse* Arena::CreateMaybeMessage< ::data_types::ConfigResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::data_types::ConfigResponse >(arena);
+template<> PROTOBUF_NOINLINE ::data_types::ConfigResponse*
+Arena::CreateMaybeMessage< ::data_types::ConfigResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::data_types::ConfigResponse >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
 
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3011000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3011000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,10 +23,8 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
@@ -46,55 +44,66 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_data_5ftypes_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[11]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_data_5ftypes_2eproto;
 namespace data_types {
 class BoundingBox;
-class BoundingBoxDefaultTypeInternal;
+struct BoundingBoxDefaultTypeInternal;
 extern BoundingBoxDefaultTypeInternal _BoundingBox_default_instance_;
 class CameraFrame;
-class CameraFrameDefaultTypeInternal;
+struct CameraFrameDefaultTypeInternal;
 extern CameraFrameDefaultTypeInternal _CameraFrame_default_instance_;
+class Capabilities;
+struct CapabilitiesDefaultTypeInternal;
+extern CapabilitiesDefaultTypeInternal _Capabilities_default_instance_;
 class ClientMessage;
-class ClientMessageDefaultTypeInternal;
+struct ClientMessageDefaultTypeInternal;
 extern ClientMessageDefaultTypeInternal _ClientMessage_default_instance_;
 class Command;
-class CommandDefaultTypeInternal;
+struct CommandDefaultTypeInternal;
 extern CommandDefaultTypeInternal _Command_default_instance_;
 class ConfigRequest;
-class ConfigRequestDefaultTypeInternal;
+struct ConfigRequestDefaultTypeInternal;
 extern ConfigRequestDefaultTypeInternal _ConfigRequest_default_instance_;
 class ConfigResponse;
-class ConfigResponseDefaultTypeInternal;
+struct ConfigResponseDefaultTypeInternal;
 extern ConfigResponseDefaultTypeInternal _ConfigResponse_default_instance_;
 class ControlAction;
-class ControlActionDefaultTypeInternal;
+struct ControlActionDefaultTypeInternal;
 extern ControlActionDefaultTypeInternal _ControlAction_default_instance_;
 class DetectionResult;
-class DetectionResultDefaultTypeInternal;
+struct DetectionResultDefaultTypeInternal;
 extern DetectionResultDefaultTypeInternal _DetectionResult_default_instance_;
 class DeviceStatus;
-class DeviceStatusDefaultTypeInternal;
+struct DeviceStatusDefaultTypeInternal;
 extern DeviceStatusDefaultTypeInternal _DeviceStatus_default_instance_;
+class FrameChunk;
+struct FrameChunkDefaultTypeInternal;
+extern FrameChunkDefaultTypeInternal _FrameChunk_default_instance_;
+class FrameHeader;
+struct FrameHeaderDefaultTypeInternal;
+extern FrameHeaderDefaultTypeInternal _FrameHeader_default_instance_;
 class Heartbeat;
-class HeartbeatDefaultTypeInternal;
+struct HeartbeatDefaultTypeInternal;
 extern HeartbeatDefaultTypeInternal _Heartbeat_default_instance_;
+class InstanceMask;
+struct InstanceMaskDefaultTypeInternal;
+extern InstanceMaskDefaultTypeInternal _InstanceMask_default_instance_;
+class ResultBatch;
+struct ResultBatchDefaultTypeInternal;
+extern ResultBatchDefaultTypeInternal _ResultBatch_default_instance_;
 class ServerMessage;
-class ServerMessageDefaultTypeInternal;
+struct ServerMessageDefaultTypeInternal;
 extern ServerMessageDefaultTypeInternal _ServerMessage_default_instance_;
+class SessionConfig;
+struct SessionConfigDefaultTypeInternal;
+extern SessionConfigDefaultTypeInternal _SessionConfig_default_instance_;
 }  // namespace data_types
 PROTOBUF_NAMESPACE_OPEN
 template<> ::data_types::BoundingBox* Arena::CreateMaybeMessage<::data_types::BoundingBox>(Arena*);
 template<> ::data_types::CameraFrame* Arena::CreateMaybeMessage<::data_types::CameraFrame>(Arena*);
+template<> ::data_types::Capabilities* Arena::CreateMaybeMessage<::data_types::Capabilities>(Arena*);
 template<> ::data_types::ClientMessage* Arena::CreateMaybeMessage<::data_types::ClientMessage>(Arena*);
 template<> ::data_types::Command* Arena::CreateMaybeMessage<::data_types::Command>(Arena*);
 template<> ::data_types::ConfigRequest* Arena::CreateMaybeMessage<::data_types::ConfigRequest>(Arena*);
@@ -102,8 +111,13 @@ template<> ::data_types::ConfigResponse* Arena::CreateMaybeMessage<::data_types:
 template<> ::data_types::ControlAction* Arena::CreateMaybeMessage<::data_types::ControlAction>(Arena*);
 template<> ::data_types::DetectionResult* Arena::CreateMaybeMessage<::data_types::DetectionResult>(Arena*);
 template<> ::data_types::DeviceStatus* Arena::CreateMaybeMessage<::data_types::DeviceStatus>(Arena*);
+template<> ::data_types::FrameChunk* Arena::CreateMaybeMessage<::data_types::FrameChunk>(Arena*);
+template<> ::data_types::FrameHeader* Arena::CreateMaybeMessage<::data_types::FrameHeader>(Arena*);
 template<> ::data_types::Heartbeat* Arena::CreateMaybeMessage<::data_types::Heartbeat>(Arena*);
+template<> ::data_types::InstanceMask* Arena::CreateMaybeMessage<::data_types::InstanceMask>(Arena*);
+template<> ::data_types::ResultBatch* Arena::CreateMaybeMessage<::data_types::ResultBatch>(Arena*);
 template<> ::data_types::ServerMessage* Arena::CreateMaybeMessage<::data_types::ServerMessage>(Arena*);
+template<> ::data_types::SessionConfig* Arena::CreateMaybeMessage<::data_types::SessionConfig>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace data_types {
 
@@ -112,8 +126,8 @@ enum DeviceStatus_ConnectionState : int {
   DeviceStatus_ConnectionState_BLE_PAIRING = 1,
   DeviceStatus_ConnectionState_WLAN_CONNECTED = 2,
   DeviceStatus_ConnectionState_GRPC_READY = 3,
-  DeviceStatus_ConnectionState_DeviceStatus_ConnectionState_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  DeviceStatus_ConnectionState_DeviceStatus_ConnectionState_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  DeviceStatus_ConnectionState_DeviceStatus_ConnectionState_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  DeviceStatus_ConnectionState_DeviceStatus_ConnectionState_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool DeviceStatus_ConnectionState_IsValid(int value);
 constexpr DeviceStatus_ConnectionState DeviceStatus_ConnectionState_ConnectionState_MIN = DeviceStatus_ConnectionState_DISCONNECTED;
@@ -130,7 +144,7 @@ inline const std::string& DeviceStatus_ConnectionState_Name(T enum_t_value) {
     DeviceStatus_ConnectionState_descriptor(), enum_t_value);
 }
 inline bool DeviceStatus_ConnectionState_Parse(
-    const std::string& name, DeviceStatus_ConnectionState* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, DeviceStatus_ConnectionState* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<DeviceStatus_ConnectionState>(
     DeviceStatus_ConnectionState_descriptor(), name, value);
 }
@@ -138,12 +152,13 @@ enum ControlAction_ActionType : int {
   ControlAction_ActionType_REBOOT = 0,
   ControlAction_ActionType_START_STREAMING = 1,
   ControlAction_ActionType_STOP_STREAMING = 2,
-  ControlAction_ActionType_ControlAction_ActionType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  ControlAction_ActionType_ControlAction_ActionType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  ControlAction_ActionType_SET_PROFILE = 3,
+  ControlAction_ActionType_ControlAction_ActionType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  ControlAction_ActionType_ControlAction_ActionType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool ControlAction_ActionType_IsValid(int value);
 constexpr ControlAction_ActionType ControlAction_ActionType_ActionType_MIN = ControlAction_ActionType_REBOOT;
-constexpr ControlAction_ActionType ControlAction_ActionType_ActionType_MAX = ControlAction_ActionType_STOP_STREAMING;
+constexpr ControlAction_ActionType ControlAction_ActionType_ActionType_MAX = ControlAction_ActionType_SET_PROFILE;
 constexpr int ControlAction_ActionType_ActionType_ARRAYSIZE = ControlAction_ActionType_ActionType_MAX + 1;
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ControlAction_ActionType_descriptor();
@@ -156,17 +171,18 @@ inline const std::string& ControlAction_ActionType_Name(T enum_t_value) {
     ControlAction_ActionType_descriptor(), enum_t_value);
 }
 inline bool ControlAction_ActionType_Parse(
-    const std::string& name, ControlAction_ActionType* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ControlAction_ActionType* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ControlAction_ActionType>(
     ControlAction_ActionType_descriptor(), name, value);
 }
 // ===================================================================
 
-class CameraFrame :
+class CameraFrame final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.CameraFrame) */ {
  public:
-  CameraFrame();
-  virtual ~CameraFrame();
+  inline CameraFrame() : CameraFrame(nullptr) {}
+  ~CameraFrame() override;
+  explicit PROTOBUF_CONSTEXPR CameraFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   CameraFrame(const CameraFrame& from);
   CameraFrame(CameraFrame&& from) noexcept
@@ -179,8 +195,13 @@ class CameraFrame :
     return *this;
   }
   inline CameraFrame& operator=(CameraFrame&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -191,14 +212,14 @@ class CameraFrame :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CameraFrame& default_instance() {
+    return *internal_default_instance();
   }
-  static const CameraFrame& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const CameraFrame* internal_default_instance() {
     return reinterpret_cast<const CameraFrame*>(
                &_CameraFrame_default_instance_);
@@ -211,57 +232,66 @@ class CameraFrame :
   }
   inline void Swap(CameraFrame* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CameraFrame* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline CameraFrame* New() const final {
-    return CreateMaybeMessage<CameraFrame>(nullptr);
-  }
-
-  CameraFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  CameraFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<CameraFrame>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const CameraFrame& from);
-  void MergeFrom(const CameraFrame& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CameraFrame& from) {
+    CameraFrame::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(CameraFrame* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "data_types.CameraFrame";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit CameraFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_data_5ftypes_2eproto);
-    return ::descriptor_table_data_5ftypes_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -273,36 +303,35 @@ class CameraFrame :
     kTimestampFieldNumber = 4,
     kWidthFieldNumber = 2,
     kHeightFieldNumber = 3,
+    kFrameIdFieldNumber = 6,
+    kLowPriorityFieldNumber = 7,
+    kCameraIdFieldNumber = 8,
   };
   // bytes image_data = 1;
   void clear_image_data();
   const std::string& image_data() const;
-  void set_image_data(const std::string& value);
-  void set_image_data(std::string&& value);
-  void set_image_data(const char* value);
-  void set_image_data(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_image_data(ArgT0&& arg0, ArgT... args);
   std::string* mutable_image_data();
-  std::string* release_image_data();
+  PROTOBUF_NODISCARD std::string* release_image_data();
   void set_allocated_image_data(std::string* image_data);
   private:
   const std::string& _internal_image_data() const;
-  void _internal_set_image_data(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_image_data(const std::string& value);
   std::string* _internal_mutable_image_data();
   public:
 
   // string format = 5;
   void clear_format();
   const std::string& format() const;
-  void set_format(const std::string& value);
-  void set_format(std::string&& value);
-  void set_format(const char* value);
-  void set_format(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_format(ArgT0&& arg0, ArgT... args);
   std::string* mutable_format();
-  std::string* release_format();
+  PROTOBUF_NODISCARD std::string* release_format();
   void set_allocated_format(std::string* format);
   private:
   const std::string& _internal_format() const;
-  void _internal_set_format(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_format(const std::string& value);
   std::string* _internal_mutable_format();
   public:
 
@@ -312,53 +341,92 @@ class CameraFrame :
   bool _internal_has_timestamp() const;
   public:
   void clear_timestamp();
-  const PROTOBUF_NAMESPACE_ID::Timestamp& timestamp() const;
-  PROTOBUF_NAMESPACE_ID::Timestamp* release_timestamp();
-  PROTOBUF_NAMESPACE_ID::Timestamp* mutable_timestamp();
-  void set_allocated_timestamp(PROTOBUF_NAMESPACE_ID::Timestamp* timestamp);
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp& timestamp() const;
+  PROTOBUF_NODISCARD ::PROTOBUF_NAMESPACE_ID::Timestamp* release_timestamp();
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* mutable_timestamp();
+  void set_allocated_timestamp(::PROTOBUF_NAMESPACE_ID::Timestamp* timestamp);
   private:
-  const PROTOBUF_NAMESPACE_ID::Timestamp& _internal_timestamp() const;
-  PROTOBUF_NAMESPACE_ID::Timestamp* _internal_mutable_timestamp();
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp& _internal_timestamp() const;
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* _internal_mutable_timestamp();
   public:
+  void unsafe_arena_set_allocated_timestamp(
+      ::PROTOBUF_NAMESPACE_ID::Timestamp* timestamp);
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* unsafe_arena_release_timestamp();
 
   // uint32 width = 2;
   void clear_width();
-  ::PROTOBUF_NAMESPACE_ID::uint32 width() const;
-  void set_width(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t width() const;
+  void set_width(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_width() const;
-  void _internal_set_width(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_width() const;
+  void _internal_set_width(uint32_t value);
   public:
 
   // uint32 height = 3;
   void clear_height();
-  ::PROTOBUF_NAMESPACE_ID::uint32 height() const;
-  void set_height(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t height() const;
+  void set_height(uint32_t value);
+  private:
+  uint32_t _internal_height() const;
+  void _internal_set_height(uint32_t value);
+  public:
+
+  // uint64 frame_id = 6;
+  void clear_frame_id();
+  uint64_t frame_id() const;
+  void set_frame_id(uint64_t value);
+  private:
+  uint64_t _internal_frame_id() const;
+  void _internal_set_frame_id(uint64_t value);
+  public:
+
+  // bool low_priority = 7;
+  void clear_low_priority();
+  bool low_priority() const;
+  void set_low_priority(bool value);
+  private:
+  bool _internal_low_priority() const;
+  void _internal_set_low_priority(bool value);
+  public:
+
+  // uint32 camera_id = 8;
+  void clear_camera_id();
+  uint32_t camera_id() const;
+  void set_camera_id(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_height() const;
-  void _internal_set_height(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_camera_id() const;
+  void _internal_set_camera_id(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:data_types.CameraFrame)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr image_data_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr format_;
-  PROTOBUF_NAMESPACE_ID::Timestamp* timestamp_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 width_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 height_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr image_data_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr format_;
+    ::PROTOBUF_NAMESPACE_ID::Timestamp* timestamp_;
+    uint32_t width_;
+    uint32_t height_;
+    uint64_t frame_id_;
+    bool low_priority_;
+    uint32_t camera_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_data_5ftypes_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BoundingBox :
+class BoundingBox final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.BoundingBox) */ {
  public:
-  BoundingBox();
-  virtual ~BoundingBox();
+  inline BoundingBox() : BoundingBox(nullptr) {}
+  ~BoundingBox() override;
+  explicit PROTOBUF_CONSTEXPR BoundingBox(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   BoundingBox(const BoundingBox& from);
   BoundingBox(BoundingBox&& from) noexcept
@@ -371,8 +439,13 @@ class BoundingBox :
     return *this;
   }
   inline BoundingBox& operator=(BoundingBox&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -383,14 +456,14 @@ class BoundingBox :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BoundingBox& default_instance() {
+    return *internal_default_instance();
   }
-  static const BoundingBox& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const BoundingBox* internal_default_instance() {
     return reinterpret_cast<const BoundingBox*>(
                &_BoundingBox_default_instance_);
@@ -403,57 +476,66 @@ class BoundingBox :
   }
   inline void Swap(BoundingBox* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BoundingBox* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline BoundingBox* New() const final {
-    return CreateMaybeMessage<BoundingBox>(nullptr);
-  }
-
-  BoundingBox* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  BoundingBox* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<BoundingBox>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const BoundingBox& from);
-  void MergeFrom(const BoundingBox& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BoundingBox& from) {
+    BoundingBox::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(BoundingBox* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "data_types.BoundingBox";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit BoundingBox(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_data_5ftypes_2eproto);
-    return ::descriptor_table_data_5ftypes_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -470,53 +552,51 @@ class BoundingBox :
   // string label = 5;
   void clear_label();
   const std::string& label() const;
-  void set_label(const std::string& value);
-  void set_label(std::string&& value);
-  void set_label(const char* value);
-  void set_label(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_label(ArgT0&& arg0, ArgT... args);
   std::string* mutable_label();
-  std::string* release_label();
+  PROTOBUF_NODISCARD std::string* release_label();
   void set_allocated_label(std::string* label);
   private:
   const std::string& _internal_label() const;
-  void _internal_set_label(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_label(const std::string& value);
   std::string* _internal_mutable_label();
   public:
 
   // uint32 x_min = 1;
   void clear_x_min();
-  ::PROTOBUF_NAMESPACE_ID::uint32 x_min() const;
-  void set_x_min(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t x_min() const;
+  void set_x_min(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_x_min() const;
-  void _internal_set_x_min(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_x_min() const;
+  void _internal_set_x_min(uint32_t value);
   public:
 
   // uint32 y_min = 2;
   void clear_y_min();
-  ::PROTOBUF_NAMESPACE_ID::uint32 y_min() const;
-  void set_y_min(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t y_min() const;
+  void set_y_min(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_y_min() const;
-  void _internal_set_y_min(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_y_min() const;
+  void _internal_set_y_min(uint32_t value);
   public:
 
   // uint32 x_max = 3;
   void clear_x_max();
-  ::PROTOBUF_NAMESPACE_ID::uint32 x_max() const;
-  void set_x_max(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t x_max() const;
+  void set_x_max(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_x_max() const;
-  void _internal_set_x_max(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_x_max() const;
+  void _internal_set_x_max(uint32_t value);
   public:
 
   // uint32 y_max = 4;
   void clear_y_max();
-  ::PROTOBUF_NAMESPACE_ID::uint32 y_max() const;
-  void set_y_max(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t y_max() const;
+  void set_y_max(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_y_max() const;
-  void _internal_set_y_max(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_y_max() const;
+  void _internal_set_y_max(uint32_t value);
   public:
 
   // float confidence = 6;
@@ -532,23 +612,295 @@ class BoundingBox :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr label_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 x_min_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 y_min_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 x_max_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 y_max_;
-  float confidence_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr label_;
+    uint32_t x_min_;
+    uint32_t y_min_;
+    uint32_t x_max_;
+    uint32_t y_max_;
+    float confidence_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_data_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class InstanceMask final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.InstanceMask) */ {
+ public:
+  inline InstanceMask() : InstanceMask(nullptr) {}
+  ~InstanceMask() override;
+  explicit PROTOBUF_CONSTEXPR InstanceMask(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  InstanceMask(const InstanceMask& from);
+  InstanceMask(InstanceMask&& from) noexcept
+    : InstanceMask() {
+    *this = ::std::move(from);
+  }
+
+  inline InstanceMask& operator=(const InstanceMask& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InstanceMask& operator=(InstanceMask&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InstanceMask& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InstanceMask* internal_default_instance() {
+    return reinterpret_cast<const InstanceMask*>(
+               &_InstanceMask_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(InstanceMask& a, InstanceMask& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InstanceMask* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InstanceMask* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InstanceMask* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InstanceMask>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const InstanceMask& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InstanceMask& from) {
+    InstanceMask::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(InstanceMask* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "data_types.InstanceMask";
+  }
+  protected:
+  explicit InstanceMask(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCountsFieldNumber = 8,
+    kLabelFieldNumber = 9,
+    kDetectionIndexFieldNumber = 1,
+    kXMinFieldNumber = 2,
+    kYMinFieldNumber = 3,
+    kXMaxFieldNumber = 4,
+    kYMaxFieldNumber = 5,
+    kWidthFieldNumber = 6,
+    kHeightFieldNumber = 7,
+    kScoreFieldNumber = 10,
+  };
+  // repeated uint32 counts = 8;
+  int counts_size() const;
+  private:
+  int _internal_counts_size() const;
+  public:
+  void clear_counts();
+  private:
+  uint32_t _internal_counts(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_counts() const;
+  void _internal_add_counts(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_counts();
+  public:
+  uint32_t counts(int index) const;
+  void set_counts(int index, uint32_t value);
+  void add_counts(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      counts() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_counts();
+
+  // string label = 9;
+  void clear_label();
+  const std::string& label() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_label(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_label();
+  PROTOBUF_NODISCARD std::string* release_label();
+  void set_allocated_label(std::string* label);
+  private:
+  const std::string& _internal_label() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_label(const std::string& value);
+  std::string* _internal_mutable_label();
+  public:
+
+  // uint32 detection_index = 1;
+  void clear_detection_index();
+  uint32_t detection_index() const;
+  void set_detection_index(uint32_t value);
+  private:
+  uint32_t _internal_detection_index() const;
+  void _internal_set_detection_index(uint32_t value);
+  public:
+
+  // float x_min = 2;
+  void clear_x_min();
+  float x_min() const;
+  void set_x_min(float value);
+  private:
+  float _internal_x_min() const;
+  void _internal_set_x_min(float value);
+  public:
+
+  // float y_min = 3;
+  void clear_y_min();
+  float y_min() const;
+  void set_y_min(float value);
+  private:
+  float _internal_y_min() const;
+  void _internal_set_y_min(float value);
+  public:
+
+  // float x_max = 4;
+  void clear_x_max();
+  float x_max() const;
+  void set_x_max(float value);
+  private:
+  float _internal_x_max() const;
+  void _internal_set_x_max(float value);
+  public:
+
+  // float y_max = 5;
+  void clear_y_max();
+  float y_max() const;
+  void set_y_max(float value);
+  private:
+  float _internal_y_max() const;
+  void _internal_set_y_max(float value);
+  public:
+
+  // uint32 width = 6;
+  void clear_width();
+  uint32_t width() const;
+  void set_width(uint32_t value);
+  private:
+  uint32_t _internal_width() const;
+  void _internal_set_width(uint32_t value);
+  public:
+
+  // uint32 height = 7;
+  void clear_height();
+  uint32_t height() const;
+  void set_height(uint32_t value);
+  private:
+  uint32_t _internal_height() const;
+  void _internal_set_height(uint32_t value);
+  public:
+
+  // float score = 10;
+  void clear_score();
+  float score() const;
+  void set_score(float value);
+  private:
+  float _internal_score() const;
+  void _internal_set_score(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:data_types.InstanceMask)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > counts_;
+    mutable std::atomic<int> _counts_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr label_;
+    uint32_t detection_index_;
+    float x_min_;
+    float y_min_;
+    float x_max_;
+    float y_max_;
+    uint32_t width_;
+    uint32_t height_;
+    float score_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_data_5ftypes_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DetectionResult :
+class DetectionResult final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.DetectionResult) */ {
  public:
-  DetectionResult();
-  virtual ~DetectionResult();
+  inline DetectionResult() : DetectionResult(nullptr) {}
+  ~DetectionResult() override;
+  explicit PROTOBUF_CONSTEXPR DetectionResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DetectionResult(const DetectionResult& from);
   DetectionResult(DetectionResult&& from) noexcept
@@ -561,8 +913,13 @@ class DetectionResult :
     return *this;
   }
   inline DetectionResult& operator=(DetectionResult&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -573,134 +930,208 @@ class DetectionResult :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DetectionResult& default_instance() {
+    return *internal_default_instance();
   }
-  static const DetectionResult& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const DetectionResult* internal_default_instance() {
     return reinterpret_cast<const DetectionResult*>(
                &_DetectionResult_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    3;
 
   friend void swap(DetectionResult& a, DetectionResult& b) {
     a.Swap(&b);
   }
   inline void Swap(DetectionResult* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DetectionResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline DetectionResult* New() const final {
-    return CreateMaybeMessage<DetectionResult>(nullptr);
-  }
-
-  DetectionResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  DetectionResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<DetectionResult>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DetectionResult& from);
-  void MergeFrom(const DetectionResult& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DetectionResult& from) {
+    DetectionResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(DetectionResult* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "data_types.DetectionResult";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit DetectionResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_data_5ftypes_2eproto);
-    return ::descriptor_table_data_5ftypes_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
+    kMasksFieldNumber = 4,
     kJsonFieldNumber = 2,
+    kBackendFieldNumber = 5,
     kFrameTimestampFieldNumber = 1,
+    kFrameIdFieldNumber = 3,
+    kCameraIdFieldNumber = 6,
   };
+  // repeated .data_types.InstanceMask masks = 4;
+  int masks_size() const;
+  private:
+  int _internal_masks_size() const;
+  public:
+  void clear_masks();
+  ::data_types::InstanceMask* mutable_masks(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::data_types::InstanceMask >*
+      mutable_masks();
+  private:
+  const ::data_types::InstanceMask& _internal_masks(int index) const;
+  ::data_types::InstanceMask* _internal_add_masks();
+  public:
+  const ::data_types::InstanceMask& masks(int index) const;
+  ::data_types::InstanceMask* add_masks();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::data_types::InstanceMask >&
+      masks() const;
+
   // string json = 2;
   void clear_json();
   const std::string& json() const;
-  void set_json(const std::string& value);
-  void set_json(std::string&& value);
-  void set_json(const char* value);
-  void set_json(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_json(ArgT0&& arg0, ArgT... args);
   std::string* mutable_json();
-  std::string* release_json();
+  PROTOBUF_NODISCARD std::string* release_json();
   void set_allocated_json(std::string* json);
   private:
   const std::string& _internal_json() const;
-  void _internal_set_json(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_json(const std::string& value);
   std::string* _internal_mutable_json();
   public:
 
+  // string backend = 5;
+  void clear_backend();
+  const std::string& backend() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_backend(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_backend();
+  PROTOBUF_NODISCARD std::string* release_backend();
+  void set_allocated_backend(std::string* backend);
+  private:
+  const std::string& _internal_backend() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_backend(const std::string& value);
+  std::string* _internal_mutable_backend();
+  public:
+
   // .google.protobuf.Timestamp frame_timestamp = 1;
   bool has_frame_timestamp() const;
   private:
   bool _internal_has_frame_timestamp() const;
   public:
   void clear_frame_timestamp();
-  const PROTOBUF_NAMESPACE_ID::Timestamp& frame_timestamp() const;
-  PROTOBUF_NAMESPACE_ID::Timestamp* release_frame_timestamp();
-  PROTOBUF_NAMESPACE_ID::Timestamp* mutable_frame_timestamp();
-  void set_allocated_frame_timestamp(PROTOBUF_NAMESPACE_ID::Timestamp* frame_timestamp);
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp& frame_timestamp() const;
+  PROTOBUF_NODISCARD ::PROTOBUF_NAMESPACE_ID::Timestamp* release_frame_timestamp();
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* mutable_frame_timestamp();
+  void set_allocated_frame_timestamp(::PROTOBUF_NAMESPACE_ID::Timestamp* frame_timestamp);
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp& _internal_frame_timestamp() const;
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* _internal_mutable_frame_timestamp();
+  public:
+  void unsafe_arena_set_allocated_frame_timestamp(
+      ::PROTOBUF_NAMESPACE_ID::Timestamp* frame_timestamp);
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* unsafe_arena_release_frame_timestamp();
+
+  // uint64 frame_id = 3;
+  void clear_frame_id();
+  uint64_t frame_id() const;
+  void set_frame_id(uint64_t value);
+  private:
+  uint64_t _internal_frame_id() const;
+  void _internal_set_frame_id(uint64_t value);
+  public:
+
+  // uint32 camera_id = 6;
+  void clear_camera_id();
+  uint32_t camera_id() const;
+  void set_camera_id(uint32_t value);
   private:
-  const PROTOBUF_NAMESPACE_ID::Timestamp& _internal_frame_timestamp() const;
-  PROTOBUF_NAMESPACE_ID::Timestamp* _internal_mutable_frame_timestamp();
+  uint32_t _internal_camera_id() const;
+  void _internal_set_camera_id(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:data_types.DetectionResult)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr json_;
-  PROTOBUF_NAMESPACE_ID::Timestamp* frame_timestamp_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::data_types::InstanceMask > masks_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr json_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr backend_;
+    ::PROTOBUF_NAMESPACE_ID::Timestamp* frame_timestamp_;
+    uint64_t frame_id_;
+    uint32_t camera_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_data_5ftypes_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DeviceStatus :
+class DeviceStatus final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.DeviceStatus) */ {
  public:
-  DeviceStatus();
-  virtual ~DeviceStatus();
+  inline DeviceStatus() : DeviceStatus(nullptr) {}
+  ~DeviceStatus() override;
+  explicit PROTOBUF_CONSTEXPR DeviceStatus(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DeviceStatus(const DeviceStatus& from);
   DeviceStatus(DeviceStatus&& from) noexcept
@@ -713,8 +1144,13 @@ class DeviceStatus :
     return *this;
   }
   inline DeviceStatus& operator=(DeviceStatus&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -725,77 +1161,86 @@ class DeviceStatus :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeviceStatus& default_instance() {
+    return *internal_default_instance();
   }
-  static const DeviceStatus& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const DeviceStatus* internal_default_instance() {
     return reinterpret_cast<const DeviceStatus*>(
                &_DeviceStatus_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    4;
 
   friend void swap(DeviceStatus& a, DeviceStatus& b) {
     a.Swap(&b);
   }
   inline void Swap(DeviceStatus* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DeviceStatus* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline DeviceStatus* New() const final {
-    return CreateMaybeMessage<DeviceStatus>(nullptr);
-  }
-
-  DeviceStatus* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  DeviceStatus* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<DeviceStatus>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DeviceStatus& from);
-  void MergeFrom(const DeviceStatus& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DeviceStatus& from) {
+    DeviceStatus::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(DeviceStatus* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "data_types.DeviceStatus";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit DeviceStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_data_5ftypes_2eproto);
-    return ::descriptor_table_data_5ftypes_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -828,7 +1273,7 @@ class DeviceStatus :
       "Incorrect type passed to function ConnectionState_Name.");
     return DeviceStatus_ConnectionState_Name(enum_t_value);
   }
-  static inline bool ConnectionState_Parse(const std::string& name,
+  static inline bool ConnectionState_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       ConnectionState* value) {
     return DeviceStatus_ConnectionState_Parse(name, value);
   }
@@ -838,44 +1283,74 @@ class DeviceStatus :
   enum : int {
     kDeviceIdFieldNumber = 1,
     kFirmwareVersionFieldNumber = 6,
+    kProfileFieldNumber = 8,
+    kProfileReasonFieldNumber = 10,
     kStateFieldNumber = 2,
     kCpuTemperatureCFieldNumber = 3,
     kFrameRateFpsFieldNumber = 4,
     kProcessingLatencyMsFieldNumber = 5,
     kIsSleepingFieldNumber = 7,
+    kProfileAutoFieldNumber = 9,
+    kBatteryPercentFieldNumber = 11,
+    kActiveStreamsFieldNumber = 12,
+    kJpegQualityFieldNumber = 13,
   };
   // string device_id = 1;
   void clear_device_id();
   const std::string& device_id() const;
-  void set_device_id(const std::string& value);
-  void set_device_id(std::string&& value);
-  void set_device_id(const char* value);
-  void set_device_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_device_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_device_id();
-  std::string* release_device_id();
+  PROTOBUF_NODISCARD std::string* release_device_id();
   void set_allocated_device_id(std::string* device_id);
   private:
   const std::string& _internal_device_id() const;
-  void _internal_set_device_id(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_device_id(const std::string& value);
   std::string* _internal_mutable_device_id();
   public:
 
   // string firmware_version = 6;
   void clear_firmware_version();
   const std::string& firmware_version() const;
-  void set_firmware_version(const std::string& value);
-  void set_firmware_version(std::string&& value);
-  void set_firmware_version(const char* value);
-  void set_firmware_version(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_firmware_version(ArgT0&& arg0, ArgT... args);
   std::string* mutable_firmware_version();
-  std::string* release_firmware_version();
+  PROTOBUF_NODISCARD std::string* release_firmware_version();
   void set_allocated_firmware_version(std::string* firmware_version);
   private:
   const std::string& _internal_firmware_version() const;
-  void _internal_set_firmware_version(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_firmware_version(const std::string& value);
   std::string* _internal_mutable_firmware_version();
   public:
 
+  // string profile = 8;
+  void clear_profile();
+  const std::string& profile() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_profile(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_profile();
+  PROTOBUF_NODISCARD std::string* release_profile();
+  void set_allocated_profile(std::string* profile);
+  private:
+  const std::string& _internal_profile() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_profile(const std::string& value);
+  std::string* _internal_mutable_profile();
+  public:
+
+  // string profile_reason = 10;
+  void clear_profile_reason();
+  const std::string& profile_reason() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_profile_reason(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_profile_reason();
+  PROTOBUF_NODISCARD std::string* release_profile_reason();
+  void set_allocated_profile_reason(std::string* profile_reason);
+  private:
+  const std::string& _internal_profile_reason() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_profile_reason(const std::string& value);
+  std::string* _internal_mutable_profile_reason();
+  public:
+
   // .data_types.DeviceStatus.ConnectionState state = 2;
   void clear_state();
   ::data_types::DeviceStatus_ConnectionState state() const;
@@ -896,20 +1371,20 @@ class DeviceStatus :
 
   // uint32 frame_rate_fps = 4;
   void clear_frame_rate_fps();
-  ::PROTOBUF_NAMESPACE_ID::uint32 frame_rate_fps() const;
-  void set_frame_rate_fps(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t frame_rate_fps() const;
+  void set_frame_rate_fps(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_frame_rate_fps() const;
-  void _internal_set_frame_rate_fps(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_frame_rate_fps() const;
+  void _internal_set_frame_rate_fps(uint32_t value);
   public:
 
   // uint32 processing_latency_ms = 5;
   void clear_processing_latency_ms();
-  ::PROTOBUF_NAMESPACE_ID::uint32 processing_latency_ms() const;
-  void set_processing_latency_ms(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t processing_latency_ms() const;
+  void set_processing_latency_ms(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_processing_latency_ms() const;
-  void _internal_set_processing_latency_ms(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_processing_latency_ms() const;
+  void _internal_set_processing_latency_ms(uint32_t value);
   public:
 
   // bool is_sleeping = 7;
@@ -921,28 +1396,76 @@ class DeviceStatus :
   void _internal_set_is_sleeping(bool value);
   public:
 
+  // bool profile_auto = 9;
+  void clear_profile_auto();
+  bool profile_auto() const;
+  void set_profile_auto(bool value);
+  private:
+  bool _internal_profile_auto() const;
+  void _internal_set_profile_auto(bool value);
+  public:
+
+  // float battery_percent = 11;
+  void clear_battery_percent();
+  float battery_percent() const;
+  void set_battery_percent(float value);
+  private:
+  float _internal_battery_percent() const;
+  void _internal_set_battery_percent(float value);
+  public:
+
+  // uint32 active_streams = 12;
+  void clear_active_streams();
+  uint32_t active_streams() const;
+  void set_active_streams(uint32_t value);
+  private:
+  uint32_t _internal_active_streams() const;
+  void _internal_set_active_streams(uint32_t value);
+  public:
+
+  // uint32 jpeg_quality = 13;
+  void clear_jpeg_quality();
+  uint32_t jpeg_quality() const;
+  void set_jpeg_quality(uint32_t value);
+  private:
+  uint32_t _internal_jpeg_quality() const;
+  void _internal_set_jpeg_quality(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:data_types.DeviceStatus)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr device_id_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr firmware_version_;
-  int state_;
-  float cpu_temperature_c_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 frame_rate_fps_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 processing_latency_ms_;
-  bool is_sleeping_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr device_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr firmware_version_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr profile_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr profile_reason_;
+    int state_;
+    float cpu_temperature_c_;
+    uint32_t frame_rate_fps_;
+    uint32_t processing_latency_ms_;
+    bool is_sleeping_;
+    bool profile_auto_;
+    float battery_percent_;
+    uint32_t active_streams_;
+    uint32_t jpeg_quality_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_data_5ftypes_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Command :
+class Command final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.Command) */ {
  public:
-  Command();
-  virtual ~Command();
+  inline Command() : Command(nullptr) {}
+  ~Command() override;
+  explicit PROTOBUF_CONSTEXPR Command(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Command(const Command& from);
   Command(Command&& from) noexcept
@@ -955,8 +1478,13 @@ class Command :
     return *this;
   }
   inline Command& operator=(Command&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -967,86 +1495,98 @@ class Command :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Command& default_instance() {
+    return *internal_default_instance();
   }
-  static const Command& default_instance();
-
   enum CommandTypeCase {
     kConfigRequest = 1,
     kControlAction = 2,
     kHeartbeat = 3,
     kDetectionResult = 4,
     kCameraFrame = 5,
+    kFrameHeader = 6,
+    kFrameChunk = 7,
+    kHello = 8,
     COMMAND_TYPE_NOT_SET = 0,
   };
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const Command* internal_default_instance() {
     return reinterpret_cast<const Command*>(
                &_Command_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    5;
 
   friend void swap(Command& a, Command& b) {
     a.Swap(&b);
   }
   inline void Swap(Command* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Command* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Command* New() const final {
-    return CreateMaybeMessage<Command>(nullptr);
-  }
-
-  Command* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Command* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Command>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Command& from);
-  void MergeFrom(const Command& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Command& from) {
+    Command::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Command* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "data_types.Command";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit Command(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_data_5ftypes_2eproto);
-    return ::descriptor_table_data_5ftypes_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1058,6 +1598,9 @@ class Command :
     kHeartbeatFieldNumber = 3,
     kDetectionResultFieldNumber = 4,
     kCameraFrameFieldNumber = 5,
+    kFrameHeaderFieldNumber = 6,
+    kFrameChunkFieldNumber = 7,
+    kHelloFieldNumber = 8,
   };
   // .data_types.ConfigRequest config_request = 1;
   bool has_config_request() const;
@@ -1066,13 +1609,16 @@ class Command :
   public:
   void clear_config_request();
   const ::data_types::ConfigRequest& config_request() const;
-  ::data_types::ConfigRequest* release_config_request();
+  PROTOBUF_NODISCARD ::data_types::ConfigRequest* release_config_request();
   ::data_types::ConfigRequest* mutable_config_request();
   void set_allocated_config_request(::data_types::ConfigRequest* config_request);
   private:
   const ::data_types::ConfigRequest& _internal_config_request() const;
   ::data_types::ConfigRequest* _internal_mutable_config_request();
   public:
+  void unsafe_arena_set_allocated_config_request(
+      ::data_types::ConfigRequest* config_request);
+  ::data_types::ConfigRequest* unsafe_arena_release_config_request();
 
   // .data_types.ControlAction control_action = 2;
   bool has_control_action() const;
@@ -1081,13 +1627,16 @@ class Command :
   public:
   void clear_control_action();
   const ::data_types::ControlAction& control_action() const;
-  ::data_types::ControlAction* release_control_action();
+  PROTOBUF_NODISCARD ::data_types::ControlAction* release_control_action();
   ::data_types::ControlAction* mutable_control_action();
   void set_allocated_control_action(::data_types::ControlAction* control_action);
   private:
   const ::data_types::ControlAction& _internal_control_action() const;
   ::data_types::ControlAction* _internal_mutable_control_action();
   public:
+  void unsafe_arena_set_allocated_control_action(
+      ::data_types::ControlAction* control_action);
+  ::data_types::ControlAction* unsafe_arena_release_control_action();
 
   // .data_types.Heartbeat heartbeat = 3;
   bool has_heartbeat() const;
@@ -1096,13 +1645,16 @@ class Command :
   public:
   void clear_heartbeat();
   const ::data_types::Heartbeat& heartbeat() const;
-  ::data_types::Heartbeat* release_heartbeat();
+  PROTOBUF_NODISCARD ::data_types::Heartbeat* release_heartbeat();
   ::data_types::Heartbeat* mutable_heartbeat();
   void set_allocated_heartbeat(::data_types::Heartbeat* heartbeat);
   private:
   const ::data_types::Heartbeat& _internal_heartbeat() const;
   ::data_types::Heartbeat* _internal_mutable_heartbeat();
   public:
+  void unsafe_arena_set_allocated_heartbeat(
+      ::data_types::Heartbeat* heartbeat);
+  ::data_types::Heartbeat* unsafe_arena_release_heartbeat();
 
   // .data_types.DetectionResult detection_result = 4;
   bool has_detection_result() const;
@@ -1111,13 +1663,16 @@ class Command :
   public:
   void clear_detection_result();
   const ::data_types::DetectionResult& detection_result() const;
-  ::data_types::DetectionResult* release_detection_result();
+  PROTOBUF_NODISCARD ::data_types::DetectionResult* release_detection_result();
   ::data_types::DetectionResult* mutable_detection_result();
   void set_allocated_detection_result(::data_types::DetectionResult* detection_result);
   private:
   const ::data_types::DetectionResult& _internal_detection_result() const;
   ::data_types::DetectionResult* _internal_mutable_detection_result();
   public:
+  void unsafe_arena_set_allocated_detection_result(
+      ::data_types::DetectionResult* detection_result);
+  ::data_types::DetectionResult* unsafe_arena_release_detection_result();
 
   // .data_types.CameraFrame camera_frame = 5;
   bool has_camera_frame() const;
@@ -1126,13 +1681,70 @@ class Command :
   public:
   void clear_camera_frame();
   const ::data_types::CameraFrame& camera_frame() const;
-  ::data_types::CameraFrame* release_camera_frame();
+  PROTOBUF_NODISCARD ::data_types::CameraFrame* release_camera_frame();
   ::data_types::CameraFrame* mutable_camera_frame();
   void set_allocated_camera_frame(::data_types::CameraFrame* camera_frame);
   private:
   const ::data_types::CameraFrame& _internal_camera_frame() const;
   ::data_types::CameraFrame* _internal_mutable_camera_frame();
   public:
+  void unsafe_arena_set_allocated_camera_frame(
+      ::data_types::CameraFrame* camera_frame);
+  ::data_types::CameraFrame* unsafe_arena_release_camera_frame();
+
+  // .data_types.FrameHeader frame_header = 6;
+  bool has_frame_header() const;
+  private:
+  bool _internal_has_frame_header() const;
+  public:
+  void clear_frame_header();
+  const ::data_types::FrameHeader& frame_header() const;
+  PROTOBUF_NODISCARD ::data_types::FrameHeader* release_frame_header();
+  ::data_types::FrameHeader* mutable_frame_header();
+  void set_allocated_frame_header(::data_types::FrameHeader* frame_header);
+  private:
+  const ::data_types::FrameHeader& _internal_frame_header() const;
+  ::data_types::FrameHeader* _internal_mutable_frame_header();
+  public:
+  void unsafe_arena_set_allocated_frame_header(
+      ::data_types::FrameHeader* frame_header);
+  ::data_types::FrameHeader* unsafe_arena_release_frame_header();
+
+  // .data_types.FrameChunk frame_chunk = 7;
+  bool has_frame_chunk() const;
+  private:
+  bool _internal_has_frame_chunk() const;
+  public:
+  void clear_frame_chunk();
+  const ::data_types::FrameChunk& frame_chunk() const;
+  PROTOBUF_NODISCARD ::data_types::FrameChunk* release_frame_chunk();
+  ::data_types::FrameChunk* mutable_frame_chunk();
+  void set_allocated_frame_chunk(::data_types::FrameChunk* frame_chunk);
+  private:
+  const ::data_types::FrameChunk& _internal_frame_chunk() const;
+  ::data_types::FrameChunk* _internal_mutable_frame_chunk();
+  public:
+  void unsafe_arena_set_allocated_frame_chunk(
+      ::data_types::FrameChunk* frame_chunk);
+  ::data_types::FrameChunk* unsafe_arena_release_frame_chunk();
+
+  // .data_types.Capabilities hello = 8;
+  bool has_hello() const;
+  private:
+  bool _internal_has_hello() const;
+  public:
+  void clear_hello();
+  const ::data_types::Capabilities& hello() const;
+  PROTOBUF_NODISCARD ::data_types::Capabilities* release_hello();
+  ::data_types::Capabilities* mutable_hello();
+  void set_allocated_hello(::data_types::Capabilities* hello);
+  private:
+  const ::data_types::Capabilities& _internal_hello() const;
+  ::data_types::Capabilities* _internal_mutable_hello();
+  public:
+  void unsafe_arena_set_allocated_hello(
+      ::data_types::Capabilities* hello);
+  ::data_types::Capabilities* unsafe_arena_release_hello();
 
   void clear_command_type();
   CommandTypeCase command_type_case() const;
@@ -1144,45 +1756,63 @@ class Command :
   void set_has_heartbeat();
   void set_has_detection_result();
   void set_has_camera_frame();
+  void set_has_frame_header();
+  void set_has_frame_chunk();
+  void set_has_hello();
 
   inline bool has_command_type() const;
   inline void clear_has_command_type();
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  union CommandTypeUnion {
-    CommandTypeUnion() {}
-    ::data_types::ConfigRequest* config_request_;
-    ::data_types::ControlAction* control_action_;
-    ::data_types::Heartbeat* heartbeat_;
-    ::data_types::DetectionResult* detection_result_;
-    ::data_types::CameraFrame* camera_frame_;
-  } command_type_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union CommandTypeUnion {
+      constexpr CommandTypeUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::data_types::ConfigRequest* config_request_;
+      ::data_types::ControlAction* control_action_;
+      ::data_types::Heartbeat* heartbeat_;
+      ::data_types::DetectionResult* detection_result_;
+      ::data_types::CameraFrame* camera_frame_;
+      ::data_types::FrameHeader* frame_header_;
+      ::data_types::FrameChunk* frame_chunk_;
+      ::data_types::Capabilities* hello_;
+    } command_type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
 
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_data_5ftypes_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ConfigRequest :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.ConfigRequest) */ {
+class Capabilities final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.Capabilities) */ {
  public:
-  ConfigRequest();
-  virtual ~ConfigRequest();
+  inline Capabilities() : Capabilities(nullptr) {}
+  ~Capabilities() override;
+  explicit PROTOBUF_CONSTEXPR Capabilities(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ConfigRequest(const ConfigRequest& from);
-  ConfigRequest(ConfigRequest&& from) noexcept
-    : ConfigRequest() {
+  Capabilities(const Capabilities& from);
+  Capabilities(Capabilities&& from) noexcept
+    : Capabilities() {
     *this = ::std::move(from);
   }
 
-  inline ConfigRequest& operator=(const ConfigRequest& from) {
+  inline Capabilities& operator=(const Capabilities& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ConfigRequest& operator=(ConfigRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline Capabilities& operator=(Capabilities&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1193,147 +1823,266 @@ class ConfigRequest :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const ConfigRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const ConfigRequest* internal_default_instance() {
-    return reinterpret_cast<const ConfigRequest*>(
-               &_ConfigRequest_default_instance_);
+  static const Capabilities& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Capabilities* internal_default_instance() {
+    return reinterpret_cast<const Capabilities*>(
+               &_Capabilities_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    6;
 
-  friend void swap(ConfigRequest& a, ConfigRequest& b) {
+  friend void swap(Capabilities& a, Capabilities& b) {
     a.Swap(&b);
   }
-  inline void Swap(ConfigRequest* other) {
+  inline void Swap(Capabilities* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Capabilities* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ConfigRequest* New() const final {
-    return CreateMaybeMessage<ConfigRequest>(nullptr);
+  Capabilities* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Capabilities>(arena);
   }
-
-  ConfigRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<ConfigRequest>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Capabilities& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Capabilities& from) {
+    Capabilities::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const ConfigRequest& from);
-  void MergeFrom(const ConfigRequest& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ConfigRequest* other);
+  void InternalSwap(Capabilities* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "data_types.ConfigRequest";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "data_types.Capabilities";
   }
+  protected:
+  explicit Capabilities(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_data_5ftypes_2eproto);
-    return ::descriptor_table_data_5ftypes_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kDetectionThresholdFieldNumber = 1,
-    kSleepTimeoutSecFieldNumber = 2,
+    kFrameFormatsFieldNumber = 2,
+    kResultEncodingsFieldNumber = 3,
+    kCompressionFieldNumber = 8,
+    kProtocolVersionFieldNumber = 1,
+    kResultBatchFieldNumber = 4,
+    kChunkedFramesFieldNumber = 5,
+    kMaxChunkBytesFieldNumber = 6,
+    kMaxInflightFieldNumber = 7,
   };
-  // .google.protobuf.FloatValue detection_threshold = 1;
-  bool has_detection_threshold() const;
+  // repeated string frame_formats = 2;
+  int frame_formats_size() const;
   private:
-  bool _internal_has_detection_threshold() const;
+  int _internal_frame_formats_size() const;
   public:
-  void clear_detection_threshold();
-  const PROTOBUF_NAMESPACE_ID::FloatValue& detection_threshold() const;
-  PROTOBUF_NAMESPACE_ID::FloatValue* release_detection_threshold();
-  PROTOBUF_NAMESPACE_ID::FloatValue* mutable_detection_threshold();
-  void set_allocated_detection_threshold(PROTOBUF_NAMESPACE_ID::FloatValue* detection_threshold);
+  void clear_frame_formats();
+  const std::string& frame_formats(int index) const;
+  std::string* mutable_frame_formats(int index);
+  void set_frame_formats(int index, const std::string& value);
+  void set_frame_formats(int index, std::string&& value);
+  void set_frame_formats(int index, const char* value);
+  void set_frame_formats(int index, const char* value, size_t size);
+  std::string* add_frame_formats();
+  void add_frame_formats(const std::string& value);
+  void add_frame_formats(std::string&& value);
+  void add_frame_formats(const char* value);
+  void add_frame_formats(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& frame_formats() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_frame_formats();
   private:
-  const PROTOBUF_NAMESPACE_ID::FloatValue& _internal_detection_threshold() const;
-  PROTOBUF_NAMESPACE_ID::FloatValue* _internal_mutable_detection_threshold();
+  const std::string& _internal_frame_formats(int index) const;
+  std::string* _internal_add_frame_formats();
   public:
 
-  // .google.protobuf.UInt32Value sleep_timeout_sec = 2;
-  bool has_sleep_timeout_sec() const;
+  // repeated string result_encodings = 3;
+  int result_encodings_size() const;
   private:
-  bool _internal_has_sleep_timeout_sec() const;
+  int _internal_result_encodings_size() const;
   public:
-  void clear_sleep_timeout_sec();
-  const PROTOBUF_NAMESPACE_ID::UInt32Value& sleep_timeout_sec() const;
-  PROTOBUF_NAMESPACE_ID::UInt32Value* release_sleep_timeout_sec();
-  PROTOBUF_NAMESPACE_ID::UInt32Value* mutable_sleep_timeout_sec();
-  void set_allocated_sleep_timeout_sec(PROTOBUF_NAMESPACE_ID::UInt32Value* sleep_timeout_sec);
+  void clear_result_encodings();
+  const std::string& result_encodings(int index) const;
+  std::string* mutable_result_encodings(int index);
+  void set_result_encodings(int index, const std::string& value);
+  void set_result_encodings(int index, std::string&& value);
+  void set_result_encodings(int index, const char* value);
+  void set_result_encodings(int index, const char* value, size_t size);
+  std::string* add_result_encodings();
+  void add_result_encodings(const std::string& value);
+  void add_result_encodings(std::string&& value);
+  void add_result_encodings(const char* value);
+  void add_result_encodings(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& result_encodings() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_result_encodings();
   private:
-  const PROTOBUF_NAMESPACE_ID::UInt32Value& _internal_sleep_timeout_sec() const;
-  PROTOBUF_NAMESPACE_ID::UInt32Value* _internal_mutable_sleep_timeout_sec();
+  const std::string& _internal_result_encodings(int index) const;
+  std::string* _internal_add_result_encodings();
   public:
 
-  // @@protoc_insertion_point(class_scope:data_types.ConfigRequest)
+  // repeated string compression = 8;
+  int compression_size() const;
+  private:
+  int _internal_compression_size() const;
+  public:
+  void clear_compression();
+  const std::string& compression(int index) const;
+  std::string* mutable_compression(int index);
+  void set_compression(int index, const std::string& value);
+  void set_compression(int index, std::string&& value);
+  void set_compression(int index, const char* value);
+  void set_compression(int index, const char* value, size_t size);
+  std::string* add_compression();
+  void add_compression(const std::string& value);
+  void add_compression(std::string&& value);
+  void add_compression(const char* value);
+  void add_compression(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& compression() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_compression();
+  private:
+  const std::string& _internal_compression(int index) const;
+  std::string* _internal_add_compression();
+  public:
+
+  // uint32 protocol_version = 1;
+  void clear_protocol_version();
+  uint32_t protocol_version() const;
+  void set_protocol_version(uint32_t value);
+  private:
+  uint32_t _internal_protocol_version() const;
+  void _internal_set_protocol_version(uint32_t value);
+  public:
+
+  // bool result_batch = 4;
+  void clear_result_batch();
+  bool result_batch() const;
+  void set_result_batch(bool value);
+  private:
+  bool _internal_result_batch() const;
+  void _internal_set_result_batch(bool value);
+  public:
+
+  // bool chunked_frames = 5;
+  void clear_chunked_frames();
+  bool chunked_frames() const;
+  void set_chunked_frames(bool value);
+  private:
+  bool _internal_chunked_frames() const;
+  void _internal_set_chunked_frames(bool value);
+  public:
+
+  // uint32 max_chunk_bytes = 6;
+  void clear_max_chunk_bytes();
+  uint32_t max_chunk_bytes() const;
+  void set_max_chunk_bytes(uint32_t value);
+  private:
+  uint32_t _internal_max_chunk_bytes() const;
+  void _internal_set_max_chunk_bytes(uint32_t value);
+  public:
+
+  // uint32 max_inflight = 7;
+  void clear_max_inflight();
+  uint32_t max_inflight() const;
+  void set_max_inflight(uint32_t value);
+  private:
+  uint32_t _internal_max_inflight() const;
+  void _internal_set_max_inflight(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:data_types.Capabilities)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  PROTOBUF_NAMESPACE_ID::FloatValue* detection_threshold_;
-  PROTOBUF_NAMESPACE_ID::UInt32Value* sleep_timeout_sec_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> frame_formats_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> result_encodings_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> compression_;
+    uint32_t protocol_version_;
+    bool result_batch_;
+    bool chunked_frames_;
+    uint32_t max_chunk_bytes_;
+    uint32_t max_inflight_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_data_5ftypes_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ControlAction :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.ControlAction) */ {
+class SessionConfig final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.SessionConfig) */ {
  public:
-  ControlAction();
-  virtual ~ControlAction();
+  inline SessionConfig() : SessionConfig(nullptr) {}
+  ~SessionConfig() override;
+  explicit PROTOBUF_CONSTEXPR SessionConfig(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ControlAction(const ControlAction& from);
-  ControlAction(ControlAction&& from) noexcept
-    : ControlAction() {
+  SessionConfig(const SessionConfig& from);
+  SessionConfig(SessionConfig&& from) noexcept
+    : SessionConfig() {
     *this = ::std::move(from);
   }
 
-  inline ControlAction& operator=(const ControlAction& from) {
+  inline SessionConfig& operator=(const SessionConfig& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ControlAction& operator=(ControlAction&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline SessionConfig& operator=(SessionConfig&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1344,156 +2093,236 @@ class ControlAction :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const ControlAction& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const ControlAction* internal_default_instance() {
-    return reinterpret_cast<const ControlAction*>(
-               &_ControlAction_default_instance_);
+  static const SessionConfig& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SessionConfig* internal_default_instance() {
+    return reinterpret_cast<const SessionConfig*>(
+               &_SessionConfig_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    7;
 
-  friend void swap(ControlAction& a, ControlAction& b) {
+  friend void swap(SessionConfig& a, SessionConfig& b) {
     a.Swap(&b);
   }
-  inline void Swap(ControlAction* other) {
+  inline void Swap(SessionConfig* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SessionConfig* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ControlAction* New() const final {
-    return CreateMaybeMessage<ControlAction>(nullptr);
+  SessionConfig* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SessionConfig>(arena);
   }
-
-  ControlAction* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<ControlAction>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SessionConfig& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SessionConfig& from) {
+    SessionConfig::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const ControlAction& from);
-  void MergeFrom(const ControlAction& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ControlAction* other);
+  void InternalSwap(SessionConfig* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "data_types.ControlAction";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "data_types.SessionConfig";
   }
+  protected:
+  explicit SessionConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_data_5ftypes_2eproto);
-    return ::descriptor_table_data_5ftypes_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
-  typedef ControlAction_ActionType ActionType;
-  static constexpr ActionType REBOOT =
-    ControlAction_ActionType_REBOOT;
-  static constexpr ActionType START_STREAMING =
-    ControlAction_ActionType_START_STREAMING;
-  static constexpr ActionType STOP_STREAMING =
-    ControlAction_ActionType_STOP_STREAMING;
-  static inline bool ActionType_IsValid(int value) {
-    return ControlAction_ActionType_IsValid(value);
-  }
-  static constexpr ActionType ActionType_MIN =
-    ControlAction_ActionType_ActionType_MIN;
-  static constexpr ActionType ActionType_MAX =
-    ControlAction_ActionType_ActionType_MAX;
-  static constexpr int ActionType_ARRAYSIZE =
-    ControlAction_ActionType_ActionType_ARRAYSIZE;
-  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
-  ActionType_descriptor() {
-    return ControlAction_ActionType_descriptor();
-  }
-  template<typename T>
-  static inline const std::string& ActionType_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, ActionType>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function ActionType_Name.");
-    return ControlAction_ActionType_Name(enum_t_value);
-  }
-  static inline bool ActionType_Parse(const std::string& name,
-      ActionType* value) {
-    return ControlAction_ActionType_Parse(name, value);
-  }
-
   // accessors -------------------------------------------------------
 
   enum : int {
-    kActionFieldNumber = 1,
+    kFrameFormatFieldNumber = 2,
+    kResultEncodingFieldNumber = 3,
+    kCompressionFieldNumber = 8,
+    kProtocolVersionFieldNumber = 1,
+    kResultBatchFieldNumber = 4,
+    kChunkedFramesFieldNumber = 5,
+    kChunkBytesFieldNumber = 6,
+    kMaxInflightFieldNumber = 7,
   };
-  // .data_types.ControlAction.ActionType action = 1;
-  void clear_action();
-  ::data_types::ControlAction_ActionType action() const;
-  void set_action(::data_types::ControlAction_ActionType value);
+  // string frame_format = 2;
+  void clear_frame_format();
+  const std::string& frame_format() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_frame_format(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_frame_format();
+  PROTOBUF_NODISCARD std::string* release_frame_format();
+  void set_allocated_frame_format(std::string* frame_format);
   private:
-  ::data_types::ControlAction_ActionType _internal_action() const;
-  void _internal_set_action(::data_types::ControlAction_ActionType value);
+  const std::string& _internal_frame_format() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_frame_format(const std::string& value);
+  std::string* _internal_mutable_frame_format();
   public:
 
-  // @@protoc_insertion_point(class_scope:data_types.ControlAction)
+  // string result_encoding = 3;
+  void clear_result_encoding();
+  const std::string& result_encoding() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_result_encoding(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_result_encoding();
+  PROTOBUF_NODISCARD std::string* release_result_encoding();
+  void set_allocated_result_encoding(std::string* result_encoding);
+  private:
+  const std::string& _internal_result_encoding() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_result_encoding(const std::string& value);
+  std::string* _internal_mutable_result_encoding();
+  public:
+
+  // string compression = 8;
+  void clear_compression();
+  const std::string& compression() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_compression(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_compression();
+  PROTOBUF_NODISCARD std::string* release_compression();
+  void set_allocated_compression(std::string* compression);
+  private:
+  const std::string& _internal_compression() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_compression(const std::string& value);
+  std::string* _internal_mutable_compression();
+  public:
+
+  // uint32 protocol_version = 1;
+  void clear_protocol_version();
+  uint32_t protocol_version() const;
+  void set_protocol_version(uint32_t value);
+  private:
+  uint32_t _internal_protocol_version() const;
+  void _internal_set_protocol_version(uint32_t value);
+  public:
+
+  // bool result_batch = 4;
+  void clear_result_batch();
+  bool result_batch() const;
+  void set_result_batch(bool value);
+  private:
+  bool _internal_result_batch() const;
+  void _internal_set_result_batch(bool value);
+  public:
+
+  // bool chunked_frames = 5;
+  void clear_chunked_frames();
+  bool chunked_frames() const;
+  void set_chunked_frames(bool value);
+  private:
+  bool _internal_chunked_frames() const;
+  void _internal_set_chunked_frames(bool value);
+  public:
+
+  // uint32 chunk_bytes = 6;
+  void clear_chunk_bytes();
+  uint32_t chunk_bytes() const;
+  void set_chunk_bytes(uint32_t value);
+  private:
+  uint32_t _internal_chunk_bytes() const;
+  void _internal_set_chunk_bytes(uint32_t value);
+  public:
+
+  // uint32 max_inflight = 7;
+  void clear_max_inflight();
+  uint32_t max_inflight() const;
+  void set_max_inflight(uint32_t value);
+  private:
+  uint32_t _internal_max_inflight() const;
+  void _internal_set_max_inflight(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:data_types.SessionConfig)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  int action_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr frame_format_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr result_encoding_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr compression_;
+    uint32_t protocol_version_;
+    bool result_batch_;
+    bool chunked_frames_;
+    uint32_t chunk_bytes_;
+    uint32_t max_inflight_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_data_5ftypes_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Heartbeat :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.Heartbeat) */ {
+class FrameHeader final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.FrameHeader) */ {
  public:
-  Heartbeat();
-  virtual ~Heartbeat();
+  inline FrameHeader() : FrameHeader(nullptr) {}
+  ~FrameHeader() override;
+  explicit PROTOBUF_CONSTEXPR FrameHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Heartbeat(const Heartbeat& from);
-  Heartbeat(Heartbeat&& from) noexcept
-    : Heartbeat() {
+  FrameHeader(const FrameHeader& from);
+  FrameHeader(FrameHeader&& from) noexcept
+    : FrameHeader() {
     *this = ::std::move(from);
   }
 
-  inline Heartbeat& operator=(const Heartbeat& from) {
+  inline FrameHeader& operator=(const FrameHeader& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Heartbeat& operator=(Heartbeat&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline FrameHeader& operator=(FrameHeader&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1504,130 +2333,164 @@ class Heartbeat :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const Heartbeat& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Heartbeat* internal_default_instance() {
-    return reinterpret_cast<const Heartbeat*>(
-               &_Heartbeat_default_instance_);
+  static const FrameHeader& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FrameHeader* internal_default_instance() {
+    return reinterpret_cast<const FrameHeader*>(
+               &_FrameHeader_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    7;
+    8;
 
-  friend void swap(Heartbeat& a, Heartbeat& b) {
+  friend void swap(FrameHeader& a, FrameHeader& b) {
     a.Swap(&b);
   }
-  inline void Swap(Heartbeat* other) {
+  inline void Swap(FrameHeader* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FrameHeader* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Heartbeat* New() const final {
-    return CreateMaybeMessage<Heartbeat>(nullptr);
+  FrameHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FrameHeader>(arena);
   }
-
-  Heartbeat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Heartbeat>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FrameHeader& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FrameHeader& from) {
+    FrameHeader::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Heartbeat& from);
-  void MergeFrom(const Heartbeat& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Heartbeat* other);
+  void InternalSwap(FrameHeader* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "data_types.Heartbeat";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "data_types.FrameHeader";
   }
+  protected:
+  explicit FrameHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_data_5ftypes_2eproto);
-    return ::descriptor_table_data_5ftypes_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kTimestampFieldNumber = 1,
+    kFrameFieldNumber = 1,
+    kTotalSizeFieldNumber = 2,
   };
-  // .google.protobuf.Timestamp timestamp = 1;
-  bool has_timestamp() const;
+  // .data_types.CameraFrame frame = 1;
+  bool has_frame() const;
   private:
-  bool _internal_has_timestamp() const;
+  bool _internal_has_frame() const;
   public:
-  void clear_timestamp();
-  const PROTOBUF_NAMESPACE_ID::Timestamp& timestamp() const;
-  PROTOBUF_NAMESPACE_ID::Timestamp* release_timestamp();
-  PROTOBUF_NAMESPACE_ID::Timestamp* mutable_timestamp();
-  void set_allocated_timestamp(PROTOBUF_NAMESPACE_ID::Timestamp* timestamp);
+  void clear_frame();
+  const ::data_types::CameraFrame& frame() const;
+  PROTOBUF_NODISCARD ::data_types::CameraFrame* release_frame();
+  ::data_types::CameraFrame* mutable_frame();
+  void set_allocated_frame(::data_types::CameraFrame* frame);
+  private:
+  const ::data_types::CameraFrame& _internal_frame() const;
+  ::data_types::CameraFrame* _internal_mutable_frame();
+  public:
+  void unsafe_arena_set_allocated_frame(
+      ::data_types::CameraFrame* frame);
+  ::data_types::CameraFrame* unsafe_arena_release_frame();
+
+  // uint64 total_size = 2;
+  void clear_total_size();
+  uint64_t total_size() const;
+  void set_total_size(uint64_t value);
   private:
-  const PROTOBUF_NAMESPACE_ID::Timestamp& _internal_timestamp() const;
-  PROTOBUF_NAMESPACE_ID::Timestamp* _internal_mutable_timestamp();
+  uint64_t _internal_total_size() const;
+  void _internal_set_total_size(uint64_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:data_types.Heartbeat)
+  // @@protoc_insertion_point(class_scope:data_types.FrameHeader)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  PROTOBUF_NAMESPACE_ID::Timestamp* timestamp_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::data_types::CameraFrame* frame_;
+    uint64_t total_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_data_5ftypes_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ServerMessage :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.ServerMessage) */ {
+class FrameChunk final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.FrameChunk) */ {
  public:
-  ServerMessage();
-  virtual ~ServerMessage();
+  inline FrameChunk() : FrameChunk(nullptr) {}
+  ~FrameChunk() override;
+  explicit PROTOBUF_CONSTEXPR FrameChunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ServerMessage(const ServerMessage& from);
-  ServerMessage(ServerMessage&& from) noexcept
-    : ServerMessage() {
+  FrameChunk(const FrameChunk& from);
+  FrameChunk(FrameChunk&& from) noexcept
+    : FrameChunk() {
     *this = ::std::move(from);
   }
 
-  inline ServerMessage& operator=(const ServerMessage& from) {
+  inline FrameChunk& operator=(const FrameChunk& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ServerMessage& operator=(ServerMessage&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline FrameChunk& operator=(FrameChunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1638,203 +2501,171 @@ class ServerMessage :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const ServerMessage& default_instance();
-
-  enum MessageTypeCase {
-    kCameraFrame = 1,
-    kDetectionResult = 2,
-    kDeviceStatus = 3,
-    kConfigResponse = 4,
-    MESSAGE_TYPE_NOT_SET = 0,
-  };
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const ServerMessage* internal_default_instance() {
-    return reinterpret_cast<const ServerMessage*>(
-               &_ServerMessage_default_instance_);
+  static const FrameChunk& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FrameChunk* internal_default_instance() {
+    return reinterpret_cast<const FrameChunk*>(
+               &_FrameChunk_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    8;
+    9;
 
-  friend void swap(ServerMessage& a, ServerMessage& b) {
+  friend void swap(FrameChunk& a, FrameChunk& b) {
     a.Swap(&b);
   }
-  inline void Swap(ServerMessage* other) {
+  inline void Swap(FrameChunk* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FrameChunk* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ServerMessage* New() const final {
-    return CreateMaybeMessage<ServerMessage>(nullptr);
+  FrameChunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FrameChunk>(arena);
   }
-
-  ServerMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<ServerMessage>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FrameChunk& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FrameChunk& from) {
+    FrameChunk::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const ServerMessage& from);
-  void MergeFrom(const ServerMessage& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ServerMessage* other);
+  void InternalSwap(FrameChunk* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "data_types.ServerMessage";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "data_types.FrameChunk";
   }
+  protected:
+  explicit FrameChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_data_5ftypes_2eproto);
-    return ::descriptor_table_data_5ftypes_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kCameraFrameFieldNumber = 1,
-    kDetectionResultFieldNumber = 2,
-    kDeviceStatusFieldNumber = 3,
-    kConfigResponseFieldNumber = 4,
+    kDataFieldNumber = 3,
+    kFrameIdFieldNumber = 1,
+    kOffsetFieldNumber = 2,
   };
-  // .data_types.CameraFrame camera_frame = 1;
-  bool has_camera_frame() const;
-  private:
-  bool _internal_has_camera_frame() const;
-  public:
-  void clear_camera_frame();
-  const ::data_types::CameraFrame& camera_frame() const;
-  ::data_types::CameraFrame* release_camera_frame();
-  ::data_types::CameraFrame* mutable_camera_frame();
-  void set_allocated_camera_frame(::data_types::CameraFrame* camera_frame);
-  private:
-  const ::data_types::CameraFrame& _internal_camera_frame() const;
-  ::data_types::CameraFrame* _internal_mutable_camera_frame();
-  public:
-
-  // .data_types.DetectionResult detection_result = 2;
-  bool has_detection_result() const;
-  private:
-  bool _internal_has_detection_result() const;
-  public:
-  void clear_detection_result();
-  const ::data_types::DetectionResult& detection_result() const;
-  ::data_types::DetectionResult* release_detection_result();
-  ::data_types::DetectionResult* mutable_detection_result();
-  void set_allocated_detection_result(::data_types::DetectionResult* detection_result);
+  // bytes data = 3;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
   private:
-  const ::data_types::DetectionResult& _internal_detection_result() const;
-  ::data_types::DetectionResult* _internal_mutable_detection_result();
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
   public:
 
-  // .data_types.DeviceStatus device_status = 3;
-  bool has_device_status() const;
-  private:
-  bool _internal_has_device_status() const;
-  public:
-  void clear_device_status();
-  const ::data_types::DeviceStatus& device_status() const;
-  ::data_types::DeviceStatus* release_device_status();
-  ::data_types::DeviceStatus* mutable_device_status();
-  void set_allocated_device_status(::data_types::DeviceStatus* device_status);
+  // uint64 frame_id = 1;
+  void clear_frame_id();
+  uint64_t frame_id() const;
+  void set_frame_id(uint64_t value);
   private:
-  const ::data_types::DeviceStatus& _internal_device_status() const;
-  ::data_types::DeviceStatus* _internal_mutable_device_status();
+  uint64_t _internal_frame_id() const;
+  void _internal_set_frame_id(uint64_t value);
   public:
 
-  // .data_types.ConfigResponse config_response = 4;
-  bool has_config_response() const;
-  private:
-  bool _internal_has_config_response() const;
-  public:
-  void clear_config_response();
-  const ::data_types::ConfigResponse& config_response() const;
-  ::data_types::ConfigResponse* release_config_response();
-  ::data_types::ConfigResponse* mutable_config_response();
-  void set_allocated_config_response(::data_types::ConfigResponse* config_response);
+  // uint64 offset = 2;
+  void clear_offset();
+  uint64_t offset() const;
+  void set_offset(uint64_t value);
   private:
-  const ::data_types::ConfigResponse& _internal_config_response() const;
-  ::data_types::ConfigResponse* _internal_mutable_config_response();
+  uint64_t _internal_offset() const;
+  void _internal_set_offset(uint64_t value);
   public:
 
-  void clear_message_type();
-  MessageTypeCase message_type_case() const;
-  // @@protoc_insertion_point(class_scope:data_types.ServerMessage)
+  // @@protoc_insertion_point(class_scope:data_types.FrameChunk)
  private:
   class _Internal;
-  void set_has_camera_frame();
-  void set_has_detection_result();
-  void set_has_device_status();
-  void set_has_config_response();
-
-  inline bool has_message_type() const;
-  inline void clear_has_message_type();
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  union MessageTypeUnion {
-    MessageTypeUnion() {}
-    ::data_types::CameraFrame* camera_frame_;
-    ::data_types::DetectionResult* detection_result_;
-    ::data_types::DeviceStatus* device_status_;
-    ::data_types::ConfigResponse* config_response_;
-  } message_type_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
 
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    uint64_t frame_id_;
+    uint64_t offset_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_data_5ftypes_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ClientMessage :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.ClientMessage) */ {
+class ConfigRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.ConfigRequest) */ {
  public:
-  ClientMessage();
-  virtual ~ClientMessage();
+  inline ConfigRequest() : ConfigRequest(nullptr) {}
+  ~ConfigRequest() override;
+  explicit PROTOBUF_CONSTEXPR ConfigRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ClientMessage(const ClientMessage& from);
-  ClientMessage(ClientMessage&& from) noexcept
-    : ClientMessage() {
+  ConfigRequest(const ConfigRequest& from);
+  ConfigRequest(ConfigRequest&& from) noexcept
+    : ConfigRequest() {
     *this = ::std::move(from);
   }
 
-  inline ClientMessage& operator=(const ClientMessage& from) {
+  inline ConfigRequest& operator=(const ConfigRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ClientMessage& operator=(ClientMessage&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline ConfigRequest& operator=(ConfigRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1845,165 +2676,189 @@ class ClientMessage :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const ClientMessage& default_instance();
-
-  enum MessageTypeCase {
-    kDeviceStatus = 1,
-    kConfigResponse = 2,
-    MESSAGE_TYPE_NOT_SET = 0,
-  };
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const ClientMessage* internal_default_instance() {
-    return reinterpret_cast<const ClientMessage*>(
-               &_ClientMessage_default_instance_);
+  static const ConfigRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ConfigRequest* internal_default_instance() {
+    return reinterpret_cast<const ConfigRequest*>(
+               &_ConfigRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    9;
+    10;
 
-  friend void swap(ClientMessage& a, ClientMessage& b) {
+  friend void swap(ConfigRequest& a, ConfigRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(ClientMessage* other) {
+  inline void Swap(ConfigRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ConfigRequest* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ClientMessage* New() const final {
-    return CreateMaybeMessage<ClientMessage>(nullptr);
+  ConfigRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ConfigRequest>(arena);
   }
-
-  ClientMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<ClientMessage>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ConfigRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ConfigRequest& from) {
+    ConfigRequest::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const ClientMessage& from);
-  void MergeFrom(const ClientMessage& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ClientMessage* other);
+  void InternalSwap(ConfigRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "data_types.ClientMessage";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "data_types.ConfigRequest";
   }
+  protected:
+  explicit ConfigRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_data_5ftypes_2eproto);
-    return ::descriptor_table_data_5ftypes_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kDeviceStatusFieldNumber = 1,
-    kConfigResponseFieldNumber = 2,
+    kProfileFieldNumber = 3,
+    kDetectionThresholdFieldNumber = 1,
+    kSleepTimeoutSecFieldNumber = 2,
   };
-  // .data_types.DeviceStatus device_status = 1;
-  bool has_device_status() const;
+  // string profile = 3;
+  void clear_profile();
+  const std::string& profile() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_profile(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_profile();
+  PROTOBUF_NODISCARD std::string* release_profile();
+  void set_allocated_profile(std::string* profile);
   private:
-  bool _internal_has_device_status() const;
+  const std::string& _internal_profile() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_profile(const std::string& value);
+  std::string* _internal_mutable_profile();
   public:
-  void clear_device_status();
-  const ::data_types::DeviceStatus& device_status() const;
-  ::data_types::DeviceStatus* release_device_status();
-  ::data_types::DeviceStatus* mutable_device_status();
-  void set_allocated_device_status(::data_types::DeviceStatus* device_status);
+
+  // .google.protobuf.FloatValue detection_threshold = 1;
+  bool has_detection_threshold() const;
   private:
-  const ::data_types::DeviceStatus& _internal_device_status() const;
-  ::data_types::DeviceStatus* _internal_mutable_device_status();
+  bool _internal_has_detection_threshold() const;
+  public:
+  void clear_detection_threshold();
+  const ::PROTOBUF_NAMESPACE_ID::FloatValue& detection_threshold() const;
+  PROTOBUF_NODISCARD ::PROTOBUF_NAMESPACE_ID::FloatValue* release_detection_threshold();
+  ::PROTOBUF_NAMESPACE_ID::FloatValue* mutable_detection_threshold();
+  void set_allocated_detection_threshold(::PROTOBUF_NAMESPACE_ID::FloatValue* detection_threshold);
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::FloatValue& _internal_detection_threshold() const;
+  ::PROTOBUF_NAMESPACE_ID::FloatValue* _internal_mutable_detection_threshold();
   public:
+  void unsafe_arena_set_allocated_detection_threshold(
+      ::PROTOBUF_NAMESPACE_ID::FloatValue* detection_threshold);
+  ::PROTOBUF_NAMESPACE_ID::FloatValue* unsafe_arena_release_detection_threshold();
 
-  // .data_types.ConfigResponse config_response = 2;
-  bool has_config_response() const;
+  // .google.protobuf.UInt32Value sleep_timeout_sec = 2;
+  bool has_sleep_timeout_sec() const;
   private:
-  bool _internal_has_config_response() const;
+  bool _internal_has_sleep_timeout_sec() const;
   public:
-  void clear_config_response();
-  const ::data_types::ConfigResponse& config_response() const;
-  ::data_types::ConfigResponse* release_config_response();
-  ::data_types::ConfigResponse* mutable_config_response();
-  void set_allocated_config_response(::data_types::ConfigResponse* config_response);
+  void clear_sleep_timeout_sec();
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value& sleep_timeout_sec() const;
+  PROTOBUF_NODISCARD ::PROTOBUF_NAMESPACE_ID::UInt32Value* release_sleep_timeout_sec();
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* mutable_sleep_timeout_sec();
+  void set_allocated_sleep_timeout_sec(::PROTOBUF_NAMESPACE_ID::UInt32Value* sleep_timeout_sec);
   private:
-  const ::data_types::ConfigResponse& _internal_config_response() const;
-  ::data_types::ConfigResponse* _internal_mutable_config_response();
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value& _internal_sleep_timeout_sec() const;
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* _internal_mutable_sleep_timeout_sec();
   public:
+  void unsafe_arena_set_allocated_sleep_timeout_sec(
+      ::PROTOBUF_NAMESPACE_ID::UInt32Value* sleep_timeout_sec);
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* unsafe_arena_release_sleep_timeout_sec();
 
-  void clear_message_type();
-  MessageTypeCase message_type_case() const;
-  // @@protoc_insertion_point(class_scope:data_types.ClientMessage)
+  // @@protoc_insertion_point(class_scope:data_types.ConfigRequest)
  private:
   class _Internal;
-  void set_has_device_status();
-  void set_has_config_response();
-
-  inline bool has_message_type() const;
-  inline void clear_has_message_type();
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  union MessageTypeUnion {
-    MessageTypeUnion() {}
-    ::data_types::DeviceStatus* device_status_;
-    ::data_types::ConfigResponse* config_response_;
-  } message_type_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
 
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr profile_;
+    ::PROTOBUF_NAMESPACE_ID::FloatValue* detection_threshold_;
+    ::PROTOBUF_NAMESPACE_ID::UInt32Value* sleep_timeout_sec_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_data_5ftypes_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ConfigResponse :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.ConfigResponse) */ {
+class ControlAction final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.ControlAction) */ {
  public:
-  ConfigResponse();
-  virtual ~ConfigResponse();
+  inline ControlAction() : ControlAction(nullptr) {}
+  ~ControlAction() override;
+  explicit PROTOBUF_CONSTEXPR ControlAction(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ConfigResponse(const ConfigResponse& from);
-  ConfigResponse(ConfigResponse&& from) noexcept
-    : ConfigResponse() {
+  ControlAction(const ControlAction& from);
+  ControlAction(ControlAction&& from) noexcept
+    : ControlAction() {
     *this = ::std::move(from);
   }
 
-  inline ConfigResponse& operator=(const ConfigResponse& from) {
+  inline ControlAction& operator=(const ControlAction& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ConfigResponse& operator=(ConfigResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline ControlAction& operator=(ControlAction&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2014,1164 +2869,3984 @@ class ConfigResponse :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const ConfigResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const ConfigResponse* internal_default_instance() {
-    return reinterpret_cast<const ConfigResponse*>(
-               &_ConfigResponse_default_instance_);
+  static const ControlAction& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ControlAction* internal_default_instance() {
+    return reinterpret_cast<const ControlAction*>(
+               &_ControlAction_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    10;
+    11;
 
-  friend void swap(ConfigResponse& a, ConfigResponse& b) {
+  friend void swap(ControlAction& a, ControlAction& b) {
     a.Swap(&b);
   }
-  inline void Swap(ConfigResponse* other) {
+  inline void Swap(ControlAction* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ControlAction* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ConfigResponse* New() const final {
-    return CreateMaybeMessage<ConfigResponse>(nullptr);
+  ControlAction* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ControlAction>(arena);
   }
-
-  ConfigResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<ConfigResponse>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ControlAction& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ControlAction& from) {
+    ControlAction::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const ConfigResponse& from);
-  void MergeFrom(const ConfigResponse& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ConfigResponse* other);
+  void InternalSwap(ControlAction* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "data_types.ConfigResponse";
+    return "data_types.ControlAction";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
+  protected:
+  explicit ControlAction(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ControlAction_ActionType ActionType;
+  static constexpr ActionType REBOOT =
+    ControlAction_ActionType_REBOOT;
+  static constexpr ActionType START_STREAMING =
+    ControlAction_ActionType_START_STREAMING;
+  static constexpr ActionType STOP_STREAMING =
+    ControlAction_ActionType_STOP_STREAMING;
+  static constexpr ActionType SET_PROFILE =
+    ControlAction_ActionType_SET_PROFILE;
+  static inline bool ActionType_IsValid(int value) {
+    return ControlAction_ActionType_IsValid(value);
   }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+  static constexpr ActionType ActionType_MIN =
+    ControlAction_ActionType_ActionType_MIN;
+  static constexpr ActionType ActionType_MAX =
+    ControlAction_ActionType_ActionType_MAX;
+  static constexpr int ActionType_ARRAYSIZE =
+    ControlAction_ActionType_ActionType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  ActionType_descriptor() {
+    return ControlAction_ActionType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& ActionType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, ActionType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function ActionType_Name.");
+    return ControlAction_ActionType_Name(enum_t_value);
+  }
+  static inline bool ActionType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      ActionType* value) {
+    return ControlAction_ActionType_Parse(name, value);
   }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kProfileFieldNumber = 2,
+    kActionFieldNumber = 1,
+  };
+  // string profile = 2;
+  void clear_profile();
+  const std::string& profile() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_profile(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_profile();
+  PROTOBUF_NODISCARD std::string* release_profile();
+  void set_allocated_profile(std::string* profile);
+  private:
+  const std::string& _internal_profile() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_profile(const std::string& value);
+  std::string* _internal_mutable_profile();
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  // .data_types.ControlAction.ActionType action = 1;
+  void clear_action();
+  ::data_types::ControlAction_ActionType action() const;
+  void set_action(::data_types::ControlAction_ActionType value);
   private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_data_5ftypes_2eproto);
-    return ::descriptor_table_data_5ftypes_2eproto.file_level_metadata[kIndexInFileMessages];
+  ::data_types::ControlAction_ActionType _internal_action() const;
+  void _internal_set_action(::data_types::ControlAction_ActionType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:data_types.ControlAction)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr profile_;
+    int action_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_data_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Heartbeat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.Heartbeat) */ {
+ public:
+  inline Heartbeat() : Heartbeat(nullptr) {}
+  ~Heartbeat() override;
+  explicit PROTOBUF_CONSTEXPR Heartbeat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Heartbeat(const Heartbeat& from);
+  Heartbeat(Heartbeat&& from) noexcept
+    : Heartbeat() {
+    *this = ::std::move(from);
+  }
+
+  inline Heartbeat& operator=(const Heartbeat& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Heartbeat& operator=(Heartbeat&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Heartbeat& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Heartbeat* internal_default_instance() {
+    return reinterpret_cast<const Heartbeat*>(
+               &_Heartbeat_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(Heartbeat& a, Heartbeat& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Heartbeat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Heartbeat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Heartbeat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Heartbeat>(arena);
   }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Heartbeat& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Heartbeat& from) {
+    Heartbeat::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Heartbeat* other);
 
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "data_types.Heartbeat";
+  }
+  protected:
+  explicit Heartbeat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kMessageFieldNumber = 2,
-    kSuccessFieldNumber = 1,
+    kTimestampFieldNumber = 1,
   };
-  // string message = 2;
-  void clear_message();
-  const std::string& message() const;
-  void set_message(const std::string& value);
-  void set_message(std::string&& value);
-  void set_message(const char* value);
-  void set_message(const char* value, size_t size);
-  std::string* mutable_message();
-  std::string* release_message();
-  void set_allocated_message(std::string* message);
+  // .google.protobuf.Timestamp timestamp = 1;
+  bool has_timestamp() const;
   private:
-  const std::string& _internal_message() const;
-  void _internal_set_message(const std::string& value);
-  std::string* _internal_mutable_message();
+  bool _internal_has_timestamp() const;
   public:
-
-  // bool success = 1;
-  void clear_success();
-  bool success() const;
-  void set_success(bool value);
+  void clear_timestamp();
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp& timestamp() const;
+  PROTOBUF_NODISCARD ::PROTOBUF_NAMESPACE_ID::Timestamp* release_timestamp();
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* mutable_timestamp();
+  void set_allocated_timestamp(::PROTOBUF_NAMESPACE_ID::Timestamp* timestamp);
   private:
-  bool _internal_success() const;
-  void _internal_set_success(bool value);
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp& _internal_timestamp() const;
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* _internal_mutable_timestamp();
   public:
+  void unsafe_arena_set_allocated_timestamp(
+      ::PROTOBUF_NAMESPACE_ID::Timestamp* timestamp);
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* unsafe_arena_release_timestamp();
 
-  // @@protoc_insertion_point(class_scope:data_types.ConfigResponse)
+  // @@protoc_insertion_point(class_scope:data_types.Heartbeat)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
-  bool success_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::Timestamp* timestamp_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_data_5ftypes_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
+
+class ServerMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.ServerMessage) */ {
+ public:
+  inline ServerMessage() : ServerMessage(nullptr) {}
+  ~ServerMessage() override;
+  explicit PROTOBUF_CONSTEXPR ServerMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
+  ServerMessage(const ServerMessage& from);
+  ServerMessage(ServerMessage&& from) noexcept
+    : ServerMessage() {
+    *this = ::std::move(from);
+  }
 
-// ===================================================================
+  inline ServerMessage& operator=(const ServerMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerMessage& operator=(ServerMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// CameraFrame
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum MessageTypeCase {
+    kCameraFrame = 1,
+    kDetectionResult = 2,
+    kDeviceStatus = 3,
+    kConfigResponse = 4,
+    kHeartbeat = 5,
+    kResultBatch = 6,
+    kSessionConfig = 7,
+    MESSAGE_TYPE_NOT_SET = 0,
+  };
+
+  static inline const ServerMessage* internal_default_instance() {
+    return reinterpret_cast<const ServerMessage*>(
+               &_ServerMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(ServerMessage& a, ServerMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerMessage& from) {
+    ServerMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "data_types.ServerMessage";
+  }
+  protected:
+  explicit ServerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCameraFrameFieldNumber = 1,
+    kDetectionResultFieldNumber = 2,
+    kDeviceStatusFieldNumber = 3,
+    kConfigResponseFieldNumber = 4,
+    kHeartbeatFieldNumber = 5,
+    kResultBatchFieldNumber = 6,
+    kSessionConfigFieldNumber = 7,
+  };
+  // .data_types.CameraFrame camera_frame = 1;
+  bool has_camera_frame() const;
+  private:
+  bool _internal_has_camera_frame() const;
+  public:
+  void clear_camera_frame();
+  const ::data_types::CameraFrame& camera_frame() const;
+  PROTOBUF_NODISCARD ::data_types::CameraFrame* release_camera_frame();
+  ::data_types::CameraFrame* mutable_camera_frame();
+  void set_allocated_camera_frame(::data_types::CameraFrame* camera_frame);
+  private:
+  const ::data_types::CameraFrame& _internal_camera_frame() const;
+  ::data_types::CameraFrame* _internal_mutable_camera_frame();
+  public:
+  void unsafe_arena_set_allocated_camera_frame(
+      ::data_types::CameraFrame* camera_frame);
+  ::data_types::CameraFrame* unsafe_arena_release_camera_frame();
+
+  // .data_types.DetectionResult detection_result = 2;
+  bool has_detection_result() const;
+  private:
+  bool _internal_has_detection_result() const;
+  public:
+  void clear_detection_result();
+  const ::data_types::DetectionResult& detection_result() const;
+  PROTOBUF_NODISCARD ::data_types::DetectionResult* release_detection_result();
+  ::data_types::DetectionResult* mutable_detection_result();
+  void set_allocated_detection_result(::data_types::DetectionResult* detection_result);
+  private:
+  const ::data_types::DetectionResult& _internal_detection_result() const;
+  ::data_types::DetectionResult* _internal_mutable_detection_result();
+  public:
+  void unsafe_arena_set_allocated_detection_result(
+      ::data_types::DetectionResult* detection_result);
+  ::data_types::DetectionResult* unsafe_arena_release_detection_result();
+
+  // .data_types.DeviceStatus device_status = 3;
+  bool has_device_status() const;
+  private:
+  bool _internal_has_device_status() const;
+  public:
+  void clear_device_status();
+  const ::data_types::DeviceStatus& device_status() const;
+  PROTOBUF_NODISCARD ::data_types::DeviceStatus* release_device_status();
+  ::data_types::DeviceStatus* mutable_device_status();
+  void set_allocated_device_status(::data_types::DeviceStatus* device_status);
+  private:
+  const ::data_types::DeviceStatus& _internal_device_status() const;
+  ::data_types::DeviceStatus* _internal_mutable_device_status();
+  public:
+  void unsafe_arena_set_allocated_device_status(
+      ::data_types::DeviceStatus* device_status);
+  ::data_types::DeviceStatus* unsafe_arena_release_device_status();
+
+  // .data_types.ConfigResponse config_response = 4;
+  bool has_config_response() const;
+  private:
+  bool _internal_has_config_response() const;
+  public:
+  void clear_config_response();
+  const ::data_types::ConfigResponse& config_response() const;
+  PROTOBUF_NODISCARD ::data_types::ConfigResponse* release_config_response();
+  ::data_types::ConfigResponse* mutable_config_response();
+  void set_allocated_config_response(::data_types::ConfigResponse* config_response);
+  private:
+  const ::data_types::ConfigResponse& _internal_config_response() const;
+  ::data_types::ConfigResponse* _internal_mutable_config_response();
+  public:
+  void unsafe_arena_set_allocated_config_response(
+      ::data_types::ConfigResponse* config_response);
+  ::data_types::ConfigResponse* unsafe_arena_release_config_response();
+
+  // .data_types.Heartbeat heartbeat = 5;
+  bool has_heartbeat() const;
+  private:
+  bool _internal_has_heartbeat() const;
+  public:
+  void clear_heartbeat();
+  const ::data_types::Heartbeat& heartbeat() const;
+  PROTOBUF_NODISCARD ::data_types::Heartbeat* release_heartbeat();
+  ::data_types::Heartbeat* mutable_heartbeat();
+  void set_allocated_heartbeat(::data_types::Heartbeat* heartbeat);
+  private:
+  const ::data_types::Heartbeat& _internal_heartbeat() const;
+  ::data_types::Heartbeat* _internal_mutable_heartbeat();
+  public:
+  void unsafe_arena_set_allocated_heartbeat(
+      ::data_types::Heartbeat* heartbeat);
+  ::data_types::Heartbeat* unsafe_arena_release_heartbeat();
+
+  // .data_types.ResultBatch result_batch = 6;
+  bool has_result_batch() const;
+  private:
+  bool _internal_has_result_batch() const;
+  public:
+  void clear_result_batch();
+  const ::data_types::ResultBatch& result_batch() const;
+  PROTOBUF_NODISCARD ::data_types::ResultBatch* release_result_batch();
+  ::data_types::ResultBatch* mutable_result_batch();
+  void set_allocated_result_batch(::data_types::ResultBatch* result_batch);
+  private:
+  const ::data_types::ResultBatch& _internal_result_batch() const;
+  ::data_types::ResultBatch* _internal_mutable_result_batch();
+  public:
+  void unsafe_arena_set_allocated_result_batch(
+      ::data_types::ResultBatch* result_batch);
+  ::data_types::ResultBatch* unsafe_arena_release_result_batch();
+
+  // .data_types.SessionConfig session_config = 7;
+  bool has_session_config() const;
+  private:
+  bool _internal_has_session_config() const;
+  public:
+  void clear_session_config();
+  const ::data_types::SessionConfig& session_config() const;
+  PROTOBUF_NODISCARD ::data_types::SessionConfig* release_session_config();
+  ::data_types::SessionConfig* mutable_session_config();
+  void set_allocated_session_config(::data_types::SessionConfig* session_config);
+  private:
+  const ::data_types::SessionConfig& _internal_session_config() const;
+  ::data_types::SessionConfig* _internal_mutable_session_config();
+  public:
+  void unsafe_arena_set_allocated_session_config(
+      ::data_types::SessionConfig* session_config);
+  ::data_types::SessionConfig* unsafe_arena_release_session_config();
+
+  void clear_message_type();
+  MessageTypeCase message_type_case() const;
+  // @@protoc_insertion_point(class_scope:data_types.ServerMessage)
+ private:
+  class _Internal;
+  void set_has_camera_frame();
+  void set_has_detection_result();
+  void set_has_device_status();
+  void set_has_config_response();
+  void set_has_heartbeat();
+  void set_has_result_batch();
+  void set_has_session_config();
+
+  inline bool has_message_type() const;
+  inline void clear_has_message_type();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union MessageTypeUnion {
+      constexpr MessageTypeUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::data_types::CameraFrame* camera_frame_;
+      ::data_types::DetectionResult* detection_result_;
+      ::data_types::DeviceStatus* device_status_;
+      ::data_types::ConfigResponse* config_response_;
+      ::data_types::Heartbeat* heartbeat_;
+      ::data_types::ResultBatch* result_batch_;
+      ::data_types::SessionConfig* session_config_;
+    } message_type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_data_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ResultBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.ResultBatch) */ {
+ public:
+  inline ResultBatch() : ResultBatch(nullptr) {}
+  ~ResultBatch() override;
+  explicit PROTOBUF_CONSTEXPR ResultBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ResultBatch(const ResultBatch& from);
+  ResultBatch(ResultBatch&& from) noexcept
+    : ResultBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline ResultBatch& operator=(const ResultBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ResultBatch& operator=(ResultBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResultBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ResultBatch* internal_default_instance() {
+    return reinterpret_cast<const ResultBatch*>(
+               &_ResultBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(ResultBatch& a, ResultBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ResultBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResultBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ResultBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResultBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResultBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResultBatch& from) {
+    ResultBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ResultBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "data_types.ResultBatch";
+  }
+  protected:
+  explicit ResultBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultsFieldNumber = 1,
+  };
+  // repeated .data_types.DetectionResult results = 1;
+  int results_size() const;
+  private:
+  int _internal_results_size() const;
+  public:
+  void clear_results();
+  ::data_types::DetectionResult* mutable_results(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::data_types::DetectionResult >*
+      mutable_results();
+  private:
+  const ::data_types::DetectionResult& _internal_results(int index) const;
+  ::data_types::DetectionResult* _internal_add_results();
+  public:
+  const ::data_types::DetectionResult& results(int index) const;
+  ::data_types::DetectionResult* add_results();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::data_types::DetectionResult >&
+      results() const;
+
+  // @@protoc_insertion_point(class_scope:data_types.ResultBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::data_types::DetectionResult > results_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_data_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ClientMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.ClientMessage) */ {
+ public:
+  inline ClientMessage() : ClientMessage(nullptr) {}
+  ~ClientMessage() override;
+  explicit PROTOBUF_CONSTEXPR ClientMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ClientMessage(const ClientMessage& from);
+  ClientMessage(ClientMessage&& from) noexcept
+    : ClientMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ClientMessage& operator=(const ClientMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ClientMessage& operator=(ClientMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClientMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum MessageTypeCase {
+    kDeviceStatus = 1,
+    kConfigResponse = 2,
+    MESSAGE_TYPE_NOT_SET = 0,
+  };
+
+  static inline const ClientMessage* internal_default_instance() {
+    return reinterpret_cast<const ClientMessage*>(
+               &_ClientMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(ClientMessage& a, ClientMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ClientMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClientMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ClientMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClientMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ClientMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ClientMessage& from) {
+    ClientMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ClientMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "data_types.ClientMessage";
+  }
+  protected:
+  explicit ClientMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDeviceStatusFieldNumber = 1,
+    kConfigResponseFieldNumber = 2,
+  };
+  // .data_types.DeviceStatus device_status = 1;
+  bool has_device_status() const;
+  private:
+  bool _internal_has_device_status() const;
+  public:
+  void clear_device_status();
+  const ::data_types::DeviceStatus& device_status() const;
+  PROTOBUF_NODISCARD ::data_types::DeviceStatus* release_device_status();
+  ::data_types::DeviceStatus* mutable_device_status();
+  void set_allocated_device_status(::data_types::DeviceStatus* device_status);
+  private:
+  const ::data_types::DeviceStatus& _internal_device_status() const;
+  ::data_types::DeviceStatus* _internal_mutable_device_status();
+  public:
+  void unsafe_arena_set_allocated_device_status(
+      ::data_types::DeviceStatus* device_status);
+  ::data_types::DeviceStatus* unsafe_arena_release_device_status();
+
+  // .data_types.ConfigResponse config_response = 2;
+  bool has_config_response() const;
+  private:
+  bool _internal_has_config_response() const;
+  public:
+  void clear_config_response();
+  const ::data_types::ConfigResponse& config_response() const;
+  PROTOBUF_NODISCARD ::data_types::ConfigResponse* release_config_response();
+  ::data_types::ConfigResponse* mutable_config_response();
+  void set_allocated_config_response(::data_types::ConfigResponse* config_response);
+  private:
+  const ::data_types::ConfigResponse& _internal_config_response() const;
+  ::data_types::ConfigResponse* _internal_mutable_config_response();
+  public:
+  void unsafe_arena_set_allocated_config_response(
+      ::data_types::ConfigResponse* config_response);
+  ::data_types::ConfigResponse* unsafe_arena_release_config_response();
+
+  void clear_message_type();
+  MessageTypeCase message_type_case() const;
+  // @@protoc_insertion_point(class_scope:data_types.ClientMessage)
+ private:
+  class _Internal;
+  void set_has_device_status();
+  void set_has_config_response();
+
+  inline bool has_message_type() const;
+  inline void clear_has_message_type();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union MessageTypeUnion {
+      constexpr MessageTypeUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::data_types::DeviceStatus* device_status_;
+      ::data_types::ConfigResponse* config_response_;
+    } message_type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_data_5ftypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ConfigResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:data_types.ConfigResponse) */ {
+ public:
+  inline ConfigResponse() : ConfigResponse(nullptr) {}
+  ~ConfigResponse() override;
+  explicit PROTOBUF_CONSTEXPR ConfigResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ConfigResponse(const ConfigResponse& from);
+  ConfigResponse(ConfigResponse&& from) noexcept
+    : ConfigResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ConfigResponse& operator=(const ConfigResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ConfigResponse& operator=(ConfigResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ConfigResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ConfigResponse* internal_default_instance() {
+    return reinterpret_cast<const ConfigResponse*>(
+               &_ConfigResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(ConfigResponse& a, ConfigResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ConfigResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ConfigResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ConfigResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ConfigResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ConfigResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ConfigResponse& from) {
+    ConfigResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ConfigResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "data_types.ConfigResponse";
+  }
+  protected:
+  explicit ConfigResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+  };
+  // string message = 2;
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // bool success = 1;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:data_types.ConfigResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_data_5ftypes_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// CameraFrame
+
+// bytes image_data = 1;
+inline void CameraFrame::clear_image_data() {
+  _impl_.image_data_.ClearToEmpty();
+}
+inline const std::string& CameraFrame::image_data() const {
+  // @@protoc_insertion_point(field_get:data_types.CameraFrame.image_data)
+  return _internal_image_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CameraFrame::set_image_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.image_data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:data_types.CameraFrame.image_data)
+}
+inline std::string* CameraFrame::mutable_image_data() {
+  std::string* _s = _internal_mutable_image_data();
+  // @@protoc_insertion_point(field_mutable:data_types.CameraFrame.image_data)
+  return _s;
+}
+inline const std::string& CameraFrame::_internal_image_data() const {
+  return _impl_.image_data_.Get();
+}
+inline void CameraFrame::_internal_set_image_data(const std::string& value) {
+  
+  _impl_.image_data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CameraFrame::_internal_mutable_image_data() {
+  
+  return _impl_.image_data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CameraFrame::release_image_data() {
+  // @@protoc_insertion_point(field_release:data_types.CameraFrame.image_data)
+  return _impl_.image_data_.Release();
+}
+inline void CameraFrame::set_allocated_image_data(std::string* image_data) {
+  if (image_data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.image_data_.SetAllocated(image_data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.image_data_.IsDefault()) {
+    _impl_.image_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:data_types.CameraFrame.image_data)
+}
+
+// uint32 width = 2;
+inline void CameraFrame::clear_width() {
+  _impl_.width_ = 0u;
+}
+inline uint32_t CameraFrame::_internal_width() const {
+  return _impl_.width_;
+}
+inline uint32_t CameraFrame::width() const {
+  // @@protoc_insertion_point(field_get:data_types.CameraFrame.width)
+  return _internal_width();
+}
+inline void CameraFrame::_internal_set_width(uint32_t value) {
+  
+  _impl_.width_ = value;
+}
+inline void CameraFrame::set_width(uint32_t value) {
+  _internal_set_width(value);
+  // @@protoc_insertion_point(field_set:data_types.CameraFrame.width)
+}
+
+// uint32 height = 3;
+inline void CameraFrame::clear_height() {
+  _impl_.height_ = 0u;
+}
+inline uint32_t CameraFrame::_internal_height() const {
+  return _impl_.height_;
+}
+inline uint32_t CameraFrame::height() const {
+  // @@protoc_insertion_point(field_get:data_types.CameraFrame.height)
+  return _internal_height();
+}
+inline void CameraFrame::_internal_set_height(uint32_t value) {
+  
+  _impl_.height_ = value;
+}
+inline void CameraFrame::set_height(uint32_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:data_types.CameraFrame.height)
+}
+
+// .google.protobuf.Timestamp timestamp = 4;
+inline bool CameraFrame::_internal_has_timestamp() const {
+  return this != internal_default_instance() && _impl_.timestamp_ != nullptr;
+}
+inline bool CameraFrame::has_timestamp() const {
+  return _internal_has_timestamp();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& CameraFrame::_internal_timestamp() const {
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.timestamp_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
+      ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& CameraFrame::timestamp() const {
+  // @@protoc_insertion_point(field_get:data_types.CameraFrame.timestamp)
+  return _internal_timestamp();
+}
+inline void CameraFrame::unsafe_arena_set_allocated_timestamp(
+    ::PROTOBUF_NAMESPACE_ID::Timestamp* timestamp) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.timestamp_);
+  }
+  _impl_.timestamp_ = timestamp;
+  if (timestamp) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.CameraFrame.timestamp)
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* CameraFrame::release_timestamp() {
+  
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.timestamp_;
+  _impl_.timestamp_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* CameraFrame::unsafe_arena_release_timestamp() {
+  // @@protoc_insertion_point(field_release:data_types.CameraFrame.timestamp)
+  
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.timestamp_;
+  _impl_.timestamp_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* CameraFrame::_internal_mutable_timestamp() {
+  
+  if (_impl_.timestamp_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaForAllocation());
+    _impl_.timestamp_ = p;
+  }
+  return _impl_.timestamp_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* CameraFrame::mutable_timestamp() {
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_timestamp();
+  // @@protoc_insertion_point(field_mutable:data_types.CameraFrame.timestamp)
+  return _msg;
+}
+inline void CameraFrame::set_allocated_timestamp(::PROTOBUF_NAMESPACE_ID::Timestamp* timestamp) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.timestamp_);
+  }
+  if (timestamp) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(timestamp));
+    if (message_arena != submessage_arena) {
+      timestamp = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, timestamp, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.timestamp_ = timestamp;
+  // @@protoc_insertion_point(field_set_allocated:data_types.CameraFrame.timestamp)
+}
+
+// string format = 5;
+inline void CameraFrame::clear_format() {
+  _impl_.format_.ClearToEmpty();
+}
+inline const std::string& CameraFrame::format() const {
+  // @@protoc_insertion_point(field_get:data_types.CameraFrame.format)
+  return _internal_format();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CameraFrame::set_format(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.format_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:data_types.CameraFrame.format)
+}
+inline std::string* CameraFrame::mutable_format() {
+  std::string* _s = _internal_mutable_format();
+  // @@protoc_insertion_point(field_mutable:data_types.CameraFrame.format)
+  return _s;
+}
+inline const std::string& CameraFrame::_internal_format() const {
+  return _impl_.format_.Get();
+}
+inline void CameraFrame::_internal_set_format(const std::string& value) {
+  
+  _impl_.format_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CameraFrame::_internal_mutable_format() {
+  
+  return _impl_.format_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CameraFrame::release_format() {
+  // @@protoc_insertion_point(field_release:data_types.CameraFrame.format)
+  return _impl_.format_.Release();
+}
+inline void CameraFrame::set_allocated_format(std::string* format) {
+  if (format != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.format_.SetAllocated(format, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.format_.IsDefault()) {
+    _impl_.format_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:data_types.CameraFrame.format)
+}
+
+// uint64 frame_id = 6;
+inline void CameraFrame::clear_frame_id() {
+  _impl_.frame_id_ = uint64_t{0u};
+}
+inline uint64_t CameraFrame::_internal_frame_id() const {
+  return _impl_.frame_id_;
+}
+inline uint64_t CameraFrame::frame_id() const {
+  // @@protoc_insertion_point(field_get:data_types.CameraFrame.frame_id)
+  return _internal_frame_id();
+}
+inline void CameraFrame::_internal_set_frame_id(uint64_t value) {
+  
+  _impl_.frame_id_ = value;
+}
+inline void CameraFrame::set_frame_id(uint64_t value) {
+  _internal_set_frame_id(value);
+  // @@protoc_insertion_point(field_set:data_types.CameraFrame.frame_id)
+}
+
+// bool low_priority = 7;
+inline void CameraFrame::clear_low_priority() {
+  _impl_.low_priority_ = false;
+}
+inline bool CameraFrame::_internal_low_priority() const {
+  return _impl_.low_priority_;
+}
+inline bool CameraFrame::low_priority() const {
+  // @@protoc_insertion_point(field_get:data_types.CameraFrame.low_priority)
+  return _internal_low_priority();
+}
+inline void CameraFrame::_internal_set_low_priority(bool value) {
+  
+  _impl_.low_priority_ = value;
+}
+inline void CameraFrame::set_low_priority(bool value) {
+  _internal_set_low_priority(value);
+  // @@protoc_insertion_point(field_set:data_types.CameraFrame.low_priority)
+}
+
+// uint32 camera_id = 8;
+inline void CameraFrame::clear_camera_id() {
+  _impl_.camera_id_ = 0u;
+}
+inline uint32_t CameraFrame::_internal_camera_id() const {
+  return _impl_.camera_id_;
+}
+inline uint32_t CameraFrame::camera_id() const {
+  // @@protoc_insertion_point(field_get:data_types.CameraFrame.camera_id)
+  return _internal_camera_id();
+}
+inline void CameraFrame::_internal_set_camera_id(uint32_t value) {
+  
+  _impl_.camera_id_ = value;
+}
+inline void CameraFrame::set_camera_id(uint32_t value) {
+  _internal_set_camera_id(value);
+  // @@protoc_insertion_point(field_set:data_types.CameraFrame.camera_id)
+}
+
+// -------------------------------------------------------------------
+
+// BoundingBox
+
+// uint32 x_min = 1;
+inline void BoundingBox::clear_x_min() {
+  _impl_.x_min_ = 0u;
+}
+inline uint32_t BoundingBox::_internal_x_min() const {
+  return _impl_.x_min_;
+}
+inline uint32_t BoundingBox::x_min() const {
+  // @@protoc_insertion_point(field_get:data_types.BoundingBox.x_min)
+  return _internal_x_min();
+}
+inline void BoundingBox::_internal_set_x_min(uint32_t value) {
+  
+  _impl_.x_min_ = value;
+}
+inline void BoundingBox::set_x_min(uint32_t value) {
+  _internal_set_x_min(value);
+  // @@protoc_insertion_point(field_set:data_types.BoundingBox.x_min)
+}
+
+// uint32 y_min = 2;
+inline void BoundingBox::clear_y_min() {
+  _impl_.y_min_ = 0u;
+}
+inline uint32_t BoundingBox::_internal_y_min() const {
+  return _impl_.y_min_;
+}
+inline uint32_t BoundingBox::y_min() const {
+  // @@protoc_insertion_point(field_get:data_types.BoundingBox.y_min)
+  return _internal_y_min();
+}
+inline void BoundingBox::_internal_set_y_min(uint32_t value) {
+  
+  _impl_.y_min_ = value;
+}
+inline void BoundingBox::set_y_min(uint32_t value) {
+  _internal_set_y_min(value);
+  // @@protoc_insertion_point(field_set:data_types.BoundingBox.y_min)
+}
+
+// uint32 x_max = 3;
+inline void BoundingBox::clear_x_max() {
+  _impl_.x_max_ = 0u;
+}
+inline uint32_t BoundingBox::_internal_x_max() const {
+  return _impl_.x_max_;
+}
+inline uint32_t BoundingBox::x_max() const {
+  // @@protoc_insertion_point(field_get:data_types.BoundingBox.x_max)
+  return _internal_x_max();
+}
+inline void BoundingBox::_internal_set_x_max(uint32_t value) {
+  
+  _impl_.x_max_ = value;
+}
+inline void BoundingBox::set_x_max(uint32_t value) {
+  _internal_set_x_max(value);
+  // @@protoc_insertion_point(field_set:data_types.BoundingBox.x_max)
+}
+
+// uint32 y_max = 4;
+inline void BoundingBox::clear_y_max() {
+  _impl_.y_max_ = 0u;
+}
+inline uint32_t BoundingBox::_internal_y_max() const {
+  return _impl_.y_max_;
+}
+inline uint32_t BoundingBox::y_max() const {
+  // @@protoc_insertion_point(field_get:data_types.BoundingBox.y_max)
+  return _internal_y_max();
+}
+inline void BoundingBox::_internal_set_y_max(uint32_t value) {
+  
+  _impl_.y_max_ = value;
+}
+inline void BoundingBox::set_y_max(uint32_t value) {
+  _internal_set_y_max(value);
+  // @@protoc_insertion_point(field_set:data_types.BoundingBox.y_max)
+}
+
+// string label = 5;
+inline void BoundingBox::clear_label() {
+  _impl_.label_.ClearToEmpty();
+}
+inline const std::string& BoundingBox::label() const {
+  // @@protoc_insertion_point(field_get:data_types.BoundingBox.label)
+  return _internal_label();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BoundingBox::set_label(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.label_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:data_types.BoundingBox.label)
+}
+inline std::string* BoundingBox::mutable_label() {
+  std::string* _s = _internal_mutable_label();
+  // @@protoc_insertion_point(field_mutable:data_types.BoundingBox.label)
+  return _s;
+}
+inline const std::string& BoundingBox::_internal_label() const {
+  return _impl_.label_.Get();
+}
+inline void BoundingBox::_internal_set_label(const std::string& value) {
+  
+  _impl_.label_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BoundingBox::_internal_mutable_label() {
+  
+  return _impl_.label_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BoundingBox::release_label() {
+  // @@protoc_insertion_point(field_release:data_types.BoundingBox.label)
+  return _impl_.label_.Release();
+}
+inline void BoundingBox::set_allocated_label(std::string* label) {
+  if (label != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.label_.SetAllocated(label, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.label_.IsDefault()) {
+    _impl_.label_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:data_types.BoundingBox.label)
+}
+
+// float confidence = 6;
+inline void BoundingBox::clear_confidence() {
+  _impl_.confidence_ = 0;
+}
+inline float BoundingBox::_internal_confidence() const {
+  return _impl_.confidence_;
+}
+inline float BoundingBox::confidence() const {
+  // @@protoc_insertion_point(field_get:data_types.BoundingBox.confidence)
+  return _internal_confidence();
+}
+inline void BoundingBox::_internal_set_confidence(float value) {
+  
+  _impl_.confidence_ = value;
+}
+inline void BoundingBox::set_confidence(float value) {
+  _internal_set_confidence(value);
+  // @@protoc_insertion_point(field_set:data_types.BoundingBox.confidence)
+}
+
+// -------------------------------------------------------------------
+
+// InstanceMask
+
+// uint32 detection_index = 1;
+inline void InstanceMask::clear_detection_index() {
+  _impl_.detection_index_ = 0u;
+}
+inline uint32_t InstanceMask::_internal_detection_index() const {
+  return _impl_.detection_index_;
+}
+inline uint32_t InstanceMask::detection_index() const {
+  // @@protoc_insertion_point(field_get:data_types.InstanceMask.detection_index)
+  return _internal_detection_index();
+}
+inline void InstanceMask::_internal_set_detection_index(uint32_t value) {
+  
+  _impl_.detection_index_ = value;
+}
+inline void InstanceMask::set_detection_index(uint32_t value) {
+  _internal_set_detection_index(value);
+  // @@protoc_insertion_point(field_set:data_types.InstanceMask.detection_index)
+}
+
+// float x_min = 2;
+inline void InstanceMask::clear_x_min() {
+  _impl_.x_min_ = 0;
+}
+inline float InstanceMask::_internal_x_min() const {
+  return _impl_.x_min_;
+}
+inline float InstanceMask::x_min() const {
+  // @@protoc_insertion_point(field_get:data_types.InstanceMask.x_min)
+  return _internal_x_min();
+}
+inline void InstanceMask::_internal_set_x_min(float value) {
+  
+  _impl_.x_min_ = value;
+}
+inline void InstanceMask::set_x_min(float value) {
+  _internal_set_x_min(value);
+  // @@protoc_insertion_point(field_set:data_types.InstanceMask.x_min)
+}
+
+// float y_min = 3;
+inline void InstanceMask::clear_y_min() {
+  _impl_.y_min_ = 0;
+}
+inline float InstanceMask::_internal_y_min() const {
+  return _impl_.y_min_;
+}
+inline float InstanceMask::y_min() const {
+  // @@protoc_insertion_point(field_get:data_types.InstanceMask.y_min)
+  return _internal_y_min();
+}
+inline void InstanceMask::_internal_set_y_min(float value) {
+  
+  _impl_.y_min_ = value;
+}
+inline void InstanceMask::set_y_min(float value) {
+  _internal_set_y_min(value);
+  // @@protoc_insertion_point(field_set:data_types.InstanceMask.y_min)
+}
+
+// float x_max = 4;
+inline void InstanceMask::clear_x_max() {
+  _impl_.x_max_ = 0;
+}
+inline float InstanceMask::_internal_x_max() const {
+  return _impl_.x_max_;
+}
+inline float InstanceMask::x_max() const {
+  // @@protoc_insertion_point(field_get:data_types.InstanceMask.x_max)
+  return _internal_x_max();
+}
+inline void InstanceMask::_internal_set_x_max(float value) {
+  
+  _impl_.x_max_ = value;
+}
+inline void InstanceMask::set_x_max(float value) {
+  _internal_set_x_max(value);
+  // @@protoc_insertion_point(field_set:data_types.InstanceMask.x_max)
+}
+
+// float y_max = 5;
+inline void InstanceMask::clear_y_max() {
+  _impl_.y_max_ = 0;
+}
+inline float InstanceMask::_internal_y_max() const {
+  return _impl_.y_max_;
+}
+inline float InstanceMask::y_max() const {
+  // @@protoc_insertion_point(field_get:data_types.InstanceMask.y_max)
+  return _internal_y_max();
+}
+inline void InstanceMask::_internal_set_y_max(float value) {
+  
+  _impl_.y_max_ = value;
+}
+inline void InstanceMask::set_y_max(float value) {
+  _internal_set_y_max(value);
+  // @@protoc_insertion_point(field_set:data_types.InstanceMask.y_max)
+}
+
+// uint32 width = 6;
+inline void InstanceMask::clear_width() {
+  _impl_.width_ = 0u;
+}
+inline uint32_t InstanceMask::_internal_width() const {
+  return _impl_.width_;
+}
+inline uint32_t InstanceMask::width() const {
+  // @@protoc_insertion_point(field_get:data_types.InstanceMask.width)
+  return _internal_width();
+}
+inline void InstanceMask::_internal_set_width(uint32_t value) {
+  
+  _impl_.width_ = value;
+}
+inline void InstanceMask::set_width(uint32_t value) {
+  _internal_set_width(value);
+  // @@protoc_insertion_point(field_set:data_types.InstanceMask.width)
+}
+
+// uint32 height = 7;
+inline void InstanceMask::clear_height() {
+  _impl_.height_ = 0u;
+}
+inline uint32_t InstanceMask::_internal_height() const {
+  return _impl_.height_;
+}
+inline uint32_t InstanceMask::height() const {
+  // @@protoc_insertion_point(field_get:data_types.InstanceMask.height)
+  return _internal_height();
+}
+inline void InstanceMask::_internal_set_height(uint32_t value) {
+  
+  _impl_.height_ = value;
+}
+inline void InstanceMask::set_height(uint32_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:data_types.InstanceMask.height)
+}
+
+// repeated uint32 counts = 8;
+inline int InstanceMask::_internal_counts_size() const {
+  return _impl_.counts_.size();
+}
+inline int InstanceMask::counts_size() const {
+  return _internal_counts_size();
+}
+inline void InstanceMask::clear_counts() {
+  _impl_.counts_.Clear();
+}
+inline uint32_t InstanceMask::_internal_counts(int index) const {
+  return _impl_.counts_.Get(index);
+}
+inline uint32_t InstanceMask::counts(int index) const {
+  // @@protoc_insertion_point(field_get:data_types.InstanceMask.counts)
+  return _internal_counts(index);
+}
+inline void InstanceMask::set_counts(int index, uint32_t value) {
+  _impl_.counts_.Set(index, value);
+  // @@protoc_insertion_point(field_set:data_types.InstanceMask.counts)
+}
+inline void InstanceMask::_internal_add_counts(uint32_t value) {
+  _impl_.counts_.Add(value);
+}
+inline void InstanceMask::add_counts(uint32_t value) {
+  _internal_add_counts(value);
+  // @@protoc_insertion_point(field_add:data_types.InstanceMask.counts)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+InstanceMask::_internal_counts() const {
+  return _impl_.counts_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+InstanceMask::counts() const {
+  // @@protoc_insertion_point(field_list:data_types.InstanceMask.counts)
+  return _internal_counts();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+InstanceMask::_internal_mutable_counts() {
+  return &_impl_.counts_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+InstanceMask::mutable_counts() {
+  // @@protoc_insertion_point(field_mutable_list:data_types.InstanceMask.counts)
+  return _internal_mutable_counts();
+}
+
+// string label = 9;
+inline void InstanceMask::clear_label() {
+  _impl_.label_.ClearToEmpty();
+}
+inline const std::string& InstanceMask::label() const {
+  // @@protoc_insertion_point(field_get:data_types.InstanceMask.label)
+  return _internal_label();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void InstanceMask::set_label(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.label_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:data_types.InstanceMask.label)
+}
+inline std::string* InstanceMask::mutable_label() {
+  std::string* _s = _internal_mutable_label();
+  // @@protoc_insertion_point(field_mutable:data_types.InstanceMask.label)
+  return _s;
+}
+inline const std::string& InstanceMask::_internal_label() const {
+  return _impl_.label_.Get();
+}
+inline void InstanceMask::_internal_set_label(const std::string& value) {
+  
+  _impl_.label_.Set(value, GetArenaForAllocation());
+}
+inline std::string* InstanceMask::_internal_mutable_label() {
+  
+  return _impl_.label_.Mutable(GetArenaForAllocation());
+}
+inline std::string* InstanceMask::release_label() {
+  // @@protoc_insertion_point(field_release:data_types.InstanceMask.label)
+  return _impl_.label_.Release();
+}
+inline void InstanceMask::set_allocated_label(std::string* label) {
+  if (label != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.label_.SetAllocated(label, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.label_.IsDefault()) {
+    _impl_.label_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:data_types.InstanceMask.label)
+}
+
+// float score = 10;
+inline void InstanceMask::clear_score() {
+  _impl_.score_ = 0;
+}
+inline float InstanceMask::_internal_score() const {
+  return _impl_.score_;
+}
+inline float InstanceMask::score() const {
+  // @@protoc_insertion_point(field_get:data_types.InstanceMask.score)
+  return _internal_score();
+}
+inline void InstanceMask::_internal_set_score(float value) {
+  
+  _impl_.score_ = value;
+}
+inline void InstanceMask::set_score(float value) {
+  _internal_set_score(value);
+  // @@protoc_insertion_point(field_set:data_types.InstanceMask.score)
+}
+
+// -------------------------------------------------------------------
+
+// DetectionResult
+
+// .google.protobuf.Timestamp frame_timestamp = 1;
+inline bool DetectionResult::_internal_has_frame_timestamp() const {
+  return this != internal_default_instance() && _impl_.frame_timestamp_ != nullptr;
+}
+inline bool DetectionResult::has_frame_timestamp() const {
+  return _internal_has_frame_timestamp();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& DetectionResult::_internal_frame_timestamp() const {
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.frame_timestamp_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
+      ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& DetectionResult::frame_timestamp() const {
+  // @@protoc_insertion_point(field_get:data_types.DetectionResult.frame_timestamp)
+  return _internal_frame_timestamp();
+}
+inline void DetectionResult::unsafe_arena_set_allocated_frame_timestamp(
+    ::PROTOBUF_NAMESPACE_ID::Timestamp* frame_timestamp) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.frame_timestamp_);
+  }
+  _impl_.frame_timestamp_ = frame_timestamp;
+  if (frame_timestamp) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.DetectionResult.frame_timestamp)
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* DetectionResult::release_frame_timestamp() {
+  
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.frame_timestamp_;
+  _impl_.frame_timestamp_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* DetectionResult::unsafe_arena_release_frame_timestamp() {
+  // @@protoc_insertion_point(field_release:data_types.DetectionResult.frame_timestamp)
+  
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.frame_timestamp_;
+  _impl_.frame_timestamp_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* DetectionResult::_internal_mutable_frame_timestamp() {
+  
+  if (_impl_.frame_timestamp_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaForAllocation());
+    _impl_.frame_timestamp_ = p;
+  }
+  return _impl_.frame_timestamp_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* DetectionResult::mutable_frame_timestamp() {
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_frame_timestamp();
+  // @@protoc_insertion_point(field_mutable:data_types.DetectionResult.frame_timestamp)
+  return _msg;
+}
+inline void DetectionResult::set_allocated_frame_timestamp(::PROTOBUF_NAMESPACE_ID::Timestamp* frame_timestamp) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.frame_timestamp_);
+  }
+  if (frame_timestamp) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(frame_timestamp));
+    if (message_arena != submessage_arena) {
+      frame_timestamp = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, frame_timestamp, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.frame_timestamp_ = frame_timestamp;
+  // @@protoc_insertion_point(field_set_allocated:data_types.DetectionResult.frame_timestamp)
+}
+
+// string json = 2;
+inline void DetectionResult::clear_json() {
+  _impl_.json_.ClearToEmpty();
+}
+inline const std::string& DetectionResult::json() const {
+  // @@protoc_insertion_point(field_get:data_types.DetectionResult.json)
+  return _internal_json();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DetectionResult::set_json(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.json_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:data_types.DetectionResult.json)
+}
+inline std::string* DetectionResult::mutable_json() {
+  std::string* _s = _internal_mutable_json();
+  // @@protoc_insertion_point(field_mutable:data_types.DetectionResult.json)
+  return _s;
+}
+inline const std::string& DetectionResult::_internal_json() const {
+  return _impl_.json_.Get();
+}
+inline void DetectionResult::_internal_set_json(const std::string& value) {
+  
+  _impl_.json_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DetectionResult::_internal_mutable_json() {
+  
+  return _impl_.json_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DetectionResult::release_json() {
+  // @@protoc_insertion_point(field_release:data_types.DetectionResult.json)
+  return _impl_.json_.Release();
+}
+inline void DetectionResult::set_allocated_json(std::string* json) {
+  if (json != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.json_.SetAllocated(json, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.json_.IsDefault()) {
+    _impl_.json_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:data_types.DetectionResult.json)
+}
+
+// uint64 frame_id = 3;
+inline void DetectionResult::clear_frame_id() {
+  _impl_.frame_id_ = uint64_t{0u};
+}
+inline uint64_t DetectionResult::_internal_frame_id() const {
+  return _impl_.frame_id_;
+}
+inline uint64_t DetectionResult::frame_id() const {
+  // @@protoc_insertion_point(field_get:data_types.DetectionResult.frame_id)
+  return _internal_frame_id();
+}
+inline void DetectionResult::_internal_set_frame_id(uint64_t value) {
+  
+  _impl_.frame_id_ = value;
+}
+inline void DetectionResult::set_frame_id(uint64_t value) {
+  _internal_set_frame_id(value);
+  // @@protoc_insertion_point(field_set:data_types.DetectionResult.frame_id)
+}
+
+// repeated .data_types.InstanceMask masks = 4;
+inline int DetectionResult::_internal_masks_size() const {
+  return _impl_.masks_.size();
+}
+inline int DetectionResult::masks_size() const {
+  return _internal_masks_size();
+}
+inline void DetectionResult::clear_masks() {
+  _impl_.masks_.Clear();
+}
+inline ::data_types::InstanceMask* DetectionResult::mutable_masks(int index) {
+  // @@protoc_insertion_point(field_mutable:data_types.DetectionResult.masks)
+  return _impl_.masks_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::data_types::InstanceMask >*
+DetectionResult::mutable_masks() {
+  // @@protoc_insertion_point(field_mutable_list:data_types.DetectionResult.masks)
+  return &_impl_.masks_;
+}
+inline const ::data_types::InstanceMask& DetectionResult::_internal_masks(int index) const {
+  return _impl_.masks_.Get(index);
+}
+inline const ::data_types::InstanceMask& DetectionResult::masks(int index) const {
+  // @@protoc_insertion_point(field_get:data_types.DetectionResult.masks)
+  return _internal_masks(index);
+}
+inline ::data_types::InstanceMask* DetectionResult::_internal_add_masks() {
+  return _impl_.masks_.Add();
+}
+inline ::data_types::InstanceMask* DetectionResult::add_masks() {
+  ::data_types::InstanceMask* _add = _internal_add_masks();
+  // @@protoc_insertion_point(field_add:data_types.DetectionResult.masks)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::data_types::InstanceMask >&
+DetectionResult::masks() const {
+  // @@protoc_insertion_point(field_list:data_types.DetectionResult.masks)
+  return _impl_.masks_;
+}
+
+// string backend = 5;
+inline void DetectionResult::clear_backend() {
+  _impl_.backend_.ClearToEmpty();
+}
+inline const std::string& DetectionResult::backend() const {
+  // @@protoc_insertion_point(field_get:data_types.DetectionResult.backend)
+  return _internal_backend();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DetectionResult::set_backend(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.backend_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:data_types.DetectionResult.backend)
+}
+inline std::string* DetectionResult::mutable_backend() {
+  std::string* _s = _internal_mutable_backend();
+  // @@protoc_insertion_point(field_mutable:data_types.DetectionResult.backend)
+  return _s;
+}
+inline const std::string& DetectionResult::_internal_backend() const {
+  return _impl_.backend_.Get();
+}
+inline void DetectionResult::_internal_set_backend(const std::string& value) {
+  
+  _impl_.backend_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DetectionResult::_internal_mutable_backend() {
+  
+  return _impl_.backend_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DetectionResult::release_backend() {
+  // @@protoc_insertion_point(field_release:data_types.DetectionResult.backend)
+  return _impl_.backend_.Release();
+}
+inline void DetectionResult::set_allocated_backend(std::string* backend) {
+  if (backend != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.backend_.SetAllocated(backend, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.backend_.IsDefault()) {
+    _impl_.backend_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:data_types.DetectionResult.backend)
+}
+
+// uint32 camera_id = 6;
+inline void DetectionResult::clear_camera_id() {
+  _impl_.camera_id_ = 0u;
+}
+inline uint32_t DetectionResult::_internal_camera_id() const {
+  return _impl_.camera_id_;
+}
+inline uint32_t DetectionResult::camera_id() const {
+  // @@protoc_insertion_point(field_get:data_types.DetectionResult.camera_id)
+  return _internal_camera_id();
+}
+inline void DetectionResult::_internal_set_camera_id(uint32_t value) {
+  
+  _impl_.camera_id_ = value;
+}
+inline void DetectionResult::set_camera_id(uint32_t value) {
+  _internal_set_camera_id(value);
+  // @@protoc_insertion_point(field_set:data_types.DetectionResult.camera_id)
+}
+
+// -------------------------------------------------------------------
+
+// DeviceStatus
+
+// string device_id = 1;
+inline void DeviceStatus::clear_device_id() {
+  _impl_.device_id_.ClearToEmpty();
+}
+inline const std::string& DeviceStatus::device_id() const {
+  // @@protoc_insertion_point(field_get:data_types.DeviceStatus.device_id)
+  return _internal_device_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeviceStatus::set_device_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.device_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:data_types.DeviceStatus.device_id)
+}
+inline std::string* DeviceStatus::mutable_device_id() {
+  std::string* _s = _internal_mutable_device_id();
+  // @@protoc_insertion_point(field_mutable:data_types.DeviceStatus.device_id)
+  return _s;
+}
+inline const std::string& DeviceStatus::_internal_device_id() const {
+  return _impl_.device_id_.Get();
+}
+inline void DeviceStatus::_internal_set_device_id(const std::string& value) {
+  
+  _impl_.device_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DeviceStatus::_internal_mutable_device_id() {
+  
+  return _impl_.device_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DeviceStatus::release_device_id() {
+  // @@protoc_insertion_point(field_release:data_types.DeviceStatus.device_id)
+  return _impl_.device_id_.Release();
+}
+inline void DeviceStatus::set_allocated_device_id(std::string* device_id) {
+  if (device_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.device_id_.SetAllocated(device_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.device_id_.IsDefault()) {
+    _impl_.device_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:data_types.DeviceStatus.device_id)
+}
+
+// .data_types.DeviceStatus.ConnectionState state = 2;
+inline void DeviceStatus::clear_state() {
+  _impl_.state_ = 0;
+}
+inline ::data_types::DeviceStatus_ConnectionState DeviceStatus::_internal_state() const {
+  return static_cast< ::data_types::DeviceStatus_ConnectionState >(_impl_.state_);
+}
+inline ::data_types::DeviceStatus_ConnectionState DeviceStatus::state() const {
+  // @@protoc_insertion_point(field_get:data_types.DeviceStatus.state)
+  return _internal_state();
+}
+inline void DeviceStatus::_internal_set_state(::data_types::DeviceStatus_ConnectionState value) {
+  
+  _impl_.state_ = value;
+}
+inline void DeviceStatus::set_state(::data_types::DeviceStatus_ConnectionState value) {
+  _internal_set_state(value);
+  // @@protoc_insertion_point(field_set:data_types.DeviceStatus.state)
+}
+
+// float cpu_temperature_c = 3;
+inline void DeviceStatus::clear_cpu_temperature_c() {
+  _impl_.cpu_temperature_c_ = 0;
+}
+inline float DeviceStatus::_internal_cpu_temperature_c() const {
+  return _impl_.cpu_temperature_c_;
+}
+inline float DeviceStatus::cpu_temperature_c() const {
+  // @@protoc_insertion_point(field_get:data_types.DeviceStatus.cpu_temperature_c)
+  return _internal_cpu_temperature_c();
+}
+inline void DeviceStatus::_internal_set_cpu_temperature_c(float value) {
+  
+  _impl_.cpu_temperature_c_ = value;
+}
+inline void DeviceStatus::set_cpu_temperature_c(float value) {
+  _internal_set_cpu_temperature_c(value);
+  // @@protoc_insertion_point(field_set:data_types.DeviceStatus.cpu_temperature_c)
+}
+
+// uint32 frame_rate_fps = 4;
+inline void DeviceStatus::clear_frame_rate_fps() {
+  _impl_.frame_rate_fps_ = 0u;
+}
+inline uint32_t DeviceStatus::_internal_frame_rate_fps() const {
+  return _impl_.frame_rate_fps_;
+}
+inline uint32_t DeviceStatus::frame_rate_fps() const {
+  // @@protoc_insertion_point(field_get:data_types.DeviceStatus.frame_rate_fps)
+  return _internal_frame_rate_fps();
+}
+inline void DeviceStatus::_internal_set_frame_rate_fps(uint32_t value) {
+  
+  _impl_.frame_rate_fps_ = value;
+}
+inline void DeviceStatus::set_frame_rate_fps(uint32_t value) {
+  _internal_set_frame_rate_fps(value);
+  // @@protoc_insertion_point(field_set:data_types.DeviceStatus.frame_rate_fps)
+}
+
+// uint32 processing_latency_ms = 5;
+inline void DeviceStatus::clear_processing_latency_ms() {
+  _impl_.processing_latency_ms_ = 0u;
+}
+inline uint32_t DeviceStatus::_internal_processing_latency_ms() const {
+  return _impl_.processing_latency_ms_;
+}
+inline uint32_t DeviceStatus::processing_latency_ms() const {
+  // @@protoc_insertion_point(field_get:data_types.DeviceStatus.processing_latency_ms)
+  return _internal_processing_latency_ms();
+}
+inline void DeviceStatus::_internal_set_processing_latency_ms(uint32_t value) {
+  
+  _impl_.processing_latency_ms_ = value;
+}
+inline void DeviceStatus::set_processing_latency_ms(uint32_t value) {
+  _internal_set_processing_latency_ms(value);
+  // @@protoc_insertion_point(field_set:data_types.DeviceStatus.processing_latency_ms)
+}
+
+// string firmware_version = 6;
+inline void DeviceStatus::clear_firmware_version() {
+  _impl_.firmware_version_.ClearToEmpty();
+}
+inline const std::string& DeviceStatus::firmware_version() const {
+  // @@protoc_insertion_point(field_get:data_types.DeviceStatus.firmware_version)
+  return _internal_firmware_version();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeviceStatus::set_firmware_version(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.firmware_version_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:data_types.DeviceStatus.firmware_version)
+}
+inline std::string* DeviceStatus::mutable_firmware_version() {
+  std::string* _s = _internal_mutable_firmware_version();
+  // @@protoc_insertion_point(field_mutable:data_types.DeviceStatus.firmware_version)
+  return _s;
+}
+inline const std::string& DeviceStatus::_internal_firmware_version() const {
+  return _impl_.firmware_version_.Get();
+}
+inline void DeviceStatus::_internal_set_firmware_version(const std::string& value) {
+  
+  _impl_.firmware_version_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DeviceStatus::_internal_mutable_firmware_version() {
+  
+  return _impl_.firmware_version_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DeviceStatus::release_firmware_version() {
+  // @@protoc_insertion_point(field_release:data_types.DeviceStatus.firmware_version)
+  return _impl_.firmware_version_.Release();
+}
+inline void DeviceStatus::set_allocated_firmware_version(std::string* firmware_version) {
+  if (firmware_version != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.firmware_version_.SetAllocated(firmware_version, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.firmware_version_.IsDefault()) {
+    _impl_.firmware_version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:data_types.DeviceStatus.firmware_version)
+}
+
+// bool is_sleeping = 7;
+inline void DeviceStatus::clear_is_sleeping() {
+  _impl_.is_sleeping_ = false;
+}
+inline bool DeviceStatus::_internal_is_sleeping() const {
+  return _impl_.is_sleeping_;
+}
+inline bool DeviceStatus::is_sleeping() const {
+  // @@protoc_insertion_point(field_get:data_types.DeviceStatus.is_sleeping)
+  return _internal_is_sleeping();
+}
+inline void DeviceStatus::_internal_set_is_sleeping(bool value) {
+  
+  _impl_.is_sleeping_ = value;
+}
+inline void DeviceStatus::set_is_sleeping(bool value) {
+  _internal_set_is_sleeping(value);
+  // @@protoc_insertion_point(field_set:data_types.DeviceStatus.is_sleeping)
+}
+
+// string profile = 8;
+inline void DeviceStatus::clear_profile() {
+  _impl_.profile_.ClearToEmpty();
+}
+inline const std::string& DeviceStatus::profile() const {
+  // @@protoc_insertion_point(field_get:data_types.DeviceStatus.profile)
+  return _internal_profile();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeviceStatus::set_profile(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.profile_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:data_types.DeviceStatus.profile)
+}
+inline std::string* DeviceStatus::mutable_profile() {
+  std::string* _s = _internal_mutable_profile();
+  // @@protoc_insertion_point(field_mutable:data_types.DeviceStatus.profile)
+  return _s;
+}
+inline const std::string& DeviceStatus::_internal_profile() const {
+  return _impl_.profile_.Get();
+}
+inline void DeviceStatus::_internal_set_profile(const std::string& value) {
+  
+  _impl_.profile_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DeviceStatus::_internal_mutable_profile() {
+  
+  return _impl_.profile_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DeviceStatus::release_profile() {
+  // @@protoc_insertion_point(field_release:data_types.DeviceStatus.profile)
+  return _impl_.profile_.Release();
+}
+inline void DeviceStatus::set_allocated_profile(std::string* profile) {
+  if (profile != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.profile_.SetAllocated(profile, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.profile_.IsDefault()) {
+    _impl_.profile_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:data_types.DeviceStatus.profile)
+}
+
+// bool profile_auto = 9;
+inline void DeviceStatus::clear_profile_auto() {
+  _impl_.profile_auto_ = false;
+}
+inline bool DeviceStatus::_internal_profile_auto() const {
+  return _impl_.profile_auto_;
+}
+inline bool DeviceStatus::profile_auto() const {
+  // @@protoc_insertion_point(field_get:data_types.DeviceStatus.profile_auto)
+  return _internal_profile_auto();
+}
+inline void DeviceStatus::_internal_set_profile_auto(bool value) {
+  
+  _impl_.profile_auto_ = value;
+}
+inline void DeviceStatus::set_profile_auto(bool value) {
+  _internal_set_profile_auto(value);
+  // @@protoc_insertion_point(field_set:data_types.DeviceStatus.profile_auto)
+}
+
+// string profile_reason = 10;
+inline void DeviceStatus::clear_profile_reason() {
+  _impl_.profile_reason_.ClearToEmpty();
+}
+inline const std::string& DeviceStatus::profile_reason() const {
+  // @@protoc_insertion_point(field_get:data_types.DeviceStatus.profile_reason)
+  return _internal_profile_reason();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeviceStatus::set_profile_reason(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.profile_reason_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:data_types.DeviceStatus.profile_reason)
+}
+inline std::string* DeviceStatus::mutable_profile_reason() {
+  std::string* _s = _internal_mutable_profile_reason();
+  // @@protoc_insertion_point(field_mutable:data_types.DeviceStatus.profile_reason)
+  return _s;
+}
+inline const std::string& DeviceStatus::_internal_profile_reason() const {
+  return _impl_.profile_reason_.Get();
+}
+inline void DeviceStatus::_internal_set_profile_reason(const std::string& value) {
+  
+  _impl_.profile_reason_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DeviceStatus::_internal_mutable_profile_reason() {
+  
+  return _impl_.profile_reason_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DeviceStatus::release_profile_reason() {
+  // @@protoc_insertion_point(field_release:data_types.DeviceStatus.profile_reason)
+  return _impl_.profile_reason_.Release();
+}
+inline void DeviceStatus::set_allocated_profile_reason(std::string* profile_reason) {
+  if (profile_reason != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.profile_reason_.SetAllocated(profile_reason, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.profile_reason_.IsDefault()) {
+    _impl_.profile_reason_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:data_types.DeviceStatus.profile_reason)
+}
+
+// float battery_percent = 11;
+inline void DeviceStatus::clear_battery_percent() {
+  _impl_.battery_percent_ = 0;
+}
+inline float DeviceStatus::_internal_battery_percent() const {
+  return _impl_.battery_percent_;
+}
+inline float DeviceStatus::battery_percent() const {
+  // @@protoc_insertion_point(field_get:data_types.DeviceStatus.battery_percent)
+  return _internal_battery_percent();
+}
+inline void DeviceStatus::_internal_set_battery_percent(float value) {
+  
+  _impl_.battery_percent_ = value;
+}
+inline void DeviceStatus::set_battery_percent(float value) {
+  _internal_set_battery_percent(value);
+  // @@protoc_insertion_point(field_set:data_types.DeviceStatus.battery_percent)
+}
+
+// uint32 active_streams = 12;
+inline void DeviceStatus::clear_active_streams() {
+  _impl_.active_streams_ = 0u;
+}
+inline uint32_t DeviceStatus::_internal_active_streams() const {
+  return _impl_.active_streams_;
+}
+inline uint32_t DeviceStatus::active_streams() const {
+  // @@protoc_insertion_point(field_get:data_types.DeviceStatus.active_streams)
+  return _internal_active_streams();
+}
+inline void DeviceStatus::_internal_set_active_streams(uint32_t value) {
+  
+  _impl_.active_streams_ = value;
+}
+inline void DeviceStatus::set_active_streams(uint32_t value) {
+  _internal_set_active_streams(value);
+  // @@protoc_insertion_point(field_set:data_types.DeviceStatus.active_streams)
+}
+
+// uint32 jpeg_quality = 13;
+inline void DeviceStatus::clear_jpeg_quality() {
+  _impl_.jpeg_quality_ = 0u;
+}
+inline uint32_t DeviceStatus::_internal_jpeg_quality() const {
+  return _impl_.jpeg_quality_;
+}
+inline uint32_t DeviceStatus::jpeg_quality() const {
+  // @@protoc_insertion_point(field_get:data_types.DeviceStatus.jpeg_quality)
+  return _internal_jpeg_quality();
+}
+inline void DeviceStatus::_internal_set_jpeg_quality(uint32_t value) {
+  
+  _impl_.jpeg_quality_ = value;
+}
+inline void DeviceStatus::set_jpeg_quality(uint32_t value) {
+  _internal_set_jpeg_quality(value);
+  // @@protoc_insertion_point(field_set:data_types.DeviceStatus.jpeg_quality)
+}
+
+// -------------------------------------------------------------------
+
+// Command
+
+// .data_types.ConfigRequest config_request = 1;
+inline bool Command::_internal_has_config_request() const {
+  return command_type_case() == kConfigRequest;
+}
+inline bool Command::has_config_request() const {
+  return _internal_has_config_request();
+}
+inline void Command::set_has_config_request() {
+  _impl_._oneof_case_[0] = kConfigRequest;
+}
+inline void Command::clear_config_request() {
+  if (_internal_has_config_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.command_type_.config_request_;
+    }
+    clear_has_command_type();
+  }
+}
+inline ::data_types::ConfigRequest* Command::release_config_request() {
+  // @@protoc_insertion_point(field_release:data_types.Command.config_request)
+  if (_internal_has_config_request()) {
+    clear_has_command_type();
+    ::data_types::ConfigRequest* temp = _impl_.command_type_.config_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.command_type_.config_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::data_types::ConfigRequest& Command::_internal_config_request() const {
+  return _internal_has_config_request()
+      ? *_impl_.command_type_.config_request_
+      : reinterpret_cast< ::data_types::ConfigRequest&>(::data_types::_ConfigRequest_default_instance_);
+}
+inline const ::data_types::ConfigRequest& Command::config_request() const {
+  // @@protoc_insertion_point(field_get:data_types.Command.config_request)
+  return _internal_config_request();
+}
+inline ::data_types::ConfigRequest* Command::unsafe_arena_release_config_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:data_types.Command.config_request)
+  if (_internal_has_config_request()) {
+    clear_has_command_type();
+    ::data_types::ConfigRequest* temp = _impl_.command_type_.config_request_;
+    _impl_.command_type_.config_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Command::unsafe_arena_set_allocated_config_request(::data_types::ConfigRequest* config_request) {
+  clear_command_type();
+  if (config_request) {
+    set_has_config_request();
+    _impl_.command_type_.config_request_ = config_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.Command.config_request)
+}
+inline ::data_types::ConfigRequest* Command::_internal_mutable_config_request() {
+  if (!_internal_has_config_request()) {
+    clear_command_type();
+    set_has_config_request();
+    _impl_.command_type_.config_request_ = CreateMaybeMessage< ::data_types::ConfigRequest >(GetArenaForAllocation());
+  }
+  return _impl_.command_type_.config_request_;
+}
+inline ::data_types::ConfigRequest* Command::mutable_config_request() {
+  ::data_types::ConfigRequest* _msg = _internal_mutable_config_request();
+  // @@protoc_insertion_point(field_mutable:data_types.Command.config_request)
+  return _msg;
+}
+
+// .data_types.ControlAction control_action = 2;
+inline bool Command::_internal_has_control_action() const {
+  return command_type_case() == kControlAction;
+}
+inline bool Command::has_control_action() const {
+  return _internal_has_control_action();
+}
+inline void Command::set_has_control_action() {
+  _impl_._oneof_case_[0] = kControlAction;
+}
+inline void Command::clear_control_action() {
+  if (_internal_has_control_action()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.command_type_.control_action_;
+    }
+    clear_has_command_type();
+  }
+}
+inline ::data_types::ControlAction* Command::release_control_action() {
+  // @@protoc_insertion_point(field_release:data_types.Command.control_action)
+  if (_internal_has_control_action()) {
+    clear_has_command_type();
+    ::data_types::ControlAction* temp = _impl_.command_type_.control_action_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.command_type_.control_action_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::data_types::ControlAction& Command::_internal_control_action() const {
+  return _internal_has_control_action()
+      ? *_impl_.command_type_.control_action_
+      : reinterpret_cast< ::data_types::ControlAction&>(::data_types::_ControlAction_default_instance_);
+}
+inline const ::data_types::ControlAction& Command::control_action() const {
+  // @@protoc_insertion_point(field_get:data_types.Command.control_action)
+  return _internal_control_action();
+}
+inline ::data_types::ControlAction* Command::unsafe_arena_release_control_action() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:data_types.Command.control_action)
+  if (_internal_has_control_action()) {
+    clear_has_command_type();
+    ::data_types::ControlAction* temp = _impl_.command_type_.control_action_;
+    _impl_.command_type_.control_action_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Command::unsafe_arena_set_allocated_control_action(::data_types::ControlAction* control_action) {
+  clear_command_type();
+  if (control_action) {
+    set_has_control_action();
+    _impl_.command_type_.control_action_ = control_action;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.Command.control_action)
+}
+inline ::data_types::ControlAction* Command::_internal_mutable_control_action() {
+  if (!_internal_has_control_action()) {
+    clear_command_type();
+    set_has_control_action();
+    _impl_.command_type_.control_action_ = CreateMaybeMessage< ::data_types::ControlAction >(GetArenaForAllocation());
+  }
+  return _impl_.command_type_.control_action_;
+}
+inline ::data_types::ControlAction* Command::mutable_control_action() {
+  ::data_types::ControlAction* _msg = _internal_mutable_control_action();
+  // @@protoc_insertion_point(field_mutable:data_types.Command.control_action)
+  return _msg;
+}
 
-// bytes image_data = 1;
-inline void CameraFrame::clear_image_data() {
-  image_data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// .data_types.Heartbeat heartbeat = 3;
+inline bool Command::_internal_has_heartbeat() const {
+  return command_type_case() == kHeartbeat;
 }
-inline const std::string& CameraFrame::image_data() const {
-  // @@protoc_insertion_point(field_get:data_types.CameraFrame.image_data)
-  return _internal_image_data();
+inline bool Command::has_heartbeat() const {
+  return _internal_has_heartbeat();
 }
-inline void CameraFrame::set_image_data(const std::string& value) {
-  _internal_set_image_data(value);
-  // @@protoc_insertion_point(field_set:data_types.CameraFrame.image_data)
+inline void Command::set_has_heartbeat() {
+  _impl_._oneof_case_[0] = kHeartbeat;
 }
-inline std::string* CameraFrame::mutable_image_data() {
-  // @@protoc_insertion_point(field_mutable:data_types.CameraFrame.image_data)
-  return _internal_mutable_image_data();
+inline void Command::clear_heartbeat() {
+  if (_internal_has_heartbeat()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.command_type_.heartbeat_;
+    }
+    clear_has_command_type();
+  }
 }
-inline const std::string& CameraFrame::_internal_image_data() const {
-  return image_data_.GetNoArena();
+inline ::data_types::Heartbeat* Command::release_heartbeat() {
+  // @@protoc_insertion_point(field_release:data_types.Command.heartbeat)
+  if (_internal_has_heartbeat()) {
+    clear_has_command_type();
+    ::data_types::Heartbeat* temp = _impl_.command_type_.heartbeat_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.command_type_.heartbeat_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void CameraFrame::_internal_set_image_data(const std::string& value) {
-  
-  image_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+inline const ::data_types::Heartbeat& Command::_internal_heartbeat() const {
+  return _internal_has_heartbeat()
+      ? *_impl_.command_type_.heartbeat_
+      : reinterpret_cast< ::data_types::Heartbeat&>(::data_types::_Heartbeat_default_instance_);
 }
-inline void CameraFrame::set_image_data(std::string&& value) {
-  
-  image_data_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:data_types.CameraFrame.image_data)
+inline const ::data_types::Heartbeat& Command::heartbeat() const {
+  // @@protoc_insertion_point(field_get:data_types.Command.heartbeat)
+  return _internal_heartbeat();
 }
-inline void CameraFrame::set_image_data(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  image_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:data_types.CameraFrame.image_data)
+inline ::data_types::Heartbeat* Command::unsafe_arena_release_heartbeat() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:data_types.Command.heartbeat)
+  if (_internal_has_heartbeat()) {
+    clear_has_command_type();
+    ::data_types::Heartbeat* temp = _impl_.command_type_.heartbeat_;
+    _impl_.command_type_.heartbeat_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void CameraFrame::set_image_data(const void* value, size_t size) {
-  
-  image_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:data_types.CameraFrame.image_data)
+inline void Command::unsafe_arena_set_allocated_heartbeat(::data_types::Heartbeat* heartbeat) {
+  clear_command_type();
+  if (heartbeat) {
+    set_has_heartbeat();
+    _impl_.command_type_.heartbeat_ = heartbeat;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.Command.heartbeat)
 }
-inline std::string* CameraFrame::_internal_mutable_image_data() {
-  
-  return image_data_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline ::data_types::Heartbeat* Command::_internal_mutable_heartbeat() {
+  if (!_internal_has_heartbeat()) {
+    clear_command_type();
+    set_has_heartbeat();
+    _impl_.command_type_.heartbeat_ = CreateMaybeMessage< ::data_types::Heartbeat >(GetArenaForAllocation());
+  }
+  return _impl_.command_type_.heartbeat_;
 }
-inline std::string* CameraFrame::release_image_data() {
-  // @@protoc_insertion_point(field_release:data_types.CameraFrame.image_data)
-  
-  return image_data_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline ::data_types::Heartbeat* Command::mutable_heartbeat() {
+  ::data_types::Heartbeat* _msg = _internal_mutable_heartbeat();
+  // @@protoc_insertion_point(field_mutable:data_types.Command.heartbeat)
+  return _msg;
 }
-inline void CameraFrame::set_allocated_image_data(std::string* image_data) {
-  if (image_data != nullptr) {
-    
+
+// .data_types.DetectionResult detection_result = 4;
+inline bool Command::_internal_has_detection_result() const {
+  return command_type_case() == kDetectionResult;
+}
+inline bool Command::has_detection_result() const {
+  return _internal_has_detection_result();
+}
+inline void Command::set_has_detection_result() {
+  _impl_._oneof_case_[0] = kDetectionResult;
+}
+inline void Command::clear_detection_result() {
+  if (_internal_has_detection_result()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.command_type_.detection_result_;
+    }
+    clear_has_command_type();
+  }
+}
+inline ::data_types::DetectionResult* Command::release_detection_result() {
+  // @@protoc_insertion_point(field_release:data_types.Command.detection_result)
+  if (_internal_has_detection_result()) {
+    clear_has_command_type();
+    ::data_types::DetectionResult* temp = _impl_.command_type_.detection_result_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.command_type_.detection_result_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  image_data_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), image_data);
-  // @@protoc_insertion_point(field_set_allocated:data_types.CameraFrame.image_data)
 }
-
-// uint32 width = 2;
-inline void CameraFrame::clear_width() {
-  width_ = 0u;
+inline const ::data_types::DetectionResult& Command::_internal_detection_result() const {
+  return _internal_has_detection_result()
+      ? *_impl_.command_type_.detection_result_
+      : reinterpret_cast< ::data_types::DetectionResult&>(::data_types::_DetectionResult_default_instance_);
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraFrame::_internal_width() const {
-  return width_;
+inline const ::data_types::DetectionResult& Command::detection_result() const {
+  // @@protoc_insertion_point(field_get:data_types.Command.detection_result)
+  return _internal_detection_result();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraFrame::width() const {
-  // @@protoc_insertion_point(field_get:data_types.CameraFrame.width)
-  return _internal_width();
+inline ::data_types::DetectionResult* Command::unsafe_arena_release_detection_result() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:data_types.Command.detection_result)
+  if (_internal_has_detection_result()) {
+    clear_has_command_type();
+    ::data_types::DetectionResult* temp = _impl_.command_type_.detection_result_;
+    _impl_.command_type_.detection_result_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void CameraFrame::_internal_set_width(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  
-  width_ = value;
+inline void Command::unsafe_arena_set_allocated_detection_result(::data_types::DetectionResult* detection_result) {
+  clear_command_type();
+  if (detection_result) {
+    set_has_detection_result();
+    _impl_.command_type_.detection_result_ = detection_result;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.Command.detection_result)
 }
-inline void CameraFrame::set_width(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_width(value);
-  // @@protoc_insertion_point(field_set:data_types.CameraFrame.width)
+inline ::data_types::DetectionResult* Command::_internal_mutable_detection_result() {
+  if (!_internal_has_detection_result()) {
+    clear_command_type();
+    set_has_detection_result();
+    _impl_.command_type_.detection_result_ = CreateMaybeMessage< ::data_types::DetectionResult >(GetArenaForAllocation());
+  }
+  return _impl_.command_type_.detection_result_;
+}
+inline ::data_types::DetectionResult* Command::mutable_detection_result() {
+  ::data_types::DetectionResult* _msg = _internal_mutable_detection_result();
+  // @@protoc_insertion_point(field_mutable:data_types.Command.detection_result)
+  return _msg;
 }
 
-// uint32 height = 3;
-inline void CameraFrame::clear_height() {
-  height_ = 0u;
+// .data_types.CameraFrame camera_frame = 5;
+inline bool Command::_internal_has_camera_frame() const {
+  return command_type_case() == kCameraFrame;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraFrame::_internal_height() const {
-  return height_;
+inline bool Command::has_camera_frame() const {
+  return _internal_has_camera_frame();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraFrame::height() const {
-  // @@protoc_insertion_point(field_get:data_types.CameraFrame.height)
-  return _internal_height();
+inline void Command::set_has_camera_frame() {
+  _impl_._oneof_case_[0] = kCameraFrame;
 }
-inline void CameraFrame::_internal_set_height(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  
-  height_ = value;
+inline void Command::clear_camera_frame() {
+  if (_internal_has_camera_frame()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.command_type_.camera_frame_;
+    }
+    clear_has_command_type();
+  }
 }
-inline void CameraFrame::set_height(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_height(value);
-  // @@protoc_insertion_point(field_set:data_types.CameraFrame.height)
+inline ::data_types::CameraFrame* Command::release_camera_frame() {
+  // @@protoc_insertion_point(field_release:data_types.Command.camera_frame)
+  if (_internal_has_camera_frame()) {
+    clear_has_command_type();
+    ::data_types::CameraFrame* temp = _impl_.command_type_.camera_frame_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.command_type_.camera_frame_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::data_types::CameraFrame& Command::_internal_camera_frame() const {
+  return _internal_has_camera_frame()
+      ? *_impl_.command_type_.camera_frame_
+      : reinterpret_cast< ::data_types::CameraFrame&>(::data_types::_CameraFrame_default_instance_);
+}
+inline const ::data_types::CameraFrame& Command::camera_frame() const {
+  // @@protoc_insertion_point(field_get:data_types.Command.camera_frame)
+  return _internal_camera_frame();
+}
+inline ::data_types::CameraFrame* Command::unsafe_arena_release_camera_frame() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:data_types.Command.camera_frame)
+  if (_internal_has_camera_frame()) {
+    clear_has_command_type();
+    ::data_types::CameraFrame* temp = _impl_.command_type_.camera_frame_;
+    _impl_.command_type_.camera_frame_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Command::unsafe_arena_set_allocated_camera_frame(::data_types::CameraFrame* camera_frame) {
+  clear_command_type();
+  if (camera_frame) {
+    set_has_camera_frame();
+    _impl_.command_type_.camera_frame_ = camera_frame;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.Command.camera_frame)
+}
+inline ::data_types::CameraFrame* Command::_internal_mutable_camera_frame() {
+  if (!_internal_has_camera_frame()) {
+    clear_command_type();
+    set_has_camera_frame();
+    _impl_.command_type_.camera_frame_ = CreateMaybeMessage< ::data_types::CameraFrame >(GetArenaForAllocation());
+  }
+  return _impl_.command_type_.camera_frame_;
+}
+inline ::data_types::CameraFrame* Command::mutable_camera_frame() {
+  ::data_types::CameraFrame* _msg = _internal_mutable_camera_frame();
+  // @@protoc_insertion_point(field_mutable:data_types.Command.camera_frame)
+  return _msg;
 }
 
-// .google.protobuf.Timestamp timestamp = 4;
-inline bool CameraFrame::_internal_has_timestamp() const {
-  return this != internal_default_instance() && timestamp_ != nullptr;
+// .data_types.FrameHeader frame_header = 6;
+inline bool Command::_internal_has_frame_header() const {
+  return command_type_case() == kFrameHeader;
 }
-inline bool CameraFrame::has_timestamp() const {
-  return _internal_has_timestamp();
+inline bool Command::has_frame_header() const {
+  return _internal_has_frame_header();
 }
-inline const PROTOBUF_NAMESPACE_ID::Timestamp& CameraFrame::_internal_timestamp() const {
-  const PROTOBUF_NAMESPACE_ID::Timestamp* p = timestamp_;
-  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Timestamp*>(
-      &PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+inline void Command::set_has_frame_header() {
+  _impl_._oneof_case_[0] = kFrameHeader;
 }
-inline const PROTOBUF_NAMESPACE_ID::Timestamp& CameraFrame::timestamp() const {
-  // @@protoc_insertion_point(field_get:data_types.CameraFrame.timestamp)
-  return _internal_timestamp();
+inline void Command::clear_frame_header() {
+  if (_internal_has_frame_header()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.command_type_.frame_header_;
+    }
+    clear_has_command_type();
+  }
 }
-inline PROTOBUF_NAMESPACE_ID::Timestamp* CameraFrame::release_timestamp() {
-  // @@protoc_insertion_point(field_release:data_types.CameraFrame.timestamp)
-  
-  PROTOBUF_NAMESPACE_ID::Timestamp* temp = timestamp_;
-  timestamp_ = nullptr;
-  return temp;
+inline ::data_types::FrameHeader* Command::release_frame_header() {
+  // @@protoc_insertion_point(field_release:data_types.Command.frame_header)
+  if (_internal_has_frame_header()) {
+    clear_has_command_type();
+    ::data_types::FrameHeader* temp = _impl_.command_type_.frame_header_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.command_type_.frame_header_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline PROTOBUF_NAMESPACE_ID::Timestamp* CameraFrame::_internal_mutable_timestamp() {
-  
-  if (timestamp_ == nullptr) {
-    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaNoVirtual());
-    timestamp_ = p;
+inline const ::data_types::FrameHeader& Command::_internal_frame_header() const {
+  return _internal_has_frame_header()
+      ? *_impl_.command_type_.frame_header_
+      : reinterpret_cast< ::data_types::FrameHeader&>(::data_types::_FrameHeader_default_instance_);
+}
+inline const ::data_types::FrameHeader& Command::frame_header() const {
+  // @@protoc_insertion_point(field_get:data_types.Command.frame_header)
+  return _internal_frame_header();
+}
+inline ::data_types::FrameHeader* Command::unsafe_arena_release_frame_header() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:data_types.Command.frame_header)
+  if (_internal_has_frame_header()) {
+    clear_has_command_type();
+    ::data_types::FrameHeader* temp = _impl_.command_type_.frame_header_;
+    _impl_.command_type_.frame_header_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
   }
-  return timestamp_;
 }
-inline PROTOBUF_NAMESPACE_ID::Timestamp* CameraFrame::mutable_timestamp() {
-  // @@protoc_insertion_point(field_mutable:data_types.CameraFrame.timestamp)
-  return _internal_mutable_timestamp();
+inline void Command::unsafe_arena_set_allocated_frame_header(::data_types::FrameHeader* frame_header) {
+  clear_command_type();
+  if (frame_header) {
+    set_has_frame_header();
+    _impl_.command_type_.frame_header_ = frame_header;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.Command.frame_header)
 }
-inline void CameraFrame::set_allocated_timestamp(PROTOBUF_NAMESPACE_ID::Timestamp* timestamp) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(timestamp_);
+inline ::data_types::FrameHeader* Command::_internal_mutable_frame_header() {
+  if (!_internal_has_frame_header()) {
+    clear_command_type();
+    set_has_frame_header();
+    _impl_.command_type_.frame_header_ = CreateMaybeMessage< ::data_types::FrameHeader >(GetArenaForAllocation());
   }
-  if (timestamp) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(timestamp)->GetArena();
-    if (message_arena != submessage_arena) {
-      timestamp = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, timestamp, submessage_arena);
+  return _impl_.command_type_.frame_header_;
+}
+inline ::data_types::FrameHeader* Command::mutable_frame_header() {
+  ::data_types::FrameHeader* _msg = _internal_mutable_frame_header();
+  // @@protoc_insertion_point(field_mutable:data_types.Command.frame_header)
+  return _msg;
+}
+
+// .data_types.FrameChunk frame_chunk = 7;
+inline bool Command::_internal_has_frame_chunk() const {
+  return command_type_case() == kFrameChunk;
+}
+inline bool Command::has_frame_chunk() const {
+  return _internal_has_frame_chunk();
+}
+inline void Command::set_has_frame_chunk() {
+  _impl_._oneof_case_[0] = kFrameChunk;
+}
+inline void Command::clear_frame_chunk() {
+  if (_internal_has_frame_chunk()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.command_type_.frame_chunk_;
     }
-    
+    clear_has_command_type();
+  }
+}
+inline ::data_types::FrameChunk* Command::release_frame_chunk() {
+  // @@protoc_insertion_point(field_release:data_types.Command.frame_chunk)
+  if (_internal_has_frame_chunk()) {
+    clear_has_command_type();
+    ::data_types::FrameChunk* temp = _impl_.command_type_.frame_chunk_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.command_type_.frame_chunk_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  timestamp_ = timestamp;
-  // @@protoc_insertion_point(field_set_allocated:data_types.CameraFrame.timestamp)
 }
-
-// string format = 5;
-inline void CameraFrame::clear_format() {
-  format_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline const ::data_types::FrameChunk& Command::_internal_frame_chunk() const {
+  return _internal_has_frame_chunk()
+      ? *_impl_.command_type_.frame_chunk_
+      : reinterpret_cast< ::data_types::FrameChunk&>(::data_types::_FrameChunk_default_instance_);
 }
-inline const std::string& CameraFrame::format() const {
-  // @@protoc_insertion_point(field_get:data_types.CameraFrame.format)
-  return _internal_format();
+inline const ::data_types::FrameChunk& Command::frame_chunk() const {
+  // @@protoc_insertion_point(field_get:data_types.Command.frame_chunk)
+  return _internal_frame_chunk();
 }
-inline void CameraFrame::set_format(const std::string& value) {
-  _internal_set_format(value);
-  // @@protoc_insertion_point(field_set:data_types.CameraFrame.format)
+inline ::data_types::FrameChunk* Command::unsafe_arena_release_frame_chunk() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:data_types.Command.frame_chunk)
+  if (_internal_has_frame_chunk()) {
+    clear_has_command_type();
+    ::data_types::FrameChunk* temp = _impl_.command_type_.frame_chunk_;
+    _impl_.command_type_.frame_chunk_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline std::string* CameraFrame::mutable_format() {
-  // @@protoc_insertion_point(field_mutable:data_types.CameraFrame.format)
-  return _internal_mutable_format();
+inline void Command::unsafe_arena_set_allocated_frame_chunk(::data_types::FrameChunk* frame_chunk) {
+  clear_command_type();
+  if (frame_chunk) {
+    set_has_frame_chunk();
+    _impl_.command_type_.frame_chunk_ = frame_chunk;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.Command.frame_chunk)
 }
-inline const std::string& CameraFrame::_internal_format() const {
-  return format_.GetNoArena();
+inline ::data_types::FrameChunk* Command::_internal_mutable_frame_chunk() {
+  if (!_internal_has_frame_chunk()) {
+    clear_command_type();
+    set_has_frame_chunk();
+    _impl_.command_type_.frame_chunk_ = CreateMaybeMessage< ::data_types::FrameChunk >(GetArenaForAllocation());
+  }
+  return _impl_.command_type_.frame_chunk_;
 }
-inline void CameraFrame::_internal_set_format(const std::string& value) {
-  
-  format_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+inline ::data_types::FrameChunk* Command::mutable_frame_chunk() {
+  ::data_types::FrameChunk* _msg = _internal_mutable_frame_chunk();
+  // @@protoc_insertion_point(field_mutable:data_types.Command.frame_chunk)
+  return _msg;
 }
-inline void CameraFrame::set_format(std::string&& value) {
-  
-  format_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:data_types.CameraFrame.format)
+
+// .data_types.Capabilities hello = 8;
+inline bool Command::_internal_has_hello() const {
+  return command_type_case() == kHello;
+}
+inline bool Command::has_hello() const {
+  return _internal_has_hello();
+}
+inline void Command::set_has_hello() {
+  _impl_._oneof_case_[0] = kHello;
+}
+inline void Command::clear_hello() {
+  if (_internal_has_hello()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.command_type_.hello_;
+    }
+    clear_has_command_type();
+  }
+}
+inline ::data_types::Capabilities* Command::release_hello() {
+  // @@protoc_insertion_point(field_release:data_types.Command.hello)
+  if (_internal_has_hello()) {
+    clear_has_command_type();
+    ::data_types::Capabilities* temp = _impl_.command_type_.hello_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.command_type_.hello_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void CameraFrame::set_format(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  format_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:data_types.CameraFrame.format)
+inline const ::data_types::Capabilities& Command::_internal_hello() const {
+  return _internal_has_hello()
+      ? *_impl_.command_type_.hello_
+      : reinterpret_cast< ::data_types::Capabilities&>(::data_types::_Capabilities_default_instance_);
 }
-inline void CameraFrame::set_format(const char* value, size_t size) {
-  
-  format_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:data_types.CameraFrame.format)
+inline const ::data_types::Capabilities& Command::hello() const {
+  // @@protoc_insertion_point(field_get:data_types.Command.hello)
+  return _internal_hello();
 }
-inline std::string* CameraFrame::_internal_mutable_format() {
-  
-  return format_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline ::data_types::Capabilities* Command::unsafe_arena_release_hello() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:data_types.Command.hello)
+  if (_internal_has_hello()) {
+    clear_has_command_type();
+    ::data_types::Capabilities* temp = _impl_.command_type_.hello_;
+    _impl_.command_type_.hello_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline std::string* CameraFrame::release_format() {
-  // @@protoc_insertion_point(field_release:data_types.CameraFrame.format)
-  
-  return format_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void Command::unsafe_arena_set_allocated_hello(::data_types::Capabilities* hello) {
+  clear_command_type();
+  if (hello) {
+    set_has_hello();
+    _impl_.command_type_.hello_ = hello;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.Command.hello)
 }
-inline void CameraFrame::set_allocated_format(std::string* format) {
-  if (format != nullptr) {
-    
-  } else {
-    
+inline ::data_types::Capabilities* Command::_internal_mutable_hello() {
+  if (!_internal_has_hello()) {
+    clear_command_type();
+    set_has_hello();
+    _impl_.command_type_.hello_ = CreateMaybeMessage< ::data_types::Capabilities >(GetArenaForAllocation());
   }
-  format_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), format);
-  // @@protoc_insertion_point(field_set_allocated:data_types.CameraFrame.format)
+  return _impl_.command_type_.hello_;
+}
+inline ::data_types::Capabilities* Command::mutable_hello() {
+  ::data_types::Capabilities* _msg = _internal_mutable_hello();
+  // @@protoc_insertion_point(field_mutable:data_types.Command.hello)
+  return _msg;
 }
 
+inline bool Command::has_command_type() const {
+  return command_type_case() != COMMAND_TYPE_NOT_SET;
+}
+inline void Command::clear_has_command_type() {
+  _impl_._oneof_case_[0] = COMMAND_TYPE_NOT_SET;
+}
+inline Command::CommandTypeCase Command::command_type_case() const {
+  return Command::CommandTypeCase(_impl_._oneof_case_[0]);
+}
 // -------------------------------------------------------------------
 
-// BoundingBox
+// Capabilities
 
-// uint32 x_min = 1;
-inline void BoundingBox::clear_x_min() {
-  x_min_ = 0u;
+// uint32 protocol_version = 1;
+inline void Capabilities::clear_protocol_version() {
+  _impl_.protocol_version_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 BoundingBox::_internal_x_min() const {
-  return x_min_;
+inline uint32_t Capabilities::_internal_protocol_version() const {
+  return _impl_.protocol_version_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 BoundingBox::x_min() const {
-  // @@protoc_insertion_point(field_get:data_types.BoundingBox.x_min)
-  return _internal_x_min();
+inline uint32_t Capabilities::protocol_version() const {
+  // @@protoc_insertion_point(field_get:data_types.Capabilities.protocol_version)
+  return _internal_protocol_version();
 }
-inline void BoundingBox::_internal_set_x_min(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Capabilities::_internal_set_protocol_version(uint32_t value) {
   
-  x_min_ = value;
+  _impl_.protocol_version_ = value;
 }
-inline void BoundingBox::set_x_min(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_x_min(value);
-  // @@protoc_insertion_point(field_set:data_types.BoundingBox.x_min)
+inline void Capabilities::set_protocol_version(uint32_t value) {
+  _internal_set_protocol_version(value);
+  // @@protoc_insertion_point(field_set:data_types.Capabilities.protocol_version)
 }
 
-// uint32 y_min = 2;
-inline void BoundingBox::clear_y_min() {
-  y_min_ = 0u;
+// repeated string frame_formats = 2;
+inline int Capabilities::_internal_frame_formats_size() const {
+  return _impl_.frame_formats_.size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 BoundingBox::_internal_y_min() const {
-  return y_min_;
+inline int Capabilities::frame_formats_size() const {
+  return _internal_frame_formats_size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 BoundingBox::y_min() const {
-  // @@protoc_insertion_point(field_get:data_types.BoundingBox.y_min)
-  return _internal_y_min();
-}
-inline void BoundingBox::_internal_set_y_min(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  
-  y_min_ = value;
+inline void Capabilities::clear_frame_formats() {
+  _impl_.frame_formats_.Clear();
 }
-inline void BoundingBox::set_y_min(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_y_min(value);
-  // @@protoc_insertion_point(field_set:data_types.BoundingBox.y_min)
+inline std::string* Capabilities::add_frame_formats() {
+  std::string* _s = _internal_add_frame_formats();
+  // @@protoc_insertion_point(field_add_mutable:data_types.Capabilities.frame_formats)
+  return _s;
 }
-
-// uint32 x_max = 3;
-inline void BoundingBox::clear_x_max() {
-  x_max_ = 0u;
+inline const std::string& Capabilities::_internal_frame_formats(int index) const {
+  return _impl_.frame_formats_.Get(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 BoundingBox::_internal_x_max() const {
-  return x_max_;
+inline const std::string& Capabilities::frame_formats(int index) const {
+  // @@protoc_insertion_point(field_get:data_types.Capabilities.frame_formats)
+  return _internal_frame_formats(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 BoundingBox::x_max() const {
-  // @@protoc_insertion_point(field_get:data_types.BoundingBox.x_max)
-  return _internal_x_max();
+inline std::string* Capabilities::mutable_frame_formats(int index) {
+  // @@protoc_insertion_point(field_mutable:data_types.Capabilities.frame_formats)
+  return _impl_.frame_formats_.Mutable(index);
 }
-inline void BoundingBox::_internal_set_x_max(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  
-  x_max_ = value;
+inline void Capabilities::set_frame_formats(int index, const std::string& value) {
+  _impl_.frame_formats_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:data_types.Capabilities.frame_formats)
 }
-inline void BoundingBox::set_x_max(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_x_max(value);
-  // @@protoc_insertion_point(field_set:data_types.BoundingBox.x_max)
+inline void Capabilities::set_frame_formats(int index, std::string&& value) {
+  _impl_.frame_formats_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:data_types.Capabilities.frame_formats)
 }
-
-// uint32 y_max = 4;
-inline void BoundingBox::clear_y_max() {
-  y_max_ = 0u;
+inline void Capabilities::set_frame_formats(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.frame_formats_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:data_types.Capabilities.frame_formats)
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 BoundingBox::_internal_y_max() const {
-  return y_max_;
+inline void Capabilities::set_frame_formats(int index, const char* value, size_t size) {
+  _impl_.frame_formats_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:data_types.Capabilities.frame_formats)
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 BoundingBox::y_max() const {
-  // @@protoc_insertion_point(field_get:data_types.BoundingBox.y_max)
-  return _internal_y_max();
+inline std::string* Capabilities::_internal_add_frame_formats() {
+  return _impl_.frame_formats_.Add();
 }
-inline void BoundingBox::_internal_set_y_max(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  
-  y_max_ = value;
+inline void Capabilities::add_frame_formats(const std::string& value) {
+  _impl_.frame_formats_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:data_types.Capabilities.frame_formats)
 }
-inline void BoundingBox::set_y_max(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_y_max(value);
-  // @@protoc_insertion_point(field_set:data_types.BoundingBox.y_max)
+inline void Capabilities::add_frame_formats(std::string&& value) {
+  _impl_.frame_formats_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:data_types.Capabilities.frame_formats)
 }
-
-// string label = 5;
-inline void BoundingBox::clear_label() {
-  label_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void Capabilities::add_frame_formats(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.frame_formats_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:data_types.Capabilities.frame_formats)
 }
-inline const std::string& BoundingBox::label() const {
-  // @@protoc_insertion_point(field_get:data_types.BoundingBox.label)
-  return _internal_label();
+inline void Capabilities::add_frame_formats(const char* value, size_t size) {
+  _impl_.frame_formats_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:data_types.Capabilities.frame_formats)
 }
-inline void BoundingBox::set_label(const std::string& value) {
-  _internal_set_label(value);
-  // @@protoc_insertion_point(field_set:data_types.BoundingBox.label)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Capabilities::frame_formats() const {
+  // @@protoc_insertion_point(field_list:data_types.Capabilities.frame_formats)
+  return _impl_.frame_formats_;
 }
-inline std::string* BoundingBox::mutable_label() {
-  // @@protoc_insertion_point(field_mutable:data_types.BoundingBox.label)
-  return _internal_mutable_label();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Capabilities::mutable_frame_formats() {
+  // @@protoc_insertion_point(field_mutable_list:data_types.Capabilities.frame_formats)
+  return &_impl_.frame_formats_;
 }
-inline const std::string& BoundingBox::_internal_label() const {
-  return label_.GetNoArena();
+
+// repeated string result_encodings = 3;
+inline int Capabilities::_internal_result_encodings_size() const {
+  return _impl_.result_encodings_.size();
 }
-inline void BoundingBox::_internal_set_label(const std::string& value) {
-  
-  label_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+inline int Capabilities::result_encodings_size() const {
+  return _internal_result_encodings_size();
 }
-inline void BoundingBox::set_label(std::string&& value) {
-  
-  label_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:data_types.BoundingBox.label)
+inline void Capabilities::clear_result_encodings() {
+  _impl_.result_encodings_.Clear();
 }
-inline void BoundingBox::set_label(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  label_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:data_types.BoundingBox.label)
+inline std::string* Capabilities::add_result_encodings() {
+  std::string* _s = _internal_add_result_encodings();
+  // @@protoc_insertion_point(field_add_mutable:data_types.Capabilities.result_encodings)
+  return _s;
 }
-inline void BoundingBox::set_label(const char* value, size_t size) {
-  
-  label_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:data_types.BoundingBox.label)
+inline const std::string& Capabilities::_internal_result_encodings(int index) const {
+  return _impl_.result_encodings_.Get(index);
 }
-inline std::string* BoundingBox::_internal_mutable_label() {
-  
-  return label_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline const std::string& Capabilities::result_encodings(int index) const {
+  // @@protoc_insertion_point(field_get:data_types.Capabilities.result_encodings)
+  return _internal_result_encodings(index);
 }
-inline std::string* BoundingBox::release_label() {
-  // @@protoc_insertion_point(field_release:data_types.BoundingBox.label)
-  
-  return label_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* Capabilities::mutable_result_encodings(int index) {
+  // @@protoc_insertion_point(field_mutable:data_types.Capabilities.result_encodings)
+  return _impl_.result_encodings_.Mutable(index);
 }
-inline void BoundingBox::set_allocated_label(std::string* label) {
-  if (label != nullptr) {
-    
-  } else {
-    
-  }
-  label_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), label);
-  // @@protoc_insertion_point(field_set_allocated:data_types.BoundingBox.label)
+inline void Capabilities::set_result_encodings(int index, const std::string& value) {
+  _impl_.result_encodings_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:data_types.Capabilities.result_encodings)
 }
-
-// float confidence = 6;
-inline void BoundingBox::clear_confidence() {
-  confidence_ = 0;
+inline void Capabilities::set_result_encodings(int index, std::string&& value) {
+  _impl_.result_encodings_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:data_types.Capabilities.result_encodings)
 }
-inline float BoundingBox::_internal_confidence() const {
-  return confidence_;
+inline void Capabilities::set_result_encodings(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.result_encodings_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:data_types.Capabilities.result_encodings)
 }
-inline float BoundingBox::confidence() const {
-  // @@protoc_insertion_point(field_get:data_types.BoundingBox.confidence)
-  return _internal_confidence();
+inline void Capabilities::set_result_encodings(int index, const char* value, size_t size) {
+  _impl_.result_encodings_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:data_types.Capabilities.result_encodings)
 }
-inline void BoundingBox::_internal_set_confidence(float value) {
-  
-  confidence_ = value;
+inline std::string* Capabilities::_internal_add_result_encodings() {
+  return _impl_.result_encodings_.Add();
 }
-inline void BoundingBox::set_confidence(float value) {
-  _internal_set_confidence(value);
-  // @@protoc_insertion_point(field_set:data_types.BoundingBox.confidence)
+inline void Capabilities::add_result_encodings(const std::string& value) {
+  _impl_.result_encodings_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:data_types.Capabilities.result_encodings)
 }
-
-// -------------------------------------------------------------------
-
-// DetectionResult
-
-// .google.protobuf.Timestamp frame_timestamp = 1;
-inline bool DetectionResult::_internal_has_frame_timestamp() const {
-  return this != internal_default_instance() && frame_timestamp_ != nullptr;
+inline void Capabilities::add_result_encodings(std::string&& value) {
+  _impl_.result_encodings_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:data_types.Capabilities.result_encodings)
 }
-inline bool DetectionResult::has_frame_timestamp() const {
-  return _internal_has_frame_timestamp();
+inline void Capabilities::add_result_encodings(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.result_encodings_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:data_types.Capabilities.result_encodings)
 }
-inline const PROTOBUF_NAMESPACE_ID::Timestamp& DetectionResult::_internal_frame_timestamp() const {
-  const PROTOBUF_NAMESPACE_ID::Timestamp* p = frame_timestamp_;
-  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Timestamp*>(
-      &PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+inline void Capabilities::add_result_encodings(const char* value, size_t size) {
+  _impl_.result_encodings_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:data_types.Capabilities.result_encodings)
 }
-inline const PROTOBUF_NAMESPACE_ID::Timestamp& DetectionResult::frame_timestamp() const {
-  // @@protoc_insertion_point(field_get:data_types.DetectionResult.frame_timestamp)
-  return _internal_frame_timestamp();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Capabilities::result_encodings() const {
+  // @@protoc_insertion_point(field_list:data_types.Capabilities.result_encodings)
+  return _impl_.result_encodings_;
 }
-inline PROTOBUF_NAMESPACE_ID::Timestamp* DetectionResult::release_frame_timestamp() {
-  // @@protoc_insertion_point(field_release:data_types.DetectionResult.frame_timestamp)
-  
-  PROTOBUF_NAMESPACE_ID::Timestamp* temp = frame_timestamp_;
-  frame_timestamp_ = nullptr;
-  return temp;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Capabilities::mutable_result_encodings() {
+  // @@protoc_insertion_point(field_mutable_list:data_types.Capabilities.result_encodings)
+  return &_impl_.result_encodings_;
 }
-inline PROTOBUF_NAMESPACE_ID::Timestamp* DetectionResult::_internal_mutable_frame_timestamp() {
-  
-  if (frame_timestamp_ == nullptr) {
-    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaNoVirtual());
-    frame_timestamp_ = p;
-  }
-  return frame_timestamp_;
+
+// bool result_batch = 4;
+inline void Capabilities::clear_result_batch() {
+  _impl_.result_batch_ = false;
 }
-inline PROTOBUF_NAMESPACE_ID::Timestamp* DetectionResult::mutable_frame_timestamp() {
-  // @@protoc_insertion_point(field_mutable:data_types.DetectionResult.frame_timestamp)
-  return _internal_mutable_frame_timestamp();
+inline bool Capabilities::_internal_result_batch() const {
+  return _impl_.result_batch_;
 }
-inline void DetectionResult::set_allocated_frame_timestamp(PROTOBUF_NAMESPACE_ID::Timestamp* frame_timestamp) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(frame_timestamp_);
-  }
-  if (frame_timestamp) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(frame_timestamp)->GetArena();
-    if (message_arena != submessage_arena) {
-      frame_timestamp = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, frame_timestamp, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  frame_timestamp_ = frame_timestamp;
-  // @@protoc_insertion_point(field_set_allocated:data_types.DetectionResult.frame_timestamp)
+inline bool Capabilities::result_batch() const {
+  // @@protoc_insertion_point(field_get:data_types.Capabilities.result_batch)
+  return _internal_result_batch();
 }
-
-// string json = 2;
-inline void DetectionResult::clear_json() {
-  json_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void Capabilities::_internal_set_result_batch(bool value) {
+  
+  _impl_.result_batch_ = value;
 }
-inline const std::string& DetectionResult::json() const {
-  // @@protoc_insertion_point(field_get:data_types.DetectionResult.json)
-  return _internal_json();
+inline void Capabilities::set_result_batch(bool value) {
+  _internal_set_result_batch(value);
+  // @@protoc_insertion_point(field_set:data_types.Capabilities.result_batch)
 }
-inline void DetectionResult::set_json(const std::string& value) {
-  _internal_set_json(value);
-  // @@protoc_insertion_point(field_set:data_types.DetectionResult.json)
+
+// bool chunked_frames = 5;
+inline void Capabilities::clear_chunked_frames() {
+  _impl_.chunked_frames_ = false;
 }
-inline std::string* DetectionResult::mutable_json() {
-  // @@protoc_insertion_point(field_mutable:data_types.DetectionResult.json)
-  return _internal_mutable_json();
+inline bool Capabilities::_internal_chunked_frames() const {
+  return _impl_.chunked_frames_;
 }
-inline const std::string& DetectionResult::_internal_json() const {
-  return json_.GetNoArena();
+inline bool Capabilities::chunked_frames() const {
+  // @@protoc_insertion_point(field_get:data_types.Capabilities.chunked_frames)
+  return _internal_chunked_frames();
 }
-inline void DetectionResult::_internal_set_json(const std::string& value) {
+inline void Capabilities::_internal_set_chunked_frames(bool value) {
   
-  json_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  _impl_.chunked_frames_ = value;
 }
-inline void DetectionResult::set_json(std::string&& value) {
-  
-  json_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:data_types.DetectionResult.json)
+inline void Capabilities::set_chunked_frames(bool value) {
+  _internal_set_chunked_frames(value);
+  // @@protoc_insertion_point(field_set:data_types.Capabilities.chunked_frames)
 }
-inline void DetectionResult::set_json(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  json_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:data_types.DetectionResult.json)
+
+// uint32 max_chunk_bytes = 6;
+inline void Capabilities::clear_max_chunk_bytes() {
+  _impl_.max_chunk_bytes_ = 0u;
 }
-inline void DetectionResult::set_json(const char* value, size_t size) {
-  
-  json_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:data_types.DetectionResult.json)
+inline uint32_t Capabilities::_internal_max_chunk_bytes() const {
+  return _impl_.max_chunk_bytes_;
 }
-inline std::string* DetectionResult::_internal_mutable_json() {
-  
-  return json_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline uint32_t Capabilities::max_chunk_bytes() const {
+  // @@protoc_insertion_point(field_get:data_types.Capabilities.max_chunk_bytes)
+  return _internal_max_chunk_bytes();
 }
-inline std::string* DetectionResult::release_json() {
-  // @@protoc_insertion_point(field_release:data_types.DetectionResult.json)
+inline void Capabilities::_internal_set_max_chunk_bytes(uint32_t value) {
   
-  return json_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.max_chunk_bytes_ = value;
 }
-inline void DetectionResult::set_allocated_json(std::string* json) {
-  if (json != nullptr) {
-    
-  } else {
-    
-  }
-  json_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), json);
-  // @@protoc_insertion_point(field_set_allocated:data_types.DetectionResult.json)
+inline void Capabilities::set_max_chunk_bytes(uint32_t value) {
+  _internal_set_max_chunk_bytes(value);
+  // @@protoc_insertion_point(field_set:data_types.Capabilities.max_chunk_bytes)
 }
 
-// -------------------------------------------------------------------
-
-// DeviceStatus
-
-// string device_id = 1;
-inline void DeviceStatus::clear_device_id() {
-  device_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// uint32 max_inflight = 7;
+inline void Capabilities::clear_max_inflight() {
+  _impl_.max_inflight_ = 0u;
 }
-inline const std::string& DeviceStatus::device_id() const {
-  // @@protoc_insertion_point(field_get:data_types.DeviceStatus.device_id)
-  return _internal_device_id();
+inline uint32_t Capabilities::_internal_max_inflight() const {
+  return _impl_.max_inflight_;
 }
-inline void DeviceStatus::set_device_id(const std::string& value) {
-  _internal_set_device_id(value);
-  // @@protoc_insertion_point(field_set:data_types.DeviceStatus.device_id)
+inline uint32_t Capabilities::max_inflight() const {
+  // @@protoc_insertion_point(field_get:data_types.Capabilities.max_inflight)
+  return _internal_max_inflight();
 }
-inline std::string* DeviceStatus::mutable_device_id() {
-  // @@protoc_insertion_point(field_mutable:data_types.DeviceStatus.device_id)
-  return _internal_mutable_device_id();
+inline void Capabilities::_internal_set_max_inflight(uint32_t value) {
+  
+  _impl_.max_inflight_ = value;
 }
-inline const std::string& DeviceStatus::_internal_device_id() const {
-  return device_id_.GetNoArena();
+inline void Capabilities::set_max_inflight(uint32_t value) {
+  _internal_set_max_inflight(value);
+  // @@protoc_insertion_point(field_set:data_types.Capabilities.max_inflight)
 }
-inline void DeviceStatus::_internal_set_device_id(const std::string& value) {
-  
-  device_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+
+// repeated string compression = 8;
+inline int Capabilities::_internal_compression_size() const {
+  return _impl_.compression_.size();
 }
-inline void DeviceStatus::set_device_id(std::string&& value) {
-  
-  device_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:data_types.DeviceStatus.device_id)
+inline int Capabilities::compression_size() const {
+  return _internal_compression_size();
 }
-inline void DeviceStatus::set_device_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  device_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:data_types.DeviceStatus.device_id)
+inline void Capabilities::clear_compression() {
+  _impl_.compression_.Clear();
 }
-inline void DeviceStatus::set_device_id(const char* value, size_t size) {
-  
-  device_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:data_types.DeviceStatus.device_id)
+inline std::string* Capabilities::add_compression() {
+  std::string* _s = _internal_add_compression();
+  // @@protoc_insertion_point(field_add_mutable:data_types.Capabilities.compression)
+  return _s;
 }
-inline std::string* DeviceStatus::_internal_mutable_device_id() {
-  
-  return device_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline const std::string& Capabilities::_internal_compression(int index) const {
+  return _impl_.compression_.Get(index);
 }
-inline std::string* DeviceStatus::release_device_id() {
-  // @@protoc_insertion_point(field_release:data_types.DeviceStatus.device_id)
-  
-  return device_id_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline const std::string& Capabilities::compression(int index) const {
+  // @@protoc_insertion_point(field_get:data_types.Capabilities.compression)
+  return _internal_compression(index);
 }
-inline void DeviceStatus::set_allocated_device_id(std::string* device_id) {
-  if (device_id != nullptr) {
-    
-  } else {
-    
-  }
-  device_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), device_id);
-  // @@protoc_insertion_point(field_set_allocated:data_types.DeviceStatus.device_id)
+inline std::string* Capabilities::mutable_compression(int index) {
+  // @@protoc_insertion_point(field_mutable:data_types.Capabilities.compression)
+  return _impl_.compression_.Mutable(index);
 }
-
-// .data_types.DeviceStatus.ConnectionState state = 2;
-inline void DeviceStatus::clear_state() {
-  state_ = 0;
+inline void Capabilities::set_compression(int index, const std::string& value) {
+  _impl_.compression_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:data_types.Capabilities.compression)
 }
-inline ::data_types::DeviceStatus_ConnectionState DeviceStatus::_internal_state() const {
-  return static_cast< ::data_types::DeviceStatus_ConnectionState >(state_);
+inline void Capabilities::set_compression(int index, std::string&& value) {
+  _impl_.compression_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:data_types.Capabilities.compression)
 }
-inline ::data_types::DeviceStatus_ConnectionState DeviceStatus::state() const {
-  // @@protoc_insertion_point(field_get:data_types.DeviceStatus.state)
-  return _internal_state();
+inline void Capabilities::set_compression(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.compression_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:data_types.Capabilities.compression)
 }
-inline void DeviceStatus::_internal_set_state(::data_types::DeviceStatus_ConnectionState value) {
-  
-  state_ = value;
+inline void Capabilities::set_compression(int index, const char* value, size_t size) {
+  _impl_.compression_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:data_types.Capabilities.compression)
 }
-inline void DeviceStatus::set_state(::data_types::DeviceStatus_ConnectionState value) {
-  _internal_set_state(value);
-  // @@protoc_insertion_point(field_set:data_types.DeviceStatus.state)
+inline std::string* Capabilities::_internal_add_compression() {
+  return _impl_.compression_.Add();
 }
-
-// float cpu_temperature_c = 3;
-inline void DeviceStatus::clear_cpu_temperature_c() {
-  cpu_temperature_c_ = 0;
+inline void Capabilities::add_compression(const std::string& value) {
+  _impl_.compression_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:data_types.Capabilities.compression)
 }
-inline float DeviceStatus::_internal_cpu_temperature_c() const {
-  return cpu_temperature_c_;
+inline void Capabilities::add_compression(std::string&& value) {
+  _impl_.compression_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:data_types.Capabilities.compression)
 }
-inline float DeviceStatus::cpu_temperature_c() const {
-  // @@protoc_insertion_point(field_get:data_types.DeviceStatus.cpu_temperature_c)
-  return _internal_cpu_temperature_c();
+inline void Capabilities::add_compression(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.compression_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:data_types.Capabilities.compression)
 }
-inline void DeviceStatus::_internal_set_cpu_temperature_c(float value) {
-  
-  cpu_temperature_c_ = value;
+inline void Capabilities::add_compression(const char* value, size_t size) {
+  _impl_.compression_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:data_types.Capabilities.compression)
 }
-inline void DeviceStatus::set_cpu_temperature_c(float value) {
-  _internal_set_cpu_temperature_c(value);
-  // @@protoc_insertion_point(field_set:data_types.DeviceStatus.cpu_temperature_c)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Capabilities::compression() const {
+  // @@protoc_insertion_point(field_list:data_types.Capabilities.compression)
+  return _impl_.compression_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Capabilities::mutable_compression() {
+  // @@protoc_insertion_point(field_mutable_list:data_types.Capabilities.compression)
+  return &_impl_.compression_;
 }
 
-// uint32 frame_rate_fps = 4;
-inline void DeviceStatus::clear_frame_rate_fps() {
-  frame_rate_fps_ = 0u;
+// -------------------------------------------------------------------
+
+// SessionConfig
+
+// uint32 protocol_version = 1;
+inline void SessionConfig::clear_protocol_version() {
+  _impl_.protocol_version_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 DeviceStatus::_internal_frame_rate_fps() const {
-  return frame_rate_fps_;
+inline uint32_t SessionConfig::_internal_protocol_version() const {
+  return _impl_.protocol_version_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 DeviceStatus::frame_rate_fps() const {
-  // @@protoc_insertion_point(field_get:data_types.DeviceStatus.frame_rate_fps)
-  return _internal_frame_rate_fps();
+inline uint32_t SessionConfig::protocol_version() const {
+  // @@protoc_insertion_point(field_get:data_types.SessionConfig.protocol_version)
+  return _internal_protocol_version();
 }
-inline void DeviceStatus::_internal_set_frame_rate_fps(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void SessionConfig::_internal_set_protocol_version(uint32_t value) {
   
-  frame_rate_fps_ = value;
+  _impl_.protocol_version_ = value;
 }
-inline void DeviceStatus::set_frame_rate_fps(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_frame_rate_fps(value);
-  // @@protoc_insertion_point(field_set:data_types.DeviceStatus.frame_rate_fps)
+inline void SessionConfig::set_protocol_version(uint32_t value) {
+  _internal_set_protocol_version(value);
+  // @@protoc_insertion_point(field_set:data_types.SessionConfig.protocol_version)
 }
 
-// uint32 processing_latency_ms = 5;
-inline void DeviceStatus::clear_processing_latency_ms() {
-  processing_latency_ms_ = 0u;
+// string frame_format = 2;
+inline void SessionConfig::clear_frame_format() {
+  _impl_.frame_format_.ClearToEmpty();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 DeviceStatus::_internal_processing_latency_ms() const {
-  return processing_latency_ms_;
+inline const std::string& SessionConfig::frame_format() const {
+  // @@protoc_insertion_point(field_get:data_types.SessionConfig.frame_format)
+  return _internal_frame_format();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 DeviceStatus::processing_latency_ms() const {
-  // @@protoc_insertion_point(field_get:data_types.DeviceStatus.processing_latency_ms)
-  return _internal_processing_latency_ms();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SessionConfig::set_frame_format(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.frame_format_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:data_types.SessionConfig.frame_format)
 }
-inline void DeviceStatus::_internal_set_processing_latency_ms(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  
-  processing_latency_ms_ = value;
+inline std::string* SessionConfig::mutable_frame_format() {
+  std::string* _s = _internal_mutable_frame_format();
+  // @@protoc_insertion_point(field_mutable:data_types.SessionConfig.frame_format)
+  return _s;
 }
-inline void DeviceStatus::set_processing_latency_ms(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_processing_latency_ms(value);
-  // @@protoc_insertion_point(field_set:data_types.DeviceStatus.processing_latency_ms)
+inline const std::string& SessionConfig::_internal_frame_format() const {
+  return _impl_.frame_format_.Get();
 }
-
-// string firmware_version = 6;
-inline void DeviceStatus::clear_firmware_version() {
-  firmware_version_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void SessionConfig::_internal_set_frame_format(const std::string& value) {
+  
+  _impl_.frame_format_.Set(value, GetArenaForAllocation());
 }
-inline const std::string& DeviceStatus::firmware_version() const {
-  // @@protoc_insertion_point(field_get:data_types.DeviceStatus.firmware_version)
-  return _internal_firmware_version();
+inline std::string* SessionConfig::_internal_mutable_frame_format() {
+  
+  return _impl_.frame_format_.Mutable(GetArenaForAllocation());
 }
-inline void DeviceStatus::set_firmware_version(const std::string& value) {
-  _internal_set_firmware_version(value);
-  // @@protoc_insertion_point(field_set:data_types.DeviceStatus.firmware_version)
+inline std::string* SessionConfig::release_frame_format() {
+  // @@protoc_insertion_point(field_release:data_types.SessionConfig.frame_format)
+  return _impl_.frame_format_.Release();
+}
+inline void SessionConfig::set_allocated_frame_format(std::string* frame_format) {
+  if (frame_format != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.frame_format_.SetAllocated(frame_format, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.frame_format_.IsDefault()) {
+    _impl_.frame_format_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:data_types.SessionConfig.frame_format)
 }
-inline std::string* DeviceStatus::mutable_firmware_version() {
-  // @@protoc_insertion_point(field_mutable:data_types.DeviceStatus.firmware_version)
-  return _internal_mutable_firmware_version();
+
+// string result_encoding = 3;
+inline void SessionConfig::clear_result_encoding() {
+  _impl_.result_encoding_.ClearToEmpty();
 }
-inline const std::string& DeviceStatus::_internal_firmware_version() const {
-  return firmware_version_.GetNoArena();
+inline const std::string& SessionConfig::result_encoding() const {
+  // @@protoc_insertion_point(field_get:data_types.SessionConfig.result_encoding)
+  return _internal_result_encoding();
 }
-inline void DeviceStatus::_internal_set_firmware_version(const std::string& value) {
-  
-  firmware_version_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SessionConfig::set_result_encoding(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.result_encoding_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:data_types.SessionConfig.result_encoding)
 }
-inline void DeviceStatus::set_firmware_version(std::string&& value) {
-  
-  firmware_version_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:data_types.DeviceStatus.firmware_version)
+inline std::string* SessionConfig::mutable_result_encoding() {
+  std::string* _s = _internal_mutable_result_encoding();
+  // @@protoc_insertion_point(field_mutable:data_types.SessionConfig.result_encoding)
+  return _s;
 }
-inline void DeviceStatus::set_firmware_version(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  firmware_version_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:data_types.DeviceStatus.firmware_version)
+inline const std::string& SessionConfig::_internal_result_encoding() const {
+  return _impl_.result_encoding_.Get();
 }
-inline void DeviceStatus::set_firmware_version(const char* value, size_t size) {
+inline void SessionConfig::_internal_set_result_encoding(const std::string& value) {
   
-  firmware_version_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:data_types.DeviceStatus.firmware_version)
+  _impl_.result_encoding_.Set(value, GetArenaForAllocation());
 }
-inline std::string* DeviceStatus::_internal_mutable_firmware_version() {
+inline std::string* SessionConfig::_internal_mutable_result_encoding() {
   
-  return firmware_version_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.result_encoding_.Mutable(GetArenaForAllocation());
 }
-inline std::string* DeviceStatus::release_firmware_version() {
-  // @@protoc_insertion_point(field_release:data_types.DeviceStatus.firmware_version)
-  
-  return firmware_version_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* SessionConfig::release_result_encoding() {
+  // @@protoc_insertion_point(field_release:data_types.SessionConfig.result_encoding)
+  return _impl_.result_encoding_.Release();
 }
-inline void DeviceStatus::set_allocated_firmware_version(std::string* firmware_version) {
-  if (firmware_version != nullptr) {
+inline void SessionConfig::set_allocated_result_encoding(std::string* result_encoding) {
+  if (result_encoding != nullptr) {
     
   } else {
     
   }
-  firmware_version_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), firmware_version);
-  // @@protoc_insertion_point(field_set_allocated:data_types.DeviceStatus.firmware_version)
+  _impl_.result_encoding_.SetAllocated(result_encoding, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.result_encoding_.IsDefault()) {
+    _impl_.result_encoding_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:data_types.SessionConfig.result_encoding)
 }
 
-// bool is_sleeping = 7;
-inline void DeviceStatus::clear_is_sleeping() {
-  is_sleeping_ = false;
+// bool result_batch = 4;
+inline void SessionConfig::clear_result_batch() {
+  _impl_.result_batch_ = false;
 }
-inline bool DeviceStatus::_internal_is_sleeping() const {
-  return is_sleeping_;
+inline bool SessionConfig::_internal_result_batch() const {
+  return _impl_.result_batch_;
 }
-inline bool DeviceStatus::is_sleeping() const {
-  // @@protoc_insertion_point(field_get:data_types.DeviceStatus.is_sleeping)
-  return _internal_is_sleeping();
+inline bool SessionConfig::result_batch() const {
+  // @@protoc_insertion_point(field_get:data_types.SessionConfig.result_batch)
+  return _internal_result_batch();
 }
-inline void DeviceStatus::_internal_set_is_sleeping(bool value) {
+inline void SessionConfig::_internal_set_result_batch(bool value) {
   
-  is_sleeping_ = value;
+  _impl_.result_batch_ = value;
 }
-inline void DeviceStatus::set_is_sleeping(bool value) {
-  _internal_set_is_sleeping(value);
-  // @@protoc_insertion_point(field_set:data_types.DeviceStatus.is_sleeping)
+inline void SessionConfig::set_result_batch(bool value) {
+  _internal_set_result_batch(value);
+  // @@protoc_insertion_point(field_set:data_types.SessionConfig.result_batch)
 }
 
-// -------------------------------------------------------------------
-
-// Command
-
-// .data_types.ConfigRequest config_request = 1;
-inline bool Command::_internal_has_config_request() const {
-  return command_type_case() == kConfigRequest;
+// bool chunked_frames = 5;
+inline void SessionConfig::clear_chunked_frames() {
+  _impl_.chunked_frames_ = false;
 }
-inline bool Command::has_config_request() const {
-  return _internal_has_config_request();
+inline bool SessionConfig::_internal_chunked_frames() const {
+  return _impl_.chunked_frames_;
 }
-inline void Command::set_has_config_request() {
-  _oneof_case_[0] = kConfigRequest;
+inline bool SessionConfig::chunked_frames() const {
+  // @@protoc_insertion_point(field_get:data_types.SessionConfig.chunked_frames)
+  return _internal_chunked_frames();
 }
-inline void Command::clear_config_request() {
-  if (_internal_has_config_request()) {
-    delete command_type_.config_request_;
-    clear_has_command_type();
-  }
+inline void SessionConfig::_internal_set_chunked_frames(bool value) {
+  
+  _impl_.chunked_frames_ = value;
 }
-inline ::data_types::ConfigRequest* Command::release_config_request() {
-  // @@protoc_insertion_point(field_release:data_types.Command.config_request)
-  if (_internal_has_config_request()) {
-    clear_has_command_type();
-      ::data_types::ConfigRequest* temp = command_type_.config_request_;
-    command_type_.config_request_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline void SessionConfig::set_chunked_frames(bool value) {
+  _internal_set_chunked_frames(value);
+  // @@protoc_insertion_point(field_set:data_types.SessionConfig.chunked_frames)
 }
-inline const ::data_types::ConfigRequest& Command::_internal_config_request() const {
-  return _internal_has_config_request()
-      ? *command_type_.config_request_
-      : *reinterpret_cast< ::data_types::ConfigRequest*>(&::data_types::_ConfigRequest_default_instance_);
+
+// uint32 chunk_bytes = 6;
+inline void SessionConfig::clear_chunk_bytes() {
+  _impl_.chunk_bytes_ = 0u;
 }
-inline const ::data_types::ConfigRequest& Command::config_request() const {
-  // @@protoc_insertion_point(field_get:data_types.Command.config_request)
-  return _internal_config_request();
+inline uint32_t SessionConfig::_internal_chunk_bytes() const {
+  return _impl_.chunk_bytes_;
 }
-inline ::data_types::ConfigRequest* Command::_internal_mutable_config_request() {
-  if (!_internal_has_config_request()) {
-    clear_command_type();
-    set_has_config_request();
-    command_type_.config_request_ = CreateMaybeMessage< ::data_types::ConfigRequest >(
-        GetArenaNoVirtual());
-  }
-  return command_type_.config_request_;
+inline uint32_t SessionConfig::chunk_bytes() const {
+  // @@protoc_insertion_point(field_get:data_types.SessionConfig.chunk_bytes)
+  return _internal_chunk_bytes();
 }
-inline ::data_types::ConfigRequest* Command::mutable_config_request() {
-  // @@protoc_insertion_point(field_mutable:data_types.Command.config_request)
-  return _internal_mutable_config_request();
+inline void SessionConfig::_internal_set_chunk_bytes(uint32_t value) {
+  
+  _impl_.chunk_bytes_ = value;
+}
+inline void SessionConfig::set_chunk_bytes(uint32_t value) {
+  _internal_set_chunk_bytes(value);
+  // @@protoc_insertion_point(field_set:data_types.SessionConfig.chunk_bytes)
 }
 
-// .data_types.ControlAction control_action = 2;
-inline bool Command::_internal_has_control_action() const {
-  return command_type_case() == kControlAction;
+// uint32 max_inflight = 7;
+inline void SessionConfig::clear_max_inflight() {
+  _impl_.max_inflight_ = 0u;
 }
-inline bool Command::has_control_action() const {
-  return _internal_has_control_action();
+inline uint32_t SessionConfig::_internal_max_inflight() const {
+  return _impl_.max_inflight_;
 }
-inline void Command::set_has_control_action() {
-  _oneof_case_[0] = kControlAction;
+inline uint32_t SessionConfig::max_inflight() const {
+  // @@protoc_insertion_point(field_get:data_types.SessionConfig.max_inflight)
+  return _internal_max_inflight();
 }
-inline void Command::clear_control_action() {
-  if (_internal_has_control_action()) {
-    delete command_type_.control_action_;
-    clear_has_command_type();
-  }
+inline void SessionConfig::_internal_set_max_inflight(uint32_t value) {
+  
+  _impl_.max_inflight_ = value;
 }
-inline ::data_types::ControlAction* Command::release_control_action() {
-  // @@protoc_insertion_point(field_release:data_types.Command.control_action)
-  if (_internal_has_control_action()) {
-    clear_has_command_type();
-      ::data_types::ControlAction* temp = command_type_.control_action_;
-    command_type_.control_action_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline void SessionConfig::set_max_inflight(uint32_t value) {
+  _internal_set_max_inflight(value);
+  // @@protoc_insertion_point(field_set:data_types.SessionConfig.max_inflight)
 }
-inline const ::data_types::ControlAction& Command::_internal_control_action() const {
-  return _internal_has_control_action()
-      ? *command_type_.control_action_
-      : *reinterpret_cast< ::data_types::ControlAction*>(&::data_types::_ControlAction_default_instance_);
+
+// string compression = 8;
+inline void SessionConfig::clear_compression() {
+  _impl_.compression_.ClearToEmpty();
 }
-inline const ::data_types::ControlAction& Command::control_action() const {
-  // @@protoc_insertion_point(field_get:data_types.Command.control_action)
-  return _internal_control_action();
+inline const std::string& SessionConfig::compression() const {
+  // @@protoc_insertion_point(field_get:data_types.SessionConfig.compression)
+  return _internal_compression();
 }
-inline ::data_types::ControlAction* Command::_internal_mutable_control_action() {
-  if (!_internal_has_control_action()) {
-    clear_command_type();
-    set_has_control_action();
-    command_type_.control_action_ = CreateMaybeMessage< ::data_types::ControlAction >(
-        GetArenaNoVirtual());
-  }
-  return command_type_.control_action_;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SessionConfig::set_compression(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.compression_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:data_types.SessionConfig.compression)
 }
-inline ::data_types::ControlAction* Command::mutable_control_action() {
-  // @@protoc_insertion_point(field_mutable:data_types.Command.control_action)
-  return _internal_mutable_control_action();
+inline std::string* SessionConfig::mutable_compression() {
+  std::string* _s = _internal_mutable_compression();
+  // @@protoc_insertion_point(field_mutable:data_types.SessionConfig.compression)
+  return _s;
 }
-
-// .data_types.Heartbeat heartbeat = 3;
-inline bool Command::_internal_has_heartbeat() const {
-  return command_type_case() == kHeartbeat;
+inline const std::string& SessionConfig::_internal_compression() const {
+  return _impl_.compression_.Get();
 }
-inline bool Command::has_heartbeat() const {
-  return _internal_has_heartbeat();
+inline void SessionConfig::_internal_set_compression(const std::string& value) {
+  
+  _impl_.compression_.Set(value, GetArenaForAllocation());
 }
-inline void Command::set_has_heartbeat() {
-  _oneof_case_[0] = kHeartbeat;
+inline std::string* SessionConfig::_internal_mutable_compression() {
+  
+  return _impl_.compression_.Mutable(GetArenaForAllocation());
 }
-inline void Command::clear_heartbeat() {
-  if (_internal_has_heartbeat()) {
-    delete command_type_.heartbeat_;
-    clear_has_command_type();
-  }
+inline std::string* SessionConfig::release_compression() {
+  // @@protoc_insertion_point(field_release:data_types.SessionConfig.compression)
+  return _impl_.compression_.Release();
 }
-inline ::data_types::Heartbeat* Command::release_heartbeat() {
-  // @@protoc_insertion_point(field_release:data_types.Command.heartbeat)
-  if (_internal_has_heartbeat()) {
-    clear_has_command_type();
-      ::data_types::Heartbeat* temp = command_type_.heartbeat_;
-    command_type_.heartbeat_ = nullptr;
-    return temp;
+inline void SessionConfig::set_allocated_compression(std::string* compression) {
+  if (compression != nullptr) {
+    
   } else {
-    return nullptr;
+    
   }
+  _impl_.compression_.SetAllocated(compression, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.compression_.IsDefault()) {
+    _impl_.compression_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:data_types.SessionConfig.compression)
 }
-inline const ::data_types::Heartbeat& Command::_internal_heartbeat() const {
-  return _internal_has_heartbeat()
-      ? *command_type_.heartbeat_
-      : *reinterpret_cast< ::data_types::Heartbeat*>(&::data_types::_Heartbeat_default_instance_);
+
+// -------------------------------------------------------------------
+
+// FrameHeader
+
+// .data_types.CameraFrame frame = 1;
+inline bool FrameHeader::_internal_has_frame() const {
+  return this != internal_default_instance() && _impl_.frame_ != nullptr;
 }
-inline const ::data_types::Heartbeat& Command::heartbeat() const {
-  // @@protoc_insertion_point(field_get:data_types.Command.heartbeat)
-  return _internal_heartbeat();
+inline bool FrameHeader::has_frame() const {
+  return _internal_has_frame();
 }
-inline ::data_types::Heartbeat* Command::_internal_mutable_heartbeat() {
-  if (!_internal_has_heartbeat()) {
-    clear_command_type();
-    set_has_heartbeat();
-    command_type_.heartbeat_ = CreateMaybeMessage< ::data_types::Heartbeat >(
-        GetArenaNoVirtual());
+inline void FrameHeader::clear_frame() {
+  if (GetArenaForAllocation() == nullptr && _impl_.frame_ != nullptr) {
+    delete _impl_.frame_;
   }
-  return command_type_.heartbeat_;
+  _impl_.frame_ = nullptr;
 }
-inline ::data_types::Heartbeat* Command::mutable_heartbeat() {
-  // @@protoc_insertion_point(field_mutable:data_types.Command.heartbeat)
-  return _internal_mutable_heartbeat();
+inline const ::data_types::CameraFrame& FrameHeader::_internal_frame() const {
+  const ::data_types::CameraFrame* p = _impl_.frame_;
+  return p != nullptr ? *p : reinterpret_cast<const ::data_types::CameraFrame&>(
+      ::data_types::_CameraFrame_default_instance_);
 }
-
-// .data_types.DetectionResult detection_result = 4;
-inline bool Command::_internal_has_detection_result() const {
-  return command_type_case() == kDetectionResult;
+inline const ::data_types::CameraFrame& FrameHeader::frame() const {
+  // @@protoc_insertion_point(field_get:data_types.FrameHeader.frame)
+  return _internal_frame();
 }
-inline bool Command::has_detection_result() const {
-  return _internal_has_detection_result();
+inline void FrameHeader::unsafe_arena_set_allocated_frame(
+    ::data_types::CameraFrame* frame) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.frame_);
+  }
+  _impl_.frame_ = frame;
+  if (frame) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.FrameHeader.frame)
 }
-inline void Command::set_has_detection_result() {
-  _oneof_case_[0] = kDetectionResult;
+inline ::data_types::CameraFrame* FrameHeader::release_frame() {
+  
+  ::data_types::CameraFrame* temp = _impl_.frame_;
+  _impl_.frame_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void Command::clear_detection_result() {
-  if (_internal_has_detection_result()) {
-    delete command_type_.detection_result_;
-    clear_has_command_type();
+inline ::data_types::CameraFrame* FrameHeader::unsafe_arena_release_frame() {
+  // @@protoc_insertion_point(field_release:data_types.FrameHeader.frame)
+  
+  ::data_types::CameraFrame* temp = _impl_.frame_;
+  _impl_.frame_ = nullptr;
+  return temp;
+}
+inline ::data_types::CameraFrame* FrameHeader::_internal_mutable_frame() {
+  
+  if (_impl_.frame_ == nullptr) {
+    auto* p = CreateMaybeMessage<::data_types::CameraFrame>(GetArenaForAllocation());
+    _impl_.frame_ = p;
   }
+  return _impl_.frame_;
 }
-inline ::data_types::DetectionResult* Command::release_detection_result() {
-  // @@protoc_insertion_point(field_release:data_types.Command.detection_result)
-  if (_internal_has_detection_result()) {
-    clear_has_command_type();
-      ::data_types::DetectionResult* temp = command_type_.detection_result_;
-    command_type_.detection_result_ = nullptr;
-    return temp;
+inline ::data_types::CameraFrame* FrameHeader::mutable_frame() {
+  ::data_types::CameraFrame* _msg = _internal_mutable_frame();
+  // @@protoc_insertion_point(field_mutable:data_types.FrameHeader.frame)
+  return _msg;
+}
+inline void FrameHeader::set_allocated_frame(::data_types::CameraFrame* frame) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.frame_;
+  }
+  if (frame) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(frame);
+    if (message_arena != submessage_arena) {
+      frame = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, frame, submessage_arena);
+    }
+    
   } else {
-    return nullptr;
+    
   }
+  _impl_.frame_ = frame;
+  // @@protoc_insertion_point(field_set_allocated:data_types.FrameHeader.frame)
 }
-inline const ::data_types::DetectionResult& Command::_internal_detection_result() const {
-  return _internal_has_detection_result()
-      ? *command_type_.detection_result_
-      : *reinterpret_cast< ::data_types::DetectionResult*>(&::data_types::_DetectionResult_default_instance_);
+
+// uint64 total_size = 2;
+inline void FrameHeader::clear_total_size() {
+  _impl_.total_size_ = uint64_t{0u};
 }
-inline const ::data_types::DetectionResult& Command::detection_result() const {
-  // @@protoc_insertion_point(field_get:data_types.Command.detection_result)
-  return _internal_detection_result();
+inline uint64_t FrameHeader::_internal_total_size() const {
+  return _impl_.total_size_;
 }
-inline ::data_types::DetectionResult* Command::_internal_mutable_detection_result() {
-  if (!_internal_has_detection_result()) {
-    clear_command_type();
-    set_has_detection_result();
-    command_type_.detection_result_ = CreateMaybeMessage< ::data_types::DetectionResult >(
-        GetArenaNoVirtual());
-  }
-  return command_type_.detection_result_;
+inline uint64_t FrameHeader::total_size() const {
+  // @@protoc_insertion_point(field_get:data_types.FrameHeader.total_size)
+  return _internal_total_size();
 }
-inline ::data_types::DetectionResult* Command::mutable_detection_result() {
-  // @@protoc_insertion_point(field_mutable:data_types.Command.detection_result)
-  return _internal_mutable_detection_result();
+inline void FrameHeader::_internal_set_total_size(uint64_t value) {
+  
+  _impl_.total_size_ = value;
+}
+inline void FrameHeader::set_total_size(uint64_t value) {
+  _internal_set_total_size(value);
+  // @@protoc_insertion_point(field_set:data_types.FrameHeader.total_size)
 }
 
-// .data_types.CameraFrame camera_frame = 5;
-inline bool Command::_internal_has_camera_frame() const {
-  return command_type_case() == kCameraFrame;
+// -------------------------------------------------------------------
+
+// FrameChunk
+
+// uint64 frame_id = 1;
+inline void FrameChunk::clear_frame_id() {
+  _impl_.frame_id_ = uint64_t{0u};
 }
-inline bool Command::has_camera_frame() const {
-  return _internal_has_camera_frame();
+inline uint64_t FrameChunk::_internal_frame_id() const {
+  return _impl_.frame_id_;
 }
-inline void Command::set_has_camera_frame() {
-  _oneof_case_[0] = kCameraFrame;
+inline uint64_t FrameChunk::frame_id() const {
+  // @@protoc_insertion_point(field_get:data_types.FrameChunk.frame_id)
+  return _internal_frame_id();
 }
-inline void Command::clear_camera_frame() {
-  if (_internal_has_camera_frame()) {
-    delete command_type_.camera_frame_;
-    clear_has_command_type();
-  }
+inline void FrameChunk::_internal_set_frame_id(uint64_t value) {
+  
+  _impl_.frame_id_ = value;
 }
-inline ::data_types::CameraFrame* Command::release_camera_frame() {
-  // @@protoc_insertion_point(field_release:data_types.Command.camera_frame)
-  if (_internal_has_camera_frame()) {
-    clear_has_command_type();
-      ::data_types::CameraFrame* temp = command_type_.camera_frame_;
-    command_type_.camera_frame_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline void FrameChunk::set_frame_id(uint64_t value) {
+  _internal_set_frame_id(value);
+  // @@protoc_insertion_point(field_set:data_types.FrameChunk.frame_id)
 }
-inline const ::data_types::CameraFrame& Command::_internal_camera_frame() const {
-  return _internal_has_camera_frame()
-      ? *command_type_.camera_frame_
-      : *reinterpret_cast< ::data_types::CameraFrame*>(&::data_types::_CameraFrame_default_instance_);
+
+// uint64 offset = 2;
+inline void FrameChunk::clear_offset() {
+  _impl_.offset_ = uint64_t{0u};
 }
-inline const ::data_types::CameraFrame& Command::camera_frame() const {
-  // @@protoc_insertion_point(field_get:data_types.Command.camera_frame)
-  return _internal_camera_frame();
+inline uint64_t FrameChunk::_internal_offset() const {
+  return _impl_.offset_;
 }
-inline ::data_types::CameraFrame* Command::_internal_mutable_camera_frame() {
-  if (!_internal_has_camera_frame()) {
-    clear_command_type();
-    set_has_camera_frame();
-    command_type_.camera_frame_ = CreateMaybeMessage< ::data_types::CameraFrame >(
-        GetArenaNoVirtual());
-  }
-  return command_type_.camera_frame_;
+inline uint64_t FrameChunk::offset() const {
+  // @@protoc_insertion_point(field_get:data_types.FrameChunk.offset)
+  return _internal_offset();
 }
-inline ::data_types::CameraFrame* Command::mutable_camera_frame() {
-  // @@protoc_insertion_point(field_mutable:data_types.Command.camera_frame)
-  return _internal_mutable_camera_frame();
+inline void FrameChunk::_internal_set_offset(uint64_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void FrameChunk::set_offset(uint64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:data_types.FrameChunk.offset)
 }
 
-inline bool Command::has_command_type() const {
-  return command_type_case() != COMMAND_TYPE_NOT_SET;
+// bytes data = 3;
+inline void FrameChunk::clear_data() {
+  _impl_.data_.ClearToEmpty();
 }
-inline void Command::clear_has_command_type() {
-  _oneof_case_[0] = COMMAND_TYPE_NOT_SET;
+inline const std::string& FrameChunk::data() const {
+  // @@protoc_insertion_point(field_get:data_types.FrameChunk.data)
+  return _internal_data();
 }
-inline Command::CommandTypeCase Command::command_type_case() const {
-  return Command::CommandTypeCase(_oneof_case_[0]);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FrameChunk::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:data_types.FrameChunk.data)
+}
+inline std::string* FrameChunk::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:data_types.FrameChunk.data)
+  return _s;
+}
+inline const std::string& FrameChunk::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void FrameChunk::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FrameChunk::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FrameChunk::release_data() {
+  // @@protoc_insertion_point(field_release:data_types.FrameChunk.data)
+  return _impl_.data_.Release();
+}
+inline void FrameChunk::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:data_types.FrameChunk.data)
 }
+
 // -------------------------------------------------------------------
 
 // ConfigRequest
 
 // .google.protobuf.FloatValue detection_threshold = 1;
 inline bool ConfigRequest::_internal_has_detection_threshold() const {
-  return this != internal_default_instance() && detection_threshold_ != nullptr;
+  return this != internal_default_instance() && _impl_.detection_threshold_ != nullptr;
 }
 inline bool ConfigRequest::has_detection_threshold() const {
   return _internal_has_detection_threshold();
 }
-inline const PROTOBUF_NAMESPACE_ID::FloatValue& ConfigRequest::_internal_detection_threshold() const {
-  const PROTOBUF_NAMESPACE_ID::FloatValue* p = detection_threshold_;
-  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::FloatValue*>(
-      &PROTOBUF_NAMESPACE_ID::_FloatValue_default_instance_);
+inline const ::PROTOBUF_NAMESPACE_ID::FloatValue& ConfigRequest::_internal_detection_threshold() const {
+  const ::PROTOBUF_NAMESPACE_ID::FloatValue* p = _impl_.detection_threshold_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::FloatValue&>(
+      ::PROTOBUF_NAMESPACE_ID::_FloatValue_default_instance_);
 }
-inline const PROTOBUF_NAMESPACE_ID::FloatValue& ConfigRequest::detection_threshold() const {
+inline const ::PROTOBUF_NAMESPACE_ID::FloatValue& ConfigRequest::detection_threshold() const {
   // @@protoc_insertion_point(field_get:data_types.ConfigRequest.detection_threshold)
   return _internal_detection_threshold();
 }
-inline PROTOBUF_NAMESPACE_ID::FloatValue* ConfigRequest::release_detection_threshold() {
+inline void ConfigRequest::unsafe_arena_set_allocated_detection_threshold(
+    ::PROTOBUF_NAMESPACE_ID::FloatValue* detection_threshold) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.detection_threshold_);
+  }
+  _impl_.detection_threshold_ = detection_threshold;
+  if (detection_threshold) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.ConfigRequest.detection_threshold)
+}
+inline ::PROTOBUF_NAMESPACE_ID::FloatValue* ConfigRequest::release_detection_threshold() {
+  
+  ::PROTOBUF_NAMESPACE_ID::FloatValue* temp = _impl_.detection_threshold_;
+  _impl_.detection_threshold_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::FloatValue* ConfigRequest::unsafe_arena_release_detection_threshold() {
   // @@protoc_insertion_point(field_release:data_types.ConfigRequest.detection_threshold)
   
-  PROTOBUF_NAMESPACE_ID::FloatValue* temp = detection_threshold_;
-  detection_threshold_ = nullptr;
+  ::PROTOBUF_NAMESPACE_ID::FloatValue* temp = _impl_.detection_threshold_;
+  _impl_.detection_threshold_ = nullptr;
   return temp;
 }
-inline PROTOBUF_NAMESPACE_ID::FloatValue* ConfigRequest::_internal_mutable_detection_threshold() {
+inline ::PROTOBUF_NAMESPACE_ID::FloatValue* ConfigRequest::_internal_mutable_detection_threshold() {
   
-  if (detection_threshold_ == nullptr) {
-    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::FloatValue>(GetArenaNoVirtual());
-    detection_threshold_ = p;
+  if (_impl_.detection_threshold_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::FloatValue>(GetArenaForAllocation());
+    _impl_.detection_threshold_ = p;
   }
-  return detection_threshold_;
+  return _impl_.detection_threshold_;
 }
-inline PROTOBUF_NAMESPACE_ID::FloatValue* ConfigRequest::mutable_detection_threshold() {
+inline ::PROTOBUF_NAMESPACE_ID::FloatValue* ConfigRequest::mutable_detection_threshold() {
+  ::PROTOBUF_NAMESPACE_ID::FloatValue* _msg = _internal_mutable_detection_threshold();
   // @@protoc_insertion_point(field_mutable:data_types.ConfigRequest.detection_threshold)
-  return _internal_mutable_detection_threshold();
+  return _msg;
 }
-inline void ConfigRequest::set_allocated_detection_threshold(PROTOBUF_NAMESPACE_ID::FloatValue* detection_threshold) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+inline void ConfigRequest::set_allocated_detection_threshold(::PROTOBUF_NAMESPACE_ID::FloatValue* detection_threshold) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(detection_threshold_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.detection_threshold_);
   }
   if (detection_threshold) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(detection_threshold)->GetArena();
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(detection_threshold));
     if (message_arena != submessage_arena) {
       detection_threshold = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, detection_threshold, submessage_arena);
@@ -3180,53 +6855,83 @@ inline void ConfigRequest::set_allocated_detection_threshold(PROTOBUF_NAMESPACE_
   } else {
     
   }
-  detection_threshold_ = detection_threshold;
+  _impl_.detection_threshold_ = detection_threshold;
   // @@protoc_insertion_point(field_set_allocated:data_types.ConfigRequest.detection_threshold)
 }
 
 // .google.protobuf.UInt32Value sleep_timeout_sec = 2;
 inline bool ConfigRequest::_internal_has_sleep_timeout_sec() const {
-  return this != internal_default_instance() && sleep_timeout_sec_ != nullptr;
+  return this != internal_default_instance() && _impl_.sleep_timeout_sec_ != nullptr;
 }
 inline bool ConfigRequest::has_sleep_timeout_sec() const {
   return _internal_has_sleep_timeout_sec();
 }
-inline const PROTOBUF_NAMESPACE_ID::UInt32Value& ConfigRequest::_internal_sleep_timeout_sec() const {
-  const PROTOBUF_NAMESPACE_ID::UInt32Value* p = sleep_timeout_sec_;
-  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::UInt32Value*>(
-      &PROTOBUF_NAMESPACE_ID::_UInt32Value_default_instance_);
+inline const ::PROTOBUF_NAMESPACE_ID::UInt32Value& ConfigRequest::_internal_sleep_timeout_sec() const {
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value* p = _impl_.sleep_timeout_sec_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::UInt32Value&>(
+      ::PROTOBUF_NAMESPACE_ID::_UInt32Value_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::UInt32Value& ConfigRequest::sleep_timeout_sec() const {
+  // @@protoc_insertion_point(field_get:data_types.ConfigRequest.sleep_timeout_sec)
+  return _internal_sleep_timeout_sec();
+}
+inline void ConfigRequest::unsafe_arena_set_allocated_sleep_timeout_sec(
+    ::PROTOBUF_NAMESPACE_ID::UInt32Value* sleep_timeout_sec) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.sleep_timeout_sec_);
+  }
+  _impl_.sleep_timeout_sec_ = sleep_timeout_sec;
+  if (sleep_timeout_sec) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.ConfigRequest.sleep_timeout_sec)
 }
-inline const PROTOBUF_NAMESPACE_ID::UInt32Value& ConfigRequest::sleep_timeout_sec() const {
-  // @@protoc_insertion_point(field_get:data_types.ConfigRequest.sleep_timeout_sec)
-  return _internal_sleep_timeout_sec();
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* ConfigRequest::release_sleep_timeout_sec() {
+  
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* temp = _impl_.sleep_timeout_sec_;
+  _impl_.sleep_timeout_sec_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline PROTOBUF_NAMESPACE_ID::UInt32Value* ConfigRequest::release_sleep_timeout_sec() {
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* ConfigRequest::unsafe_arena_release_sleep_timeout_sec() {
   // @@protoc_insertion_point(field_release:data_types.ConfigRequest.sleep_timeout_sec)
   
-  PROTOBUF_NAMESPACE_ID::UInt32Value* temp = sleep_timeout_sec_;
-  sleep_timeout_sec_ = nullptr;
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* temp = _impl_.sleep_timeout_sec_;
+  _impl_.sleep_timeout_sec_ = nullptr;
   return temp;
 }
-inline PROTOBUF_NAMESPACE_ID::UInt32Value* ConfigRequest::_internal_mutable_sleep_timeout_sec() {
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* ConfigRequest::_internal_mutable_sleep_timeout_sec() {
   
-  if (sleep_timeout_sec_ == nullptr) {
-    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::UInt32Value>(GetArenaNoVirtual());
-    sleep_timeout_sec_ = p;
+  if (_impl_.sleep_timeout_sec_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::UInt32Value>(GetArenaForAllocation());
+    _impl_.sleep_timeout_sec_ = p;
   }
-  return sleep_timeout_sec_;
+  return _impl_.sleep_timeout_sec_;
 }
-inline PROTOBUF_NAMESPACE_ID::UInt32Value* ConfigRequest::mutable_sleep_timeout_sec() {
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* ConfigRequest::mutable_sleep_timeout_sec() {
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* _msg = _internal_mutable_sleep_timeout_sec();
   // @@protoc_insertion_point(field_mutable:data_types.ConfigRequest.sleep_timeout_sec)
-  return _internal_mutable_sleep_timeout_sec();
+  return _msg;
 }
-inline void ConfigRequest::set_allocated_sleep_timeout_sec(PROTOBUF_NAMESPACE_ID::UInt32Value* sleep_timeout_sec) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+inline void ConfigRequest::set_allocated_sleep_timeout_sec(::PROTOBUF_NAMESPACE_ID::UInt32Value* sleep_timeout_sec) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(sleep_timeout_sec_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.sleep_timeout_sec_);
   }
   if (sleep_timeout_sec) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(sleep_timeout_sec)->GetArena();
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(sleep_timeout_sec));
     if (message_arena != submessage_arena) {
       sleep_timeout_sec = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, sleep_timeout_sec, submessage_arena);
@@ -3235,20 +6940,70 @@ inline void ConfigRequest::set_allocated_sleep_timeout_sec(PROTOBUF_NAMESPACE_ID
   } else {
     
   }
-  sleep_timeout_sec_ = sleep_timeout_sec;
+  _impl_.sleep_timeout_sec_ = sleep_timeout_sec;
   // @@protoc_insertion_point(field_set_allocated:data_types.ConfigRequest.sleep_timeout_sec)
 }
 
+// string profile = 3;
+inline void ConfigRequest::clear_profile() {
+  _impl_.profile_.ClearToEmpty();
+}
+inline const std::string& ConfigRequest::profile() const {
+  // @@protoc_insertion_point(field_get:data_types.ConfigRequest.profile)
+  return _internal_profile();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ConfigRequest::set_profile(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.profile_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:data_types.ConfigRequest.profile)
+}
+inline std::string* ConfigRequest::mutable_profile() {
+  std::string* _s = _internal_mutable_profile();
+  // @@protoc_insertion_point(field_mutable:data_types.ConfigRequest.profile)
+  return _s;
+}
+inline const std::string& ConfigRequest::_internal_profile() const {
+  return _impl_.profile_.Get();
+}
+inline void ConfigRequest::_internal_set_profile(const std::string& value) {
+  
+  _impl_.profile_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ConfigRequest::_internal_mutable_profile() {
+  
+  return _impl_.profile_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ConfigRequest::release_profile() {
+  // @@protoc_insertion_point(field_release:data_types.ConfigRequest.profile)
+  return _impl_.profile_.Release();
+}
+inline void ConfigRequest::set_allocated_profile(std::string* profile) {
+  if (profile != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.profile_.SetAllocated(profile, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.profile_.IsDefault()) {
+    _impl_.profile_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:data_types.ConfigRequest.profile)
+}
+
 // -------------------------------------------------------------------
 
 // ControlAction
 
 // .data_types.ControlAction.ActionType action = 1;
 inline void ControlAction::clear_action() {
-  action_ = 0;
+  _impl_.action_ = 0;
 }
 inline ::data_types::ControlAction_ActionType ControlAction::_internal_action() const {
-  return static_cast< ::data_types::ControlAction_ActionType >(action_);
+  return static_cast< ::data_types::ControlAction_ActionType >(_impl_.action_);
 }
 inline ::data_types::ControlAction_ActionType ControlAction::action() const {
   // @@protoc_insertion_point(field_get:data_types.ControlAction.action)
@@ -3256,60 +7011,140 @@ inline ::data_types::ControlAction_ActionType ControlAction::action() const {
 }
 inline void ControlAction::_internal_set_action(::data_types::ControlAction_ActionType value) {
   
-  action_ = value;
+  _impl_.action_ = value;
 }
 inline void ControlAction::set_action(::data_types::ControlAction_ActionType value) {
   _internal_set_action(value);
   // @@protoc_insertion_point(field_set:data_types.ControlAction.action)
 }
 
+// string profile = 2;
+inline void ControlAction::clear_profile() {
+  _impl_.profile_.ClearToEmpty();
+}
+inline const std::string& ControlAction::profile() const {
+  // @@protoc_insertion_point(field_get:data_types.ControlAction.profile)
+  return _internal_profile();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ControlAction::set_profile(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.profile_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:data_types.ControlAction.profile)
+}
+inline std::string* ControlAction::mutable_profile() {
+  std::string* _s = _internal_mutable_profile();
+  // @@protoc_insertion_point(field_mutable:data_types.ControlAction.profile)
+  return _s;
+}
+inline const std::string& ControlAction::_internal_profile() const {
+  return _impl_.profile_.Get();
+}
+inline void ControlAction::_internal_set_profile(const std::string& value) {
+  
+  _impl_.profile_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ControlAction::_internal_mutable_profile() {
+  
+  return _impl_.profile_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ControlAction::release_profile() {
+  // @@protoc_insertion_point(field_release:data_types.ControlAction.profile)
+  return _impl_.profile_.Release();
+}
+inline void ControlAction::set_allocated_profile(std::string* profile) {
+  if (profile != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.profile_.SetAllocated(profile, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.profile_.IsDefault()) {
+    _impl_.profile_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:data_types.ControlAction.profile)
+}
+
 // -------------------------------------------------------------------
 
 // Heartbeat
 
 // .google.protobuf.Timestamp timestamp = 1;
 inline bool Heartbeat::_internal_has_timestamp() const {
-  return this != internal_default_instance() && timestamp_ != nullptr;
+  return this != internal_default_instance() && _impl_.timestamp_ != nullptr;
 }
 inline bool Heartbeat::has_timestamp() const {
   return _internal_has_timestamp();
 }
-inline const PROTOBUF_NAMESPACE_ID::Timestamp& Heartbeat::_internal_timestamp() const {
-  const PROTOBUF_NAMESPACE_ID::Timestamp* p = timestamp_;
-  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Timestamp*>(
-      &PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& Heartbeat::_internal_timestamp() const {
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.timestamp_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
+      ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
 }
-inline const PROTOBUF_NAMESPACE_ID::Timestamp& Heartbeat::timestamp() const {
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& Heartbeat::timestamp() const {
   // @@protoc_insertion_point(field_get:data_types.Heartbeat.timestamp)
   return _internal_timestamp();
 }
-inline PROTOBUF_NAMESPACE_ID::Timestamp* Heartbeat::release_timestamp() {
+inline void Heartbeat::unsafe_arena_set_allocated_timestamp(
+    ::PROTOBUF_NAMESPACE_ID::Timestamp* timestamp) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.timestamp_);
+  }
+  _impl_.timestamp_ = timestamp;
+  if (timestamp) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.Heartbeat.timestamp)
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* Heartbeat::release_timestamp() {
+  
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.timestamp_;
+  _impl_.timestamp_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* Heartbeat::unsafe_arena_release_timestamp() {
   // @@protoc_insertion_point(field_release:data_types.Heartbeat.timestamp)
   
-  PROTOBUF_NAMESPACE_ID::Timestamp* temp = timestamp_;
-  timestamp_ = nullptr;
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.timestamp_;
+  _impl_.timestamp_ = nullptr;
   return temp;
 }
-inline PROTOBUF_NAMESPACE_ID::Timestamp* Heartbeat::_internal_mutable_timestamp() {
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* Heartbeat::_internal_mutable_timestamp() {
   
-  if (timestamp_ == nullptr) {
-    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaNoVirtual());
-    timestamp_ = p;
+  if (_impl_.timestamp_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaForAllocation());
+    _impl_.timestamp_ = p;
   }
-  return timestamp_;
+  return _impl_.timestamp_;
 }
-inline PROTOBUF_NAMESPACE_ID::Timestamp* Heartbeat::mutable_timestamp() {
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* Heartbeat::mutable_timestamp() {
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_timestamp();
   // @@protoc_insertion_point(field_mutable:data_types.Heartbeat.timestamp)
-  return _internal_mutable_timestamp();
+  return _msg;
 }
-inline void Heartbeat::set_allocated_timestamp(PROTOBUF_NAMESPACE_ID::Timestamp* timestamp) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+inline void Heartbeat::set_allocated_timestamp(::PROTOBUF_NAMESPACE_ID::Timestamp* timestamp) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(timestamp_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.timestamp_);
   }
   if (timestamp) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(timestamp)->GetArena();
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(timestamp));
     if (message_arena != submessage_arena) {
       timestamp = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, timestamp, submessage_arena);
@@ -3318,7 +7153,7 @@ inline void Heartbeat::set_allocated_timestamp(PROTOBUF_NAMESPACE_ID::Timestamp*
   } else {
     
   }
-  timestamp_ = timestamp;
+  _impl_.timestamp_ = timestamp;
   // @@protoc_insertion_point(field_set_allocated:data_types.Heartbeat.timestamp)
 }
 
@@ -3334,11 +7169,13 @@ inline bool ServerMessage::has_camera_frame() const {
   return _internal_has_camera_frame();
 }
 inline void ServerMessage::set_has_camera_frame() {
-  _oneof_case_[0] = kCameraFrame;
+  _impl_._oneof_case_[0] = kCameraFrame;
 }
 inline void ServerMessage::clear_camera_frame() {
   if (_internal_has_camera_frame()) {
-    delete message_type_.camera_frame_;
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.message_type_.camera_frame_;
+    }
     clear_has_message_type();
   }
 }
@@ -3346,8 +7183,11 @@ inline ::data_types::CameraFrame* ServerMessage::release_camera_frame() {
   // @@protoc_insertion_point(field_release:data_types.ServerMessage.camera_frame)
   if (_internal_has_camera_frame()) {
     clear_has_message_type();
-      ::data_types::CameraFrame* temp = message_type_.camera_frame_;
-    message_type_.camera_frame_ = nullptr;
+    ::data_types::CameraFrame* temp = _impl_.message_type_.camera_frame_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.message_type_.camera_frame_ = nullptr;
     return temp;
   } else {
     return nullptr;
@@ -3355,25 +7195,44 @@ inline ::data_types::CameraFrame* ServerMessage::release_camera_frame() {
 }
 inline const ::data_types::CameraFrame& ServerMessage::_internal_camera_frame() const {
   return _internal_has_camera_frame()
-      ? *message_type_.camera_frame_
-      : *reinterpret_cast< ::data_types::CameraFrame*>(&::data_types::_CameraFrame_default_instance_);
+      ? *_impl_.message_type_.camera_frame_
+      : reinterpret_cast< ::data_types::CameraFrame&>(::data_types::_CameraFrame_default_instance_);
 }
 inline const ::data_types::CameraFrame& ServerMessage::camera_frame() const {
   // @@protoc_insertion_point(field_get:data_types.ServerMessage.camera_frame)
   return _internal_camera_frame();
 }
+inline ::data_types::CameraFrame* ServerMessage::unsafe_arena_release_camera_frame() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:data_types.ServerMessage.camera_frame)
+  if (_internal_has_camera_frame()) {
+    clear_has_message_type();
+    ::data_types::CameraFrame* temp = _impl_.message_type_.camera_frame_;
+    _impl_.message_type_.camera_frame_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ServerMessage::unsafe_arena_set_allocated_camera_frame(::data_types::CameraFrame* camera_frame) {
+  clear_message_type();
+  if (camera_frame) {
+    set_has_camera_frame();
+    _impl_.message_type_.camera_frame_ = camera_frame;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.ServerMessage.camera_frame)
+}
 inline ::data_types::CameraFrame* ServerMessage::_internal_mutable_camera_frame() {
   if (!_internal_has_camera_frame()) {
     clear_message_type();
     set_has_camera_frame();
-    message_type_.camera_frame_ = CreateMaybeMessage< ::data_types::CameraFrame >(
-        GetArenaNoVirtual());
+    _impl_.message_type_.camera_frame_ = CreateMaybeMessage< ::data_types::CameraFrame >(GetArenaForAllocation());
   }
-  return message_type_.camera_frame_;
+  return _impl_.message_type_.camera_frame_;
 }
 inline ::data_types::CameraFrame* ServerMessage::mutable_camera_frame() {
+  ::data_types::CameraFrame* _msg = _internal_mutable_camera_frame();
   // @@protoc_insertion_point(field_mutable:data_types.ServerMessage.camera_frame)
-  return _internal_mutable_camera_frame();
+  return _msg;
 }
 
 // .data_types.DetectionResult detection_result = 2;
@@ -3384,11 +7243,13 @@ inline bool ServerMessage::has_detection_result() const {
   return _internal_has_detection_result();
 }
 inline void ServerMessage::set_has_detection_result() {
-  _oneof_case_[0] = kDetectionResult;
+  _impl_._oneof_case_[0] = kDetectionResult;
 }
 inline void ServerMessage::clear_detection_result() {
   if (_internal_has_detection_result()) {
-    delete message_type_.detection_result_;
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.message_type_.detection_result_;
+    }
     clear_has_message_type();
   }
 }
@@ -3396,8 +7257,11 @@ inline ::data_types::DetectionResult* ServerMessage::release_detection_result()
   // @@protoc_insertion_point(field_release:data_types.ServerMessage.detection_result)
   if (_internal_has_detection_result()) {
     clear_has_message_type();
-      ::data_types::DetectionResult* temp = message_type_.detection_result_;
-    message_type_.detection_result_ = nullptr;
+    ::data_types::DetectionResult* temp = _impl_.message_type_.detection_result_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.message_type_.detection_result_ = nullptr;
     return temp;
   } else {
     return nullptr;
@@ -3405,25 +7269,44 @@ inline ::data_types::DetectionResult* ServerMessage::release_detection_result()
 }
 inline const ::data_types::DetectionResult& ServerMessage::_internal_detection_result() const {
   return _internal_has_detection_result()
-      ? *message_type_.detection_result_
-      : *reinterpret_cast< ::data_types::DetectionResult*>(&::data_types::_DetectionResult_default_instance_);
+      ? *_impl_.message_type_.detection_result_
+      : reinterpret_cast< ::data_types::DetectionResult&>(::data_types::_DetectionResult_default_instance_);
 }
 inline const ::data_types::DetectionResult& ServerMessage::detection_result() const {
   // @@protoc_insertion_point(field_get:data_types.ServerMessage.detection_result)
   return _internal_detection_result();
 }
+inline ::data_types::DetectionResult* ServerMessage::unsafe_arena_release_detection_result() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:data_types.ServerMessage.detection_result)
+  if (_internal_has_detection_result()) {
+    clear_has_message_type();
+    ::data_types::DetectionResult* temp = _impl_.message_type_.detection_result_;
+    _impl_.message_type_.detection_result_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ServerMessage::unsafe_arena_set_allocated_detection_result(::data_types::DetectionResult* detection_result) {
+  clear_message_type();
+  if (detection_result) {
+    set_has_detection_result();
+    _impl_.message_type_.detection_result_ = detection_result;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.ServerMessage.detection_result)
+}
 inline ::data_types::DetectionResult* ServerMessage::_internal_mutable_detection_result() {
   if (!_internal_has_detection_result()) {
     clear_message_type();
     set_has_detection_result();
-    message_type_.detection_result_ = CreateMaybeMessage< ::data_types::DetectionResult >(
-        GetArenaNoVirtual());
+    _impl_.message_type_.detection_result_ = CreateMaybeMessage< ::data_types::DetectionResult >(GetArenaForAllocation());
   }
-  return message_type_.detection_result_;
+  return _impl_.message_type_.detection_result_;
 }
 inline ::data_types::DetectionResult* ServerMessage::mutable_detection_result() {
+  ::data_types::DetectionResult* _msg = _internal_mutable_detection_result();
   // @@protoc_insertion_point(field_mutable:data_types.ServerMessage.detection_result)
-  return _internal_mutable_detection_result();
+  return _msg;
 }
 
 // .data_types.DeviceStatus device_status = 3;
@@ -3434,11 +7317,13 @@ inline bool ServerMessage::has_device_status() const {
   return _internal_has_device_status();
 }
 inline void ServerMessage::set_has_device_status() {
-  _oneof_case_[0] = kDeviceStatus;
+  _impl_._oneof_case_[0] = kDeviceStatus;
 }
 inline void ServerMessage::clear_device_status() {
   if (_internal_has_device_status()) {
-    delete message_type_.device_status_;
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.message_type_.device_status_;
+    }
     clear_has_message_type();
   }
 }
@@ -3446,8 +7331,11 @@ inline ::data_types::DeviceStatus* ServerMessage::release_device_status() {
   // @@protoc_insertion_point(field_release:data_types.ServerMessage.device_status)
   if (_internal_has_device_status()) {
     clear_has_message_type();
-      ::data_types::DeviceStatus* temp = message_type_.device_status_;
-    message_type_.device_status_ = nullptr;
+    ::data_types::DeviceStatus* temp = _impl_.message_type_.device_status_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.message_type_.device_status_ = nullptr;
     return temp;
   } else {
     return nullptr;
@@ -3455,25 +7343,44 @@ inline ::data_types::DeviceStatus* ServerMessage::release_device_status() {
 }
 inline const ::data_types::DeviceStatus& ServerMessage::_internal_device_status() const {
   return _internal_has_device_status()
-      ? *message_type_.device_status_
-      : *reinterpret_cast< ::data_types::DeviceStatus*>(&::data_types::_DeviceStatus_default_instance_);
+      ? *_impl_.message_type_.device_status_
+      : reinterpret_cast< ::data_types::DeviceStatus&>(::data_types::_DeviceStatus_default_instance_);
 }
 inline const ::data_types::DeviceStatus& ServerMessage::device_status() const {
   // @@protoc_insertion_point(field_get:data_types.ServerMessage.device_status)
   return _internal_device_status();
 }
+inline ::data_types::DeviceStatus* ServerMessage::unsafe_arena_release_device_status() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:data_types.ServerMessage.device_status)
+  if (_internal_has_device_status()) {
+    clear_has_message_type();
+    ::data_types::DeviceStatus* temp = _impl_.message_type_.device_status_;
+    _impl_.message_type_.device_status_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ServerMessage::unsafe_arena_set_allocated_device_status(::data_types::DeviceStatus* device_status) {
+  clear_message_type();
+  if (device_status) {
+    set_has_device_status();
+    _impl_.message_type_.device_status_ = device_status;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.ServerMessage.device_status)
+}
 inline ::data_types::DeviceStatus* ServerMessage::_internal_mutable_device_status() {
   if (!_internal_has_device_status()) {
     clear_message_type();
     set_has_device_status();
-    message_type_.device_status_ = CreateMaybeMessage< ::data_types::DeviceStatus >(
-        GetArenaNoVirtual());
+    _impl_.message_type_.device_status_ = CreateMaybeMessage< ::data_types::DeviceStatus >(GetArenaForAllocation());
   }
-  return message_type_.device_status_;
+  return _impl_.message_type_.device_status_;
 }
 inline ::data_types::DeviceStatus* ServerMessage::mutable_device_status() {
+  ::data_types::DeviceStatus* _msg = _internal_mutable_device_status();
   // @@protoc_insertion_point(field_mutable:data_types.ServerMessage.device_status)
-  return _internal_mutable_device_status();
+  return _msg;
 }
 
 // .data_types.ConfigResponse config_response = 4;
@@ -3484,11 +7391,13 @@ inline bool ServerMessage::has_config_response() const {
   return _internal_has_config_response();
 }
 inline void ServerMessage::set_has_config_response() {
-  _oneof_case_[0] = kConfigResponse;
+  _impl_._oneof_case_[0] = kConfigResponse;
 }
 inline void ServerMessage::clear_config_response() {
   if (_internal_has_config_response()) {
-    delete message_type_.config_response_;
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.message_type_.config_response_;
+    }
     clear_has_message_type();
   }
 }
@@ -3496,8 +7405,11 @@ inline ::data_types::ConfigResponse* ServerMessage::release_config_response() {
   // @@protoc_insertion_point(field_release:data_types.ServerMessage.config_response)
   if (_internal_has_config_response()) {
     clear_has_message_type();
-      ::data_types::ConfigResponse* temp = message_type_.config_response_;
-    message_type_.config_response_ = nullptr;
+    ::data_types::ConfigResponse* temp = _impl_.message_type_.config_response_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.message_type_.config_response_ = nullptr;
     return temp;
   } else {
     return nullptr;
@@ -3505,36 +7417,321 @@ inline ::data_types::ConfigResponse* ServerMessage::release_config_response() {
 }
 inline const ::data_types::ConfigResponse& ServerMessage::_internal_config_response() const {
   return _internal_has_config_response()
-      ? *message_type_.config_response_
-      : *reinterpret_cast< ::data_types::ConfigResponse*>(&::data_types::_ConfigResponse_default_instance_);
+      ? *_impl_.message_type_.config_response_
+      : reinterpret_cast< ::data_types::ConfigResponse&>(::data_types::_ConfigResponse_default_instance_);
 }
 inline const ::data_types::ConfigResponse& ServerMessage::config_response() const {
   // @@protoc_insertion_point(field_get:data_types.ServerMessage.config_response)
   return _internal_config_response();
 }
+inline ::data_types::ConfigResponse* ServerMessage::unsafe_arena_release_config_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:data_types.ServerMessage.config_response)
+  if (_internal_has_config_response()) {
+    clear_has_message_type();
+    ::data_types::ConfigResponse* temp = _impl_.message_type_.config_response_;
+    _impl_.message_type_.config_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ServerMessage::unsafe_arena_set_allocated_config_response(::data_types::ConfigResponse* config_response) {
+  clear_message_type();
+  if (config_response) {
+    set_has_config_response();
+    _impl_.message_type_.config_response_ = config_response;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.ServerMessage.config_response)
+}
 inline ::data_types::ConfigResponse* ServerMessage::_internal_mutable_config_response() {
   if (!_internal_has_config_response()) {
     clear_message_type();
     set_has_config_response();
-    message_type_.config_response_ = CreateMaybeMessage< ::data_types::ConfigResponse >(
-        GetArenaNoVirtual());
+    _impl_.message_type_.config_response_ = CreateMaybeMessage< ::data_types::ConfigResponse >(GetArenaForAllocation());
   }
-  return message_type_.config_response_;
+  return _impl_.message_type_.config_response_;
 }
 inline ::data_types::ConfigResponse* ServerMessage::mutable_config_response() {
+  ::data_types::ConfigResponse* _msg = _internal_mutable_config_response();
   // @@protoc_insertion_point(field_mutable:data_types.ServerMessage.config_response)
-  return _internal_mutable_config_response();
+  return _msg;
+}
+
+// .data_types.Heartbeat heartbeat = 5;
+inline bool ServerMessage::_internal_has_heartbeat() const {
+  return message_type_case() == kHeartbeat;
+}
+inline bool ServerMessage::has_heartbeat() const {
+  return _internal_has_heartbeat();
+}
+inline void ServerMessage::set_has_heartbeat() {
+  _impl_._oneof_case_[0] = kHeartbeat;
+}
+inline void ServerMessage::clear_heartbeat() {
+  if (_internal_has_heartbeat()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.message_type_.heartbeat_;
+    }
+    clear_has_message_type();
+  }
+}
+inline ::data_types::Heartbeat* ServerMessage::release_heartbeat() {
+  // @@protoc_insertion_point(field_release:data_types.ServerMessage.heartbeat)
+  if (_internal_has_heartbeat()) {
+    clear_has_message_type();
+    ::data_types::Heartbeat* temp = _impl_.message_type_.heartbeat_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.message_type_.heartbeat_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::data_types::Heartbeat& ServerMessage::_internal_heartbeat() const {
+  return _internal_has_heartbeat()
+      ? *_impl_.message_type_.heartbeat_
+      : reinterpret_cast< ::data_types::Heartbeat&>(::data_types::_Heartbeat_default_instance_);
+}
+inline const ::data_types::Heartbeat& ServerMessage::heartbeat() const {
+  // @@protoc_insertion_point(field_get:data_types.ServerMessage.heartbeat)
+  return _internal_heartbeat();
+}
+inline ::data_types::Heartbeat* ServerMessage::unsafe_arena_release_heartbeat() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:data_types.ServerMessage.heartbeat)
+  if (_internal_has_heartbeat()) {
+    clear_has_message_type();
+    ::data_types::Heartbeat* temp = _impl_.message_type_.heartbeat_;
+    _impl_.message_type_.heartbeat_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ServerMessage::unsafe_arena_set_allocated_heartbeat(::data_types::Heartbeat* heartbeat) {
+  clear_message_type();
+  if (heartbeat) {
+    set_has_heartbeat();
+    _impl_.message_type_.heartbeat_ = heartbeat;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.ServerMessage.heartbeat)
+}
+inline ::data_types::Heartbeat* ServerMessage::_internal_mutable_heartbeat() {
+  if (!_internal_has_heartbeat()) {
+    clear_message_type();
+    set_has_heartbeat();
+    _impl_.message_type_.heartbeat_ = CreateMaybeMessage< ::data_types::Heartbeat >(GetArenaForAllocation());
+  }
+  return _impl_.message_type_.heartbeat_;
+}
+inline ::data_types::Heartbeat* ServerMessage::mutable_heartbeat() {
+  ::data_types::Heartbeat* _msg = _internal_mutable_heartbeat();
+  // @@protoc_insertion_point(field_mutable:data_types.ServerMessage.heartbeat)
+  return _msg;
+}
+
+// .data_types.ResultBatch result_batch = 6;
+inline bool ServerMessage::_internal_has_result_batch() const {
+  return message_type_case() == kResultBatch;
+}
+inline bool ServerMessage::has_result_batch() const {
+  return _internal_has_result_batch();
+}
+inline void ServerMessage::set_has_result_batch() {
+  _impl_._oneof_case_[0] = kResultBatch;
+}
+inline void ServerMessage::clear_result_batch() {
+  if (_internal_has_result_batch()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.message_type_.result_batch_;
+    }
+    clear_has_message_type();
+  }
+}
+inline ::data_types::ResultBatch* ServerMessage::release_result_batch() {
+  // @@protoc_insertion_point(field_release:data_types.ServerMessage.result_batch)
+  if (_internal_has_result_batch()) {
+    clear_has_message_type();
+    ::data_types::ResultBatch* temp = _impl_.message_type_.result_batch_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.message_type_.result_batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::data_types::ResultBatch& ServerMessage::_internal_result_batch() const {
+  return _internal_has_result_batch()
+      ? *_impl_.message_type_.result_batch_
+      : reinterpret_cast< ::data_types::ResultBatch&>(::data_types::_ResultBatch_default_instance_);
+}
+inline const ::data_types::ResultBatch& ServerMessage::result_batch() const {
+  // @@protoc_insertion_point(field_get:data_types.ServerMessage.result_batch)
+  return _internal_result_batch();
+}
+inline ::data_types::ResultBatch* ServerMessage::unsafe_arena_release_result_batch() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:data_types.ServerMessage.result_batch)
+  if (_internal_has_result_batch()) {
+    clear_has_message_type();
+    ::data_types::ResultBatch* temp = _impl_.message_type_.result_batch_;
+    _impl_.message_type_.result_batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ServerMessage::unsafe_arena_set_allocated_result_batch(::data_types::ResultBatch* result_batch) {
+  clear_message_type();
+  if (result_batch) {
+    set_has_result_batch();
+    _impl_.message_type_.result_batch_ = result_batch;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.ServerMessage.result_batch)
+}
+inline ::data_types::ResultBatch* ServerMessage::_internal_mutable_result_batch() {
+  if (!_internal_has_result_batch()) {
+    clear_message_type();
+    set_has_result_batch();
+    _impl_.message_type_.result_batch_ = CreateMaybeMessage< ::data_types::ResultBatch >(GetArenaForAllocation());
+  }
+  return _impl_.message_type_.result_batch_;
+}
+inline ::data_types::ResultBatch* ServerMessage::mutable_result_batch() {
+  ::data_types::ResultBatch* _msg = _internal_mutable_result_batch();
+  // @@protoc_insertion_point(field_mutable:data_types.ServerMessage.result_batch)
+  return _msg;
+}
+
+// .data_types.SessionConfig session_config = 7;
+inline bool ServerMessage::_internal_has_session_config() const {
+  return message_type_case() == kSessionConfig;
+}
+inline bool ServerMessage::has_session_config() const {
+  return _internal_has_session_config();
+}
+inline void ServerMessage::set_has_session_config() {
+  _impl_._oneof_case_[0] = kSessionConfig;
+}
+inline void ServerMessage::clear_session_config() {
+  if (_internal_has_session_config()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.message_type_.session_config_;
+    }
+    clear_has_message_type();
+  }
+}
+inline ::data_types::SessionConfig* ServerMessage::release_session_config() {
+  // @@protoc_insertion_point(field_release:data_types.ServerMessage.session_config)
+  if (_internal_has_session_config()) {
+    clear_has_message_type();
+    ::data_types::SessionConfig* temp = _impl_.message_type_.session_config_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.message_type_.session_config_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::data_types::SessionConfig& ServerMessage::_internal_session_config() const {
+  return _internal_has_session_config()
+      ? *_impl_.message_type_.session_config_
+      : reinterpret_cast< ::data_types::SessionConfig&>(::data_types::_SessionConfig_default_instance_);
+}
+inline const ::data_types::SessionConfig& ServerMessage::session_config() const {
+  // @@protoc_insertion_point(field_get:data_types.ServerMessage.session_config)
+  return _internal_session_config();
+}
+inline ::data_types::SessionConfig* ServerMessage::unsafe_arena_release_session_config() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:data_types.ServerMessage.session_config)
+  if (_internal_has_session_config()) {
+    clear_has_message_type();
+    ::data_types::SessionConfig* temp = _impl_.message_type_.session_config_;
+    _impl_.message_type_.session_config_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ServerMessage::unsafe_arena_set_allocated_session_config(::data_types::SessionConfig* session_config) {
+  clear_message_type();
+  if (session_config) {
+    set_has_session_config();
+    _impl_.message_type_.session_config_ = session_config;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.ServerMessage.session_config)
+}
+inline ::data_types::SessionConfig* ServerMessage::_internal_mutable_session_config() {
+  if (!_internal_has_session_config()) {
+    clear_message_type();
+    set_has_session_config();
+    _impl_.message_type_.session_config_ = CreateMaybeMessage< ::data_types::SessionConfig >(GetArenaForAllocation());
+  }
+  return _impl_.message_type_.session_config_;
+}
+inline ::data_types::SessionConfig* ServerMessage::mutable_session_config() {
+  ::data_types::SessionConfig* _msg = _internal_mutable_session_config();
+  // @@protoc_insertion_point(field_mutable:data_types.ServerMessage.session_config)
+  return _msg;
 }
 
 inline bool ServerMessage::has_message_type() const {
   return message_type_case() != MESSAGE_TYPE_NOT_SET;
 }
 inline void ServerMessage::clear_has_message_type() {
-  _oneof_case_[0] = MESSAGE_TYPE_NOT_SET;
+  _impl_._oneof_case_[0] = MESSAGE_TYPE_NOT_SET;
 }
 inline ServerMessage::MessageTypeCase ServerMessage::message_type_case() const {
-  return ServerMessage::MessageTypeCase(_oneof_case_[0]);
+  return ServerMessage::MessageTypeCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// ResultBatch
+
+// repeated .data_types.DetectionResult results = 1;
+inline int ResultBatch::_internal_results_size() const {
+  return _impl_.results_.size();
+}
+inline int ResultBatch::results_size() const {
+  return _internal_results_size();
+}
+inline void ResultBatch::clear_results() {
+  _impl_.results_.Clear();
+}
+inline ::data_types::DetectionResult* ResultBatch::mutable_results(int index) {
+  // @@protoc_insertion_point(field_mutable:data_types.ResultBatch.results)
+  return _impl_.results_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::data_types::DetectionResult >*
+ResultBatch::mutable_results() {
+  // @@protoc_insertion_point(field_mutable_list:data_types.ResultBatch.results)
+  return &_impl_.results_;
+}
+inline const ::data_types::DetectionResult& ResultBatch::_internal_results(int index) const {
+  return _impl_.results_.Get(index);
+}
+inline const ::data_types::DetectionResult& ResultBatch::results(int index) const {
+  // @@protoc_insertion_point(field_get:data_types.ResultBatch.results)
+  return _internal_results(index);
+}
+inline ::data_types::DetectionResult* ResultBatch::_internal_add_results() {
+  return _impl_.results_.Add();
 }
+inline ::data_types::DetectionResult* ResultBatch::add_results() {
+  ::data_types::DetectionResult* _add = _internal_add_results();
+  // @@protoc_insertion_point(field_add:data_types.ResultBatch.results)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::data_types::DetectionResult >&
+ResultBatch::results() const {
+  // @@protoc_insertion_point(field_list:data_types.ResultBatch.results)
+  return _impl_.results_;
+}
+
 // -------------------------------------------------------------------
 
 // ClientMessage
@@ -3547,11 +7744,13 @@ inline bool ClientMessage::has_device_status() const {
   return _internal_has_device_status();
 }
 inline void ClientMessage::set_has_device_status() {
-  _oneof_case_[0] = kDeviceStatus;
+  _impl_._oneof_case_[0] = kDeviceStatus;
 }
 inline void ClientMessage::clear_device_status() {
   if (_internal_has_device_status()) {
-    delete message_type_.device_status_;
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.message_type_.device_status_;
+    }
     clear_has_message_type();
   }
 }
@@ -3559,8 +7758,11 @@ inline ::data_types::DeviceStatus* ClientMessage::release_device_status() {
   // @@protoc_insertion_point(field_release:data_types.ClientMessage.device_status)
   if (_internal_has_device_status()) {
     clear_has_message_type();
-      ::data_types::DeviceStatus* temp = message_type_.device_status_;
-    message_type_.device_status_ = nullptr;
+    ::data_types::DeviceStatus* temp = _impl_.message_type_.device_status_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.message_type_.device_status_ = nullptr;
     return temp;
   } else {
     return nullptr;
@@ -3568,25 +7770,44 @@ inline ::data_types::DeviceStatus* ClientMessage::release_device_status() {
 }
 inline const ::data_types::DeviceStatus& ClientMessage::_internal_device_status() const {
   return _internal_has_device_status()
-      ? *message_type_.device_status_
-      : *reinterpret_cast< ::data_types::DeviceStatus*>(&::data_types::_DeviceStatus_default_instance_);
+      ? *_impl_.message_type_.device_status_
+      : reinterpret_cast< ::data_types::DeviceStatus&>(::data_types::_DeviceStatus_default_instance_);
 }
 inline const ::data_types::DeviceStatus& ClientMessage::device_status() const {
   // @@protoc_insertion_point(field_get:data_types.ClientMessage.device_status)
   return _internal_device_status();
 }
+inline ::data_types::DeviceStatus* ClientMessage::unsafe_arena_release_device_status() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:data_types.ClientMessage.device_status)
+  if (_internal_has_device_status()) {
+    clear_has_message_type();
+    ::data_types::DeviceStatus* temp = _impl_.message_type_.device_status_;
+    _impl_.message_type_.device_status_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ClientMessage::unsafe_arena_set_allocated_device_status(::data_types::DeviceStatus* device_status) {
+  clear_message_type();
+  if (device_status) {
+    set_has_device_status();
+    _impl_.message_type_.device_status_ = device_status;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.ClientMessage.device_status)
+}
 inline ::data_types::DeviceStatus* ClientMessage::_internal_mutable_device_status() {
   if (!_internal_has_device_status()) {
     clear_message_type();
     set_has_device_status();
-    message_type_.device_status_ = CreateMaybeMessage< ::data_types::DeviceStatus >(
-        GetArenaNoVirtual());
+    _impl_.message_type_.device_status_ = CreateMaybeMessage< ::data_types::DeviceStatus >(GetArenaForAllocation());
   }
-  return message_type_.device_status_;
+  return _impl_.message_type_.device_status_;
 }
 inline ::data_types::DeviceStatus* ClientMessage::mutable_device_status() {
+  ::data_types::DeviceStatus* _msg = _internal_mutable_device_status();
   // @@protoc_insertion_point(field_mutable:data_types.ClientMessage.device_status)
-  return _internal_mutable_device_status();
+  return _msg;
 }
 
 // .data_types.ConfigResponse config_response = 2;
@@ -3597,11 +7818,13 @@ inline bool ClientMessage::has_config_response() const {
   return _internal_has_config_response();
 }
 inline void ClientMessage::set_has_config_response() {
-  _oneof_case_[0] = kConfigResponse;
+  _impl_._oneof_case_[0] = kConfigResponse;
 }
 inline void ClientMessage::clear_config_response() {
   if (_internal_has_config_response()) {
-    delete message_type_.config_response_;
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.message_type_.config_response_;
+    }
     clear_has_message_type();
   }
 }
@@ -3609,8 +7832,11 @@ inline ::data_types::ConfigResponse* ClientMessage::release_config_response() {
   // @@protoc_insertion_point(field_release:data_types.ClientMessage.config_response)
   if (_internal_has_config_response()) {
     clear_has_message_type();
-      ::data_types::ConfigResponse* temp = message_type_.config_response_;
-    message_type_.config_response_ = nullptr;
+    ::data_types::ConfigResponse* temp = _impl_.message_type_.config_response_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.message_type_.config_response_ = nullptr;
     return temp;
   } else {
     return nullptr;
@@ -3618,35 +7844,54 @@ inline ::data_types::ConfigResponse* ClientMessage::release_config_response() {
 }
 inline const ::data_types::ConfigResponse& ClientMessage::_internal_config_response() const {
   return _internal_has_config_response()
-      ? *message_type_.config_response_
-      : *reinterpret_cast< ::data_types::ConfigResponse*>(&::data_types::_ConfigResponse_default_instance_);
+      ? *_impl_.message_type_.config_response_
+      : reinterpret_cast< ::data_types::ConfigResponse&>(::data_types::_ConfigResponse_default_instance_);
 }
 inline const ::data_types::ConfigResponse& ClientMessage::config_response() const {
   // @@protoc_insertion_point(field_get:data_types.ClientMessage.config_response)
   return _internal_config_response();
 }
+inline ::data_types::ConfigResponse* ClientMessage::unsafe_arena_release_config_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:data_types.ClientMessage.config_response)
+  if (_internal_has_config_response()) {
+    clear_has_message_type();
+    ::data_types::ConfigResponse* temp = _impl_.message_type_.config_response_;
+    _impl_.message_type_.config_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ClientMessage::unsafe_arena_set_allocated_config_response(::data_types::ConfigResponse* config_response) {
+  clear_message_type();
+  if (config_response) {
+    set_has_config_response();
+    _impl_.message_type_.config_response_ = config_response;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:data_types.ClientMessage.config_response)
+}
 inline ::data_types::ConfigResponse* ClientMessage::_internal_mutable_config_response() {
   if (!_internal_has_config_response()) {
     clear_message_type();
     set_has_config_response();
-    message_type_.config_response_ = CreateMaybeMessage< ::data_types::ConfigResponse >(
-        GetArenaNoVirtual());
+    _impl_.message_type_.config_response_ = CreateMaybeMessage< ::data_types::ConfigResponse >(GetArenaForAllocation());
   }
-  return message_type_.config_response_;
+  return _impl_.message_type_.config_response_;
 }
 inline ::data_types::ConfigResponse* ClientMessage::mutable_config_response() {
+  ::data_types::ConfigResponse* _msg = _internal_mutable_config_response();
   // @@protoc_insertion_point(field_mutable:data_types.ClientMessage.config_response)
-  return _internal_mutable_config_response();
+  return _msg;
 }
 
 inline bool ClientMessage::has_message_type() const {
   return message_type_case() != MESSAGE_TYPE_NOT_SET;
 }
 inline void ClientMessage::clear_has_message_type() {
-  _oneof_case_[0] = MESSAGE_TYPE_NOT_SET;
+  _impl_._oneof_case_[0] = MESSAGE_TYPE_NOT_SET;
 }
 inline ClientMessage::MessageTypeCase ClientMessage::message_type_case() const {
-  return ClientMessage::MessageTypeCase(_oneof_case_[0]);
+  return ClientMessage::MessageTypeCase(_impl_._oneof_case_[0]);
 }
 // -------------------------------------------------------------------
 
@@ -3654,10 +7899,10 @@ inline ClientMessage::MessageTypeCase ClientMessage::message_type_case() const {
 
 // bool success = 1;
 inline void ConfigResponse::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
 }
 inline bool ConfigResponse::_internal_success() const {
-  return success_;
+  return _impl_.success_;
 }
 inline bool ConfigResponse::success() const {
   // @@protoc_insertion_point(field_get:data_types.ConfigResponse.success)
@@ -3665,7 +7910,7 @@ inline bool ConfigResponse::success() const {
 }
 inline void ConfigResponse::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
 }
 inline void ConfigResponse::set_success(bool value) {
   _internal_set_success(value);
@@ -3674,53 +7919,38 @@ inline void ConfigResponse::set_success(bool value) {
 
 // string message = 2;
 inline void ConfigResponse::clear_message() {
-  message_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.message_.ClearToEmpty();
 }
 inline const std::string& ConfigResponse::message() const {
   // @@protoc_insertion_point(field_get:data_types.ConfigResponse.message)
   return _internal_message();
 }
-inline void ConfigResponse::set_message(const std::string& value) {
-  _internal_set_message(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ConfigResponse::set_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:data_types.ConfigResponse.message)
 }
 inline std::string* ConfigResponse::mutable_message() {
+  std::string* _s = _internal_mutable_message();
   // @@protoc_insertion_point(field_mutable:data_types.ConfigResponse.message)
-  return _internal_mutable_message();
+  return _s;
 }
 inline const std::string& ConfigResponse::_internal_message() const {
-  return message_.GetNoArena();
+  return _impl_.message_.Get();
 }
 inline void ConfigResponse::_internal_set_message(const std::string& value) {
   
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ConfigResponse::set_message(std::string&& value) {
-  
-  message_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:data_types.ConfigResponse.message)
-}
-inline void ConfigResponse::set_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:data_types.ConfigResponse.message)
-}
-inline void ConfigResponse::set_message(const char* value, size_t size) {
-  
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:data_types.ConfigResponse.message)
+  _impl_.message_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ConfigResponse::_internal_mutable_message() {
   
-  return message_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.message_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ConfigResponse::release_message() {
   // @@protoc_insertion_point(field_release:data_types.ConfigResponse.message)
-  
-  return message_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.message_.Release();
 }
 inline void ConfigResponse::set_allocated_message(std::string* message) {
   if (message != nullptr) {
@@ -3728,7 +7958,12 @@ inline void ConfigResponse::set_allocated_message(std::string* message) {
   } else {
     
   }
-  message_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), message);
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:data_types.ConfigResponse.message)
 }
 
@@ -3755,6 +7990,18 @@ inline void ConfigResponse::set_allocated_message(std::string* message) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -23,6 +23,7 @@ namespace wakemeup {
 
 static const char* WakeUpService_method_names[] = {
   "/wakemeup.WakeUpService/TriggerScript",
+  "/wakemeup.WakeUpService/IsDisplayOn",
 };
 
 std::unique_ptr< WakeUpService::Stub> WakeUpService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -33,6 +34,7 @@ std::unique_ptr< WakeUpService::Stub> WakeUpService::NewStub(const std::shared_p
 
 WakeUpService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
   : channel_(channel), rpcmethod_TriggerScript_(WakeUpService_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_IsDisplayOn_(WakeUpService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status WakeUpService::Stub::TriggerScript(::grpc::ClientContext* context, const ::wakemeup::WakeUpRequest& request, ::wakemeup::WakeUpResponse* response) {
@@ -58,6 +60,29 @@ void WakeUpService::Stub::async::TriggerScript(::grpc::ClientContext* context, c
   return result;
 }
 
+::grpc::Status WakeUpService::Stub::IsDisplayOn(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::wakemeup::DisplayState* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::google::protobuf::Empty, ::wakemeup::DisplayState, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_IsDisplayOn_, context, request, response);
+}
+
+void WakeUpService::Stub::async::IsDisplayOn(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::wakemeup::DisplayState* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::google::protobuf::Empty, ::wakemeup::DisplayState, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_IsDisplayOn_, context, request, response, std::move(f));
+}
+
+void WakeUpService::Stub::async::IsDisplayOn(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::wakemeup::DisplayState* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_IsDisplayOn_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::wakemeup::DisplayState>* WakeUpService::Stub::PrepareAsyncIsDisplayOnRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::wakemeup::DisplayState, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_IsDisplayOn_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::wakemeup::DisplayState>* WakeUpService::Stub::AsyncIsDisplayOnRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncIsDisplayOnRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 WakeUpService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       WakeUpService_method_names[0],
@@ -69,6 +94,16 @@ WakeUpService::Service::Service() {
              ::wakemeup::WakeUpResponse* resp) {
                return service->TriggerScript(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      WakeUpService_method_names[1],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< WakeUpService::Service, ::google::protobuf::Empty, ::wakemeup::DisplayState, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](WakeUpService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::google::protobuf::Empty* req,
+             ::wakemeup::DisplayState* resp) {
+               return service->IsDisplayOn(ctx, req, resp);
+             }, this)));
 }
 
 WakeUpService::Service::~Service() {
@@ -81,6 +116,13 @@ WakeUpService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status WakeUpService::Service::IsDisplayOn(::grpc::ServerContext* context, const ::google::protobuf::Empty* request, ::wakemeup::DisplayState* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace wakemeup
 
@@ -42,11 +42,20 @@ class WakeUpService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::wakemeup::WakeUpResponse>> PrepareAsyncTriggerScript(::grpc::ClientContext* context, const ::wakemeup::WakeUpRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::wakemeup::WakeUpResponse>>(PrepareAsyncTriggerScriptRaw(context, request, cq));
     }
+    virtual ::grpc::Status IsDisplayOn(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::wakemeup::DisplayState* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::wakemeup::DisplayState>> AsyncIsDisplayOn(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::wakemeup::DisplayState>>(AsyncIsDisplayOnRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::wakemeup::DisplayState>> PrepareAsyncIsDisplayOn(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::wakemeup::DisplayState>>(PrepareAsyncIsDisplayOnRaw(context, request, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
       virtual void TriggerScript(::grpc::ClientContext* context, const ::wakemeup::WakeUpRequest* request, ::wakemeup::WakeUpResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void TriggerScript(::grpc::ClientContext* context, const ::wakemeup::WakeUpRequest* request, ::wakemeup::WakeUpResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void IsDisplayOn(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::wakemeup::DisplayState* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void IsDisplayOn(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::wakemeup::DisplayState* response, ::grpc::ClientUnaryReactor* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -54,6 +63,8 @@ class WakeUpService final {
    private:
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::wakemeup::WakeUpResponse>* AsyncTriggerScriptRaw(::grpc::ClientContext* context, const ::wakemeup::WakeUpRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::wakemeup::WakeUpResponse>* PrepareAsyncTriggerScriptRaw(::grpc::ClientContext* context, const ::wakemeup::WakeUpRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::wakemeup::DisplayState>* AsyncIsDisplayOnRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::wakemeup::DisplayState>* PrepareAsyncIsDisplayOnRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -65,11 +76,20 @@ class WakeUpService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::wakemeup::WakeUpResponse>> PrepareAsyncTriggerScript(::grpc::ClientContext* context, const ::wakemeup::WakeUpRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::wakemeup::WakeUpResponse>>(PrepareAsyncTriggerScriptRaw(context, request, cq));
     }
+    ::grpc::Status IsDisplayOn(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::wakemeup::DisplayState* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::wakemeup::DisplayState>> AsyncIsDisplayOn(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::wakemeup::DisplayState>>(AsyncIsDisplayOnRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::wakemeup::DisplayState>> PrepareAsyncIsDisplayOn(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::wakemeup::DisplayState>>(PrepareAsyncIsDisplayOnRaw(context, request, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
       void TriggerScript(::grpc::ClientContext* context, const ::wakemeup::WakeUpRequest* request, ::wakemeup::WakeUpResponse* response, std::function<void(::grpc::Status)>) override;
       void TriggerScript(::grpc::ClientContext* context, const ::wakemeup::WakeUpRequest* request, ::wakemeup::WakeUpResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void IsDisplayOn(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::wakemeup::DisplayState* response, std::function<void(::grpc::Status)>) override;
+      void IsDisplayOn(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::wakemeup::DisplayState* response, ::grpc::ClientUnaryReactor* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -83,7 +103,10 @@ class WakeUpService final {
     class async async_stub_{this};
     ::grpc::ClientAsyncResponseReader< ::wakemeup::WakeUpResponse>* AsyncTriggerScriptRaw(::grpc::ClientContext* context, const ::wakemeup::WakeUpRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::wakemeup::WakeUpResponse>* PrepareAsyncTriggerScriptRaw(::grpc::ClientContext* context, const ::wakemeup::WakeUpRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::wakemeup::DisplayState>* AsyncIsDisplayOnRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::wakemeup::DisplayState>* PrepareAsyncIsDisplayOnRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_TriggerScript_;
+    const ::grpc::internal::RpcMethod rpcmethod_IsDisplayOn_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -92,6 +115,7 @@ class WakeUpService final {
     Service();
     virtual ~Service();
     virtual ::grpc::Status TriggerScript(::grpc::ServerContext* context, const ::wakemeup::WakeUpRequest* request, ::wakemeup::WakeUpResponse* response);
+    virtual ::grpc::Status IsDisplayOn(::grpc::ServerContext* context, const ::google::protobuf::Empty* request, ::wakemeup::DisplayState* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_TriggerScript : public BaseClass {
@@ -113,7 +137,27 @@ class WakeUpService final {
       ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_TriggerScript<Service > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_IsDisplayOn : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_IsDisplayOn() {
+      ::grpc::Service::MarkMethodAsync(1);
+    }
+    ~WithAsyncMethod_IsDisplayOn() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status IsDisplayOn(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::wakemeup::DisplayState* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestIsDisplayOn(::grpc::ServerContext* context, ::google::protobuf::Empty* request, ::grpc::ServerAsyncResponseWriter< ::wakemeup::DisplayState>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_TriggerScript<WithAsyncMethod_IsDisplayOn<Service > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_TriggerScript : public BaseClass {
    private:
@@ -141,7 +185,34 @@ class WakeUpService final {
     virtual ::grpc::ServerUnaryReactor* TriggerScript(
       ::grpc::CallbackServerContext* /*context*/, const ::wakemeup::WakeUpRequest* /*request*/, ::wakemeup::WakeUpResponse* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_TriggerScript<Service > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_IsDisplayOn : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_IsDisplayOn() {
+      ::grpc::Service::MarkMethodCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::wakemeup::DisplayState>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::google::protobuf::Empty* request, ::wakemeup::DisplayState* response) { return this->IsDisplayOn(context, request, response); }));}
+    void SetMessageAllocatorFor_IsDisplayOn(
+        ::grpc::MessageAllocator< ::google::protobuf::Empty, ::wakemeup::DisplayState>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::wakemeup::DisplayState>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_IsDisplayOn() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status IsDisplayOn(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::wakemeup::DisplayState* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* IsDisplayOn(
+      ::grpc::CallbackServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::wakemeup::DisplayState* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_TriggerScript<WithCallbackMethod_IsDisplayOn<Service > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_TriggerScript : public BaseClass {
@@ -161,6 +232,23 @@ class WakeUpService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_IsDisplayOn : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_IsDisplayOn() {
+      ::grpc::Service::MarkMethodGeneric(1);
+    }
+    ~WithGenericMethod_IsDisplayOn() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status IsDisplayOn(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::wakemeup::DisplayState* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_TriggerScript : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -181,6 +269,26 @@ class WakeUpService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_IsDisplayOn : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_IsDisplayOn() {
+      ::grpc::Service::MarkMethodRaw(1);
+    }
+    ~WithRawMethod_IsDisplayOn() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status IsDisplayOn(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::wakemeup::DisplayState* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestIsDisplayOn(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_TriggerScript : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -203,6 +311,28 @@ class WakeUpService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_IsDisplayOn : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_IsDisplayOn() {
+      ::grpc::Service::MarkMethodRawCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->IsDisplayOn(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_IsDisplayOn() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status IsDisplayOn(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::wakemeup::DisplayState* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* IsDisplayOn(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_TriggerScript : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -229,9 +359,36 @@ class WakeUpService final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedTriggerScript(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::wakemeup::WakeUpRequest,::wakemeup::WakeUpResponse>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_TriggerScript<Service > StreamedUnaryService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_IsDisplayOn : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_IsDisplayOn() {
+      ::grpc::Service::MarkMethodStreamed(1,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::google::protobuf::Empty, ::wakemeup::DisplayState>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::google::protobuf::Empty, ::wakemeup::DisplayState>* streamer) {
+                       return this->StreamedIsDisplayOn(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_IsDisplayOn() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status IsDisplayOn(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::wakemeup::DisplayState* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedIsDisplayOn(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::google::protobuf::Empty,::wakemeup::DisplayState>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_TriggerScript<WithStreamedUnaryMethod_IsDisplayOn<Service > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_TriggerScript<Service > StreamedService;
+  typedef WithStreamedUnaryMethod_TriggerScript<WithStreamedUnaryMethod_IsDisplayOn<Service > > StreamedService;
 };
 
 }  // namespace wakemeup
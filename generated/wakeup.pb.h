@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3011000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3011000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,15 +23,14 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/empty.pb.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
 #define PROTOBUF_INTERNAL_EXPORT_wakeup_2eproto
@@ -43,26 +42,22 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_wakeup_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[2]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_wakeup_2eproto;
 namespace wakemeup {
+class DisplayState;
+struct DisplayStateDefaultTypeInternal;
+extern DisplayStateDefaultTypeInternal _DisplayState_default_instance_;
 class WakeUpRequest;
-class WakeUpRequestDefaultTypeInternal;
+struct WakeUpRequestDefaultTypeInternal;
 extern WakeUpRequestDefaultTypeInternal _WakeUpRequest_default_instance_;
 class WakeUpResponse;
-class WakeUpResponseDefaultTypeInternal;
+struct WakeUpResponseDefaultTypeInternal;
 extern WakeUpResponseDefaultTypeInternal _WakeUpResponse_default_instance_;
 }  // namespace wakemeup
 PROTOBUF_NAMESPACE_OPEN
+template<> ::wakemeup::DisplayState* Arena::CreateMaybeMessage<::wakemeup::DisplayState>(Arena*);
 template<> ::wakemeup::WakeUpRequest* Arena::CreateMaybeMessage<::wakemeup::WakeUpRequest>(Arena*);
 template<> ::wakemeup::WakeUpResponse* Arena::CreateMaybeMessage<::wakemeup::WakeUpResponse>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
@@ -70,11 +65,12 @@ namespace wakemeup {
 
 // ===================================================================
 
-class WakeUpRequest :
+class WakeUpRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wakemeup.WakeUpRequest) */ {
  public:
-  WakeUpRequest();
-  virtual ~WakeUpRequest();
+  inline WakeUpRequest() : WakeUpRequest(nullptr) {}
+  ~WakeUpRequest() override;
+  explicit PROTOBUF_CONSTEXPR WakeUpRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   WakeUpRequest(const WakeUpRequest& from);
   WakeUpRequest(WakeUpRequest&& from) noexcept
@@ -87,8 +83,13 @@ class WakeUpRequest :
     return *this;
   }
   inline WakeUpRequest& operator=(WakeUpRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -99,14 +100,14 @@ class WakeUpRequest :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WakeUpRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const WakeUpRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const WakeUpRequest* internal_default_instance() {
     return reinterpret_cast<const WakeUpRequest*>(
                &_WakeUpRequest_default_instance_);
@@ -119,57 +120,66 @@ class WakeUpRequest :
   }
   inline void Swap(WakeUpRequest* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WakeUpRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline WakeUpRequest* New() const final {
-    return CreateMaybeMessage<WakeUpRequest>(nullptr);
-  }
-
-  WakeUpRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  WakeUpRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<WakeUpRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const WakeUpRequest& from);
-  void MergeFrom(const WakeUpRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WakeUpRequest& from) {
+    WakeUpRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(WakeUpRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "wakemeup.WakeUpRequest";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit WakeUpRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_wakeup_2eproto);
-    return ::descriptor_table_wakeup_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -182,32 +192,28 @@ class WakeUpRequest :
   // string script_name = 1;
   void clear_script_name();
   const std::string& script_name() const;
-  void set_script_name(const std::string& value);
-  void set_script_name(std::string&& value);
-  void set_script_name(const char* value);
-  void set_script_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_script_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_script_name();
-  std::string* release_script_name();
+  PROTOBUF_NODISCARD std::string* release_script_name();
   void set_allocated_script_name(std::string* script_name);
   private:
   const std::string& _internal_script_name() const;
-  void _internal_set_script_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_script_name(const std::string& value);
   std::string* _internal_mutable_script_name();
   public:
 
   // string args = 2;
   void clear_args();
   const std::string& args() const;
-  void set_args(const std::string& value);
-  void set_args(std::string&& value);
-  void set_args(const char* value);
-  void set_args(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_args(ArgT0&& arg0, ArgT... args);
   std::string* mutable_args();
-  std::string* release_args();
+  PROTOBUF_NODISCARD std::string* release_args();
   void set_allocated_args(std::string* args);
   private:
   const std::string& _internal_args() const;
-  void _internal_set_args(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_args(const std::string& value);
   std::string* _internal_mutable_args();
   public:
 
@@ -215,19 +221,25 @@ class WakeUpRequest :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr script_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr args_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr script_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr args_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_wakeup_2eproto;
 };
 // -------------------------------------------------------------------
 
-class WakeUpResponse :
+class WakeUpResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wakemeup.WakeUpResponse) */ {
  public:
-  WakeUpResponse();
-  virtual ~WakeUpResponse();
+  inline WakeUpResponse() : WakeUpResponse(nullptr) {}
+  ~WakeUpResponse() override;
+  explicit PROTOBUF_CONSTEXPR WakeUpResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   WakeUpResponse(const WakeUpResponse& from);
   WakeUpResponse(WakeUpResponse&& from) noexcept
@@ -240,8 +252,13 @@ class WakeUpResponse :
     return *this;
   }
   inline WakeUpResponse& operator=(WakeUpResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -252,14 +269,14 @@ class WakeUpResponse :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WakeUpResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const WakeUpResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const WakeUpResponse* internal_default_instance() {
     return reinterpret_cast<const WakeUpResponse*>(
                &_WakeUpResponse_default_instance_);
@@ -272,57 +289,66 @@ class WakeUpResponse :
   }
   inline void Swap(WakeUpResponse* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WakeUpResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline WakeUpResponse* New() const final {
-    return CreateMaybeMessage<WakeUpResponse>(nullptr);
-  }
-
-  WakeUpResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  WakeUpResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<WakeUpResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const WakeUpResponse& from);
-  void MergeFrom(const WakeUpResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WakeUpResponse& from) {
+    WakeUpResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(WakeUpResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "wakemeup.WakeUpResponse";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit WakeUpResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_wakeup_2eproto);
-    return ::descriptor_table_wakeup_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -336,16 +362,14 @@ class WakeUpResponse :
   // string message = 2;
   void clear_message();
   const std::string& message() const;
-  void set_message(const std::string& value);
-  void set_message(std::string&& value);
-  void set_message(const char* value);
-  void set_message(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
   std::string* mutable_message();
-  std::string* release_message();
+  PROTOBUF_NODISCARD std::string* release_message();
   void set_allocated_message(std::string* message);
   private:
   const std::string& _internal_message() const;
-  void _internal_set_message(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
   std::string* _internal_mutable_message();
   public:
 
@@ -360,22 +384,191 @@ class WakeUpResponse :
 
   // int32 process_id = 3;
   void clear_process_id();
-  ::PROTOBUF_NAMESPACE_ID::int32 process_id() const;
-  void set_process_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t process_id() const;
+  void set_process_id(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_process_id() const;
-  void _internal_set_process_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_process_id() const;
+  void _internal_set_process_id(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:wakemeup.WakeUpResponse)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
-  bool success_;
-  ::PROTOBUF_NAMESPACE_ID::int32 process_id_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    bool success_;
+    int32_t process_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wakeup_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DisplayState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wakemeup.DisplayState) */ {
+ public:
+  inline DisplayState() : DisplayState(nullptr) {}
+  ~DisplayState() override;
+  explicit PROTOBUF_CONSTEXPR DisplayState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DisplayState(const DisplayState& from);
+  DisplayState(DisplayState&& from) noexcept
+    : DisplayState() {
+    *this = ::std::move(from);
+  }
+
+  inline DisplayState& operator=(const DisplayState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DisplayState& operator=(DisplayState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DisplayState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DisplayState* internal_default_instance() {
+    return reinterpret_cast<const DisplayState*>(
+               &_DisplayState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(DisplayState& a, DisplayState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DisplayState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DisplayState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DisplayState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DisplayState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DisplayState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DisplayState& from) {
+    DisplayState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DisplayState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wakemeup.DisplayState";
+  }
+  protected:
+  explicit DisplayState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInfoFieldNumber = 2,
+    kOnFieldNumber = 1,
+  };
+  // string info = 2;
+  void clear_info();
+  const std::string& info() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_info(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_info();
+  PROTOBUF_NODISCARD std::string* release_info();
+  void set_allocated_info(std::string* info);
+  private:
+  const std::string& _internal_info() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_info(const std::string& value);
+  std::string* _internal_mutable_info();
+  public:
+
+  // bool on = 1;
+  void clear_on();
+  bool on() const;
+  void set_on(bool value);
+  private:
+  bool _internal_on() const;
+  void _internal_set_on(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:wakemeup.DisplayState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr info_;
+    bool on_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_wakeup_2eproto;
 };
 // ===================================================================
@@ -391,53 +584,38 @@ class WakeUpResponse :
 
 // string script_name = 1;
 inline void WakeUpRequest::clear_script_name() {
-  script_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.script_name_.ClearToEmpty();
 }
 inline const std::string& WakeUpRequest::script_name() const {
   // @@protoc_insertion_point(field_get:wakemeup.WakeUpRequest.script_name)
   return _internal_script_name();
 }
-inline void WakeUpRequest::set_script_name(const std::string& value) {
-  _internal_set_script_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WakeUpRequest::set_script_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.script_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:wakemeup.WakeUpRequest.script_name)
 }
 inline std::string* WakeUpRequest::mutable_script_name() {
+  std::string* _s = _internal_mutable_script_name();
   // @@protoc_insertion_point(field_mutable:wakemeup.WakeUpRequest.script_name)
-  return _internal_mutable_script_name();
+  return _s;
 }
 inline const std::string& WakeUpRequest::_internal_script_name() const {
-  return script_name_.GetNoArena();
+  return _impl_.script_name_.Get();
 }
 inline void WakeUpRequest::_internal_set_script_name(const std::string& value) {
   
-  script_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void WakeUpRequest::set_script_name(std::string&& value) {
-  
-  script_name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:wakemeup.WakeUpRequest.script_name)
-}
-inline void WakeUpRequest::set_script_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  script_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:wakemeup.WakeUpRequest.script_name)
-}
-inline void WakeUpRequest::set_script_name(const char* value, size_t size) {
-  
-  script_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:wakemeup.WakeUpRequest.script_name)
+  _impl_.script_name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* WakeUpRequest::_internal_mutable_script_name() {
   
-  return script_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.script_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* WakeUpRequest::release_script_name() {
   // @@protoc_insertion_point(field_release:wakemeup.WakeUpRequest.script_name)
-  
-  return script_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.script_name_.Release();
 }
 inline void WakeUpRequest::set_allocated_script_name(std::string* script_name) {
   if (script_name != nullptr) {
@@ -445,59 +623,49 @@ inline void WakeUpRequest::set_allocated_script_name(std::string* script_name) {
   } else {
     
   }
-  script_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), script_name);
+  _impl_.script_name_.SetAllocated(script_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.script_name_.IsDefault()) {
+    _impl_.script_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:wakemeup.WakeUpRequest.script_name)
 }
 
 // string args = 2;
 inline void WakeUpRequest::clear_args() {
-  args_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.args_.ClearToEmpty();
 }
 inline const std::string& WakeUpRequest::args() const {
   // @@protoc_insertion_point(field_get:wakemeup.WakeUpRequest.args)
   return _internal_args();
 }
-inline void WakeUpRequest::set_args(const std::string& value) {
-  _internal_set_args(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WakeUpRequest::set_args(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.args_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:wakemeup.WakeUpRequest.args)
 }
 inline std::string* WakeUpRequest::mutable_args() {
+  std::string* _s = _internal_mutable_args();
   // @@protoc_insertion_point(field_mutable:wakemeup.WakeUpRequest.args)
-  return _internal_mutable_args();
+  return _s;
 }
 inline const std::string& WakeUpRequest::_internal_args() const {
-  return args_.GetNoArena();
+  return _impl_.args_.Get();
 }
 inline void WakeUpRequest::_internal_set_args(const std::string& value) {
   
-  args_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void WakeUpRequest::set_args(std::string&& value) {
-  
-  args_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:wakemeup.WakeUpRequest.args)
-}
-inline void WakeUpRequest::set_args(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  args_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:wakemeup.WakeUpRequest.args)
-}
-inline void WakeUpRequest::set_args(const char* value, size_t size) {
-  
-  args_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:wakemeup.WakeUpRequest.args)
+  _impl_.args_.Set(value, GetArenaForAllocation());
 }
 inline std::string* WakeUpRequest::_internal_mutable_args() {
   
-  return args_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.args_.Mutable(GetArenaForAllocation());
 }
 inline std::string* WakeUpRequest::release_args() {
   // @@protoc_insertion_point(field_release:wakemeup.WakeUpRequest.args)
-  
-  return args_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.args_.Release();
 }
 inline void WakeUpRequest::set_allocated_args(std::string* args) {
   if (args != nullptr) {
@@ -505,7 +673,12 @@ inline void WakeUpRequest::set_allocated_args(std::string* args) {
   } else {
     
   }
-  args_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), args);
+  _impl_.args_.SetAllocated(args, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.args_.IsDefault()) {
+    _impl_.args_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:wakemeup.WakeUpRequest.args)
 }
 
@@ -515,10 +688,10 @@ inline void WakeUpRequest::set_allocated_args(std::string* args) {
 
 // bool success = 1;
 inline void WakeUpResponse::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
 }
 inline bool WakeUpResponse::_internal_success() const {
-  return success_;
+  return _impl_.success_;
 }
 inline bool WakeUpResponse::success() const {
   // @@protoc_insertion_point(field_get:wakemeup.WakeUpResponse.success)
@@ -526,7 +699,7 @@ inline bool WakeUpResponse::success() const {
 }
 inline void WakeUpResponse::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
 }
 inline void WakeUpResponse::set_success(bool value) {
   _internal_set_success(value);
@@ -535,53 +708,38 @@ inline void WakeUpResponse::set_success(bool value) {
 
 // string message = 2;
 inline void WakeUpResponse::clear_message() {
-  message_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.message_.ClearToEmpty();
 }
 inline const std::string& WakeUpResponse::message() const {
   // @@protoc_insertion_point(field_get:wakemeup.WakeUpResponse.message)
   return _internal_message();
 }
-inline void WakeUpResponse::set_message(const std::string& value) {
-  _internal_set_message(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WakeUpResponse::set_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:wakemeup.WakeUpResponse.message)
 }
 inline std::string* WakeUpResponse::mutable_message() {
+  std::string* _s = _internal_mutable_message();
   // @@protoc_insertion_point(field_mutable:wakemeup.WakeUpResponse.message)
-  return _internal_mutable_message();
+  return _s;
 }
 inline const std::string& WakeUpResponse::_internal_message() const {
-  return message_.GetNoArena();
+  return _impl_.message_.Get();
 }
 inline void WakeUpResponse::_internal_set_message(const std::string& value) {
   
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void WakeUpResponse::set_message(std::string&& value) {
-  
-  message_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:wakemeup.WakeUpResponse.message)
-}
-inline void WakeUpResponse::set_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:wakemeup.WakeUpResponse.message)
-}
-inline void WakeUpResponse::set_message(const char* value, size_t size) {
-  
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:wakemeup.WakeUpResponse.message)
+  _impl_.message_.Set(value, GetArenaForAllocation());
 }
 inline std::string* WakeUpResponse::_internal_mutable_message() {
   
-  return message_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.message_.Mutable(GetArenaForAllocation());
 }
 inline std::string* WakeUpResponse::release_message() {
   // @@protoc_insertion_point(field_release:wakemeup.WakeUpResponse.message)
-  
-  return message_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.message_.Release();
 }
 inline void WakeUpResponse::set_allocated_message(std::string* message) {
   if (message != nullptr) {
@@ -589,35 +747,116 @@ inline void WakeUpResponse::set_allocated_message(std::string* message) {
   } else {
     
   }
-  message_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), message);
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:wakemeup.WakeUpResponse.message)
 }
 
 // int32 process_id = 3;
 inline void WakeUpResponse::clear_process_id() {
-  process_id_ = 0;
+  _impl_.process_id_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 WakeUpResponse::_internal_process_id() const {
-  return process_id_;
+inline int32_t WakeUpResponse::_internal_process_id() const {
+  return _impl_.process_id_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 WakeUpResponse::process_id() const {
+inline int32_t WakeUpResponse::process_id() const {
   // @@protoc_insertion_point(field_get:wakemeup.WakeUpResponse.process_id)
   return _internal_process_id();
 }
-inline void WakeUpResponse::_internal_set_process_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void WakeUpResponse::_internal_set_process_id(int32_t value) {
   
-  process_id_ = value;
+  _impl_.process_id_ = value;
 }
-inline void WakeUpResponse::set_process_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void WakeUpResponse::set_process_id(int32_t value) {
   _internal_set_process_id(value);
   // @@protoc_insertion_point(field_set:wakemeup.WakeUpResponse.process_id)
 }
 
+// -------------------------------------------------------------------
+
+// DisplayState
+
+// bool on = 1;
+inline void DisplayState::clear_on() {
+  _impl_.on_ = false;
+}
+inline bool DisplayState::_internal_on() const {
+  return _impl_.on_;
+}
+inline bool DisplayState::on() const {
+  // @@protoc_insertion_point(field_get:wakemeup.DisplayState.on)
+  return _internal_on();
+}
+inline void DisplayState::_internal_set_on(bool value) {
+  
+  _impl_.on_ = value;
+}
+inline void DisplayState::set_on(bool value) {
+  _internal_set_on(value);
+  // @@protoc_insertion_point(field_set:wakemeup.DisplayState.on)
+}
+
+// string info = 2;
+inline void DisplayState::clear_info() {
+  _impl_.info_.ClearToEmpty();
+}
+inline const std::string& DisplayState::info() const {
+  // @@protoc_insertion_point(field_get:wakemeup.DisplayState.info)
+  return _internal_info();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DisplayState::set_info(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.info_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wakemeup.DisplayState.info)
+}
+inline std::string* DisplayState::mutable_info() {
+  std::string* _s = _internal_mutable_info();
+  // @@protoc_insertion_point(field_mutable:wakemeup.DisplayState.info)
+  return _s;
+}
+inline const std::string& DisplayState::_internal_info() const {
+  return _impl_.info_.Get();
+}
+inline void DisplayState::_internal_set_info(const std::string& value) {
+  
+  _impl_.info_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DisplayState::_internal_mutable_info() {
+  
+  return _impl_.info_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DisplayState::release_info() {
+  // @@protoc_insertion_point(field_release:wakemeup.DisplayState.info)
+  return _impl_.info_.Release();
+}
+inline void DisplayState::set_allocated_info(std::string* info) {
+  if (info != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.info_.SetAllocated(info, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.info_.IsDefault()) {
+    _impl_.info_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wakemeup.DisplayState.info)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -0,0 +1,64 @@
+/*
+ * 후처리 플러그인 C ABI (server)
+ * - 모델 계열별 후처리를 펌웨어 재빌드 없이 .so 로 추가하기 위한 안정 인터페이스
+ * - 플러그인은 aipex_postprocess_plugin() 하나만 export 하고, 함수 테이블을 돌려줌
+ * - 출력 텐서는 장치 출력 버퍼를 그대로 빌려줌 (복사 없음), 검출 결과는 호출자가 준 버퍼에 채움
+ * - 구조체에 필드를 추가할 때는 끝에만 추가하고 AIPEX_PP_ABI_VERSION 을 올림
+ */
+#ifndef AIPEX_POSTPROCESS_H
+#define AIPEX_POSTPROCESS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AIPEX_PP_ABI_VERSION 1
+
+/* run() 반환값 */
+#define AIPEX_PP_OK 0
+#define AIPEX_PP_TRUNCATED 1   /* 결과가 capacity 보다 많아 잘림. *out_count 에 전체 개수 */
+#define AIPEX_PP_ERROR (-1)
+
+/* 출력 텐서 하나와 vstream 정보. format_type / format_order 는 HailoRT 의 enum 값 그대로 */
+typedef struct aipex_pp_tensor {
+    const char* name;
+    const void* data;
+    size_t size;                   /* bytes */
+    uint32_t format_type;          /* hailo_format_type_t (UINT8=1, UINT16=2, FLOAT32=3) */
+    uint32_t format_order;         /* hailo_format_order_t (HAILO_NMS_BY_CLASS=22 등) */
+    uint32_t height, width, features;
+    uint32_t nms_classes;          /* NMS 출력일 때만 */
+    uint32_t nms_max_boxes_per_class;
+    float qp_zp, qp_scale;         /* 양자화 출력일 때 dequantize 용 */
+} aipex_pp_tensor;
+
+/* 검출 한 건. 정규화 좌표 (0..1), class_id 0-based */
+typedef struct aipex_pp_detection {
+    int32_t class_id;
+    float score;
+    float x_min, y_min, x_max, y_max;
+} aipex_pp_detection;
+
+typedef struct aipex_pp_plugin {
+    uint32_t abi_version;          /* AIPEX_PP_ABI_VERSION */
+    const char* name;
+    /* config: "key=value,key=value" (AIPEX_PP_CONFIG). 실패 시 NULL */
+    void* (*create)(const char* config);
+    void (*destroy)(void* state);
+    /* 한 프레임 후처리. 여러 스레드에서 동시에 호출될 수 있으므로 state 는 읽기 전용으로 쓸 것 */
+    int (*run)(void* state, const aipex_pp_tensor* tensors, size_t num_tensors,
+               uint32_t model_w, uint32_t model_h,
+               aipex_pp_detection* out, size_t capacity, size_t* out_count);
+} aipex_pp_plugin;
+
+#define AIPEX_PP_ENTRY_SYMBOL "aipex_postprocess_plugin"
+typedef const aipex_pp_plugin* (*aipex_pp_entry_fn)(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AIPEX_POSTPROCESS_H */
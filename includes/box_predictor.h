@@ -0,0 +1,51 @@
+// 지연 보상 박스 표시 (client)
+// 서버 결과는 항상 round trip 만큼 늦으므로, 객체별 등속 모델로 박스를 표시 시점까지 외삽
+// - track_id 가 있으면 그대로 사용, 없으면 IoU 로 이전 박스와 연결
+// - 오래 갱신되지 않은 track 은 제거, track 수 상한 유지
+#pragma once
+#include "grpc_client.h"
+#include <chrono>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+class BoxPredictor {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        bool enabled = true;
+        size_t max_tracks = 64;
+        std::chrono::milliseconds max_age{500};       // 이 시간 동안 갱신 없으면 track 제거
+        std::chrono::milliseconds max_horizon{300};   // 외삽 상한 (과도한 예측 방지)
+        float iou_threshold = 0.3f;
+        float velocity_gain = 0.5f;                   // 속도 갱신 가중치 (alpha-beta 필터의 beta)
+    };
+
+    // AIPEX_PREDICT_* 환경변수로 옵션 구성
+    static Options FromEnv();
+
+    explicit BoxPredictor(Options opts);
+
+    // observed_at: 결과가 대응하는 프레임의 촬영 시각 (= 수신 시각 - round trip)
+    // boxes 가 비어 있으면 (장면이 비었음) 그보다 먼저 관측된 track 을 바로 제거
+    void Update(const std::vector<GrpcClient::BBox>& boxes, Clock::time_point observed_at);
+    // display_at 시점으로 외삽한 박스. 오래된 track 은 여기서 정리됨
+    std::vector<GrpcClient::BBox> Predict(Clock::time_point display_at);
+
+    size_t TrackCount() const { return tracks_.size(); }
+    const Options& options() const { return opts_; }
+
+private:
+    struct Track {
+        int id;
+        GrpcClient::BBox box;
+        float vx{0.f}, vy{0.f}, vw{0.f}, vh{0.f};   // 정규화 좌표 / 초
+        Clock::time_point observed_at;
+        uint32_t hits{0};
+    };
+
+    Options opts_;
+    std::vector<Track> tracks_;
+    int next_id_{1};
+};
@@ -0,0 +1,17 @@
+// 코루틴 기반 Datastream 처리 (AIPEX_COROUTINES 빌드 전용)
+// AIPEX_CORO_INFLIGHT=K 설정 시 기본 핸들러 대신 사용. 프레임마다 코루틴 하나가
+// 디코드 -> 전처리 -> co_await 추론 -> 후처리 -> Write 를 순차 코드로 수행하고,
+// 스트림당 최대 K 프레임이 장치에 동시에 올라가 있도록 함
+#pragma once
+#include <grpcpp/grpcpp.h>
+#include "ComputeService.grpc.pb.h"
+#include "data_types.pb.h"
+#include "stream_registry.h"
+
+// AIPEX_CORO_INFLIGHT 가 1 이상이면 true (이 경우 hailo_init 대신 HailoInfer 가 장치를 소유)
+bool coro_datastream_enabled();
+
+// live: 프레임/heartbeat 를 받을 때 갱신, Read 하지 않는 동안은 멈춤 (StreamRegistry 생존 확인)
+grpc::Status CoroDatastream(grpc::ServerContext* context,
+                            grpc::ServerReaderWriter<data_types::ServerMessage, data_types::Command>* stream,
+                            StreamLiveness* live);
@@ -0,0 +1,69 @@
+// C++20 코루틴 지원 타입 (AIPEX_COROUTINES 빌드 전용)
+// - CoroExecutor: 코루틴을 어느 스레드에서 재개할지 결정
+// - ThreadCoroExecutor: 전용 스레드 하나에서 순서대로 재개
+// - DetachedTask: 시작 즉시 실행되고 끝나면 스스로 해제되는 fire-and-forget 코루틴
+#pragma once
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+class CoroExecutor {
+public:
+    virtual ~CoroExecutor() = default;
+    virtual void Post(std::coroutine_handle<> h) = 0;
+};
+
+class ThreadCoroExecutor : public CoroExecutor {
+public:
+    ThreadCoroExecutor() : worker_([this] { Loop(); }) {}
+    ~ThreadCoroExecutor() override {
+        {
+            std::lock_guard<std::mutex> lk(mtx_);
+            stop_ = true;
+        }
+        cv_.notify_one();
+        worker_.join();
+    }
+
+    // coroutine_handle 은 포인터 하나라 큐에 넣을 때 추가 할당 없음 (deque 블록 제외)
+    void Post(std::coroutine_handle<> h) override {
+        {
+            std::lock_guard<std::mutex> lk(mtx_);
+            queue_.push_back(h);
+        }
+        cv_.notify_one();
+    }
+
+private:
+    void Loop() {
+        std::unique_lock<std::mutex> lk(mtx_);
+        while (true) {
+            cv_.wait(lk, [this] { return stop_ || !queue_.empty(); });
+            if (queue_.empty()) break; // stop 이어도 남은 코루틴은 모두 재개
+            auto h = queue_.front();
+            queue_.pop_front();
+            lk.unlock();
+            h.resume();
+            lk.lock();
+        }
+    }
+
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    std::deque<std::coroutine_handle<>> queue_;
+    bool stop_ = false;
+    std::thread worker_;
+};
+
+struct DetachedTask {
+    struct promise_type {
+        DetachedTask get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+};
@@ -0,0 +1,65 @@
+// Hailo 없이 같은 검출 모델(ONNX export)을 OpenCV DNN 으로 CPU 에서 실행 (server)
+// - Hailo 모듈이 없거나 초기화에 실패한 보드, 개발 PC 에서 end-to-end 동작 확인용
+// - 출력은 YOLOv8 계열 anchor-free 텐서 (1, 4+nc, N) 또는 (1, N, 4+nc) -> segmentation 경로와 같은 디코더/NMS 사용
+// - cv::dnn::Net 은 스레드 안전하지 않으므로 Net 을 여러 개 두고 동시에 들어온 프레임이 하나씩 빌려 씀
+// - 주기적으로 [cpu] 로그에 추론 FPS 출력 (가속기 대비 baseline)
+#pragma once
+#include "hailo_segmentation.h"
+#include <opencv2/opencv.hpp>
+#include <opencv2/dnn.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class CpuDetector {
+public:
+    struct Options {
+        std::string onnx_path;
+        int input_w = 640;
+        int input_h = 640;
+        size_t nets = 0;                  // 동시에 추론할 프레임 수 (0 = 코어 수 / 2)
+        float score_threshold = 0.35f;
+        float iou_threshold = 0.5f;
+        size_t max_detections = 50;
+        int bench_frames = 0;             // Init 직후 합성 프레임으로 FPS 측정
+    };
+
+    // AIPEX_CPU_ONNX, AIPEX_CPU_INPUT ("640" 또는 "640x480"), AIPEX_CPU_NETS,
+    // AIPEX_CPU_SCORE_THRESHOLD, AIPEX_CPU_BENCH
+    static Options FromEnv();
+
+    explicit CpuDetector(Options opts);
+
+    int Init();
+    bool Ready() const { return nets_ > 0; }
+    int InputWidth() const { return opts_.input_w; }
+    int InputHeight() const { return opts_.input_h; }
+
+    // BGR 프레임 하나 검출. 정규화 좌표, class_id 0-based. 실패 시 -1
+    int Detect(const cv::Mat& bgr, std::vector<SegDetection>& out);
+
+    // nets 개 만큼 동시에 frames 회 추론하여 FPS 출력
+    void Benchmark(int frames);
+
+private:
+    std::unique_ptr<cv::dnn::Net> Acquire();
+    void Release(std::unique_ptr<cv::dnn::Net> net);
+    void Account(double ms);
+
+    Options opts_;
+    SegConfig decode_cfg_;
+    std::mutex pool_mtx_;
+    std::condition_variable pool_cv_;
+    std::vector<std::unique_ptr<cv::dnn::Net>> pool_;
+    size_t nets_ = 0;
+
+    // 통계
+    std::mutex stats_mtx_;
+    uint64_t frames_ = 0;
+    uint64_t window_frames_ = 0;
+    double window_infer_ms_ = 0.0;
+    std::chrono::steady_clock::time_point window_start_;
+};
@@ -0,0 +1,104 @@
+// 가속기 멈춤 감시 (server)
+// - 장치 실행마다 시작 시각을 기록하고, run 타임아웃보다 한참 넘게 돌아오지 않거나 (hang)
+//   실패가 연속 max_failures 번 나오면 장치를 복구 중 상태로 바꾸고 background 스레드에서 reset 호출
+// - reset 은 호출자가 준 함수 (VDevice / configured model 재생성). 실패하면 backoff 후 재시도
+// - 복구 중 들어온 프레임과 실패한 프레임 처리: FAIL (바로 실패), REPLAY (복구를 기다렸다가 다시 실행),
+//   CPU (spill CPU 모델이 있으면 그쪽으로)
+// - REPLAY 프레임은 executor worker 를 막지 않도록 watchdog 의 대기열에 넣어 두고, 복구되면
+//   (또는 replay_wait 이 지나면) 호출자가 준 함수로 다시 제출
+// - 복구마다 걸린 시간(장치를 쓰지 못한 시간)을 [watchdog] 로그로 출력
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// REPLAY 정책에서 복구 중이라 실행하지 않고 미룬 추론의 반환값 (hailo_infer, 0 = 성공, -1 = 실패)
+constexpr int kHailoInferDeferred = 1;
+
+class DeviceWatchdog {
+public:
+    enum class Policy { FAIL, REPLAY, CPU };
+
+    struct Options {
+        std::chrono::milliseconds run_timeout{500};   // AIPEX_WD_RUN_TIMEOUT_MS, 장치 run() 타임아웃
+        std::chrono::milliseconds hang{2000};         // AIPEX_WD_HANG_MS, run() 이 이만큼 돌아오지 않으면 멈춤으로 판단
+        int max_failures = 3;                         // AIPEX_WD_MAX_FAILURES, 연속 실패 횟수 (0 = watchdog 끔)
+        Policy policy = Policy::REPLAY;               // AIPEX_WD_POLICY = fail | replay | cpu
+        std::chrono::milliseconds replay_wait{5000};  // AIPEX_WD_REPLAY_WAIT_MS, REPLAY 프레임이 복구를 기다리는 최대 시간
+                                                      // (reset 실행 중에는 그 시도가 끝난 뒤 만료 처리)
+        std::chrono::milliseconds retry_backoff{1000}; // AIPEX_WD_RETRY_MS, reset 실패 시 다음 시도까지 (시도마다 2 배, 최대 8 배)
+    };
+    static Options FromEnv();
+
+    struct Stats {
+        uint64_t resets = 0;          // 복구 완료
+        uint64_t reset_attempts = 0;
+        uint64_t failures = 0;        // 실패한 장치 실행 (타임아웃 포함)
+        uint64_t hangs = 0;           // hang 기준을 넘긴 실행
+        uint64_t replayed = 0;        // 복구 후 다시 실행한 프레임
+        uint64_t rejected = 0;        // 복구 중이라 실패/CPU 로 보낸 프레임
+        double downtime_ms_total = 0.0;
+        double downtime_ms_last = 0.0;
+        bool healthy = true;
+    };
+
+    // reset: 진행 중인 장치 실행이 끝나기를 기다린 뒤 장치 객체를 다시 만들고 성공 여부 반환
+    DeviceWatchdog(Options opts, std::function<bool()> reset);
+    ~DeviceWatchdog();
+
+    const Options& GetOptions() const { return opts_; }
+    bool Healthy() const { return healthy_.load(std::memory_order_acquire); }
+
+    // 장치를 쓰기 전에 호출. true 면 실행, 복구 중이면 false (기다리지 않음)
+    bool Acquire() const { return Healthy(); }
+
+    // REPLAY: 복구되면 resume(true), replay_wait 안에 복구되지 않으면 resume(false) 를 watchdog 스레드에서 호출.
+    // 이미 정상이면 바로 resume(true). resume 은 짧게 (executor 에 다시 제출 등)
+    void DeferUntilRecovered(std::function<void(bool recovered)> resume);
+
+    // 장치 실행 구간 (장치 mutex 안에서). 실패/타임아웃이 쌓이면 복구 시작
+    void RunStarted();
+    void RunFinished(bool ok);
+
+    void CountReplay() { replayed_.fetch_add(1, std::memory_order_relaxed); }
+    void CountRejected() { rejected_.fetch_add(1, std::memory_order_relaxed); }
+
+    Stats GetStats() const;
+
+private:
+    struct Deferred {
+        std::function<void(bool)> resume;
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    void Loop();
+    void TriggerLocked(const std::string& reason);
+    // recovered 면 전부, 아니면 deadline 이 지난 것만 꺼냄 (mtx_ 안에서)
+    std::vector<Deferred> TakeDeferredLocked(bool recovered);
+    // lock 밖에서 호출
+    static void Resume(std::vector<Deferred>& ready, bool recovered);
+
+    Options opts_;
+    std::function<bool()> reset_;
+
+    mutable std::mutex mtx_;
+    std::condition_variable cv_;          // Loop 깨우기
+    std::deque<Deferred> deferred_;        // 복구를 기다리는 REPLAY 프레임 (deadline 순)
+    bool running_ = true;
+    std::atomic<bool> healthy_{true};
+    int consecutive_ = 0;
+    std::chrono::steady_clock::time_point down_since_;
+    std::atomic<int64_t> run_started_ns_{0}; // 0 = 실행 중 아님
+    bool hang_reported_ = false;
+    Stats stats_;
+    std::atomic<uint64_t> replayed_{0};
+    std::atomic<uint64_t> rejected_{0};
+    std::thread thread_;
+};
@@ -0,0 +1,25 @@
+// AIPEX_* 환경 변수 읽기. 없거나 비어 있으면 def
+// (각 모듈의 Options::FromEnv 등에서 사용)
+#pragma once
+#include <cstdlib>
+#include <string>
+
+inline int env_int(const char* name, int def) {
+    const char* v = std::getenv(name);
+    return (v && *v) ? std::atoi(v) : def;
+}
+
+inline double env_double(const char* name, double def) {
+    const char* v = std::getenv(name);
+    return (v && *v) ? std::atof(v) : def;
+}
+
+// 0 이 아닌 정수면 true
+inline bool env_bool(const char* name, bool def) {
+    return env_int(name, def ? 1 : 0) != 0;
+}
+
+inline std::string env_str(const char* name, const std::string& def = std::string()) {
+    const char* v = std::getenv(name);
+    return (v && *v) ? std::string(v) : def;
+}
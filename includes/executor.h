@@ -0,0 +1,104 @@
+// 프로세스 공용 work-stealing executor
+// 디코드/전처리/후처리/JPEG 인코딩/그리기 등 짧은 CPU 작업을 코어 수만큼의 worker 에서 실행
+// - worker 마다 우선순위별 deque. 자기 큐는 뒤에서(LIFO, 캐시 지역성), 남의 큐는 앞에서 훔침(FIFO)
+// - affinity 힌트: 선호 worker(=코어) 지정. worker 는 코어에 고정 (AIPEX_EXEC_PIN)
+// - 큐 대기 지연(제출 -> 실행 시작)과 steal 횟수 집계, 주기적으로 [exec] 로그
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+class Executor {
+public:
+    enum class Priority { HIGH = 0, NORMAL = 1, LOW = 2 };
+    static constexpr int kPriorities = 3;
+
+    struct Options {
+        size_t workers = 0;                           // 0 = hardware_concurrency
+        bool pin_threads = true;
+        std::chrono::seconds report_interval{10};     // 0 = 로그 없음
+    };
+
+    struct Stats {
+        uint64_t executed[kPriorities] = {0, 0, 0};
+        double avg_wait_us[kPriorities] = {0, 0, 0};  // 제출 -> 실행 시작
+        double max_wait_us[kPriorities] = {0, 0, 0};
+        uint64_t steals = 0;
+        uint64_t pending = 0;
+        size_t workers = 0;
+    };
+
+    // AIPEX_EXEC_THREADS / AIPEX_EXEC_PIN / AIPEX_EXEC_REPORT_S 로 처음 사용할 때 생성
+    static Executor& Instance();
+
+    explicit Executor(Options opts);
+    ~Executor();
+    Executor(const Executor&) = delete;
+    Executor& operator=(const Executor&) = delete;
+
+    // affinity: 선호 worker index (-1 = 제출한 worker 또는 round-robin)
+    void Submit(std::function<void()> fn, Priority prio = Priority::NORMAL, int affinity = -1);
+
+    // 결과를 future 로 받는 Submit
+    template <typename F>
+    auto Async(F&& fn, Priority prio = Priority::NORMAL, int affinity = -1)
+        -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+        using R = std::invoke_result_t<std::decay_t<F>>;
+        auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(fn));
+        auto fut = task->get_future();
+        Submit([task] { (*task)(); }, prio, affinity);
+        return fut;
+    }
+
+    // fn(i), i in [0, n) 를 worker 들과 호출 스레드가 나눠 실행하고 모두 끝나면 반환
+    // worker 안에서 호출해도 호출 스레드가 직접 일을 처리하므로 교착되지 않음
+    void ParallelFor(size_t n, const std::function<void(size_t)>& fn, Priority prio = Priority::NORMAL);
+
+    size_t WorkerCount() const { return workers_.size(); }
+    // 현재 스레드가 worker 이면 그 index, 아니면 -1
+    static int CurrentWorker();
+
+    Stats GetStats();
+    void LogStats();
+    void Shutdown();
+
+private:
+    struct Task {
+        std::function<void()> fn;
+        std::chrono::steady_clock::time_point enqueued;
+        int prio;
+    };
+    struct Worker {
+        std::mutex mtx;
+        std::deque<Task> queues[kPriorities];
+        std::thread thread;
+        std::atomic<uint64_t> steals{0};
+    };
+
+    void WorkerLoop(size_t index);
+    bool TryPopLocal(size_t index, Task& out);
+    bool TrySteal(size_t thief, Task& out);
+    void Run(Task& task);
+
+    Options opts_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<bool> stop_{false};
+    std::atomic<uint64_t> pending_{0};
+    std::atomic<size_t> next_{0};
+    std::mutex sleep_mtx_;
+    std::condition_variable sleep_cv_;
+
+    std::mutex stats_mtx_;
+    uint64_t executed_[kPriorities] = {0, 0, 0};
+    double wait_sum_us_[kPriorities] = {0, 0, 0};
+    double wait_max_us_[kPriorities] = {0, 0, 0};
+    std::chrono::steady_clock::time_point last_report_;
+};
@@ -0,0 +1,100 @@
+// 큰 프레임 분할 수신 (server)
+// - FrameHeader 뒤에 오는 FrameChunk 들을 pool 에서 빌린 버퍼에 바로 이어 붙여 프레임을 조립
+//   (protobuf 문자열로 한 번 더 복사하지 않음)
+// - 여러 프레임의 chunk 가 섞여 와도 frame_id 로 구분. 같은 프레임의 chunk 는 offset 순서여야 함
+// - 조립 중인 프레임 수/프레임 크기 상한을 넘거나 순서가 어긋나면 그 프레임은 버림.
+//   버린 프레임의 메타데이터는 TakeAborted 로 꺼내 빈 결과로 응답 (client 미완료 상태 정리)
+#pragma once
+#include "data_types.pb.h"
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// 프레임 버퍼 재사용 pool (프로세스 공용). 마지막 참조가 풀리면 pool 로 돌아감
+class FrameBufferPool {
+public:
+    struct Block {
+        std::unique_ptr<uint8_t[]> data;
+        size_t capacity = 0;
+        size_t size = 0;
+    };
+    using Buffer = std::shared_ptr<Block>;
+
+    static FrameBufferPool& Instance();
+
+    // size 바이트 이상인 버퍼. 내용은 초기화하지 않음
+    Buffer Acquire(size_t size);
+
+private:
+    FrameBufferPool() = default;
+    void Release(Block* b);
+
+    std::mutex mtx_;
+    std::vector<std::unique_ptr<Block>> free_;
+    const size_t max_free_ = 8;
+};
+
+// Datastream 이 처리하는 프레임 하나. 한 메시지로 온 프레임은 meta.image_data() 를,
+// 분할 전송으로 조립된 프레임은 pixels 를 씀
+struct InboundFrame {
+    data_types::CameraFrame meta;
+    FrameBufferPool::Buffer pixels;
+
+    const uint8_t* data() const {
+        return pixels ? pixels->data.get() : reinterpret_cast<const uint8_t*>(meta.image_data().data());
+    }
+    size_t size() const { return pixels ? pixels->size : meta.image_data().size(); }
+};
+
+class FrameAssembler {
+public:
+    struct Options {
+        size_t max_frame_bytes = 64u << 20; // AIPEX_CHUNK_MAX_FRAME_MB
+        size_t max_partial = 4;             // 동시에 조립 중인 프레임 수 (넘으면 가장 오래된 것을 버림)
+    };
+    static Options FromEnv();
+
+    struct Stats {
+        uint64_t assembled = 0;
+        uint64_t aborted = 0;
+        uint64_t duplicates = 0; // 조립 중인 frame_id 로 다시 온 헤더 (거절)
+        uint64_t bytes = 0;
+        double assemble_ms_sum = 0.0; // header 수신 -> 마지막 chunk 수신
+        double assemble_ms_max = 0.0;
+    };
+
+    explicit FrameAssembler(Options opts) : opts_(opts) {}
+
+    // false: 헤더가 잘못됨 또는 이미 조립 중인 frame_id (err 에 이유)
+    bool OnHeader(data_types::FrameHeader& header, std::string& err);
+    // 프레임이 완성되면 out 에 넣고 true. 잘못된 chunk 면 그 프레임을 버리고 err 설정
+    bool OnChunk(data_types::FrameChunk& chunk, std::shared_ptr<InboundFrame>& out, std::string& err);
+
+    // OnHeader/OnChunk 에서 버린 프레임들 (frame_id, camera_id 등. image_data 없음)
+    std::vector<data_types::CameraFrame> TakeAborted() {
+        std::vector<data_types::CameraFrame> out;
+        out.swap(aborted_);
+        return out;
+    }
+
+    const Stats& GetStats() const { return stats_; }
+
+private:
+    struct Partial {
+        std::shared_ptr<InboundFrame> frame;
+        size_t received = 0;
+        size_t total = 0;
+        std::chrono::steady_clock::time_point started;
+    };
+
+    void Abort(std::map<uint64_t, Partial>::iterator it);
+
+    Options opts_;
+    std::map<uint64_t, Partial> partial_; // frame_id -> 조립 중 (Datastream 의 Read 스레드에서만 사용)
+    std::vector<data_types::CameraFrame> aborted_;
+    Stats stats_;
+};
@@ -6,6 +6,7 @@
 #include <atomic>
 #include <mutex>
 #include <vector>
+#include "load_balancer.h"
 
 namespace cv { class Mat; }
 class GrpcClient {
@@ -16,11 +17,23 @@ public:
     bool StartStreaming();
     void StopStreaming();
     bool SendRequest(const std::string& request_data);
-    bool SendFrame(const cv::Mat& frame);
+    // camera_id tags frames from multiple sources multiplexed on the same stream;
+    // results and remote frames come back with the same id
+    bool SendFrame(const cv::Mat& frame, uint32_t camera_id = 0);
+    // Switch the operating profile on every connected board
+    // ("low_latency", "balanced", "high_throughput", "power_save", or "auto")
+    bool SetProfile(const std::string& name);
+
+    // Live endpoint list (e.g. from ServiceDiscovery). The first entry is used
+    // the next time the stream is (re)started; thread-safe.
+    void SetEndpoints(const std::vector<std::string>& endpoints);
+    std::vector<std::string> GetEndpoints();
 
     // perf counters
     uint64_t GetSentFrames();
     uint64_t GetReceivedResults();
+    // per-board routing/health stats (multi-board load balancing)
+    std::vector<LoadBalancer::BackendStats> GetBackendStats();
 
     // Detection structs returned to main for drawing
     struct BBox {
@@ -32,16 +45,37 @@ public:
         float h;
         float score{0.0f};
         std::string label;
+        int track_id{-1};  // server-side track id if provided, -1 otherwise
+        std::string subclass;       // second-stage class (e.g. vehicle type), empty if not classified
+        float subclass_score{0.0f};
+    };
+    // instance mask decoded from the RLE on the wire. alpha is height x width
+    // (0 or 255) covering the normalized ROI x_min..y_max
+    struct Mask {
+        float x_min{0.f}, y_min{0.f}, x_max{0.f}, y_max{0.f};
+        int width{0};
+        int height{0};
+        std::vector<uint8_t> alpha;
+        std::string label;
+        float score{0.0f};
     };
     struct Detection {
         std::vector<BBox> boxes;
+        std::vector<Mask> masks;   // empty unless the server runs a segmentation model
         uint64_t timestamp_ms{0};
+        uint64_t frame_id{0};      // 0 if the server did not echo a frame id
+        double latency_ms{0.0};    // send -> result round trip for this frame
+        std::string backend;       // "hailo" / "cpu" (spillover), empty for older servers
+        uint32_t camera_id{0};     // source the frame was sent with (SendFrame)
     };
 
     // pop all pending detection messages (thread-safe)
     std::vector<Detection> PopDetections();
-    // Pop one remote frame (thread-safe). returns true and fills out if a frame available.
-    bool PopRemoteFrame(cv::Mat &out);
+    // Remote frame that should be on screen now (thread-safe). Remote frames go through a
+    // playout buffer ordered by capture time and are released on a smoothed schedule; this
+    // returns the most recently released frame until it goes stale (AIPEX_PLAYOUT_HOLD_MS).
+    // Returns false when there is no current remote frame. Each camera_id has its own buffer.
+    bool DueRemoteFrame(cv::Mat &out, uint32_t camera_id = 0);
 
 private:
     std::shared_ptr<grpc::Channel> channel_;
@@ -5,12 +5,17 @@
 #include <future>
 #include <thread>
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include "service_impl.h" // ComputeServiceImpl 선언
 
 using grpc::Server;
 
 
+// 종료/재시작
+// - Shutdown: 새 프레임을 거절하고 처리 중인 프레임의 결과가 나가기를 shutdown budget (AIPEX_SHUTDOWN_MS, 기본 80)
+//   까지 기다린 뒤 열린 스트림을 취소. 남은 호출은 gRPC deadline 으로 취소, 모든 스레드를 join 하고 반환 (detach 하지 않음)
+// - Shutdown 뒤 같은 객체로 다시 Start 가능. Hailo 장치/모델은 서버와 별개라 그대로 유지됨
 class GrpcServer {
 public:
     GrpcServer(const std::string& server_address);
@@ -23,11 +28,11 @@ private:
     std::unique_ptr<grpc::Server> server_;
     std::unique_ptr<grpc::ServerCompletionQueue> cq_;
     std::thread cq_thread_;
+    std::chrono::milliseconds shutdown_budget_;
 
     // 실제 서비스 구현을 멤버로 유지
     ComputeServiceImpl service_;
 
     std::atomic<bool> shutting_down_{false};
-    std::atomic<bool> cq_thread_exited_{false};
     std::mutex shutdown_mutex_;
-};
\ No newline at end of file
+};
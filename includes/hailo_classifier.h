@@ -0,0 +1,98 @@
+// 2단계 crop-and-classify (server)
+// 1단계 검출 박스를 원본 프레임에서 잘라 분류 HEF 로 세분류 (차종, 보행자 자세 등)
+// - 같은 VDevice 위에 두 번째 모델을 올리고 (scheduler 가 두 모델을 번갈아 실행)
+// - 여러 프레임/스트림의 crop 을 모아 한 번의 batch 추론으로 처리 -> 프레임당 장치 왕복 수 증가 방지
+// - 프레임당 crop 수 상한, crop/batch/지연 통계
+#pragma once
+#include "hailo/hailort.hpp"
+#include "pipeline_policy.h"
+#include <opencv2/opencv.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class CropClassifier {
+public:
+    struct Options {
+        std::string hef_path;             // 비어 있으면 2단계 비활성
+        std::string labels_path;          // 한 줄에 하나씩 class 이름 (없으면 "cls<N>")
+        float score_threshold = 0.5f;     // 이 점수 이상의 검출만 분류
+        size_t max_crops_per_frame = 8;
+        uint16_t batch_size = 8;
+        std::chrono::milliseconds batch_wait{2};   // 다른 프레임의 crop 을 기다리는 최대 시간
+    };
+
+    // 정규화 좌표 박스 하나에 대한 분류 요청/결과
+    struct Crop {
+        float x_min, y_min, x_max, y_max;
+        float det_score;
+        std::string label;      // 결과
+        float score = 0.f;      // 결과 (softmax 확률)
+        bool classified = false;
+    };
+
+    // AIPEX_CLS_* 환경변수로 옵션 구성
+    static Options FromEnv();
+
+    explicit CropClassifier(Options opts);
+    ~CropClassifier();
+
+    // 1단계 모델과 같은 VDevice 에 분류 모델을 구성하고 batch worker 시작.
+    // device_rw: 장치 재생성과 batch 실행을 막는 lock (batch 마다 shared 로 잡음). 호출자는 기다리는 동안 잡지 않아도 됨
+    int Init(hailort::VDevice& vdevice, std::shared_timed_mutex* device_rw = nullptr);
+    bool Ready() const { return ready_.load(std::memory_order_acquire); }
+
+    // 한 번에 보내는 crop 수 (운영 프로필). 0 이면 Options::batch_size, 그보다 크게는 못 함
+    void SetDispatchBatch(size_t n);
+
+    // score 순으로 상한 개수까지 crop 하여 분류. 다른 호출의 crop 과 함께 batch 로 처리되며 끝날 때까지 block
+    void Classify(const cv::Mat& frame, std::vector<Crop>& crops);
+
+    // 장치 재생성 전 (device_rw 를 exclusive 로 잡은 상태에서) 호출. 대기 중인 crop 은 분류 없이 끝내고
+    // 모델 객체를 닫음. 이후 Classify 는 아무것도 하지 않음
+    void Shutdown();
+
+    const Options& options() const { return opts_; }
+
+private:
+    struct Job {
+        std::vector<uint8_t> input;  // 전처리 끝난 한 crop (모델 입력 크기)
+        std::promise<std::pair<int, float>> result;
+        std::chrono::steady_clock::time_point enqueued;
+    };
+
+    void WorkerLoop();
+    void RunBatch(std::vector<std::unique_ptr<Job>>& batch);
+    std::pair<int, float> Decode(const float* logits, size_t n) const;
+    void Account(size_t frame_crops, size_t skipped, double ms);
+
+    Options opts_;
+    BatchPolicy batch_;
+    std::vector<std::string> labels_;
+    std::shared_ptr<hailort::InferModel> model_;
+    std::shared_ptr<hailort::ConfiguredInferModel> configured_;
+    std::shared_timed_mutex* device_rw_ = nullptr;
+    std::atomic<bool> ready_{false};
+    std::string input_name_, output_name_;
+    int in_w_ = 0, in_h_ = 0;
+    size_t in_size_ = 0, out_size_ = 0;
+
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    std::deque<std::unique_ptr<Job>> queue_;
+    bool running_ = false;
+    std::thread worker_;
+
+    // 통계
+    std::mutex stats_mtx_;
+    uint64_t frames_ = 0, crops_ = 0, skipped_ = 0, batches_ = 0, batched_crops_ = 0;
+    double total_ms_ = 0.0, ewma_ms_ = 0.0;
+};
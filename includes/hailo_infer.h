@@ -6,10 +6,54 @@
 #include <opencv2/opencv.hpp>
 #include <opencv2/core/matx.hpp>
 #include <opencv2/imgcodecs.hpp>
+#if AIPEX_COROUTINES
+#include "coro_task.h"
+#include <mutex>
+#endif
 
 using namespace hailort;
 using Operation = std::function<void(const hailort::AsyncInferCompletionInfo&, cv::Mat org_frame)>;
 
+#if AIPEX_COROUTINES
+class HailoInfer;
+
+/**
+ * @brief Result of an awaited inference: status plus output buffers.
+ * The guards keep the input images and output buffers alive while the caller uses them.
+ */
+struct InferOutput {
+    hailo_status status = HAILO_SUCCESS;
+    std::vector<std::pair<uint8_t*, hailo_vstream_info_t>> outputs;
+    std::vector<std::shared_ptr<uint8_t>> output_guards;
+    std::vector<std::shared_ptr<cv::Mat>> input_guards;
+};
+
+/**
+ * @brief Awaitable returned by HailoInfer::infer(input, executor)
+ *
+ * Suspends the calling coroutine until the async job completes, then resumes it on
+ * the given executor (or inline on the HailoRT callback thread when none is given).
+ * The completion callback captures only this awaitable, which lives in the coroutine
+ * frame, so no per-job heap allocation is needed for it.
+ */
+class InferAwaitable {
+    public:
+        InferAwaitable(HailoInfer &owner, std::vector<cv::Mat> input_data, CoroExecutor *executor)
+            : owner(owner), input_data(std::move(input_data)), executor(executor) {}
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> handle);
+        InferOutput await_resume() { return std::move(result); }
+
+    private:
+        HailoInfer &owner;
+        std::vector<cv::Mat> input_data;
+        CoroExecutor *executor;
+        std::coroutine_handle<> handle;
+        InferOutput result;
+};
+#endif
+
 /**
  * @brief HailoInfer - Wrapper for HailoRT async inference
  * 
@@ -59,6 +103,19 @@ class HailoInfer {
             std::function<void(const hailort::AsyncInferCompletionInfo&,
                 const std::vector<std::pair<uint8_t*, hailo_vstream_info_t>> &,
                 const std::vector<std::shared_ptr<uint8_t>> &)> callback);
+
+        /**
+         * @brief Waits for device capacity, starts the job on the current bindings and detaches it
+         * @param done Called on completion
+         * @return false if the job could not be started (done is not called then)
+         */
+        bool submit(std::function<void(const hailort::AsyncInferCompletionInfo&)> done);
+
+#if AIPEX_COROUTINES
+        friend class InferAwaitable;
+        // awaitable 제출(bindings 구성 + run_async)을 직렬화. 여러 스레드의 코루틴이 동시에 co_await 가능
+        std::mutex submit_mutex;
+#endif
     public:
         // Constructors and Destructor
         
@@ -130,6 +187,18 @@ class HailoInfer {
                 const std::vector<std::pair<uint8_t*, hailo_vstream_info_t>> &,
                 const std::vector<std::shared_ptr<uint8_t>> &)> callback);
 
+#if AIPEX_COROUTINES
+        /**
+         * @brief Awaitable async inference (C++20 build only)
+         * @param input_data Input images, one per batch entry
+         * @param resume_on Executor the awaiting coroutine resumes on (nullptr = HailoRT callback thread)
+         *
+         * Usage: `InferOutput out = co_await infer.infer({frame}, &executor);`
+         * Submission is serialized internally, so coroutines on any thread may await concurrently.
+         */
+        InferAwaitable infer(std::vector<cv::Mat> input_data, CoroExecutor *resume_on = nullptr);
+#endif
+
         /**
          * @brief Wait for the last inference job to complete
          */
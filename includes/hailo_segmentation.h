@@ -0,0 +1,61 @@
+// YOLO-seg 스타일 인스턴스 분할 후처리
+// - 검출 텐서: 행마다 [cx, cy, w, h, class scores(nc), mask coeffs(nm)] (anchor-free, 모델 입력 픽셀 단위)
+// - prototype 텐서: (mh, mw, nm) NHWC float
+// - 박스 ROI 안에서만 coeffs · proto 를 계산하고 run-length 로 인코딩
+#pragma once
+#include <opencv2/opencv.hpp>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+struct SegConfig {
+    float score_threshold = 0.35f;
+    float iou_threshold = 0.5f;
+    float mask_threshold = 0.5f;   // sigmoid 출력 기준
+    size_t max_detections = 50;
+    size_t max_masks = 20;         // 프레임당 마스크 상한
+    double budget_ms = 0.0;        // 마스크 CPU 시간 예산 (0 = 제한 없음)
+    bool masks_enabled = true;
+};
+
+struct SegDetection {
+    float x_min, y_min, x_max, y_max;  // 정규화 좌표 (0..1)
+    float score;
+    int class_id;                      // 0-based
+    std::vector<float> coeffs;
+};
+
+// 전송용 마스크: ROI(정규화) 와 그 안의 (width x height) 격자에 대한 row-major RLE
+// counts 는 0 의 run 부터 시작하여 0/1 run 이 번갈아 나옴
+struct EncodedMask {
+    uint32_t detection_index = 0;
+    float x_min = 0.f, y_min = 0.f, x_max = 0.f, y_max = 0.f;
+    uint32_t width = 0, height = 0;
+    std::vector<uint32_t> counts;
+    int class_id = 0;
+    std::string label;   // 호출측에서 class_id 로 채움
+    float score = 0.f;
+};
+
+// AIPEX_SEG_* 환경변수로 설정 구성
+SegConfig seg_config_from_env();
+
+// rows x row_len 검출 텐서 디코드 + class-wise NMS.
+// transposed=true 이면 (row_len x rows) 배치 (예: 116 x 8400 export)
+std::vector<SegDetection> decode_yolo_seg(const float* data, size_t rows, size_t row_len, bool transposed,
+                                          size_t num_classes, size_t num_coeffs,
+                                          int input_w, int input_h, const SegConfig& cfg);
+
+// 박스 ROI 에 대한 이진 마스크(CV_8U, 0/1) 를 proto 해상도로 계산. roi 는 proto 좌표
+cv::Mat assemble_instance_mask(const float* proto, int mh, int mw, int nm,
+                               const SegDetection& det, float mask_threshold, cv::Rect& roi);
+
+void rle_encode(const cv::Mat& binary_mask, std::vector<uint32_t>& counts);
+// 클라이언트측 복원: width x height CV_8U (0/255)
+cv::Mat rle_decode(const std::vector<uint32_t>& counts, int width, int height);
+
+// 검출 + 마스크 전체 후처리. 마스크 CPU 시간/바이트를 측정하고 예산 초과 시 일부 프레임은 마스크 생략
+void run_segmentation_postprocess(const float* det_data, size_t rows, size_t row_len, bool transposed,
+                                  const float* proto, int mh, int mw, int nm,
+                                  size_t num_classes, int input_w, int input_h, const SegConfig& cfg,
+                                  std::vector<SegDetection>& dets, std::vector<EncodedMask>& masks);
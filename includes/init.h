@@ -3,4 +3,6 @@
 #include <thread>
 
 bool init_system(GrpcServer &server, std::thread &server_thread);
-void shutdown_system(GrpcServer &server, std::thread &server_thread);
\ No newline at end of file
+void shutdown_system(GrpcServer &server, std::thread &server_thread);
+// gRPC 서버만 재시작 (SIGHUP, OTA 적용 등). 추론 장치는 열린 채로 유지
+bool restart_server(GrpcServer &server, std::thread &server_thread);
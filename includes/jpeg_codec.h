@@ -0,0 +1,50 @@
+// JPEG 인코드/디코드 (libjpeg-turbo TurboJPEG API)
+// - compressor/decompressor handle 은 스레드마다 하나를 만들어 계속 사용 (호출마다 init/destroy 하지 않음)
+// - 디코드는 호출자가 준 버퍼(또는 재사용하는 cv::Mat)에 원하는 채널 순서로 바로 기록
+// - 인코드는 tjBufSize 로 잡은 재사용 버퍼에 기록 (호출마다 할당하지 않음)
+// AIPEX_TURBOJPEG 없이 빌드하면 같은 인터페이스로 OpenCV imdecode/imencode 사용
+#pragma once
+#include <opencv2/opencv.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+enum class PixelOrder { BGR, RGB };
+
+struct JpegEncodeOptions {
+    int quality = 90;
+    int subsampling = 420; // 444 / 422 / 420
+    bool fast_dct = false;
+    // AIPEX_JPEG_QUALITY, AIPEX_JPEG_SUBSAMP, AIPEX_JPEG_FAST_DCT
+    static JpegEncodeOptions FromEnv();
+};
+
+// 인코딩 결과 버퍼. 가장 컸던 크기만큼 유지하고 다음 인코딩에 다시 씀
+class JpegBuffer {
+public:
+    const uint8_t* data() const { return buf_.data(); }
+    size_t size() const { return size_; }
+
+private:
+    friend bool jpeg_encode(const cv::Mat&, JpegBuffer&, const JpegEncodeOptions&);
+    std::vector<uint8_t> buf_;
+    size_t size_ = 0;
+};
+
+// 헤더만 읽어 크기 확인
+bool jpeg_dimensions(const uint8_t* data, size_t size, int& width, int& height);
+
+// dst 에 width x height x 3 (행 간격 pitch 바이트) 로 디코드. 이미지 크기가 다르면 false
+bool jpeg_decode_into(const uint8_t* data, size_t size, uint8_t* dst, int width, int height, size_t pitch,
+                      PixelOrder order = PixelOrder::BGR, bool fast_dct = false);
+
+// out 에 디코드 (CV_8UC3). out 이 같은 크기이고 다른 곳에서 참조하지 않으면 그 메모리를 다시 씀
+bool jpeg_decode(const uint8_t* data, size_t size, cv::Mat& out, PixelOrder order = PixelOrder::BGR,
+                 bool fast_dct = false);
+
+// 8UC3 BGR 이미지를 out 에 인코딩
+bool jpeg_encode(const cv::Mat& bgr, JpegBuffer& out, const JpegEncodeOptions& opts);
+
+// 기존 경로(imdecode + cvtColor, imencode) 와 이 코덱을 width x height 합성 프레임으로 iterations 회씩 비교
+// (AIPEX_JPEG_BENCH=<iterations> 설정 시 서버 시작 시 실행)
+void benchmark_jpeg_codec(int width, int height, int iterations);
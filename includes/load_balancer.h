@@ -0,0 +1,122 @@
+// 여러 연산 보드(AipexFW 서버)에 프레임을 분산하기 위한 클라이언트측 로드밸런서
+// - 라우팅: 미완료 프레임 수 최소(least outstanding) 또는 최근 지연 최소(lowest latency)
+// - 헬스체크: heartbeat RTT, 응답 없는 보드 감지
+// - ReorderBuffer: 여러 보드에서 섞여 도착한 결과를 frame id 순서로 재정렬
+#pragma once
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <cstdint>
+
+class LoadBalancer {
+public:
+    enum class Policy { LEAST_OUTSTANDING, LOWEST_LATENCY };
+
+    struct BackendStats {
+        std::string target;
+        bool healthy{false};
+        size_t outstanding{0};
+        double ewma_latency_ms{0.0};
+        double heartbeat_rtt_ms{0.0};
+        uint64_t completed{0};
+        uint64_t failures{0};
+    };
+
+    explicit LoadBalancer(Policy policy);
+    // "latency" -> LOWEST_LATENCY, 그 외 LEAST_OUTSTANDING
+    static Policy PolicyFromString(const std::string& s);
+
+    size_t AddBackend(const std::string& target);
+    size_t Size() const;
+
+    // 다음 프레임을 보낼 backend index. healthy 한 backend 가 없으면 -1
+    // exclude: 방금 쓰기에 실패해 아직 unhealthy 로 표시되기 전인 backend (-1 = 없음)
+    int Pick(int exclude = -1) const;
+    // now: 시뮬레이터(pipeline_sim) 가 가상 시계를 넘길 수 있도록 인자로 받음
+    void OnSent(size_t idx, uint64_t frame_id,
+                std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+    // 결과 수신 처리. 해당 frame 의 지연(ms) 반환, 모르는 frame 이면 -1
+    double OnResult(size_t idx, uint64_t frame_id,
+                    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+    // 전송 실패: inflight 에서만 제거 (지연/완료 통계는 건드리지 않음)
+    void OnFailed(size_t idx, uint64_t frame_id);
+    void OnHeartbeatRtt(size_t idx, double rtt_ms);
+    void OnActivity(size_t idx);
+
+    void SetHealthy(size_t idx, bool healthy);
+    bool IsHealthy(size_t idx) const;
+    // 미완료 프레임이 있는데 dead_after 동안 아무 응답이 없는 backend 목록
+    std::vector<size_t> FindStalled(std::chrono::milliseconds dead_after) const;
+    // 장애 backend 의 미완료 frame id 를 꺼내고 실패 횟수 증가 (failover 용)
+    std::vector<uint64_t> TakeOutstanding(size_t idx);
+
+    std::vector<BackendStats> Stats() const;
+
+private:
+    struct Entry {
+        BackendStats stats;
+        std::map<uint64_t, std::chrono::steady_clock::time_point> inflight;
+        std::chrono::steady_clock::time_point last_activity;
+    };
+    double CostLocked(const Entry& e) const;
+
+    Policy policy_;
+    mutable std::mutex mtx_;
+    std::vector<Entry> entries_;
+};
+
+// frame id 순서대로 결과를 내보내는 재정렬 버퍼. 빠진 id 는 max_wait 후 건너뜀
+template <typename T>
+class ReorderBuffer {
+public:
+    explicit ReorderBuffer(std::chrono::milliseconds max_wait) : max_wait_(max_wait) {}
+
+    std::vector<T> Push(uint64_t id, T item) {
+        std::vector<T> out;
+        std::lock_guard<std::mutex> lk(mtx_);
+        if (id < next_id_) return out; // 이미 건너뛴 frame 의 늦은 결과는 버림
+        pending_.emplace(id, Slot{std::move(item), std::chrono::steady_clock::now()});
+        DrainLocked(out);
+        return out;
+    }
+
+    // 가장 오래 기다린 결과가 max_wait 를 넘겼으면 빠진 id 를 건너뛰고 내보냄
+    std::vector<T> Flush() {
+        std::vector<T> out;
+        std::lock_guard<std::mutex> lk(mtx_);
+        auto now = std::chrono::steady_clock::now();
+        while (!pending_.empty() && now - pending_.begin()->second.arrived > max_wait_) {
+            skipped_ += pending_.begin()->first - next_id_;
+            next_id_ = pending_.begin()->first;
+            DrainLocked(out);
+        }
+        return out;
+    }
+
+    uint64_t Skipped() const {
+        std::lock_guard<std::mutex> lk(mtx_);
+        return skipped_;
+    }
+
+private:
+    struct Slot {
+        T item;
+        std::chrono::steady_clock::time_point arrived;
+    };
+    void DrainLocked(std::vector<T>& out) {
+        auto it = pending_.begin();
+        while (it != pending_.end() && it->first == next_id_) {
+            out.push_back(std::move(it->second.item));
+            it = pending_.erase(it);
+            ++next_id_;
+        }
+    }
+
+    std::chrono::milliseconds max_wait_;
+    mutable std::mutex mtx_;
+    std::map<uint64_t, Slot> pending_;
+    uint64_t next_id_{1};
+    uint64_t skipped_{0};
+};
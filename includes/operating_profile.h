@@ -0,0 +1,93 @@
+// 운영 프로필 (server): 지연/처리량/전력 관련 설정을 이름 하나로 묶어 한 번에 전환
+// - low_latency / balanced / high_throughput / power_save. balanced 는 기존 개별 환경 변수 값을 그대로 씀
+// - 수동 전환: ConfigRequest.profile 또는 ControlAction SET_PROFILE ("auto" 면 자동 전환으로 복귀)
+// - 자동 전환: 온도/배터리/활성 스트림 수 조건 (우선순위: 온도 > 배터리 > 스트림 수 > 기본 프로필)
+// - 사용하는 쪽은 Current() 로 매번 읽음. 바뀔 때마다 Generation() 증가 (DeviceStatus 재전송 판단용)
+#pragma once
+#include "pipeline_policy.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct OperatingProfile {
+    std::string name;
+    size_t stream_inflight = 2;                         // 카메라별 동시 처리 프레임 수 (FrameAdmission)
+    FrameAdmission::Mode admission = FrameAdmission::Mode::BLOCK;
+    int jpeg_quality = 90;                              // client 프레임 인코딩 (DeviceStatus 로 전달) 과 annotated 프레임
+    int cv_threads = 1;                                 // OpenCV 내부 스레드 수 (executor worker 수는 시작 시 고정)
+    uint32_t infer_stride = 1;                          // 카메라별 N 프레임 중 1 장만 추론 (나머지는 빈 결과)
+    uint16_t classifier_batch = 0;                      // crop 분류기가 한 번에 보내는 crop 수
+                                                        // (0 = AIPEX_CLS_BATCH, 모델에 구성된 batch 를 넘지 않음)
+
+    FrameAdmission Admission() const {
+        FrameAdmission a;
+        a.max_inflight = stream_inflight;
+        a.mode = admission;
+        return a;
+    }
+};
+
+class ProfileManager {
+public:
+    struct Triggers {
+        double temp_hot_c = 80.0;        // AIPEX_PROFILE_TEMP_HOT_C, 이상이면 power_save (0 = 끔)
+        double temp_hysteresis_c = 5.0;  // hot - 이 값 아래로 내려가야 해제
+        double battery_low_pct = 20.0;   // AIPEX_PROFILE_BATTERY_LOW, 방전 중 이하이면 power_save (0 = 끔)
+        int busy_streams = 3;            // AIPEX_PROFILE_BUSY_STREAMS, 이상이면 high_throughput (0 = 끔)
+        std::string temp_file = "/sys/class/thermal/thermal_zone0/temp"; // AIPEX_PROFILE_TEMP_FILE (m°C)
+        std::string battery_dir;         // AIPEX_PROFILE_BATTERY_DIR (capacity, status), 비우면 BAT* 탐색
+        std::chrono::milliseconds poll{2000}; // AIPEX_PROFILE_POLL_MS
+    };
+
+    struct Status {
+        OperatingProfile profile;
+        bool automatic = true;
+        std::string reason;              // 마지막 전환 이유
+        double temperature_c = -1.0;     // 읽지 못하면 음수
+        double battery_pct = -1.0;
+        bool discharging = false;
+        int active_streams = 0;
+    };
+
+    // AIPEX_PROFILE (기본 프로필, 기본 balanced) 와 Triggers 환경 변수로 처음 사용할 때 생성
+    static ProfileManager& Instance();
+    ~ProfileManager();
+
+    static std::vector<std::string> Names();
+
+    OperatingProfile Current() const;
+    Status GetStatus() const;
+    uint64_t Generation() const { return generation_.load(std::memory_order_acquire); }
+
+    // 수동 선택. "auto" 는 자동 전환 재개. 모르는 이름이면 false
+    bool Select(const std::string& name, std::string& message);
+
+    // Datastream 시작/종료 시 호출 (활성 스트림 수 조건)
+    void StreamOpened();
+    void StreamClosed();
+
+private:
+    ProfileManager();
+    void Loop();
+    void ReadSensorsLocked();
+    void EvaluateLocked();
+    void ApplyLocked(const OperatingProfile& p, const std::string& reason);
+    bool Lookup(const std::string& name, OperatingProfile& out) const;
+
+    Triggers triggers_;
+    std::vector<OperatingProfile> profiles_;
+    std::string base_name_;
+
+    mutable std::mutex mtx_;
+    std::condition_variable cv_;
+    bool running_ = true;
+    Status status_;
+    bool hot_ = false;
+    std::atomic<uint64_t> generation_{0};
+    std::thread thread_;
+};
@@ -0,0 +1,33 @@
+// 파이프라인 단계별 하드웨어 성능 카운터 (AIPEX_PERF_COUNTERS=1 일 때만 동작)
+// - 스레드마다 perf_event_open 카운터(cycles, instructions, cache misses, branch misses, context switches) 를 열고
+//   PerfStage 범위의 시작/끝에서 읽어 단계별로 누적
+// - 주기적으로 [perfctr] 로그: 단계별 프레임당 시간, IPC, miss 수
+// - perf 이벤트를 쓸 수 없는 환경(컨테이너, perf_event_paranoid 등)에서는 해당 카운터만 n/a, 시간은 계속 측정
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+// 환경변수를 처음 한 번만 읽음
+bool perf_counters_enabled();
+
+class PerfStage {
+public:
+    static constexpr int kCounters = 5; // cycles, instructions, cache_misses, branch_misses, context_switches
+
+    // stage 는 문자열 리터럴 (포인터로 보관). frames: 이 범위가 처리하는 프레임 수 (batch 크기)
+    explicit PerfStage(const char* stage, uint64_t frames = 1);
+    ~PerfStage();
+    PerfStage(const PerfStage&) = delete;
+    PerfStage& operator=(const PerfStage&) = delete;
+
+private:
+    const char* stage_;
+    uint64_t frames_;
+    bool active_;
+    std::chrono::steady_clock::time_point t0_;
+    uint64_t start_[kCounters];
+    bool valid_[kCounters];
+};
+
+// 누적된 단계별 통계를 지금 로그로 출력
+void perf_counters_report();
@@ -0,0 +1,52 @@
+// 서버 파이프라인 스케줄링 정책 (실제 코드와 pipeline_sim 시뮬레이터가 같은 객체를 사용)
+// - FrameAdmission: 스트림당 처리 중 프레임 상한과 상한 도달 시 동작 (대기 또는 새 프레임 버림)
+// - BatchPolicy: 장치 batch 구성. batch 가 차거나 가장 오래된 요청이 max_wait 를 넘기면 실행
+// - SpillPolicy: 가속기 예상 대기 시간이 임계값을 넘으면 프레임을 CPU 백엔드로 넘길지 결정
+// 시간은 모두 인자로 받음 (가상 시계로 구동 가능)
+#pragma once
+#include <chrono>
+#include <cstddef>
+
+struct FrameAdmission {
+    enum class Mode { BLOCK, DROP_NEWEST };
+    enum class Decision { ADMIT, WAIT, DROP };
+
+    size_t max_inflight = 2;
+    Mode mode = Mode::BLOCK;
+
+    // AIPEX_EXEC_STREAM_INFLIGHT, AIPEX_ADMISSION=block|drop
+    static FrameAdmission FromEnv();
+
+    Decision Admit(size_t inflight) const {
+        if (inflight < max_inflight) return Decision::ADMIT;
+        return mode == Mode::BLOCK ? Decision::WAIT : Decision::DROP;
+    }
+};
+
+struct BatchPolicy {
+    using Clock = std::chrono::steady_clock;
+
+    size_t batch_size = 1;
+    std::chrono::microseconds max_wait{0};
+
+    // queued: 대기 중인 요청 수, oldest: 가장 오래된 요청의 도착 시각
+    bool ShouldDispatch(size_t queued, Clock::time_point oldest, Clock::time_point now) const {
+        if (queued == 0) return false;
+        return queued >= batch_size || now - oldest >= max_wait;
+    }
+    // 더 기다린다면 언제 다시 확인해야 하는지
+    Clock::time_point Deadline(Clock::time_point oldest) const { return oldest + max_wait; }
+};
+
+struct SpillPolicy {
+    double wait_threshold_ms = 30.0; // 저우선순위 프레임은 예상 대기가 이보다 길면 CPU 로
+    double hard_threshold_ms = 0.0;  // 모든 프레임이 CPU 로 넘어가는 예상 대기 (0 = 사용 안 함)
+
+    // AIPEX_SPILL_WAIT_MS, AIPEX_SPILL_HARD_WAIT_MS
+    static SpillPolicy FromEnv();
+
+    bool ShouldSpill(double expected_wait_ms, bool low_priority) const {
+        if (low_priority && wait_threshold_ms > 0.0 && expected_wait_ms > wait_threshold_ms) return true;
+        return hard_threshold_ms > 0.0 && expected_wait_ms > hard_threshold_ms;
+    }
+};
@@ -0,0 +1,92 @@
+// 파이프라인 discrete-event 시뮬레이터 (aipex_sim)
+// 카메라 -> RateGovernor -> LoadBalancer -> 업링크 -> 보드[admission -> executor worker:
+//   decode -> preprocess -> 장치(batch) -> postprocess -> classify -> encode] -> 다운링크 -> client
+// - 가상 시계로 구동 (실제 시간 대기 없음). 수 분 분량을 1초 안에 평가
+// - 실제 코드와 같은 정책 객체 사용: RateGovernor, LoadBalancer, FrameAdmission, BatchPolicy
+// - 단계 지연은 측정값 분포(AIPEX_PERF_SAMPLES 로 기록한 "stage ms" 파일)로 구성
+#pragma once
+#include "load_balancer.h"
+#include "pipeline_policy.h"
+#include "rate_governor.h"
+#include <cstdint>
+#include <ostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+// 단계 지연 분포 (ms)
+class LatencyDist {
+public:
+    static LatencyDist Constant(double ms);
+    static LatencyDist LogNormal(double mean_ms, double cv);
+    static LatencyDist Empirical(std::vector<double> samples_ms);
+
+    double Sample(std::mt19937_64& rng) const;
+    double Mean() const { return mean_; }
+
+private:
+    enum class Kind { CONSTANT, LOGNORMAL, EMPIRICAL };
+    Kind kind_ = Kind::CONSTANT;
+    double mean_ = 0.0;
+    double mu_ = 0.0, sigma_ = 0.0;
+    std::vector<double> samples_;
+};
+
+// batch 크기 -> 장치 지연 (ms). 측정점 사이는 선형 보간, 밖은 마지막 구간 기울기로 외삽
+struct DeviceCurve {
+    std::vector<std::pair<size_t, double>> points;  // (batch, ms), batch 오름차순
+    double LatencyMs(size_t batch) const;
+};
+
+struct SimConfig {
+    double source_fps = 30.0;
+    double duration_s = 60.0;
+    uint64_t seed = 1;
+
+    bool use_rate_governor = false;
+    RateGovernor::Options rate;
+    double activity = 1.0;           // 결과에 검출이 있을 확률 (RateGovernor 입력)
+
+    LoadBalancer::Policy lb_policy = LoadBalancer::Policy::LEAST_OUTSTANDING;
+    size_t boards = 1;
+    size_t cpu_workers = 4;          // 보드당 executor worker 수
+
+    FrameAdmission admission;
+    BatchPolicy batch;
+
+    LatencyDist uplink = LatencyDist::LogNormal(3.0, 0.3);
+    LatencyDist decode = LatencyDist::LogNormal(4.0, 0.2);
+    LatencyDist preprocess = LatencyDist::LogNormal(2.0, 0.2);
+    LatencyDist infer = LatencyDist::Constant(12.0);   // batch 1 장치 지연의 흔들림 (curve 에 비율로 적용)
+    LatencyDist postprocess = LatencyDist::LogNormal(1.5, 0.3);
+    LatencyDist classify = LatencyDist::Constant(0.0);
+    LatencyDist encode = LatencyDist::LogNormal(0.3, 0.2);
+    LatencyDist downlink = LatencyDist::LogNormal(2.0, 0.3);
+    DeviceCurve device{{{1, 12.0}, {8, 40.0}}};
+};
+
+// "stage ms" (측정 샘플) 와 "device <batch> <ms>" (장치 curve) 줄로 된 파일을 읽어 cfg 에 반영
+// stage: uplink decode preprocess infer postprocess classify encode downlink. '#' 이후는 주석
+bool LoadStageLatencies(const std::string& path, SimConfig& cfg);
+
+struct SimResult {
+    uint64_t generated = 0;          // 카메라 프레임
+    uint64_t sent = 0;               // RateGovernor 통과 후 전송
+    uint64_t completed = 0;
+    uint64_t dropped = 0;            // admission DROP
+    double sim_seconds = 0.0;
+    double throughput_fps = 0.0;
+    std::vector<double> e2e_ms;      // 캡처 -> client 수신, 정렬됨
+    double admission_wait_ms = 0.0;  // 평균
+    double worker_wait_ms = 0.0;
+    double device_wait_ms = 0.0;
+    double cpu_seconds = 0.0;        // 모든 보드 CPU 단계 합
+    double device_util = 0.0;        // 보드 평균 장치 사용률 (0..1)
+    double avg_batch = 0.0;
+
+    double Percentile(double p) const;
+};
+
+SimResult RunPipelineSim(const SimConfig& cfg);
+void PrintSimResult(const SimConfig& cfg, const SimResult& r, std::ostream& os);
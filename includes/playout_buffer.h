@@ -0,0 +1,121 @@
+// 원격 프레임 playout(jitter) 버퍼 (client)
+// - 서버가 보낸 프레임을 캡처 시각 순으로 모아 두고, 캡처 간격을 유지한 일정한 스케줄로 내보냄
+// - 도착 지연의 흔들림(jitter)을 최근 창에서 측정해 목표 지연을 자동 조정 (늘릴 때는 즉시, 줄일 때는 천천히)
+// - 표시 루프는 Due(now) 로 "지금 보여야 할 프레임" 만 받음. 이미 지난 프레임은 건너뜀(skipped),
+//   재생 시각이 지난 뒤 도착한 프레임은 late 로 집계 (이미 표시한 프레임보다 오래된 캡처면 버림)
+// 시간은 인자로 받음 (시뮬레이터/오프라인 확인용)
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <vector>
+
+template <typename T>
+class PlayoutBuffer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        std::chrono::milliseconds min_delay{20};
+        std::chrono::milliseconds max_delay{300};
+        size_t jitter_window = 120; // 목표 지연 계산에 쓰는 최근 프레임 수
+        double percentile = 0.95;
+        size_t max_frames = 30;     // 버퍼 상한 (넘으면 가장 오래된 프레임을 건너뜀)
+    };
+
+    struct Stats {
+        uint64_t released = 0;
+        uint64_t skipped = 0;
+        uint64_t late = 0;
+        double target_delay_ms = 0.0;
+        double jitter_ms = 0.0; // 최근 창의 percentile jitter
+        size_t buffered = 0;
+    };
+
+    explicit PlayoutBuffer(Options opts) : opts_(opts), target_delay_us_(ToUs(opts.min_delay)) {}
+
+    // capture_us: 송신측 캡처 시각 (송신측 시계, us). arrival: 로컬 도착 시각
+    void Push(int64_t capture_us, Clock::time_point arrival, T item) {
+        std::lock_guard<std::mutex> lk(mtx_);
+        if (has_released_ && capture_us <= last_released_capture_) {
+            stats_.late++;
+            return;
+        }
+        // 두 시계의 차이는 모르지만 일정하므로 (도착 - 캡처) 의 최소값을 기준 전송 지연으로 봄
+        int64_t offset = ToUs(arrival.time_since_epoch()) - capture_us;
+        offsets_.push_back(offset);
+        if (offsets_.size() > opts_.jitter_window) offsets_.pop_front();
+        UpdateTargetLocked();
+        if (PlayoutAtLocked(capture_us) < ToUs(arrival.time_since_epoch())) stats_.late++;
+
+        frames_[capture_us] = std::move(item);
+        while (frames_.size() > opts_.max_frames) {
+            frames_.erase(frames_.begin());
+            stats_.skipped++;
+        }
+    }
+
+    // now 기준으로 재생 시각이 지난 프레임 중 가장 최근 것을 out 에 넣고 true. 새로 낼 프레임이 없으면 false
+    bool Due(Clock::time_point now, T& out) {
+        std::lock_guard<std::mutex> lk(mtx_);
+        if (frames_.empty()) return false;
+        int64_t now_us = ToUs(now.time_since_epoch());
+        auto due_end = frames_.begin();
+        while (due_end != frames_.end() && PlayoutAtLocked(due_end->first) <= now_us) ++due_end;
+        if (due_end == frames_.begin()) return false;
+        auto last = std::prev(due_end);
+        stats_.skipped += static_cast<uint64_t>(std::distance(frames_.begin(), last));
+        out = std::move(last->second);
+        last_released_capture_ = last->first;
+        has_released_ = true;
+        stats_.released++;
+        frames_.erase(frames_.begin(), due_end);
+        return true;
+    }
+
+    Stats GetStats() const {
+        std::lock_guard<std::mutex> lk(mtx_);
+        Stats s = stats_;
+        s.target_delay_ms = target_delay_us_ / 1000.0;
+        s.jitter_ms = jitter_us_ / 1000.0;
+        s.buffered = frames_.size();
+        return s;
+    }
+
+private:
+    template <typename D>
+    static int64_t ToUs(D d) { return std::chrono::duration_cast<std::chrono::microseconds>(d).count(); }
+
+    int64_t PlayoutAtLocked(int64_t capture_us) const {
+        return capture_us + base_offset_us_ + static_cast<int64_t>(target_delay_us_);
+    }
+
+    void UpdateTargetLocked() {
+        base_offset_us_ = *std::min_element(offsets_.begin(), offsets_.end());
+        std::vector<int64_t> jit;
+        jit.reserve(offsets_.size());
+        for (int64_t o : offsets_) jit.push_back(o - base_offset_us_);
+        size_t k = std::min(jit.size() - 1, static_cast<size_t>(opts_.percentile * jit.size()));
+        std::nth_element(jit.begin(), jit.begin() + k, jit.end());
+        jitter_us_ = static_cast<double>(jit[k]);
+        double want = std::min(std::max(jitter_us_, static_cast<double>(ToUs(opts_.min_delay))),
+                               static_cast<double>(ToUs(opts_.max_delay)));
+        // 늘어난 jitter 는 바로 반영 (늦은 프레임 방지), 줄어든 jitter 는 천천히 (스케줄 급변 방지)
+        if (want > target_delay_us_) target_delay_us_ = want;
+        else target_delay_us_ += 0.02 * (want - target_delay_us_);
+    }
+
+    Options opts_;
+    mutable std::mutex mtx_;
+    std::map<int64_t, T> frames_; // capture_us -> frame
+    std::deque<int64_t> offsets_;
+    int64_t base_offset_us_ = 0;
+    double target_delay_us_;
+    double jitter_us_ = 0.0;
+    int64_t last_released_capture_ = 0;
+    bool has_released_ = false;
+    Stats stats_;
+};
@@ -0,0 +1,42 @@
+// 후처리 플러그인 로더 (server). aipex_postprocess.h 의 C ABI 를 dlopen 으로 불러 옴
+// - 선택: AIPEX_PP_PLUGIN (경로 또는 이름) 이 있으면 그것, 없으면 AIPEX_PP_PLUGIN_DIR 에서
+//   HEF network group 이름 -> 출력 형식(nms, seg) 순으로 libaipex_pp_<이름>.so 를 찾음
+// - 어느 것도 없으면 내장 후처리 사용
+#pragma once
+#include "aipex_postprocess.h"
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+class PostprocessPlugin {
+public:
+    ~PostprocessPlugin();
+
+    // path 의 .so 를 열고 ABI 버전 확인 후 create(config). 실패 시 nullptr
+    static std::unique_ptr<PostprocessPlugin> Load(const std::string& path, const std::string& config);
+    // 위 선택 규칙으로 찾아서 Load. 찾지 못하면 nullptr (에러 아님)
+    static std::unique_ptr<PostprocessPlugin> FromEnv(const std::vector<std::string>& candidates);
+
+    const std::string& Name() const { return name_; }
+    const std::string& Path() const { return path_; }
+
+    // 결과가 capacity 를 넘으면 버퍼를 키워서 한 번 더 호출. 실패 시 -1
+    int Run(const std::vector<aipex_pp_tensor>& tensors, uint32_t model_w, uint32_t model_h,
+            std::vector<aipex_pp_detection>& out);
+
+private:
+    PostprocessPlugin() = default;
+
+    void* lib_handle_ = nullptr;
+    const aipex_pp_plugin* api_ = nullptr;
+    void* state_ = nullptr;
+    std::string name_;
+    std::string path_;
+};
+
+// 플러그인 호출과 내장 후처리를 같은 입력으로 iters 회씩 실행하여 호출당 시간 비교 ([pp] bench 로그)
+// builtin 은 내장 경로로 한 번 후처리하고 검출 수를 반환
+void benchmark_postprocess_plugin(PostprocessPlugin& plugin, const std::vector<aipex_pp_tensor>& tensors,
+                                  uint32_t model_w, uint32_t model_h,
+                                  const std::function<size_t()>& builtin, int iters);
@@ -0,0 +1,32 @@
+// 모델 입력 전처리 커널 (server)
+// BGR 프레임 -> 모델 입력 크기 bilinear resize + RGB 변환 + NHWC uint8 버퍼 기록을 한 번에 수행
+// - 배포 중인 입력 크기(640x640x3, 320x320x3)는 크기/stride 가 컴파일 타임 상수인 템플릿 커널로 특수화
+// - 그 외 크기는 OpenCV 기반 generic 경로
+// - 모델 로드 시 HEF 입력 vstream 정보로 한 번 선택
+#pragma once
+#include <opencv2/opencv.hpp>
+#include <cstdint>
+#include <string>
+
+// dst 는 width*height*3 바이트 (NHWC, RGB). 특수화 커널은 width/height 인자를 무시
+using PreprocessFn = void (*)(const cv::Mat& bgr, uint8_t* dst, int width, int height);
+
+struct PreprocessKernel {
+    const char* name;
+    PreprocessFn fn;
+    bool specialized;
+};
+
+// 입력 shape/format 으로 커널 선택. NHWC uint8 3채널이 아니면 generic
+PreprocessKernel select_preprocess_kernel(int width, int height, int features, bool nhwc_uint8);
+
+// 기존 경로: cv::resize + cvtColor + 복사. 모든 커널이 처리하지 못하는 입력을 넘기는 곳이며,
+// 빈 입력이면 dst 를 0 으로 채우고 반환
+void preprocess_generic(const cv::Mat& bgr, uint8_t* dst, int width, int height);
+
+// 임의 크기 출력용 한 번 순회 커널 (고정 크기 커널과 같은 고정소수점 bilinear). ROI view 도 그대로 받음
+void preprocess_resize_rgb(const cv::Mat& bgr, uint8_t* dst, int width, int height);
+
+// 선택된 커널과 generic 경로를 src_w x src_h 합성 프레임으로 iterations 회씩 측정하여 로그 출력
+// (AIPEX_PREPROCESS_BENCH=<iterations> 설정 시 모델 로드 직후 실행)
+void benchmark_preprocess(const PreprocessKernel& kernel, int width, int height, int src_w, int src_h, int iterations);
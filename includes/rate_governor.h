@@ -0,0 +1,52 @@
+// 장면 적응형 전송률 조절기 (client)
+// - 최근 결과에 검출도 움직임도 없으면 전송률을 min_fps 까지 서서히 낮춤
+// - 무언가 나타나면 즉시(또는 ramp_up 동안) max_fps 로 복귀
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+class RateGovernor {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        bool enabled = true;
+        double min_fps = 2.0;
+        double max_fps = 30.0;
+        std::chrono::milliseconds idle_hold{1000};   // 활동이 끊긴 뒤 감속 시작까지
+        std::chrono::milliseconds ramp_down{3000};   // max -> min 감속에 걸리는 시간
+        std::chrono::milliseconds ramp_up{0};        // min -> max 가속 시간 (0 = 즉시)
+        double motion_threshold = 0.02;              // 평균 픽셀 변화율(0..1) 이 이 값을 넘으면 움직임
+    };
+
+    // AIPEX_RATE_* 환경변수로 옵션 구성. max_fps 기본값은 소스 fps
+    static Options FromEnv(double source_fps);
+
+    explicit RateGovernor(Options opts);
+
+    void ObserveDetections(size_t count, Clock::time_point now = Clock::now());
+    void ObserveMotion(double score, Clock::time_point now = Clock::now());
+
+    // 이번 소스 프레임을 보낼지 결정 (전송률 갱신 포함)
+    bool ShouldSend(Clock::time_point now = Clock::now());
+
+    double EffectiveRate() const { return current_fps_; }
+    // 최근 window 동안 실제 전송한 fps
+    double MeasuredSendRate() const { return measured_fps_; }
+    const Options& options() const { return opts_; }
+
+private:
+    double TargetRate(Clock::time_point now) const;
+
+    Options opts_;
+    double current_fps_;
+    double credit_{1.0};
+    Clock::time_point last_activity_;
+    Clock::time_point last_update_;
+
+    // 실제 전송률 측정
+    Clock::time_point window_start_;
+    uint32_t window_sent_{0};
+    double measured_fps_{0.0};
+};
@@ -0,0 +1,64 @@
+// 검출 결과 Write 묶음 (server, 스트림별)
+// - AIPEX_RESULT_COALESCE_MS=0 (기본): 사용하지 않음. 결과마다 ServerMessage 하나를 바로 Write
+// - 켜면 스트림마다 writer 스레드 하나가 결과를 씀. writer 가 한가하면 바로 보내므로 지연이 늘지 않고,
+//   Write 중에 도착한 결과들은 다음 Write 에서 ResultBatch 하나로 묶음 (바쁠 때만 메시지 수가 줄어듦)
+// - 급하지 않은 결과 (admission drop / stride skip 의 빈 결과) 는 최대 cap 까지 모아 다음 결과와 함께 보냄
+// - 바로 이어 쓸 결과가 남아 있으면 WriteOptions buffer hint 로 보내 전송을 다음 Write 와 합침
+#pragma once
+#include <grpcpp/grpcpp.h>
+#include "ComputeService.grpc.pb.h"
+#include "data_types.pb.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+class ResultWriter {
+public:
+    struct Options {
+        std::chrono::milliseconds cap{0}; // AIPEX_RESULT_COALESCE_MS, 급하지 않은 결과를 모아 두는 최대 시간 (0 = 끔)
+        size_t max_batch = 16;            // AIPEX_RESULT_BATCH_MAX, 메시지 하나에 넣는 결과 수
+    };
+    static Options FromEnv();
+
+    using Stream = grpc::ServerReaderWriter<data_types::ServerMessage, data_types::Command>;
+
+    // write_mtx: 다른 메시지(heartbeat, 상태 등) 와 Write 를 직렬화하는 스트림의 mutex
+    ResultWriter(Options opts, Stream* stream, std::mutex& write_mtx);
+    ~ResultWriter(); // Close
+
+    bool Enabled() const { return opts_.cap.count() > 0; }
+
+    // 결과 하나를 보낼 차례에 넣음. false: stream 이 이미 끊김 (Write 실패) 또는 Close 뒤 (결과는 버려짐)
+    bool Push(data_types::DetectionResult&& result, bool urgent);
+
+    // 남은 결과를 모두 보내고 writer 스레드 종료
+    void Close();
+
+private:
+    struct Item {
+        data_types::DetectionResult result;
+        std::chrono::steady_clock::time_point due; // 급한 결과는 넣은 시각
+    };
+
+    void Loop();
+
+    Options opts_;
+    Stream* stream_;
+    std::mutex& write_mtx_;
+
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    std::deque<Item> pending_;
+    bool closing_ = false;
+    bool failed_ = false;
+    std::thread thread_;
+
+    // 스트림 종료 시 [results] 로그
+    uint64_t messages_ = 0;
+    uint64_t results_ = 0;
+    uint64_t hinted_ = 0;
+    size_t largest_ = 0;
+};
@@ -0,0 +1,102 @@
+// 연산 보드(AipexFW) 탐색 컴포넌트
+// - 탐색 소스(mDNS/DNS-SD, 정적 파일)를 플러그인처럼 추가
+// - 마지막 탐색 결과를 디스크에 캐시하여 부팅 직후 바로 접속
+// - 백그라운드에서 주기적으로 갱신하고 리스너(GrpcClient 등)에 엔드포인트 목록 전달
+#pragma once
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <condition_variable>
+#include <cstdint>
+
+struct DiscoveredEndpoint {
+    std::string name;          // instance/host name (e.g. "AipexFW.local")
+    std::string address;       // "ip:port", GrpcClient에 그대로 전달 가능한 형태
+    uint64_t last_seen_ms{0};  // epoch ms, 캐시 만료 판단용
+};
+
+// 탐색 소스 인터페이스. Browse()는 timeout 안에 반환되어야 함
+class DiscoverySource {
+public:
+    virtual ~DiscoverySource() = default;
+    virtual std::string Name() const = 0;
+    virtual std::vector<DiscoveredEndpoint> Browse(std::chrono::milliseconds timeout) = 0;
+};
+
+// 정적 파일 소스 (테스트/고정 배치용)
+// 한 줄에 "name address" 또는 "address", '#' 이후는 주석
+class StaticFileSource : public DiscoverySource {
+public:
+    explicit StaticFileSource(const std::string& path);
+    std::string Name() const override { return "file:" + path_; }
+    std::vector<DiscoveredEndpoint> Browse(std::chrono::milliseconds timeout) override;
+private:
+    std::string path_;
+};
+
+// mDNS/DNS-SD 소스: avahi-resolve 같은 외부 프로세스 없이 직접 multicast 질의
+// - service_type(예: "_aipex._tcp.local") PTR browse -> SRV/A 로 주소 확보
+// - hostnames(예: "AipexFW.local") 에 대한 A 질의 -> default_port 사용
+class MdnsSource : public DiscoverySource {
+public:
+    MdnsSource(const std::string& service_type, std::vector<std::string> hostnames, uint16_t default_port);
+    std::string Name() const override { return "mdns"; }
+    std::vector<DiscoveredEndpoint> Browse(std::chrono::milliseconds timeout) override;
+private:
+    std::string service_type_;
+    std::vector<std::string> hostnames_;
+    uint16_t default_port_;
+};
+
+class ServiceDiscovery {
+public:
+    struct Options {
+        std::string cache_path;                                   // 비어 있으면 캐시 사용 안 함
+        std::chrono::milliseconds refresh_interval{10000};
+        std::chrono::milliseconds browse_timeout{1500};
+        std::chrono::milliseconds entry_ttl{10 * 60 * 1000};      // 이 시간 동안 안 보이면 목록에서 제거
+    };
+    using Listener = std::function<void(const std::vector<std::string>&)>;
+
+    explicit ServiceDiscovery(Options opts);
+    ~ServiceDiscovery();
+
+    void AddSource(std::unique_ptr<DiscoverySource> src);
+    void SetListener(Listener listener);
+
+    // 디스크 캐시 로드 (네트워크 대기 없음). 로드된 항목 수 반환
+    size_t LoadCache();
+    // 모든 소스를 한 번 탐색하고 목록/캐시 갱신. 목록이 바뀌었으면 true
+    bool RefreshOnce();
+
+    // 백그라운드 갱신 스레드
+    void Start();
+    void Stop();
+
+    // 최근에 본 순서대로 정렬된 "ip:port" 목록
+    std::vector<std::string> Endpoints() const;
+    std::vector<DiscoveredEndpoint> Snapshot() const;
+    // 목록이 비어 있지 않게 될 때까지 최대 timeout 대기
+    bool WaitForEndpoints(std::chrono::milliseconds timeout);
+
+private:
+    void RefreshLoop();
+    void SaveCacheLocked() const;
+    void NotifyListener();
+
+    Options opts_;
+    std::vector<std::unique_ptr<DiscoverySource>> sources_;
+    Listener listener_;
+
+    mutable std::mutex mtx_;
+    std::condition_variable cv_;
+    std::vector<DiscoveredEndpoint> entries_;
+
+    std::thread refresh_thread_;
+    std::atomic<bool> running_{false};
+};
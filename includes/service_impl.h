@@ -2,14 +2,31 @@
 #include <grpcpp/grpcpp.h>
 #include "ComputeService.grpc.pb.h"
 #include "data_types.pb.h"
+#include "stream_registry.h"
 #include <mutex>
 #include <thread>
 #include <atomic>
+#include <chrono>
 
 class ComputeServiceImpl final : public compute::ComputeService::Service {
 public:
+    ComputeServiceImpl() : streams_(StreamRegistry::FromEnv()) {}
+
     grpc::Status Datastream(::grpc::ServerContext* context,
                             ::grpc::ServerReaderWriter<data_types::ServerMessage, data_types::Command>* stream) override;
+
+    // 종료 시작: 새 스트림은 UNAVAILABLE 로 거절하고, 열린 스트림에 새로 들어온 프레임은 빈 결과로 응답.
+    // 처리 중인 프레임은 WaitDrained 동안 끝나 결과가 나가고, 그 뒤 CancelAll 로 Read 에서 막힌 handler 를 끝냄
+    void BeginShutdown(std::chrono::steady_clock::time_point deadline) { streams_.BeginShutdown(deadline); }
+    size_t WaitDrained(std::chrono::steady_clock::time_point deadline) { return streams_.WaitDrained(deadline); }
+    void CancelAll() { streams_.CancelAll(); }
+    // 열린 스트림이 모두 끝나거나 deadline 이 될 때까지 기다림. 남은 스트림 수 반환
+    size_t WaitIdle(std::chrono::steady_clock::time_point deadline) { return streams_.WaitIdle(deadline); }
+    // 재시작 시 다시 스트림을 받음
+    void Resume() { streams_.Resume(); }
+
 private:
-    // sender thread 관련은 각 RPC 인스턴스별로 로컬 멤버로 관리 (service 인스턴스는 stateless)
+    // 스트림별 상태는 Datastream 이 만들어 executor 작업과 공유 (service_impl.cpp 의 DatastreamState).
+    // 여기에는 열린 스트림 목록(종료/생존 확인용)만 둠
+    StreamRegistry streams_;
 };
\ No newline at end of file
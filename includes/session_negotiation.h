@@ -0,0 +1,21 @@
+// Datastream 시작 시 전송 방식 합의 (client Command.hello -> server ServerMessage.session_config)
+// - 양쪽이 프레임 형식/결과 인코딩/결과 묶음/분할 전송/동시 처리 수/압축 지원 범위를 알리고
+//   server 가 둘 다 지원하는 것 중 가장 빠른 조합을 정해 응답
+// - hello 가 없거나(구버전 client) 응답이 없으면(구버전 server) 기본 방식: JPEG, JSON, 분할/묶음/압축 없음
+#pragma once
+#include "data_types.pb.h"
+#include <cstddef>
+#include <string>
+
+constexpr uint32_t kSessionProtocolVersion = 1;
+
+// server 지원 범위. max_inflight: 카메라별 동시 처리 수 (현재 운영 프로필),
+// result_batch: 결과 묶음 사용 여부 (AIPEX_RESULT_COALESCE_MS), 압축은 AIPEX_STREAM_COMPRESSION (gzip / deflate)
+data_types::Capabilities server_capabilities(size_t max_inflight, bool result_batch);
+
+// 프레임 형식/결과 인코딩은 client 의 선호 순서를 따르고, 나머지는 양쪽 모두 지원할 때만 켬
+data_types::SessionConfig negotiate_session(const data_types::Capabilities& client,
+                                            const data_types::Capabilities& server);
+
+// 로그용 한 줄 요약
+std::string describe_session(const data_types::SessionConfig& s);
@@ -0,0 +1,97 @@
+// 가속기 포화 시 일부 프레임을 CPU 백엔드(작은 모델)로 넘기는 hybrid 스케줄러 (server)
+// - 장치 대기 프레임 수 x 최근 장치 실행 시간(EWMA) 으로 예상 대기 시간을 계산하고 SpillPolicy 로 판단
+// - 저우선순위 프레임(CameraFrame.low_priority)만 넘기는 것이 기본, hard 임계값을 넘으면 모든 프레임
+// - CPU Net 이 모두 사용 중이면 넘기지 않음 (CPU 쪽에서 다시 줄 서는 것 방지)
+// - 백엔드별 지연/검출 수/평균 점수와, 한가할 때 일부 Hailo 프레임을 CPU 모델로도 돌려 본
+//   일치율(Hailo 결과 기준 recall/precision) 을 [spill] 로그로 출력
+#pragma once
+#include "cpu_detector.h"
+#include "pipeline_policy.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// 백엔드 간 비교용 박스 (정규화 좌표, class 이름으로 비교)
+struct SpillBox {
+    std::string label;
+    float score;
+    float x_min, y_min, x_max, y_max;
+};
+
+class SpilloverScheduler {
+public:
+    enum class Backend { HAILO = 0, CPU = 1 };
+
+    struct Options {
+        CpuDetector::Options cpu;
+        SpillPolicy policy;
+        int audit_every = 50; // Hailo 프레임 N 장마다 1 장 CPU 모델로도 실행 (0 = 끔)
+    };
+
+    // AIPEX_SPILL_ONNX, AIPEX_SPILL_INPUT (기본 320), AIPEX_SPILL_NETS (기본 2),
+    // AIPEX_SPILL_WAIT_MS, AIPEX_SPILL_HARD_WAIT_MS, AIPEX_SPILL_AUDIT_EVERY
+    static Options FromEnv();
+
+    explicit SpilloverScheduler(Options opts);
+    ~SpilloverScheduler(); // 진행 중인 audit 작업을 기다림
+
+    int Init();
+
+    // 장치 큐 추적: 장치 mutex 를 기다리기 전에 Enter, 실행이 끝나면 Exit(실행 시간)
+    void DeviceEnter() { device_waiters_.fetch_add(1, std::memory_order_relaxed); }
+    void DeviceExit(double run_ms);
+    // 실행하지 않고 나감 (watchdog 복구 중). 실행 시간 평균에 넣지 않음
+    void DeviceAbort() { device_waiters_.fetch_sub(1, std::memory_order_relaxed); }
+    double ExpectedWaitMs() const;
+
+    // 이 프레임을 CPU 로 넘길지. true 면 CPU 자리를 하나 예약하므로 반드시 Detect 를 호출
+    // device_down: 장치를 쓸 수 없음 (watchdog 복구 중). 예상 대기와 상관없이 CPU 자리만 확인
+    bool TrySpill(bool low_priority, bool device_down = false);
+    // 작은 모델로 검출 (TrySpill 예약 해제 포함). 정규화 좌표, class_id 0-based
+    int Detect(const cv::Mat& bgr, std::vector<SegDetection>& out);
+    int InputWidth() const { return cpu_.InputWidth(); }
+    int InputHeight() const { return cpu_.InputHeight(); }
+
+    // 프레임 하나 완료 (latency: 요청 시작부터 결과까지)
+    void Record(Backend backend, double latency_ms, const std::vector<SpillBox>& dets);
+
+    // Hailo 결과가 나온 프레임을 audit 대상으로 할지 보고, 대상이면 executor(LOW) 에서 CPU 모델을 돌려 비교.
+    // to_boxes: CPU 검출 결과를 Hailo 와 같은 이름 체계로 변환
+    void MaybeAudit(const cv::Mat& frame, const std::vector<SpillBox>& reference,
+                    std::vector<SpillBox> (*to_boxes)(const std::vector<SegDetection>&));
+
+private:
+    void MaybeLog(std::chrono::steady_clock::time_point now);
+    bool TakeCpuSlot(); // cpu_inflight_ 가 cpu_slots_ 미만이면 하나 차지
+
+    Options opts_;
+    CpuDetector cpu_;
+    size_t cpu_slots_ = 0;
+
+    std::atomic<int> device_waiters_{0};
+    std::atomic<double> device_run_ewma_ms_{0.0};
+    std::atomic<size_t> cpu_inflight_{0};
+    std::atomic<uint64_t> hailo_frames_seen_{0};
+
+    std::mutex audit_mtx_;
+    std::condition_variable audit_cv_;
+    size_t audits_inflight_ = 0;
+
+    struct BackendStats {
+        uint64_t frames = 0;
+        double latency_ms = 0.0;
+        uint64_t detections = 0;
+        double score_sum = 0.0;
+    };
+    std::mutex stats_mtx_;
+    BackendStats stats_[2];
+    uint64_t audits_ = 0;
+    uint64_t audit_ref_ = 0;     // Hailo 박스 수
+    uint64_t audit_cpu_ = 0;     // CPU 박스 수
+    uint64_t audit_matched_ = 0; // 같은 class, IoU >= 0.5 로 짝지어진 수
+    std::chrono::steady_clock::time_point window_start_;
+};
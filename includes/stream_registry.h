@@ -0,0 +1,77 @@
+// 열린 Datastream 목록 (server)
+// - 종료: 새 스트림/새 프레임을 거절 (BeginShutdown) -> 처리 중인 프레임이 끝나 결과가 나갈 때까지 기다림
+//   (WaitDrained) -> 열린 스트림을 모두 취소 (CancelAll) -> handler 가 끝나기를 기다림 (WaitIdle).
+//   모두 같은 shutdown deadline (AIPEX_SHUTDOWN_MS) 안에서
+// - 생존 확인: handler 가 프레임(chunk 포함)이나 heartbeat 를 받을 때마다 Touch.
+//   AIPEX_STREAM_IDLE_MS 동안 둘 다 오지 않으면 (Wi-Fi 끊김 등으로 client 가 stream 을 닫지 못함)
+//   TryCancel 로 handler 를 끝내 그 스트림의 처리 자리/보관 프레임/조립 버퍼를 TCP timeout 전에 반환
+// - 서버가 Read 하지 않는 동안(메시지 처리, admission 대기로 backpressure 중) 은 idle 로 세지 않음.
+//   handler 는 Read 전후로 ResumeReading/PauseReading 을 호출
+// - client 는 프레임이 없어도 heartbeat 를 보내므로 (AIPEX_LB_HEARTBEAT_MS, 기본 500) 멈춘 카메라는 끊기지 않음.
+//   heartbeat 를 보내지 않는 구버전 client 를 위해 기본 timeout 은 길게 둠
+#pragma once
+#include <grpcpp/grpcpp.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+struct StreamLiveness {
+    std::atomic<int64_t> live_ns{0};       // 마지막 프레임/heartbeat 시각. 서버가 Read 하지 않은 시간만큼 뒤로 밀림
+    std::atomic<int64_t> last_frame_ns{0}; // 0 = 아직 프레임 없음
+    std::atomic<int64_t> paused_ns{0};     // Read 를 멈춘 시각 (0 = Read 중, client 를 기다리는 중)
+    std::atomic<bool> reaped{false};
+    std::atomic<size_t> inflight{0};       // 처리 중인 프레임 수 (handler 가 셈, WaitDrained 용)
+
+    // 프레임(frame = true) 또는 heartbeat 를 받음
+    void Touch(bool frame);
+    void PauseReading();
+    void ResumeReading();
+};
+
+class StreamRegistry {
+public:
+    struct Options {
+        std::chrono::milliseconds idle_timeout{30000}; // AIPEX_STREAM_IDLE_MS (0 = 끊지 않음)
+    };
+    static Options FromEnv();
+
+    explicit StreamRegistry(Options opts);
+    ~StreamRegistry();
+
+    // 종료 중이면 nullptr (호출자는 UNAVAILABLE 로 반환)
+    std::shared_ptr<StreamLiveness> Register(::grpc::ServerContext* context);
+    void Unregister(::grpc::ServerContext* context);
+
+    // 새 스트림 거절. 열린 스트림은 취소하지 않음 (처리 중인 프레임의 결과를 보낼 수 있도록)
+    void BeginShutdown(std::chrono::steady_clock::time_point deadline);
+    // 모든 스트림의 처리 중인 프레임이 끝나거나 deadline 이 될 때까지 기다림. 아직 처리 중인 프레임 수 반환
+    size_t WaitDrained(std::chrono::steady_clock::time_point deadline);
+    // 열린 스트림을 모두 취소 (Read 에서 막힌 handler 가 바로 반환)
+    void CancelAll();
+    // 열린 스트림이 모두 끝나거나 deadline 이 될 때까지 기다림. 남은 스트림 수 반환
+    size_t WaitIdle(std::chrono::steady_clock::time_point deadline);
+    void Resume();
+
+    bool Draining() const { return draining_.load(std::memory_order_acquire); }
+    // BeginShutdown 에 준 deadline (Draining 일 때만 의미 있음)
+    std::chrono::steady_clock::time_point ShutdownDeadline();
+
+private:
+    void Loop();
+
+    Options opts_;
+    std::mutex mtx_;
+    std::condition_variable cv_;      // Unregister -> WaitIdle
+    std::condition_variable loop_cv_; // 소멸 시 Loop 깨우기
+    std::map<::grpc::ServerContext*, std::shared_ptr<StreamLiveness>> streams_;
+    std::atomic<bool> draining_{false};
+    std::chrono::steady_clock::time_point shutdown_deadline_;
+    bool running_ = true;
+    uint64_t reaped_ = 0;
+    std::thread thread_;
+};
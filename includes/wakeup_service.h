@@ -0,0 +1,93 @@
+// 출력 보드측 WakeUpService (wakeup.proto) C++ 구현 -> aipex_wakeup 실행 파일
+// - ScriptRunner: 시작 시(스레드 생성 전) helper 프로세스를 fork 하고, helper 는 exec 직전 상태로 대기하는
+//   자식을 하나 미리 만들어 둠. TriggerScript 는 그 자식에게 경로/인자만 보내고 pid 를 바로 반환
+// - DisplayStateCache: 표시 상태 확인 명령(xset 등)을 백그라운드에서 주기적으로 실행하여 캐시,
+//   IsDisplayOn 은 캐시만 읽음. trigger 직후에는 짧은 주기로 확인하여 trigger -> 화면 켜짐 지연 측정
+#pragma once
+#include "wakeup.grpc.pb.h"
+#include <grpcpp/grpcpp.h>
+#include <sys/types.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class ScriptRunner {
+public:
+    ScriptRunner() = default;
+    ~ScriptRunner();
+
+    // helper 프로세스 시작. 다른 스레드가 생기기 전에 호출해야 함
+    bool Start();
+    // 미리 fork 된 자식이 path 를 args 로 exec. 반환: 실행된 pid, 실패 시 -1 (err 에 이유)
+    pid_t Run(const std::string& path, const std::vector<std::string>& args, std::string& err);
+
+private:
+    std::mutex mtx_;
+    pid_t helper_pid_ = -1;
+    int req_fd_ = -1;  // parent -> helper
+    int resp_fd_ = -1; // helper -> parent
+};
+
+class DisplayStateCache {
+public:
+    struct Options {
+        std::string probe = "xset -display :0 q"; // AIPEX_DISPLAY_PROBE (sh -c 로 실행)
+        std::string on_pattern = "Monitor is On"; // AIPEX_DISPLAY_ON_PATTERN
+        std::chrono::milliseconds idle_interval{1000};   // AIPEX_DISPLAY_POLL_MS
+        std::chrono::milliseconds fast_interval{20};     // trigger 직후 확인 주기
+        std::chrono::milliseconds fast_window{10000};    // 이 시간 안에 켜지지 않으면 측정 포기
+    };
+    static Options FromEnv();
+
+    explicit DisplayStateCache(Options opts);
+    ~DisplayStateCache();
+
+    void Start();
+    void Stop();
+    bool On(std::string& info) const;
+    // TriggerScript 직후 호출: 빠른 확인 주기로 전환하고 켜질 때까지 걸린 시간을 기록
+    void NoteTrigger(std::chrono::steady_clock::time_point t);
+
+private:
+    void Loop();
+    bool Probe(std::string& info);
+
+    Options opts_;
+    mutable std::mutex mtx_;
+    std::condition_variable cv_;
+    bool running_ = false;
+    bool on_ = false;
+    std::string info_ = "unknown";
+    std::thread thread_;
+
+    // trigger -> 켜짐 지연 통계
+    bool pending_trigger_ = false;
+    bool was_on_at_trigger_ = false;
+    std::chrono::steady_clock::time_point trigger_at_;
+    uint64_t wakeups_ = 0;
+    double wake_ms_sum_ = 0.0, wake_ms_max_ = 0.0;
+};
+
+class WakeUpServiceImpl final : public wakemeup::WakeUpService::Service {
+public:
+    // AIPEX_WAKEUP_SCRIPT: 기본 스크립트 (script_name 이 비었거나 "wakeup")
+    // AIPEX_WAKEUP_SCRIPT_DIR: 그 외 script_name 은 이 디렉터리의 <name> 또는 <name>.sh
+    WakeUpServiceImpl(ScriptRunner& runner, DisplayStateCache& display);
+
+    grpc::Status TriggerScript(grpc::ServerContext* context, const wakemeup::WakeUpRequest* request,
+                               wakemeup::WakeUpResponse* response) override;
+    grpc::Status IsDisplayOn(grpc::ServerContext* context, const google::protobuf::Empty* request,
+                             wakemeup::DisplayState* response) override;
+
+private:
+    bool ResolveScript(const std::string& name, std::string& path, std::string& err) const;
+
+    ScriptRunner& runner_;
+    DisplayStateCache& display_;
+    std::string default_script_;
+    std::string script_dir_;
+};
@@ -0,0 +1,111 @@
+#include "box_predictor.h"
+#include "env_config.h"
+#include <algorithm>
+#include <cstdlib>
+
+static float iou(const GrpcClient::BBox& a, const GrpcClient::BBox& b) {
+    float x1 = std::max(a.x, b.x), y1 = std::max(a.y, b.y);
+    float x2 = std::min(a.x + a.w, b.x + b.w), y2 = std::min(a.y + a.h, b.y + b.h);
+    float inter = std::max(0.f, x2 - x1) * std::max(0.f, y2 - y1);
+    float uni = a.w * a.h + b.w * b.h - inter;
+    return uni > 0.f ? inter / uni : 0.f;
+}
+
+BoxPredictor::Options BoxPredictor::FromEnv() {
+    Options o;
+    o.enabled = env_bool("AIPEX_PREDICT", true);
+    o.max_tracks = static_cast<size_t>(std::max(1, env_int("AIPEX_PREDICT_MAX_TRACKS", static_cast<int>(o.max_tracks))));
+    o.max_age = std::chrono::milliseconds(env_int("AIPEX_PREDICT_MAX_AGE_MS", static_cast<int>(o.max_age.count())));
+    o.max_horizon = std::chrono::milliseconds(env_int("AIPEX_PREDICT_HORIZON_MS", static_cast<int>(o.max_horizon.count())));
+    return o;
+}
+
+BoxPredictor::BoxPredictor(Options opts) : opts_(opts) {}
+
+void BoxPredictor::Update(const std::vector<GrpcClient::BBox>& boxes, Clock::time_point observed_at) {
+    if (boxes.empty()) {
+        // max_age 까지 외삽된 박스를 남기지 않음. 더 늦게 관측된 track (재정렬 전 결과) 은 유지
+        tracks_.erase(std::remove_if(tracks_.begin(), tracks_.end(),
+                                     [&](const Track& t) { return t.observed_at <= observed_at; }),
+                      tracks_.end());
+        return;
+    }
+    std::vector<bool> matched(tracks_.size(), false);
+
+    for (const auto& b : boxes) {
+        // 1) track id 가 있으면 id 로, 없으면 같은 label 중 IoU 최대인 track 과 연결
+        int best = -1;
+        if (b.track_id >= 0) {
+            for (size_t i = 0; i < tracks_.size(); ++i) {
+                if (tracks_[i].id == b.track_id) { best = static_cast<int>(i); break; }
+            }
+        } else {
+            float best_iou = opts_.iou_threshold;
+            for (size_t i = 0; i < tracks_.size(); ++i) {
+                if (matched[i] || tracks_[i].box.label != b.label) continue;
+                float v = iou(tracks_[i].box, b);
+                if (v >= best_iou) { best_iou = v; best = static_cast<int>(i); }
+            }
+        }
+
+        if (best < 0) {
+            Track t;
+            t.id = b.track_id >= 0 ? b.track_id : -(next_id_++); // 자체 id 는 음수로 구분
+            t.box = b;
+            t.observed_at = observed_at;
+            t.hits = 1;
+            tracks_.push_back(t);
+            matched.push_back(true);
+            continue;
+        }
+
+        // 2) 등속 모델 갱신: 관측 변위로부터 속도를 평활화
+        Track& t = tracks_[best];
+        matched[best] = true;
+        float dt = std::chrono::duration<float>(observed_at - t.observed_at).count();
+        if (dt > 1e-3f) {
+            float g = opts_.velocity_gain;
+            t.vx = (1.f - g) * t.vx + g * (b.x - t.box.x) / dt;
+            t.vy = (1.f - g) * t.vy + g * (b.y - t.box.y) / dt;
+            t.vw = (1.f - g) * t.vw + g * (b.w - t.box.w) / dt;
+            t.vh = (1.f - g) * t.vh + g * (b.h - t.box.h) / dt;
+            t.observed_at = observed_at;
+        }
+        int keep_id = t.box.track_id;
+        t.box = b;
+        if (b.track_id < 0) t.box.track_id = keep_id;
+        t.hits++;
+    }
+
+    // 3) track 수 상한: 가장 오래된 것부터 제거
+    if (tracks_.size() > opts_.max_tracks) {
+        std::sort(tracks_.begin(), tracks_.end(),
+                  [](const Track& a, const Track& b) { return a.observed_at > b.observed_at; });
+        tracks_.resize(opts_.max_tracks);
+    }
+}
+
+std::vector<GrpcClient::BBox> BoxPredictor::Predict(Clock::time_point display_at) {
+    tracks_.erase(std::remove_if(tracks_.begin(), tracks_.end(),
+                                 [&](const Track& t) { return display_at - t.observed_at > opts_.max_age; }),
+                  tracks_.end());
+
+    std::vector<GrpcClient::BBox> out;
+    out.reserve(tracks_.size());
+    for (const auto& t : tracks_) {
+        GrpcClient::BBox b = t.box;
+        // 관측이 한 번뿐이면 속도를 모르므로 외삽하지 않음
+        if (opts_.enabled && t.hits > 1) {
+            float dt = std::chrono::duration<float>(
+                std::min<Clock::duration>(display_at - t.observed_at, opts_.max_horizon)).count();
+            b.x += t.vx * dt;
+            b.y += t.vy * dt;
+            b.w = std::max(0.f, b.w + t.vw * dt);
+            b.h = std::max(0.f, b.h + t.vh * dt);
+        }
+        b.x = std::clamp(b.x, 0.f, 1.f);
+        b.y = std::clamp(b.y, 0.f, 1.f);
+        if (b.w > 0.f && b.h > 0.f) out.push_back(b);
+    }
+    return out;
+}
@@ -0,0 +1,178 @@
+#include "coro_datastream.h"
+#include "env_config.h"
+#include "coro_task.h"
+#include "hailo_infer.h"
+#include "preprocess.h"
+#include "jpeg_codec.h"
+#include "perf_counters.h"
+#include "session_negotiation.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <semaphore>
+
+// hailo_object_detection.cpp
+extern std::string hailo_nms_to_json(const uint8_t* data, size_t size, size_t num_classes);
+
+#define HEF_FILE "/home/pi/hailo/best.hef"
+
+static constexpr int kMaxInFlight = 64;
+
+static int coro_inflight() {
+    return std::clamp(env_int("AIPEX_CORO_INFLIGHT", 0), 0, kMaxInFlight);
+}
+
+bool coro_datastream_enabled() {
+    return coro_inflight() > 0;
+}
+
+// 장치는 프로세스에 하나: 첫 스트림에서 생성하고 이후 스트림이 공유
+static HailoInfer& shared_infer() {
+    static HailoInfer infer([] {
+        const char* hef = std::getenv("HEF_PATH");
+        return std::string(hef ? hef : HEF_FILE);
+    }(), 1);
+    return infer;
+}
+
+namespace {
+struct StreamCtx {
+    grpc::ServerReaderWriter<data_types::ServerMessage, data_types::Command>* stream;
+    HailoInfer& infer;
+    PreprocessKernel preprocess;
+    int model_w, model_h;
+    size_t nms_size, nms_classes;
+    std::counting_semaphore<kMaxInFlight> slots;
+    std::mutex write_mtx;
+    std::atomic<bool> write_failed{false};
+    StreamLiveness* live = nullptr; // 처리 중인 프레임 수를 registry 에 알림 (서버 종료 시 drain)
+    // 후처리/Write 는 HailoRT callback 스레드 밖에서. 마지막에 선언해 가장 먼저 해제(join) 되도록 함
+    // -> 마지막 코루틴이 slots.release() 이후 frame 을 정리하는 동안 다른 멤버가 살아 있음
+    ThreadCoroExecutor executor;
+
+    StreamCtx(grpc::ServerReaderWriter<data_types::ServerMessage, data_types::Command>* s, HailoInfer& i, int k)
+        : stream(s), infer(i), slots(k) {}
+
+    bool Write(const data_types::ServerMessage& sm) {
+        std::lock_guard<std::mutex> lk(write_mtx);
+        if (!stream->Write(sm)) {
+            write_failed.store(true);
+            return false;
+        }
+        return true;
+    }
+
+    void AcquireSlot() {
+        slots.acquire();
+        if (live) live->inflight.fetch_add(1);
+    }
+    void ReleaseSlot() {
+        if (live) live->inflight.fetch_sub(1);
+        slots.release();
+    }
+};
+} // namespace
+
+// 프레임 하나의 전체 처리. 호출 스레드(reader)에서 co_await 까지 실행되고 이후는 executor 에서 재개
+static DetachedTask process_frame(data_types::CameraFrame cf, StreamCtx& ctx) {
+    cv::Mat frame;
+    {
+        // co_await 전후로 스레드가 바뀌므로 스레드별 버퍼를 재사용하지 않음
+        PerfStage stage("decode");
+        jpeg_decode(reinterpret_cast<const uint8_t*>(cf.image_data().data()), cf.image_data().size(), frame);
+    }
+    if (frame.empty()) {
+        std::cerr << "[coro] Failed to decode image\n";
+        ctx.ReleaseSlot();
+        co_return;
+    }
+    cv::Mat input(ctx.model_h, ctx.model_w, CV_8UC3);
+    {
+        PerfStage stage("preprocess");
+        ctx.preprocess.fn(frame, input.data, ctx.model_w, ctx.model_h);
+    }
+
+    std::vector<cv::Mat> batch{input};
+    InferOutput out = co_await ctx.infer.infer(std::move(batch), &ctx.executor);
+
+    if (out.status != HAILO_SUCCESS || out.outputs.empty()) {
+        std::cerr << "[coro] inference failed: " << out.status << "\n";
+        ctx.ReleaseSlot();
+        co_return;
+    }
+
+    data_types::ServerMessage sm;
+    auto dr = sm.mutable_detection_result();
+    {
+        // co_await 이후 executor 스레드에서 실행되므로 그 스레드의 카운터로 측정
+        PerfStage stage("postprocess");
+        dr->set_json(hailo_nms_to_json(out.outputs[0].first, ctx.nms_size, ctx.nms_classes));
+    }
+    dr->set_frame_id(cf.frame_id());
+    dr->set_backend("hailo");
+    dr->set_camera_id(cf.camera_id());
+    auto now = std::chrono::system_clock::now();
+    dr->mutable_frame_timestamp()->set_seconds(
+        std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count());
+    ctx.Write(sm);
+    ctx.ReleaseSlot();
+}
+
+grpc::Status CoroDatastream(grpc::ServerContext* context,
+                            grpc::ServerReaderWriter<data_types::ServerMessage, data_types::Command>* stream,
+                            StreamLiveness* live) {
+    const int k = coro_inflight();
+    HailoInfer& infer = shared_infer();
+    StreamCtx ctx(stream, infer, k);
+    ctx.live = live;
+    auto shape = infer.get_model_shape();
+    ctx.model_w = static_cast<int>(shape.width);
+    ctx.model_h = static_cast<int>(shape.height);
+    ctx.preprocess = select_preprocess_kernel(ctx.model_w, ctx.model_h, static_cast<int>(shape.features), true);
+    const auto& outputs = infer.get_outputs();
+    if (outputs.empty()) return grpc::Status(grpc::StatusCode::INTERNAL, "model has no outputs");
+    ctx.nms_size = outputs[0].get_frame_size();
+    ctx.nms_classes = outputs[0].get_nms_shape().number_of_classes;
+    std::cerr << "[coro] Datastream started, in-flight=" << k << " preprocess=" << ctx.preprocess.name << "\n";
+
+    data_types::Command cmd;
+    while (!context->IsCancelled() && !ctx.write_failed.load()) {
+        if (live) live->ResumeReading();
+        bool ok = stream->Read(&cmd);
+        if (live) live->PauseReading(); // slots 대기 중에는 생존 확인을 멈춤
+        if (!ok) break;
+        if (live && (cmd.has_camera_frame() || cmd.has_heartbeat())) live->Touch(cmd.has_camera_frame());
+        if (cmd.has_camera_frame()) {
+            ctx.AcquireSlot(); // K 프레임이 처리 중이면 하나 끝날 때까지 대기 (자연스러운 backpressure)
+            process_frame(cmd.camera_frame(), ctx);
+        } else if (cmd.has_hello()) {
+            // 이 경로는 JPEG 단일 메시지 프레임과 개별 결과만 처리
+            data_types::Capabilities server;
+            server.set_protocol_version(kSessionProtocolVersion);
+            server.add_frame_formats("JPEG");
+            server.add_result_encodings("json");
+            server.set_max_inflight(static_cast<uint32_t>(k));
+            data_types::ServerMessage resp;
+            *resp.mutable_session_config() = negotiate_session(cmd.hello(), server);
+            std::cerr << "[coro] negotiated: " << describe_session(resp.session_config()) << "\n";
+            ctx.Write(resp);
+        } else if (cmd.has_heartbeat()) {
+            data_types::ServerMessage hb;
+            hb.mutable_heartbeat()->CopyFrom(cmd.heartbeat());
+            ctx.Write(hb);
+        } else if (cmd.has_control_action() &&
+                   cmd.control_action().action() == data_types::ControlAction::STOP_STREAMING) {
+            std::cerr << "[coro] STOP_STREAMING\n";
+            break;
+        }
+    }
+
+    // 처리 중인 프레임이 모두 끝나야 ctx(executor, stream) 를 해제할 수 있음
+    for (int i = 0; i < k; ++i) ctx.slots.acquire();
+    std::cerr << "[coro] Datastream handler exiting\n";
+    return grpc::Status::OK;
+}
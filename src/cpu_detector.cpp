@@ -0,0 +1,148 @@
+#include "cpu_detector.h"
+#include "env_config.h"
+#include "executor.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+CpuDetector::Options CpuDetector::FromEnv() {
+    Options o;
+    const char* onnx = std::getenv("AIPEX_CPU_ONNX");
+    if (onnx) o.onnx_path = onnx;
+    const char* in = std::getenv("AIPEX_CPU_INPUT");
+    if (in && *in) {
+        int w = 0, h = 0;
+        if (std::sscanf(in, "%dx%d", &w, &h) == 2 && w > 0 && h > 0) {
+            o.input_w = w;
+            o.input_h = h;
+        } else if (std::atoi(in) > 0) {
+            o.input_w = o.input_h = std::atoi(in);
+        }
+    }
+    o.nets = static_cast<size_t>(std::max(0, env_int("AIPEX_CPU_NETS", 0)));
+    const char* thr = std::getenv("AIPEX_CPU_SCORE_THRESHOLD");
+    if (thr && *thr) o.score_threshold = static_cast<float>(std::atof(thr));
+    o.bench_frames = std::max(0, env_int("AIPEX_CPU_BENCH", 0));
+    return o;
+}
+
+CpuDetector::CpuDetector(Options opts) : opts_(std::move(opts)), window_start_(std::chrono::steady_clock::now()) {
+    decode_cfg_.score_threshold = opts_.score_threshold;
+    decode_cfg_.iou_threshold = opts_.iou_threshold;
+    decode_cfg_.max_detections = opts_.max_detections;
+}
+
+int CpuDetector::Init() {
+    if (opts_.onnx_path.empty()) {
+        std::cerr << "[cpu] AIPEX_CPU_ONNX not set\n";
+        return -1;
+    }
+    size_t n = opts_.nets ? opts_.nets : std::max(1u, std::thread::hardware_concurrency() / 2);
+    for (size_t i = 0; i < n; ++i) {
+        auto net = std::make_unique<cv::dnn::Net>();
+        try {
+            *net = cv::dnn::readNetFromONNX(opts_.onnx_path);
+        } catch (const cv::Exception& e) {
+            std::cerr << "[cpu] Failed to load " << opts_.onnx_path << ": " << e.what() << "\n";
+            return -1;
+        }
+        if (net->empty()) {
+            std::cerr << "[cpu] Failed to load " << opts_.onnx_path << "\n";
+            return -1;
+        }
+        net->setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
+        net->setPreferableTarget(cv::dnn::DNN_TARGET_CPU);
+        pool_.push_back(std::move(net));
+    }
+    nets_ = n;
+    std::cerr << "[cpu] " << opts_.onnx_path << " loaded: input=" << opts_.input_w << "x" << opts_.input_h
+              << " nets=" << n << " cv_threads=" << cv::getNumThreads() << "\n";
+    if (opts_.bench_frames > 0) Benchmark(opts_.bench_frames);
+    return 0;
+}
+
+std::unique_ptr<cv::dnn::Net> CpuDetector::Acquire() {
+    std::unique_lock<std::mutex> lk(pool_mtx_);
+    pool_cv_.wait(lk, [this] { return !pool_.empty(); });
+    auto net = std::move(pool_.back());
+    pool_.pop_back();
+    return net;
+}
+
+void CpuDetector::Release(std::unique_ptr<cv::dnn::Net> net) {
+    {
+        std::lock_guard<std::mutex> lk(pool_mtx_);
+        pool_.push_back(std::move(net));
+    }
+    pool_cv_.notify_one();
+}
+
+int CpuDetector::Detect(const cv::Mat& bgr, std::vector<SegDetection>& out) {
+    out.clear();
+    if (bgr.empty()) return -1;
+    // Hailo 경로와 같이 전체 프레임을 입력 크기로 늘림 (letterbox 없음) -> 정규화 좌표가 원본에 그대로 대응
+    cv::Mat blob = cv::dnn::blobFromImage(bgr, 1.0 / 255.0, cv::Size(opts_.input_w, opts_.input_h), cv::Scalar(), true, false);
+
+    auto t0 = std::chrono::steady_clock::now();
+    cv::Mat pred;
+    auto net = Acquire();
+    try {
+        net->setInput(blob);
+        pred = net->forward();
+    } catch (const cv::Exception& e) {
+        Release(std::move(net));
+        std::cerr << "[cpu] forward failed: " << e.what() << "\n";
+        return -1;
+    }
+    Release(std::move(net));
+    Account(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count());
+
+    if (pred.dims != 3 || !pred.isContinuous()) {
+        std::cerr << "[cpu] unexpected output rank " << pred.dims << "\n";
+        return -1;
+    }
+    // (1, 4+nc, N) 또는 (1, N, 4+nc). 긴 축이 anchor 축
+    size_t a = static_cast<size_t>(pred.size[1]), b = static_cast<size_t>(pred.size[2]);
+    size_t rows = std::max(a, b), row_len = std::min(a, b);
+    if (row_len <= 4) {
+        std::cerr << "[cpu] detection tensor too narrow: " << row_len << "\n";
+        return -1;
+    }
+    out = decode_yolo_seg(pred.ptr<float>(), rows, row_len, a < b, row_len - 4, 0,
+                          opts_.input_w, opts_.input_h, decode_cfg_);
+    return 0;
+}
+
+void CpuDetector::Account(double ms) {
+    std::lock_guard<std::mutex> lk(stats_mtx_);
+    frames_++;
+    window_frames_++;
+    window_infer_ms_ += ms;
+    auto now = std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration<double>(now - window_start_).count();
+    if (elapsed >= 10.0) {
+        std::cerr << "[cpu] frames=" << frames_ << " fps=" << window_frames_ / elapsed
+                  << " infer_ms=" << window_infer_ms_ / window_frames_ << "\n";
+        window_frames_ = 0;
+        window_infer_ms_ = 0.0;
+        window_start_ = now;
+    }
+}
+
+void CpuDetector::Benchmark(int frames) {
+    cv::Mat frame(opts_.input_h, opts_.input_w, CV_8UC3);
+    cv::randu(frame, cv::Scalar::all(0), cv::Scalar::all(255));
+    std::vector<SegDetection> warm;
+    Detect(frame, warm); // 첫 forward 는 graph 초기화 포함
+
+    auto t0 = std::chrono::steady_clock::now();
+    Executor::Instance().ParallelFor(static_cast<size_t>(frames), [&](size_t) {
+        std::vector<SegDetection> dets;
+        Detect(frame, dets);
+    });
+    double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    std::cerr << "[cpu] bench: " << frames << " frames in " << sec << "s -> " << (sec > 0 ? frames / sec : 0.0)
+              << " fps (nets=" << nets_ << ", cv_threads=" << cv::getNumThreads() << ")\n";
+}
@@ -0,0 +1,180 @@
+#include "device_watchdog.h"
+#include "env_config.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+static int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+static double ms_since(std::chrono::steady_clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
+
+DeviceWatchdog::Options DeviceWatchdog::FromEnv() {
+    Options o;
+    o.run_timeout = std::chrono::milliseconds(std::max(10, env_int("AIPEX_WD_RUN_TIMEOUT_MS", 500)));
+    // hang 은 run 타임아웃보다 길어야 함 (타임아웃으로 돌아오는 실행은 실패 횟수로 처리)
+    int hang = std::max(env_int("AIPEX_WD_HANG_MS", 2000), static_cast<int>(o.run_timeout.count()) * 2);
+    o.hang = std::chrono::milliseconds(hang);
+    o.max_failures = std::max(0, env_int("AIPEX_WD_MAX_FAILURES", o.max_failures));
+    o.replay_wait = std::chrono::milliseconds(std::max(0, env_int("AIPEX_WD_REPLAY_WAIT_MS", 5000)));
+    o.retry_backoff = std::chrono::milliseconds(std::max(50, env_int("AIPEX_WD_RETRY_MS", 1000)));
+    const char* p = std::getenv("AIPEX_WD_POLICY");
+    std::string policy = (p && *p) ? std::string(p) : std::string("replay");
+    if (policy == "fail") o.policy = Policy::FAIL;
+    else if (policy == "cpu") o.policy = Policy::CPU;
+    else o.policy = Policy::REPLAY;
+    return o;
+}
+
+DeviceWatchdog::DeviceWatchdog(Options opts, std::function<bool()> reset) : opts_(opts), reset_(std::move(reset)) {
+    static const char* kPolicy[] = {"fail", "replay", "cpu"};
+    std::cerr << "[watchdog] run_timeout=" << opts_.run_timeout.count() << "ms hang=" << opts_.hang.count()
+              << "ms max_failures=" << opts_.max_failures << " policy=" << kPolicy[static_cast<int>(opts_.policy)]
+              << "\n";
+    thread_ = std::thread([this] { Loop(); });
+}
+
+DeviceWatchdog::~DeviceWatchdog() {
+    std::vector<Deferred> left;
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        running_ = false;
+        left.assign(std::make_move_iterator(deferred_.begin()), std::make_move_iterator(deferred_.end()));
+        deferred_.clear();
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) thread_.join();
+    Resume(left, false);
+}
+
+void DeviceWatchdog::DeferUntilRecovered(std::function<void(bool recovered)> resume) {
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        if (running_ && !healthy_.load(std::memory_order_acquire)) {
+            deferred_.push_back({std::move(resume), std::chrono::steady_clock::now() + opts_.replay_wait});
+            cv_.notify_all();
+            return;
+        }
+    }
+    resume(healthy_.load(std::memory_order_acquire));
+}
+
+std::vector<DeviceWatchdog::Deferred> DeviceWatchdog::TakeDeferredLocked(bool recovered) {
+    std::vector<Deferred> out;
+    auto now = std::chrono::steady_clock::now();
+    while (!deferred_.empty() && (recovered || deferred_.front().deadline <= now)) {
+        out.push_back(std::move(deferred_.front()));
+        deferred_.pop_front();
+    }
+    return out;
+}
+
+void DeviceWatchdog::Resume(std::vector<Deferred>& ready, bool recovered) {
+    for (auto& d : ready) d.resume(recovered);
+    ready.clear();
+}
+
+void DeviceWatchdog::RunStarted() {
+    run_started_ns_.store(now_ns(), std::memory_order_release);
+}
+
+void DeviceWatchdog::RunFinished(bool ok) {
+    run_started_ns_.store(0, std::memory_order_release);
+    std::lock_guard<std::mutex> lk(mtx_);
+    if (ok) {
+        consecutive_ = 0;
+        return;
+    }
+    stats_.failures++;
+    if (++consecutive_ >= opts_.max_failures) {
+        TriggerLocked(std::to_string(consecutive_) + " consecutive failed runs");
+    }
+}
+
+void DeviceWatchdog::TriggerLocked(const std::string& reason) {
+    if (!healthy_.load(std::memory_order_relaxed)) return;
+    healthy_.store(false, std::memory_order_release);
+    down_since_ = std::chrono::steady_clock::now();
+    std::cerr << "[watchdog] device unhealthy (" << reason << "), resetting\n";
+    cv_.notify_all();
+}
+
+void DeviceWatchdog::Loop() {
+    // hang 확인 주기. 멈춤을 hang 의 1/4 정도 늦게 알아채는 것은 허용
+    const auto period = std::max(std::chrono::milliseconds(50), opts_.hang / 4);
+    int64_t reported_ns = 0; // 이미 hang 으로 처리한 실행의 시작 시각
+    int attempt = 0;
+    std::unique_lock<std::mutex> lk(mtx_);
+    while (running_) {
+        if (healthy_.load(std::memory_order_relaxed)) {
+            cv_.wait_for(lk, period, [this] { return !running_ || !healthy_.load(std::memory_order_relaxed); });
+            if (!running_) break;
+            int64_t started = run_started_ns_.load(std::memory_order_acquire);
+            if (healthy_.load(std::memory_order_relaxed) && started != 0 && started != reported_ns &&
+                now_ns() - started > std::chrono::duration_cast<std::chrono::nanoseconds>(opts_.hang).count()) {
+                reported_ns = started;
+                stats_.hangs++;
+                TriggerLocked("run() not returned for " + std::to_string((now_ns() - started) / 1000000) + "ms");
+            }
+            continue;
+        }
+
+        // 복구: reset 은 진행 중인 실행을 기다리므로 lock 밖에서 호출. 그 전에 기다림이 끝난 프레임을 돌려보냄
+        std::vector<Deferred> expired = TakeDeferredLocked(false);
+        stats_.reset_attempts++;
+        attempt++;
+        lk.unlock();
+        Resume(expired, false);
+        auto t0 = std::chrono::steady_clock::now();
+        bool ok = reset_();
+        double reset_ms = ms_since(t0);
+        lk.lock();
+        if (!running_) break;
+        if (!ok) {
+            auto backoff = opts_.retry_backoff * std::min(1 << std::min(attempt - 1, 3), 8);
+            std::cerr << "[watchdog] reset attempt " << attempt << " failed after " << reset_ms << "ms, retry in "
+                      << backoff.count() << "ms\n";
+            // backoff 중에도 replay_wait 이 지난 프레임은 바로 돌려보냄
+            const auto retry_at = std::chrono::steady_clock::now() + backoff;
+            while (running_ && std::chrono::steady_clock::now() < retry_at) {
+                auto wake = deferred_.empty() ? retry_at : std::min(retry_at, deferred_.front().deadline);
+                cv_.wait_until(lk, wake, [this] { return !running_; });
+                expired = TakeDeferredLocked(false);
+                if (expired.empty()) continue;
+                lk.unlock();
+                Resume(expired, false);
+                lk.lock();
+            }
+            continue;
+        }
+        double down_ms = ms_since(down_since_);
+        stats_.resets++;
+        stats_.downtime_ms_last = down_ms;
+        stats_.downtime_ms_total += down_ms;
+        consecutive_ = 0;
+        healthy_.store(true, std::memory_order_release);
+        std::cerr << "[watchdog] device recovered: reset=" << reset_ms << "ms downtime=" << down_ms
+                  << "ms attempts=" << attempt << " | resets=" << stats_.resets
+                  << " downtime_total=" << stats_.downtime_ms_total << "ms failures=" << stats_.failures
+                  << " hangs=" << stats_.hangs << " replayed=" << replayed_.load(std::memory_order_relaxed)
+                  << " rejected=" << rejected_.load(std::memory_order_relaxed) << "\n";
+        attempt = 0;
+        std::vector<Deferred> ready = TakeDeferredLocked(true);
+        lk.unlock();
+        Resume(ready, true);
+        lk.lock();
+    }
+}
+
+DeviceWatchdog::Stats DeviceWatchdog::GetStats() const {
+    std::lock_guard<std::mutex> lk(mtx_);
+    Stats s = stats_;
+    s.replayed = replayed_.load(std::memory_order_relaxed);
+    s.rejected = rejected_.load(std::memory_order_relaxed);
+    s.healthy = healthy_.load(std::memory_order_acquire);
+    return s;
+}
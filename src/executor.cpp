@@ -0,0 +1,213 @@
+#include "executor.h"
+#include "env_config.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+static thread_local int t_worker_index = -1;
+
+Executor& Executor::Instance() {
+    static Executor exec([] {
+        Options o;
+        o.workers = static_cast<size_t>(std::max(0, env_int("AIPEX_EXEC_THREADS", 0)));
+        o.pin_threads = env_bool("AIPEX_EXEC_PIN", true);
+        o.report_interval = std::chrono::seconds(std::max(0, env_int("AIPEX_EXEC_REPORT_S", 10)));
+        return o;
+    }());
+    return exec;
+}
+
+Executor::Executor(Options opts) : opts_(opts), last_report_(std::chrono::steady_clock::now()) {
+    size_t n = opts_.workers;
+    if (n == 0) n = std::max(1u, std::thread::hardware_concurrency());
+    workers_.reserve(n);
+    for (size_t i = 0; i < n; ++i) workers_.push_back(std::make_unique<Worker>());
+    for (size_t i = 0; i < n; ++i) {
+        workers_[i]->thread = std::thread(&Executor::WorkerLoop, this, i);
+#if defined(__linux__)
+        if (opts_.pin_threads) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(i % std::max(1u, std::thread::hardware_concurrency()), &set);
+            pthread_setaffinity_np(workers_[i]->thread.native_handle(), sizeof(set), &set);
+        }
+#endif
+    }
+    std::cerr << "[exec] " << n << " workers" << (opts_.pin_threads ? " (pinned)" : "") << "\n";
+}
+
+Executor::~Executor() {
+    Shutdown();
+}
+
+void Executor::Shutdown() {
+    {
+        std::lock_guard<std::mutex> lk(sleep_mtx_);
+        if (stop_.exchange(true)) return;
+    }
+    sleep_cv_.notify_all();
+    for (auto& w : workers_) {
+        if (w->thread.joinable()) w->thread.join();
+    }
+}
+
+int Executor::CurrentWorker() {
+    return t_worker_index;
+}
+
+void Executor::Submit(std::function<void()> fn, Priority prio, int affinity) {
+    if (stop_.load()) {
+        fn(); // 종료 중에는 호출 스레드에서 바로 실행 (작업 유실 방지)
+        return;
+    }
+    size_t target;
+    if (affinity >= 0) target = static_cast<size_t>(affinity) % workers_.size();
+    else if (t_worker_index >= 0) target = static_cast<size_t>(t_worker_index);
+    else target = next_.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+
+    int p = static_cast<int>(prio);
+    // 작업을 넣기 전에 센다 (먼저 꺼낸 worker 의 fetch_sub 로 pending_ 이 0 아래로 내려가지 않도록)
+    pending_.fetch_add(1);
+    {
+        std::lock_guard<std::mutex> lk(workers_[target]->mtx);
+        workers_[target]->queues[p].push_back(Task{std::move(fn), std::chrono::steady_clock::now(), p});
+    }
+    {
+        std::lock_guard<std::mutex> lk(sleep_mtx_); // 잠들기 직전의 worker 가 notify 를 놓치지 않도록
+    }
+    sleep_cv_.notify_one();
+}
+
+bool Executor::TryPopLocal(size_t index, Task& out) {
+    Worker& w = *workers_[index];
+    std::lock_guard<std::mutex> lk(w.mtx);
+    for (int p = 0; p < kPriorities; ++p) {
+        if (!w.queues[p].empty()) {
+            out = std::move(w.queues[p].back());
+            w.queues[p].pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Executor::TrySteal(size_t thief, Task& out) {
+    const size_t n = workers_.size();
+    // 우선순위가 높은 작업부터 모든 victim 을 훑음
+    for (int p = 0; p < kPriorities; ++p) {
+        for (size_t k = 1; k < n; ++k) {
+            Worker& v = *workers_[(thief + k) % n];
+            std::lock_guard<std::mutex> lk(v.mtx);
+            if (!v.queues[p].empty()) {
+                out = std::move(v.queues[p].front());
+                v.queues[p].pop_front();
+                workers_[thief]->steals.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void Executor::WorkerLoop(size_t index) {
+    t_worker_index = static_cast<int>(index);
+    while (true) {
+        Task task;
+        if (TryPopLocal(index, task) || TrySteal(index, task)) {
+            pending_.fetch_sub(1);
+            Run(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lk(sleep_mtx_);
+        sleep_cv_.wait(lk, [this] { return stop_.load() || pending_.load() > 0; });
+        if (stop_.load() && pending_.load() == 0) break;
+    }
+}
+
+void Executor::Run(Task& task) {
+    auto start = std::chrono::steady_clock::now();
+    double wait_us = std::chrono::duration<double, std::micro>(start - task.enqueued).count();
+    try {
+        task.fn();
+    } catch (const std::exception& e) {
+        std::cerr << "[exec] task threw: " << e.what() << "\n";
+    } catch (...) {
+        std::cerr << "[exec] task threw unknown exception\n";
+    }
+
+    bool report = false;
+    {
+        std::lock_guard<std::mutex> lk(stats_mtx_);
+        executed_[task.prio]++;
+        wait_sum_us_[task.prio] += wait_us;
+        wait_max_us_[task.prio] = std::max(wait_max_us_[task.prio], wait_us);
+        if (opts_.report_interval.count() > 0 && start - last_report_ >= opts_.report_interval) {
+            last_report_ = start;
+            report = true;
+        }
+    }
+    if (report) LogStats();
+}
+
+void Executor::ParallelFor(size_t n, const std::function<void(size_t)>& fn, Priority prio) {
+    if (n == 0) return;
+    struct State {
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> done{0};
+        size_t n = 0;
+        const std::function<void(size_t)>* fn = nullptr;
+        std::mutex mtx;
+        std::condition_variable cv;
+    };
+    auto st = std::make_shared<State>();
+    st->n = n;
+    st->fn = &fn;
+    // 늦게 시작한 helper 는 남은 index 가 없으면 fn 에 접근하지 않고 끝남
+    auto work = [st] {
+        size_t i;
+        while ((i = st->next.fetch_add(1)) < st->n) {
+            (*st->fn)(i);
+            if (st->done.fetch_add(1) + 1 == st->n) {
+                std::lock_guard<std::mutex> lk(st->mtx);
+                st->cv.notify_all();
+            }
+        }
+    };
+    size_t helpers = std::min(n - 1, workers_.size());
+    for (size_t h = 0; h < helpers; ++h) Submit(work, prio);
+    work();
+    std::unique_lock<std::mutex> lk(st->mtx);
+    st->cv.wait(lk, [&] { return st->done.load() == st->n; });
+}
+
+Executor::Stats Executor::GetStats() {
+    Stats s;
+    {
+        std::lock_guard<std::mutex> lk(stats_mtx_);
+        for (int p = 0; p < kPriorities; ++p) {
+            s.executed[p] = executed_[p];
+            s.avg_wait_us[p] = executed_[p] ? wait_sum_us_[p] / executed_[p] : 0.0;
+            s.max_wait_us[p] = wait_max_us_[p];
+        }
+    }
+    for (auto& w : workers_) s.steals += w->steals.load(std::memory_order_relaxed);
+    s.pending = pending_.load();
+    s.workers = workers_.size();
+    return s;
+}
+
+void Executor::LogStats() {
+    Stats s = GetStats();
+    static const char* names[kPriorities] = {"high", "normal", "low"};
+    std::cerr << "[exec] workers=" << s.workers << " pending=" << s.pending << " steals=" << s.steals;
+    for (int p = 0; p < kPriorities; ++p) {
+        if (s.executed[p] == 0) continue;
+        std::cerr << " " << names[p] << "{n=" << s.executed[p]
+                  << " wait_avg=" << s.avg_wait_us[p] << "us wait_max=" << s.max_wait_us[p] << "us}";
+    }
+    std::cerr << "\n";
+}
@@ -0,0 +1,117 @@
+#include "frame_assembler.h"
+#include "env_config.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+FrameBufferPool& FrameBufferPool::Instance() {
+    static FrameBufferPool pool;
+    return pool;
+}
+
+FrameBufferPool::Buffer FrameBufferPool::Acquire(size_t size) {
+    std::unique_ptr<Block> block;
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        // 들어가는 것 중 가장 작은 버퍼 (해상도가 섞여도 큰 버퍼를 작은 프레임에 쓰지 않도록)
+        auto best = free_.end();
+        for (auto it = free_.begin(); it != free_.end(); ++it) {
+            if ((*it)->capacity >= size && (best == free_.end() || (*it)->capacity < (*best)->capacity)) best = it;
+        }
+        if (best != free_.end()) {
+            block = std::move(*best);
+            free_.erase(best);
+        }
+    }
+    if (!block) {
+        block = std::make_unique<Block>();
+        block->data.reset(new uint8_t[size]);
+        block->capacity = size;
+    }
+    block->size = size;
+    return Buffer(block.release(), [this](Block* b) { Release(b); });
+}
+
+void FrameBufferPool::Release(Block* b) {
+    std::unique_ptr<Block> block(b);
+    std::lock_guard<std::mutex> lk(mtx_);
+    if (free_.size() < max_free_) free_.push_back(std::move(block));
+}
+
+FrameAssembler::Options FrameAssembler::FromEnv() {
+    Options o;
+    o.max_frame_bytes = static_cast<size_t>(std::max(1, env_int("AIPEX_CHUNK_MAX_FRAME_MB", 64))) << 20;
+    o.max_partial = static_cast<size_t>(std::max(1, env_int("AIPEX_CHUNK_MAX_PARTIAL", 4)));
+    return o;
+}
+
+void FrameAssembler::Abort(std::map<uint64_t, Partial>::iterator it) {
+    aborted_.push_back(std::move(it->second.frame->meta));
+    partial_.erase(it);
+    stats_.aborted++;
+}
+
+bool FrameAssembler::OnHeader(data_types::FrameHeader& header, std::string& err) {
+    uint64_t id = header.frame().frame_id();
+    size_t total = static_cast<size_t>(header.total_size());
+    if (id == 0 || total == 0 || total > opts_.max_frame_bytes) {
+        err = "invalid frame header (frame_id=" + std::to_string(id) + " size=" + std::to_string(total) + ")";
+        if (id != 0) {
+            aborted_.push_back(std::move(*header.mutable_frame()));
+            aborted_.back().clear_image_data();
+        }
+        return false;
+    }
+    if (partial_.count(id)) {
+        // 조립 중인 frame_id 의 헤더가 또 옴: 먼저 온 프레임을 그대로 두고 (그 프레임이 완성되거나 버려질 때
+        // 응답이 한 번 나감) 새 헤더는 거절. 이어지는 chunk 는 offset 이 어긋나면 그 프레임과 함께 버려짐
+        err = "duplicate frame header (frame_id=" + std::to_string(id) + ") while assembling";
+        stats_.duplicates++;
+        return false;
+    }
+    if (partial_.size() >= opts_.max_partial) {
+        // 끝나지 않은 가장 오래된(헤더를 먼저 받은) 프레임을 버림. frame_id 순서와 도착 순서는 다를 수 있음
+        auto oldest = std::min_element(partial_.begin(), partial_.end(), [](const auto& a, const auto& b) {
+            return a.second.started < b.second.started;
+        });
+        Abort(oldest);
+    }
+    Partial& p = partial_[id];
+    p.frame = std::make_shared<InboundFrame>();
+    p.frame->meta = std::move(*header.mutable_frame());
+    p.frame->meta.clear_image_data();
+    p.frame->pixels = FrameBufferPool::Instance().Acquire(total);
+    p.received = 0;
+    p.total = total;
+    p.started = std::chrono::steady_clock::now();
+    return true;
+}
+
+bool FrameAssembler::OnChunk(data_types::FrameChunk& chunk, std::shared_ptr<InboundFrame>& out, std::string& err) {
+    auto it = partial_.find(chunk.frame_id());
+    if (it == partial_.end()) {
+        err = "chunk for unknown frame " + std::to_string(chunk.frame_id());
+        return false;
+    }
+    Partial& p = it->second;
+    const std::string& data = chunk.data();
+    if (chunk.offset() != p.received || data.size() > p.total - p.received) {
+        err = "out-of-order chunk for frame " + std::to_string(chunk.frame_id()) + " (offset=" +
+              std::to_string(chunk.offset()) + " expected=" + std::to_string(p.received) + ")";
+        Abort(it);
+        return false;
+    }
+    std::memcpy(p.frame->pixels->data.get() + p.received, data.data(), data.size());
+    p.received += data.size();
+    if (p.received < p.total) return false;
+
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - p.started).count();
+    stats_.assembled++;
+    stats_.bytes += p.total;
+    stats_.assemble_ms_sum += ms;
+    stats_.assemble_ms_max = std::max(stats_.assemble_ms_max, ms);
+    out = std::move(p.frame);
+    partial_.erase(it);
+    return true;
+}
@@ -1,7 +1,13 @@
 #include "grpc_client.h"
+#include "env_config.h"
 #include "ComputeService.grpc.pb.h"
 #include "wakeup.grpc.pb.h"
 #include "data_types.pb.h"
+#include "hailo_segmentation.h"
+#include "executor.h"
+#include "playout_buffer.h"
+#include "jpeg_codec.h"
+#include "session_negotiation.h"
 #include <google/protobuf/timestamp.pb.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/descriptor.h>
@@ -10,6 +16,9 @@
 #include <regex>
 #include <chrono>
 #include <condition_variable>
+#include <csignal>
+#include <cstdlib>
+#include <map>
 #include <opencv2/opencv.hpp>
 
 // Helper: parse simple arrays [x,y,w,h] or [x,y,w,h,score] in JSON-like string
@@ -56,6 +65,12 @@ static std::vector<GrpcClient::BBox> parse_bboxes_from_json(const std::string& s
             if (std::regex_search(det_block, m, class_re)) b.label = m[1].str();
             std::regex score_re("\"score\"\\s*:\\s*([-+]?[0-9]*\\.?[0-9]+)");
             if (std::regex_search(det_block, m, score_re)) b.score = std::stof(m[1].str());
+            std::regex track_re("\"track_id\"\\s*:\\s*([0-9]+)");
+            if (std::regex_search(det_block, m, track_re)) b.track_id = std::stoi(m[1].str());
+            std::regex subclass_re("\"subclass\"\\s*:\\s*\"([^\"]+)\"");
+            if (std::regex_search(det_block, m, subclass_re)) b.subclass = m[1].str();
+            std::regex subscore_re("\"subclass_score\"\\s*:\\s*([-+]?[0-9]*\\.?[0-9]+)");
+            if (std::regex_search(det_block, m, subscore_re)) b.subclass_score = std::stof(m[1].str());
 
             // push if valid
             if (b.w > 0.0f && b.h > 0.0f) {
@@ -90,96 +105,235 @@ static std::vector<GrpcClient::BBox> parse_bboxes_from_json(const std::string& s
     return res;
 }
 
+// detection_result 에서 JSON 문자열 추출 (reflection -> DebugString fallback)
+static std::string extract_detection_json(const data_types::DetectionResult& dr) {
+    std::string jstr;
+    const google::protobuf::Message& dr_msg = dr;
+    const google::protobuf::Descriptor* desc = dr_msg.GetDescriptor();
+    const google::protobuf::Reflection* refl = dr_msg.GetReflection();
+    const char* candidates[] = { "json", "json_str", "json_payload", "payload" };
+    for (const char* fname : candidates) {
+        const auto* fd = desc->FindFieldByName(fname);
+        if (fd && fd->cpp_type() == google::protobuf::FieldDescriptor::CPPTYPE_STRING) {
+            jstr = refl->GetString(dr_msg, fd);
+            break;
+        }
+    }
+    // fallback: if detection_result.DebugString contains "json:" substring, try to extract after it
+    if (jstr.empty()) {
+        std::string dbg = dr_msg.DebugString();
+        auto pos = dbg.find("json:");
+        if (pos != std::string::npos) {
+            jstr = dbg.substr(pos + 5);
+        }
+    }
+    return jstr;
+}
+
 class GrpcClient::Impl {
 public:
-    Impl(std::shared_ptr<grpc::Channel> ch)
-      : channel_(ch), stub_(compute::ComputeService::NewStub(ch)), running_(false),
-        sent_frames_(0), received_results_(0)
+    // 연산 보드 하나에 대한 스트림 상태
+    struct Backend {
+        size_t index{0};
+        std::string target;
+        std::shared_ptr<grpc::Channel> channel;
+        std::unique_ptr<compute::ComputeService::Stub> stub;
+        std::unique_ptr<grpc::ClientContext> context; // 교체는 write_mtx + ctx_mtx, 취소는 ctx_mtx 만
+        std::unique_ptr<grpc::ClientReaderWriter<data_types::Command, data_types::ServerMessage>> stream;
+        std::thread reader;
+        std::mutex write_mtx;
+        std::mutex ctx_mtx; // Write 에 막힌 스레드가 write_mtx 를 쥐고 있어도 취소할 수 있도록
+        std::atomic<bool> connected{false};
+        std::chrono::steady_clock::time_point last_attempt;
+        // session_config 로 합의한 전송 방식. 응답 전/구버전 보드는 JPEG 한 메시지로 보냄
+        std::atomic<bool> raw_frames{false};
+        std::atomic<size_t> chunk_bytes{0}; // 0 = 분할 전송 안 함
+        // 보드 운영 프로필이 요청한 JPEG 품질 (DeviceStatus). 0 = AIPEX_JPEG_QUALITY
+        std::atomic<int> jpeg_quality{0};
+    };
+
+    // 미완료 프레임. cmd 는 장애 조치 시 다른 보드로 재전송하기 위한 것으로 전송 경로와 같은 객체를 공유
+    // (보드가 하나뿐이면 보관하지 않음)
+    struct PendingFrame {
+        size_t backend{0};
+        std::shared_ptr<const data_types::Command> cmd;
+        bool chunked{false};
+    };
+
+    Impl(std::shared_ptr<grpc::Channel> ch, const std::string& target)
+      : running_(false), sent_frames_(0), received_results_(0),
+        lb_(LoadBalancer::PolicyFromString(env_str("AIPEX_LB_POLICY"))),
+        reorder_wait_(std::chrono::milliseconds(env_int("AIPEX_LB_REORDER_MS", 200))),
+        reorder_(reorder_wait_),
+        endpoints_{target}, initial_channel_(ch), initial_target_(target)
     {}
 
-    // Start the bi-directional stream and reader thread
+    // Start one bi-directional stream (+ reader thread) per known endpoint
     bool Start() {
         // already running?
         if (running_.exchange(true)) return true;
 
-        // create context and stream
-        context_ = std::make_unique<grpc::ClientContext>();
-        stream_ = stub_->Datastream(context_.get());
-        if (!stream_) {
+        std::vector<std::string> eps = GetEndpoints();
+        bool any = false;
+        for (const auto& ep : eps) {
+            Backend* b = AddBackend(ep);
+            if (!b) break;
+            any = Open(*b) || any;
+        }
+        if (!any) {
             std::cerr << "[client] Failed to create Datastream\n";
             running_.store(false);
             return false;
         }
+        const size_t n = Backends().size();
+        if (n > 1) std::cerr << "[client] load balancing over " << n << " boards\n";
 
-        // launch reader thread
-        reader_thread_ = std::thread(&Impl::ReaderLoop, this);
+        monitor_thread_ = std::thread(&Impl::MonitorLoop, this);
         return true;
     }
-    
+
     ~Impl() { Stop(); }
 
-    void ReaderLoop() {
-        data_types::ServerMessage sm;
-        std::cerr << "[client] reader_thread started\n";
-        while (stream_->Read(&sm)) {
-            // 기본 Debug 출력
-            // std::cout << "[client recv] ServerMessage Debug:\n" << sm.DebugString() << std::endl;
+    // backends_ 는 backends_mtx_ 안에서만 읽고 씀. Backend 객체는 Stop() 까지 유지되므로
+    // 꺼낸 포인터는 lock 없이 써도 됨
+    std::vector<Backend*> Backends() {
+        std::lock_guard<std::mutex> lk(backends_mtx_);
+        std::vector<Backend*> out;
+        out.reserve(backends_.size());
+        for (auto& b : backends_) out.push_back(b.get());
+        return out;
+    }
 
-            // count results if detection_result present
-            if (sm.has_detection_result()) {
-                received_results_.fetch_add(1, std::memory_order_relaxed);
+    // 인코딩은 보드를 고르기 전에 하므로 보드들이 요청한 품질 중 가장 낮은 값을 씀 (0 = 요청 없음)
+    void UpdateEncodeQuality() {
+        int q = 0;
+        for (Backend* b : Backends()) {
+            int bq = b->jpeg_quality.load();
+            if (bq > 0 && (q == 0 || bq < q)) q = bq;
+        }
+        encode_quality_.store(q, std::memory_order_relaxed);
+    }
 
-                // try to extract JSON-like field named "json" (reflection) OR detection_result may be a message with string field
-                std::string jstr;
-                // reflection attempt
-                const google::protobuf::Message& dr_msg = sm.detection_result();
-                const google::protobuf::Descriptor* desc = dr_msg.GetDescriptor();
-                const google::protobuf::Reflection* refl = dr_msg.GetReflection();
-                const char* candidates[] = { "json", "json_str", "json_payload", "payload" };
-                for (const char* fname : candidates) {
-                    const auto* fd = desc->FindFieldByName(fname);
-                    if (fd && fd->cpp_type() == google::protobuf::FieldDescriptor::CPPTYPE_STRING) {
-                        jstr = refl->GetString(dr_msg, fd);
-                        break;
-                    }
-                }
-                // fallback: if detection_result.DebugString contains "json:" substring, try to extract after it
-                if (jstr.empty()) {
-                    std::string dbg = dr_msg.DebugString();
-                    auto pos = dbg.find("json:");
-                    if (pos != std::string::npos) {
-                        jstr = dbg.substr(pos + 5);
-                    }
-                }
+    size_t BackendCount() {
+        std::lock_guard<std::mutex> lk(backends_mtx_);
+        return backends_.size();
+    }
 
-                // std::cerr << "[client] extracted JSON string: " << jstr << "\n";
+    Backend* BackendAt(size_t idx) {
+        std::lock_guard<std::mutex> lk(backends_mtx_);
+        return idx < backends_.size() ? backends_[idx].get() : nullptr;
+    }
 
-                std::vector<BBox> boxes;
-                if (!jstr.empty()) {
-                    boxes = parse_bboxes_from_json(jstr);
-                } else {
-                    // as last resort, try parse whole ServerMessage DebugString for bracket arrays
-                    boxes = parse_bboxes_from_json(sm.DebugString());
-                }
+    // Start()/MonitorLoop 에서만 호출. AIPEX_LB_MAX_BACKENDS 에 닿았으면 nullptr
+    Backend* AddBackend(const std::string& target) {
+        auto b = std::make_unique<Backend>();
+        b->target = target;
+        b->channel = (target == initial_target_ && initial_channel_)
+            ? initial_channel_ : grpc::CreateChannel(target, grpc::InsecureChannelCredentials());
+        b->stub = compute::ComputeService::NewStub(b->channel);
+        std::lock_guard<std::mutex> lk(backends_mtx_);
+        if (backends_.size() >= max_backends_) return nullptr;
+        b->index = backends_.size();
+        backends_.push_back(std::move(b));
+        lb_.AddBackend(target); // index 일치 (추가는 항상 이 함수로만)
+        return backends_.back().get();
+    }
 
-                // std::cerr << "[client] parsed " << boxes.size() << " bboxes\n";
-                // for (const auto &b : boxes) {
-                //     // std::cerr << "  box: x=" << b.x << " y=" << b.y << " w=" << b.w << " h=" << b.h
-                //     //           << " score=" << b.score << " label=" << b.label << "\n";
-                // }
-
-                if (!boxes.empty()) {
-                    Detection det;
-                    det.boxes = std::move(boxes);
-                    det.timestamp_ms = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
-                        std::chrono::system_clock::now().time_since_epoch()).count());
-                    {
-                        std::lock_guard<std::mutex> lk(det_mtx_);
-                        det_queue_.push_back(std::move(det));
-                    }
-                    det_cv_.notify_one();
-                } else {
-                    std::cerr << "[client] no boxes parsed from detection_result\n";
+    bool Open(Backend& b) {
+        b.last_attempt = std::chrono::steady_clock::now();
+        auto context = std::make_unique<grpc::ClientContext>();
+        auto stream = b.stub->Datastream(context.get());
+        if (!stream) {
+            std::cerr << "[client] Failed to create Datastream to " << b.target << "\n";
+            return false;
+        }
+        // 스트림의 첫 메시지. 구버전 보드는 모르는 필드로 무시하고 응답하지 않음
+        data_types::Command hello;
+        FillHello(*hello.mutable_hello());
+        if (!stream->Write(hello)) {
+            std::cerr << "[client] Write(hello) failed to " << b.target << "\n";
+            return false;
+        }
+        {
+            // 다른 스레드의 WriteTo 는 write_mtx 안에서 stream 을 보므로 교체도 그 안에서
+            std::lock_guard<std::mutex> lk(b.write_mtx);
+            std::lock_guard<std::mutex> ctx_lk(b.ctx_mtx);
+            b.context = std::move(context);
+            b.stream = std::move(stream);
+            b.raw_frames.store(false);
+            b.chunk_bytes.store(0);
+        }
+        if (!running_.load()) Cancel(b); // Stop() 이 전체 취소를 마친 뒤에 열린 스트림
+        b.connected.store(true);
+        lb_.SetHealthy(b.index, true);
+        b.reader = std::thread(&Impl::ReaderLoop, this, &b);
+        return true;
+    }
+
+    // 이 client 가 쓸 수 있는 전송 방식. 프레임 형식은 선호 순서 (AIPEX_FRAME_FORMAT=raw 면 BGR 먼저)
+    void FillHello(data_types::Capabilities& c) const {
+        c.set_protocol_version(kSessionProtocolVersion);
+        c.add_frame_formats(send_raw_ ? "BGR" : "JPEG");
+        c.add_frame_formats(send_raw_ ? "JPEG" : "BGR");
+        c.add_result_encodings("json");
+        c.set_result_batch(true);
+        c.set_chunked_frames(true);
+        c.set_max_chunk_bytes(static_cast<uint32_t>(chunk_bytes_));
+        // gRPC client 는 gzip/deflate 응답을 기본으로 풀 수 있음
+        c.add_compression("gzip");
+        c.add_compression("deflate");
+    }
+
+    // 막힌 Read/Write 를 풀어 줌. write_mtx 없이 호출 가능
+    void Cancel(Backend& b) {
+        std::lock_guard<std::mutex> lk(b.ctx_mtx);
+        if (b.context) b.context->TryCancel();
+    }
+
+    void Close(Backend& b, bool graceful) {
+        b.connected.store(false);
+        lb_.SetHealthy(b.index, false);
+        Cancel(b);
+        if (b.reader.joinable()) b.reader.join();
+        std::lock_guard<std::mutex> lk(b.write_mtx);
+        if (b.stream) {
+            if (graceful) b.stream->WritesDone();
+            grpc::Status s = b.stream->Finish();
+            (void)s;
+        }
+        b.stream.reset();
+        std::lock_guard<std::mutex> ctx_lk(b.ctx_mtx);
+        b.context.reset();
+    }
+
+    void ReaderLoop(Backend* b) {
+        data_types::ServerMessage sm;
+        std::cerr << "[client] reader_thread started (" << b->target << ")\n";
+        while (b->stream->Read(&sm)) {
+            lb_.OnActivity(b->index);
+
+            // heartbeat echo -> RTT
+            if (sm.has_heartbeat()) {
+                const auto& ts = sm.heartbeat().timestamp();
+                auto sent = std::chrono::system_clock::time_point(
+                    std::chrono::seconds(ts.seconds()) + std::chrono::nanoseconds(ts.nanos()));
+                double rtt = std::chrono::duration<double, std::milli>(std::chrono::system_clock::now() - sent).count();
+                if (rtt >= 0.0) lb_.OnHeartbeatRtt(b->index, rtt);
+            }
+
+            // count results if detection_result present
+            if (sm.has_detection_result()) {
+                received_results_.fetch_add(1, std::memory_order_relaxed);
+                result_messages_.fetch_add(1, std::memory_order_relaxed);
+                HandleDetection(*b, sm.detection_result());
+            }
+            // 서버가 묶어 보낸 결과 (AIPEX_RESULT_COALESCE_MS). 하나씩 보낸 것과 같게 처리
+            if (sm.has_result_batch()) {
+                result_messages_.fetch_add(1, std::memory_order_relaxed);
+                result_batches_.fetch_add(1, std::memory_order_relaxed);
+                for (const auto& dr : sm.result_batch().results()) {
+                    received_results_.fetch_add(1, std::memory_order_relaxed);
+                    HandleDetection(*b, dr);
                 }
             }
 
@@ -188,18 +342,39 @@ public:
                 const auto &cf = sm.camera_frame();
                 const std::string &imgdata = cf.image_data();
                 if (!imgdata.empty()) {
-                    std::vector<uchar> buf(imgdata.begin(), imgdata.end());
-                    cv::Mat img = cv::imdecode(buf, cv::IMREAD_COLOR);
-                    if (!img.empty()) {
+                    // playout 버퍼가 프레임을 들고 있으므로 매번 새 Mat 에 디코드
+                    cv::Mat img;
+                    if (jpeg_decode(reinterpret_cast<const uint8_t*>(imgdata.data()), imgdata.size(), img)) {
+                        auto arrival = std::chrono::steady_clock::now();
+                        int64_t capture_us = cf.timestamp().seconds() * 1000000LL + cf.timestamp().nanos() / 1000;
+                        // 캡처 시각이 없으면(구버전 서버) 도착 시각 기준으로 순서만 유지
+                        if (capture_us == 0) capture_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                            std::chrono::system_clock::now().time_since_epoch()).count();
                         std::lock_guard<std::mutex> lk(frame_mtx_);
-                        frame_queue_.push_back(img);
-                        if (frame_queue_.size() > 4) frame_queue_.erase(frame_queue_.begin()); // bounded
+                        RemoteViewLocked(cf.camera_id()).playout.Push(capture_us, arrival, img);
                     } else {
                         std::cerr << "[client] camera_frame imdecode failed\n";
                     }
                 }
             }
 
+            if (sm.has_session_config()) {
+                const auto& sc = sm.session_config();
+                b->raw_frames.store(sc.frame_format() == "BGR");
+                b->chunk_bytes.store(sc.chunked_frames() ? sc.chunk_bytes() : 0);
+                std::cerr << "[client] negotiated with " << b->target << ": " << describe_session(sc) << "\n";
+            }
+
+            if (sm.has_device_status()) {
+                const auto& ds = sm.device_status();
+                std::cerr << "[client] board " << b->target << " profile=" << ds.profile()
+                          << (ds.profile_auto() ? " (auto: " : " (manual: ") << ds.profile_reason() << ")"
+                          << " temp=" << ds.cpu_temperature_c() << "C streams=" << ds.active_streams()
+                          << " jpeg_q=" << ds.jpeg_quality() << "\n";
+                b->jpeg_quality.store(static_cast<int>(std::min<uint32_t>(ds.jpeg_quality(), 100)));
+                UpdateEncodeQuality();
+            }
+
             // handle config_response terminate ack
             if (sm.has_config_response()) {
                 const auto& cr = sm.config_response();
@@ -208,9 +383,274 @@ public:
                     ::raise(SIGTERM);
                     break;
                 }
+                if (!cr.message().empty()) {
+                    std::cerr << "[client] config_response from " << b->target << ": "
+                              << (cr.success() ? "" : "failed: ") << cr.message() << "\n";
+                }
+            }
+        }
+        b->connected.store(false);
+        std::cerr << "[client] reader_thread exiting (" << b->target << ")\n";
+    }
+
+    void HandleDetection(Backend& b, const data_types::DetectionResult& dr) {
+        uint64_t frame_id = dr.frame_id();
+        double latency_ms = 0.0;
+        if (frame_id != 0) {
+            latency_ms = lb_.OnResult(b.index, frame_id);
+            if (latency_ms < 0.0) return; // 이미 다른 보드로 재전송되어 처리된 frame
+            std::lock_guard<std::mutex> lk(pending_mtx_);
+            auto it = pending_.find(frame_id);
+            if (it != pending_.end()) {
+                SendLatency& l = it->second.chunked ? latency_chunked_ : latency_single_;
+                l.frames++;
+                l.ms_sum += latency_ms;
+                pending_.erase(it);
+            }
+        }
+
+        std::string jstr = extract_detection_json(dr);
+        std::vector<BBox> boxes;
+        if (!jstr.empty()) {
+            boxes = parse_bboxes_from_json(jstr);
+        } else {
+            // as last resort, try parse whole DetectionResult DebugString for bracket arrays
+            boxes = parse_bboxes_from_json(dr.DebugString());
+        }
+
+        Detection det;
+        det.boxes = std::move(boxes);
+        det.frame_id = frame_id;
+        det.latency_ms = latency_ms;
+        det.backend = dr.backend();
+        det.camera_id = dr.camera_id();
+        for (const auto& im : dr.masks()) {
+            Mask m;
+            m.x_min = im.x_min();
+            m.y_min = im.y_min();
+            m.x_max = im.x_max();
+            m.y_max = im.y_max();
+            m.width = static_cast<int>(im.width());
+            m.height = static_cast<int>(im.height());
+            std::vector<uint32_t> counts(im.counts().begin(), im.counts().end());
+            cv::Mat a = rle_decode(counts, m.width, m.height);
+            m.alpha.assign(a.data, a.data + a.total());
+            m.label = im.label();
+            m.score = im.score();
+            det.masks.push_back(std::move(m));
+        }
+        det.timestamp_ms = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+
+        // frame id 가 없으면(구버전 서버) 재정렬 없이 바로 전달
+        if (frame_id == 0) {
+            Deliver({std::move(det)});
+        } else {
+            Deliver(reorder_.Push(frame_id, std::move(det)));
+        }
+        // 빠진 id 를 기다리던 결과는 MonitorLoop 주기를 기다리지 않고 바로 내보냄
+        Deliver(reorder_.Flush());
+    }
+
+    void Deliver(std::vector<Detection> dets) {
+        bool any = false;
+        {
+            std::lock_guard<std::mutex> lk(det_mtx_);
+            for (auto& d : dets) {
+                // 실제로 추론한 빈 결과는 전달 (box predictor 가 track 을 바로 정리).
+                // backend 가 없는 빈 결과는 서버가 처리하지 않은 프레임 (admission drop, 실패) 이므로 버림
+                if (d.boxes.empty() && d.backend.empty()) continue;
+                det_queue_.push_back(std::move(d));
+                any = true;
+            }
+        }
+        if (any) det_cv_.notify_one();
+    }
+
+    // heartbeat 전송, 멈춘 보드 감지/장애 조치, 재연결, 재정렬 timeout 처리
+    // 재정렬 timeout 은 결과가 더 오지 않을 때도 max_wait 근처에서 풀리도록 heartbeat 보다 짧은 주기로 확인
+    void MonitorLoop() {
+        const auto hb_interval = std::chrono::milliseconds(env_int("AIPEX_LB_HEARTBEAT_MS", 500));
+        const auto dead_after = std::chrono::milliseconds(env_int("AIPEX_LB_DEAD_MS", 2000));
+        const auto reconnect_after = std::chrono::milliseconds(env_int("AIPEX_LB_RECONNECT_MS", 3000));
+        const auto tick = std::max(std::chrono::milliseconds(10), std::min(hb_interval, reorder_wait_ / 4));
+        auto last_hb = std::chrono::steady_clock::now();
+        while (running_.load()) {
+            {
+                std::unique_lock<std::mutex> lk(monitor_mtx_);
+                monitor_cv_.wait_for(lk, tick, [this] { return !running_.load(); });
+            }
+            if (!running_.load()) break;
+            Deliver(reorder_.Flush());
+            auto now = std::chrono::steady_clock::now();
+            if (now - last_hb < hb_interval) continue;
+            last_hb = now;
+
+            for (size_t idx : lb_.FindStalled(dead_after)) {
+                Backend* b = BackendAt(idx);
+                if (!b) continue;
+                std::cerr << "[client] board " << b->target << " stopped responding, cancelling stream\n";
+                // 막힌 Write 를 풀어야 하므로 write_mtx 없이 취소
+                Cancel(*b);
+                b->connected.store(false);
+            }
+
+            for (Backend* bp : Backends()) {
+                Backend& b = *bp;
+                if (b.connected.load()) {
+                    SendHeartbeat(b);
+                    continue;
+                }
+                if (lb_.IsHealthy(b.index)) {
+                    // 방금 끊긴 보드: 미완료 프레임을 다른 보드로 넘김
+                    lb_.SetHealthy(b.index, false);
+                    Failover(b);
+                    Close(b, false);
+                } else if (now - b.last_attempt > reconnect_after) {
+                    std::cerr << "[client] reconnecting to " << b.target << "\n";
+                    Open(b);
+                }
             }
+
+            AddDiscoveredBackends();
+            ReportSendLatency();
         }
-        std::cerr << "[client] reader_thread exiting\n";
+    }
+
+    // 스트리밍 중 새로 발견된 보드를 바로 용량에 추가
+    void AddDiscoveredBackends() {
+        for (const auto& ep : GetEndpoints()) {
+            bool known = false;
+            for (Backend* b : Backends()) known = known || b->target == ep;
+            if (known) continue;
+            Backend* b = AddBackend(ep);
+            if (!b) break;
+            std::cerr << "[client] new board discovered: " << ep << "\n";
+            Open(*b);
+        }
+    }
+
+    void Failover(Backend& dead) {
+        auto ids = lb_.TakeOutstanding(dead.index);
+        size_t moved = 0;
+        for (uint64_t id : ids) {
+            std::shared_ptr<const data_types::Command> cmd;
+            {
+                std::lock_guard<std::mutex> lk(pending_mtx_);
+                auto it = pending_.find(id);
+                if (it == pending_.end()) continue;
+                cmd = it->second.cmd;
+            }
+            if (!cmd) continue; // 보관하지 않은 프레임 (보드가 하나였을 때 보낸 것)
+            int idx = lb_.Pick();
+            if (idx < 0) break;
+            Backend* target = BackendAt(static_cast<size_t>(idx));
+            if (target && WriteFrame(*target, *cmd)) {
+                lb_.OnSent(static_cast<size_t>(idx), id);
+                std::lock_guard<std::mutex> lk(pending_mtx_);
+                pending_[id].backend = static_cast<size_t>(idx);
+                moved++;
+            }
+        }
+        {
+            // 재전송하지 못한 프레임은 포기 (재정렬 버퍼가 timeout 후 건너뜀)
+            std::lock_guard<std::mutex> lk(pending_mtx_);
+            for (auto it = pending_.begin(); it != pending_.end();) {
+                if (it->second.backend == dead.index) it = pending_.erase(it);
+                else ++it;
+            }
+        }
+        std::cerr << "[client] failover from " << dead.target << ": " << moved << "/" << ids.size()
+                  << " in-flight frame(s) resent\n";
+    }
+
+    bool WriteTo(Backend& b, const data_types::Command& cmd) {
+        std::lock_guard<std::mutex> lk(b.write_mtx);
+        if (!b.connected.load() || !b.stream) return false;
+        if (!b.stream->Write(cmd)) {
+            b.connected.store(false);
+            return false;
+        }
+        return true;
+    }
+
+    // 프레임 전송. 데이터가 AIPEX_CHUNK_THRESHOLD_KB 를 넘으면 FrameHeader + FrameChunk 들로 나눠 보냄
+    // chunk 마다 write_mtx 를 다시 잡으므로 그 사이에 heartbeat/제어 명령이 끼어들 수 있음
+    // 보드가 합의하지 않은 방식이면 (BGR 미지원 / 분할 미지원) 그 보드에 맞춰 JPEG 한 메시지로 보냄
+    bool WriteFrame(Backend& b, const data_types::Command& cmd) {
+        const auto& cf = cmd.camera_frame();
+        if (cf.format() == "BGR" && !b.raw_frames.load()) {
+            cv::Mat view(cf.height(), cf.width(), CV_8UC3, const_cast<char*>(cf.image_data().data()));
+            thread_local JpegBuffer buf;
+            JpegEncodeOptions opts = jpeg_opts_;
+            if (int q = b.jpeg_quality.load()) opts.quality = q;
+            if (!jpeg_encode(view, buf, opts)) return false;
+            data_types::Command jpeg = cmd;
+            jpeg.mutable_camera_frame()->set_image_data(buf.data(), buf.size());
+            jpeg.mutable_camera_frame()->set_format("JPEG");
+            return WriteFrame(b, jpeg);
+        }
+        const std::string& data = cf.image_data();
+        const size_t chunk_bytes = b.chunk_bytes.load();
+        if (data.size() <= chunk_threshold_ || chunk_bytes == 0) return WriteTo(b, cmd);
+
+        data_types::Command hdr;
+        auto* h = hdr.mutable_frame_header();
+        h->set_total_size(data.size());
+        auto* meta = h->mutable_frame();
+        *meta = cf;
+        meta->clear_image_data();
+        if (!WriteTo(b, hdr)) return false;
+
+        data_types::Command chunk;
+        auto* c = chunk.mutable_frame_chunk();
+        c->set_frame_id(cf.frame_id());
+        for (size_t off = 0; off < data.size(); off += chunk_bytes) {
+            c->set_offset(off);
+            c->set_data(data.data() + off, std::min(chunk_bytes, data.size() - off));
+            if (!WriteTo(b, chunk)) return false;
+        }
+        return true;
+    }
+
+    // 전송 방식(한 메시지 / 분할)별 평균 round trip
+    void ReportSendLatency() {
+        auto now = std::chrono::steady_clock::now();
+        if (now - last_latency_report_ < std::chrono::seconds(10)) return;
+        double secs = std::chrono::duration<double>(now - last_latency_report_).count();
+        last_latency_report_ = now;
+        uint64_t messages = result_messages_.exchange(0, std::memory_order_relaxed);
+        uint64_t batches = result_batches_.exchange(0, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lk(pending_mtx_);
+        auto avg = [](const SendLatency& l) { return l.frames ? l.ms_sum / l.frames : 0.0; };
+        // 결과 메시지 수 대비 결과 수 (서버 결과 묶음 효과) 와 전송 -> 결과 지연
+        uint64_t frames = latency_chunked_.frames + latency_single_.frames;
+        if (frames) {
+            SendLatency all{frames, latency_chunked_.ms_sum + latency_single_.ms_sum};
+            std::cerr << "[results] results/s=" << frames / secs << " messages/s=" << messages / secs
+                      << " batches=" << batches << " avg_ms=" << avg(all) << "\n";
+        }
+        if (latency_chunked_.frames) {
+            std::cerr << "[chunk] chunked frames=" << latency_chunked_.frames << " avg_ms=" << avg(latency_chunked_)
+                      << " single frames=" << latency_single_.frames << " avg_ms=" << avg(latency_single_) << "\n";
+        }
+        latency_chunked_ = latency_single_ = SendLatency{};
+    }
+
+    void SendHeartbeat(Backend& b) {
+        data_types::Command cmd;
+        auto ts = cmd.mutable_heartbeat()->mutable_timestamp();
+        auto now = std::chrono::system_clock::now().time_since_epoch();
+        auto secs = std::chrono::duration_cast<std::chrono::seconds>(now);
+        ts->set_seconds(secs.count());
+        ts->set_nanos(static_cast<int32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - secs).count()));
+        WriteTo(b, cmd);
+    }
+
+    // 제어 명령은 가장 적합한 보드 하나로만 보냄
+    Backend* Primary() {
+        int idx = lb_.Pick();
+        return idx < 0 ? nullptr : BackendAt(static_cast<size_t>(idx));
     }
 
     bool Send(const std::string& request_data) {
@@ -256,62 +696,124 @@ public:
             det.set_json(request_data);
             cmd.mutable_detection_result()->CopyFrom(det);
         }
-        auto hb = cmd.mutable_heartbeat();
-        google::protobuf::Timestamp ts;
-        ts.set_seconds(static_cast<int64_t>(std::time(nullptr)));
-        ts.set_nanos(0);
-        hb->mutable_timestamp()->CopyFrom(ts);
+        // heartbeat 는 MonitorLoop 가 별도로 보냄 (oneof 이므로 여기서 덮어쓰면 명령이 사라짐)
 
-        std::lock_guard<std::mutex> lk(writer_mtx_);
-        if (!stream_) return false;
-        bool ok = stream_->Write(cmd);
-        if (!ok) {
-            running_.store(false);
-            return false;
-        }
-        return true;
+        Backend* b = Primary();
+        if (!b) return false;
+        return WriteTo(*b, cmd);
     }
 
-    bool SendFrameInternal(const cv::Mat& frame) {
+    // 운영 프로필은 보드마다 적용되므로 연결된 모든 보드에 보냄
+    bool SetProfile(const std::string& name) {
         if (!running_.load()) return false;
         data_types::Command cmd;
-        auto cf = cmd.mutable_camera_frame();
-        std::vector<uint8_t> buf;
-        cv::imencode(".jpg", frame, buf);
-        cf->set_image_data(buf.data(), buf.size());
+        cmd.mutable_control_action()->set_action(data_types::ControlAction::SET_PROFILE);
+        cmd.mutable_control_action()->set_profile(name);
+        bool any = false;
+        for (Backend* b : Backends()) any = WriteTo(*b, cmd) || any;
+        return any;
+    }
+
+    bool SendFrameInternal(const cv::Mat& frame, uint32_t camera_id) {
+        if (!running_.load()) return false;
+        // frame_id 는 호출 순서대로 부여 (인코딩이 병렬이라 전송 순서는 바뀔 수 있음 -> 재정렬 버퍼가 처리)
+        uint64_t frame_id = next_frame_id_.fetch_add(1);
+        auto now = std::chrono::system_clock::now();
+
+        // JPEG 인코딩 + Write 는 공용 executor 에서. 동시 인코딩이 상한에 닿으면 호출 스레드에서 직접 처리
+        {
+            std::lock_guard<std::mutex> lk(encode_mtx_);
+            if (encode_inflight_ < max_encode_inflight_) {
+                encode_inflight_++;
+                cv::Mat copy = frame.clone(); // 캡처 버퍼는 다음 프레임에서 재사용됨
+                Executor::Instance().Submit([this, copy, frame_id, camera_id, now] {
+                    EncodeAndSend(copy, frame_id, camera_id, now);
+                    std::lock_guard<std::mutex> lk2(encode_mtx_);
+                    encode_inflight_--;
+                    encode_cv_.notify_all();
+                }, Executor::Priority::NORMAL);
+                return true;
+            }
+        }
+        return EncodeAndSend(frame, frame_id, camera_id, now);
+    }
+
+    bool EncodeAndSend(const cv::Mat& frame, uint64_t frame_id, uint32_t camera_id,
+                       std::chrono::system_clock::time_point now) {
+        if (!running_.load()) return false;
+        auto cmd = std::make_shared<data_types::Command>();
+        auto cf = cmd->mutable_camera_frame();
+        if (send_raw_ && frame.type() == CV_8UC3) {
+            // 무손실/인코딩 없음. 크기가 커서 보통 분할 전송됨
+            cv::Mat cont = frame.isContinuous() ? frame : frame.clone();
+            cf->set_image_data(cont.data, cont.total() * cont.elemSize());
+            cf->set_format("BGR");
+        } else {
+            // 인코딩 스레드마다 출력 버퍼 재사용
+            thread_local JpegBuffer buf;
+            JpegEncodeOptions opts = jpeg_opts_;
+            if (int q = encode_quality_.load(std::memory_order_relaxed)) opts.quality = q;
+            if (!jpeg_encode(frame, buf, opts)) return running_.load();
+            cf->set_image_data(buf.data(), buf.size());
+            cf->set_format("JPEG");
+        }
         cf->set_width(frame.cols);
         cf->set_height(frame.rows);
-        cf->set_format("JPEG");
         auto ts = cf->mutable_timestamp();
-        auto now = std::chrono::system_clock::now();
-        ts->set_seconds(std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count());
-
-        std::lock_guard<std::mutex> lk(writer_mtx_);
-        if (!stream_) return false;
-        bool ok = stream_->Write(cmd);
-        if (!ok) {
-            std::cerr << "[client] Write(frame) failed\n";
-            running_.store(false);
-            return false;
+        auto since = now.time_since_epoch();
+        auto secs = std::chrono::duration_cast<std::chrono::seconds>(since);
+        ts->set_seconds(secs.count());
+        ts->set_nanos(static_cast<int32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(since - secs).count()));
+        cf->set_frame_id(frame_id);
+        cf->set_camera_id(camera_id);
+        cf->set_low_priority(low_priority_);
+
+        // 재전송할 다른 보드가 없으면 payload 를 보관하지 않음
+        std::shared_ptr<const data_types::Command> retained;
+        if (BackendCount() > 1) retained = cmd;
+        // 보낼 보드 선택. 쓰기 실패 시 다른 보드로 한 번 더 시도
+        // (실패한 보드는 MonitorLoop 가 failover/close 할 때까지 healthy 로 남아 있으므로 직접 제외)
+        int failed = -1;
+        for (int attempt = 0; attempt < 2; ++attempt) {
+            int idx = lb_.Pick(failed);
+            if (idx < 0) break;
+            Backend* b = BackendAt(static_cast<size_t>(idx));
+            if (!b) break;
+            const bool chunked = cf->image_data().size() > chunk_threshold_ && b->chunk_bytes.load() > 0;
+            {
+                std::lock_guard<std::mutex> lk(pending_mtx_);
+                pending_[frame_id] = PendingFrame{static_cast<size_t>(idx), retained, chunked};
+            }
+            lb_.OnSent(static_cast<size_t>(idx), frame_id);
+            if (WriteFrame(*b, *cmd)) {
+                sent_frames_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+            std::cerr << "[client] Write(frame) failed on " << b->target << "\n";
+            lb_.OnFailed(static_cast<size_t>(idx), frame_id);
+            failed = idx;
+            std::lock_guard<std::mutex> lk(pending_mtx_);
+            pending_.erase(frame_id);
         }
-        sent_frames_.fetch_add(1, std::memory_order_relaxed);
-        return true;
+        // 모든 보드가 죽어도 스트리밍 자체는 유지 (MonitorLoop 가 재연결)
+        return running_.load();
     }
 
     void Stop() {
         if (!running_.exchange(false)) return;
-        if (context_) context_->TryCancel();
+        // 멈춘 보드로의 Write 에 막힌 인코딩 작업/MonitorLoop 를 풀기 위해 먼저 모든 스트림을 취소
+        // (멈춘 보드를 취소하던 MonitorLoop 는 이제 끝나므로)
+        for (Backend* b : Backends()) Cancel(*b);
         {
-            std::lock_guard<std::mutex> lk(writer_mtx_);
-            if (stream_) {
-                stream_->WritesDone();
-                grpc::Status s = stream_->Finish();
-                (void)s;
-            }
+            // 인코딩 중인 작업이 backends_ 를 참조하므로 먼저 끝나길 기다림
+            std::unique_lock<std::mutex> lk(encode_mtx_);
+            encode_cv_.wait(lk, [this] { return encode_inflight_ == 0; });
         }
-        if (reader_thread_.joinable()) reader_thread_.join();
-        stream_.reset();
-        context_.reset();
+        monitor_cv_.notify_all();
+        if (monitor_thread_.joinable()) monitor_thread_.join();
+        std::lock_guard<std::mutex> lk(backends_mtx_);
+        for (auto& b : backends_) Close(*b, true);
+        backends_.clear();
     }
 
     // Pop all queued detections
@@ -322,45 +824,129 @@ public:
         return out;
     }
 
-    // Pop one remote frame (thread-safe)
-    bool PopRemoteFrame(cv::Mat &out) {
+    // 지금 표시할 원격 프레임 (카메라별). 새로 재생 시각이 된 프레임이 있으면 교체, 없으면 직전 프레임 유지
+    bool DueRemoteFrame(cv::Mat &out, uint32_t camera_id) {
+        auto now = std::chrono::steady_clock::now();
         std::lock_guard<std::mutex> lk(frame_mtx_);
-        if (frame_queue_.empty()) return false;
-        out = frame_queue_.front();
-        frame_queue_.erase(frame_queue_.begin());
+        RemoteView& v = RemoteViewLocked(camera_id);
+        cv::Mat due;
+        if (v.playout.Due(now, due)) {
+            v.current = due;
+            v.current_at = now;
+        }
+        if (now - v.last_report >= std::chrono::seconds(10)) {
+            auto s = v.playout.GetStats();
+            if (s.released || s.buffered) {
+                std::cerr << "[playout] camera=" << camera_id << " released=" << s.released << " skipped=" << s.skipped
+                          << " late=" << s.late << " target_delay_ms=" << s.target_delay_ms
+                          << " jitter_ms=" << s.jitter_ms << " buffered=" << s.buffered << "\n";
+            }
+            v.last_report = now;
+        }
+        if (v.current.empty() || now - v.current_at > playout_hold_) return false;
+        out = v.current;
         return true;
     }
 
+    void SetEndpoints(const std::vector<std::string>& endpoints) {
+        if (endpoints.empty()) return; // 탐색이 일시적으로 비어도 마지막 목록 유지
+        std::lock_guard<std::mutex> lk(endpoints_mtx_);
+        endpoints_ = endpoints;
+    }
+
+    std::vector<std::string> GetEndpoints() {
+        std::lock_guard<std::mutex> lk(endpoints_mtx_);
+        return endpoints_;
+    }
+
+    std::vector<LoadBalancer::BackendStats> GetBackendStats() const { return lb_.Stats(); }
+
     uint64_t GetSentFrames() const { return sent_frames_.load(std::memory_order_relaxed); }
     uint64_t GetReceivedResults() const { return received_results_.load(std::memory_order_relaxed); }
 
     // members
-    std::shared_ptr<grpc::Channel> channel_;
-    std::unique_ptr<compute::ComputeService::Stub> stub_;
-    std::unique_ptr<grpc::ClientContext> context_;
-    std::unique_ptr<grpc::ClientReaderWriter<data_types::Command, data_types::ServerMessage>> stream_;
-    std::thread reader_thread_;
     std::atomic<bool> running_;
-    std::mutex writer_mtx_;
-
     std::atomic<uint64_t> sent_frames_;
     std::atomic<uint64_t> received_results_;
+    std::atomic<uint64_t> result_messages_{0}; // detection_result / result_batch 메시지 수 (ReportSendLatency 구간)
+    std::atomic<uint64_t> result_batches_{0};
+    std::atomic<uint64_t> next_frame_id_{1};
+    // AIPEX_STREAM_PRIORITY=low: 서버 가속기가 밀리면 이 스트림 프레임은 CPU 모델로 처리돼도 됨
+    const bool low_priority_ = env_str("AIPEX_STREAM_PRIORITY") == "low";
+
+    std::mutex encode_mtx_;
+    std::condition_variable encode_cv_;
+    size_t encode_inflight_ = 0;
+    const size_t max_encode_inflight_ = static_cast<size_t>(std::max(0, env_int("AIPEX_EXEC_ENCODE_INFLIGHT", 2)));
+
+    LoadBalancer lb_;
+    const std::chrono::milliseconds reorder_wait_; // AIPEX_LB_REORDER_MS
+    ReorderBuffer<Detection> reorder_;
+    std::mutex backends_mtx_;
+    std::vector<std::unique_ptr<Backend>> backends_;
+    const size_t max_backends_ = static_cast<size_t>(std::max(1, env_int("AIPEX_LB_MAX_BACKENDS", 4)));
+
+    std::mutex pending_mtx_;
+    std::map<uint64_t, PendingFrame> pending_;
+    struct SendLatency {
+        uint64_t frames = 0;
+        double ms_sum = 0.0;
+    };
+    SendLatency latency_chunked_, latency_single_; // pending_mtx_ 로 보호
+    std::chrono::steady_clock::time_point last_latency_report_ = std::chrono::steady_clock::now();
+
+    const JpegEncodeOptions jpeg_opts_ = JpegEncodeOptions::FromEnv();
+    std::atomic<int> encode_quality_{0}; // UpdateEncodeQuality
+    // AIPEX_FRAME_FORMAT=raw: JPEG 대신 BGR 그대로 전송
+    const bool send_raw_ = env_str("AIPEX_FRAME_FORMAT") == "raw";
+    // gRPC 기본 메시지 상한(4MB) 보다 충분히 작게. 큰 메시지 하나가 뒤의 heartbeat/결과를 막지 않도록
+    const size_t chunk_threshold_ = static_cast<size_t>(std::max(1, env_int("AIPEX_CHUNK_THRESHOLD_KB", 1024))) * 1024;
+    const size_t chunk_bytes_ = static_cast<size_t>(std::max(16, env_int("AIPEX_CHUNK_KB", 256))) * 1024;
+
+    std::thread monitor_thread_;
+    std::mutex monitor_mtx_;
+    std::condition_variable monitor_cv_;
 
     // detection queue
     std::mutex det_mtx_;
     std::condition_variable det_cv_;
     std::vector<Detection> det_queue_;
 
-    // frame queue
+    // remote frame playout
+    static PlayoutBuffer<cv::Mat>::Options PlayoutOptionsFromEnv() {
+        PlayoutBuffer<cv::Mat>::Options o;
+        o.min_delay = std::chrono::milliseconds(std::max(0, env_int("AIPEX_PLAYOUT_MIN_DELAY_MS", 20)));
+        o.max_delay = std::chrono::milliseconds(std::max(0, env_int("AIPEX_PLAYOUT_MAX_DELAY_MS", 300)));
+        return o;
+    }
+    // 카메라마다 캡처 간격/지연이 달라 playout 버퍼를 따로 둠
+    struct RemoteView {
+        PlayoutBuffer<cv::Mat> playout{PlayoutOptionsFromEnv()};
+        cv::Mat current;
+        std::chrono::steady_clock::time_point current_at;
+        std::chrono::steady_clock::time_point last_report;
+    };
+    RemoteView& RemoteViewLocked(uint32_t camera_id) {
+        auto& v = remote_views_[camera_id];
+        if (!v) v = std::make_unique<RemoteView>();
+        return *v;
+    }
     std::mutex frame_mtx_;
-    std::vector<cv::Mat> frame_queue_;
+    std::map<uint32_t, std::unique_ptr<RemoteView>> remote_views_; // frame_mtx_ 로 보호
+    const std::chrono::milliseconds playout_hold_{std::max(0, env_int("AIPEX_PLAYOUT_HOLD_MS", 500))};
+
+    // endpoints (discovery)
+    std::mutex endpoints_mtx_;
+    std::vector<std::string> endpoints_;
+    std::shared_ptr<grpc::Channel> initial_channel_;
+    std::string initial_target_;
 };
 
 // --- forwarding implementations ---
 
 GrpcClient::GrpcClient(const std::string& server_address)
   : channel_(grpc::CreateChannel(server_address, grpc::InsecureChannelCredentials())),
-    impl_(std::make_unique<Impl>(channel_))
+    impl_(std::make_unique<Impl>(channel_, server_address))
 {}
 
 GrpcClient::~GrpcClient() { if (impl_) impl_->Stop(); }
@@ -368,7 +954,15 @@ GrpcClient::~GrpcClient() { if (impl_) impl_->Stop(); }
 bool GrpcClient::StartStreaming() { return impl_ ? impl_->Start() : false; }
 void GrpcClient::StopStreaming() { if (impl_) impl_->Stop(); }
 bool GrpcClient::SendRequest(const std::string& request_data) { return impl_ ? impl_->Send(request_data) : false; }
-bool GrpcClient::SendFrame(const cv::Mat& frame) { return impl_ ? impl_->SendFrameInternal(frame) : false; }
+bool GrpcClient::SendFrame(const cv::Mat& frame, uint32_t camera_id) {
+    return impl_ ? impl_->SendFrameInternal(frame, camera_id) : false;
+}
+bool GrpcClient::SetProfile(const std::string& name) { return impl_ ? impl_->SetProfile(name) : false; }
+void GrpcClient::SetEndpoints(const std::vector<std::string>& endpoints) { if (impl_) impl_->SetEndpoints(endpoints); }
+std::vector<std::string> GrpcClient::GetEndpoints() { return impl_ ? impl_->GetEndpoints() : std::vector<std::string>{}; }
+std::vector<LoadBalancer::BackendStats> GrpcClient::GetBackendStats() {
+    return impl_ ? impl_->GetBackendStats() : std::vector<LoadBalancer::BackendStats>{};
+}
 
 uint64_t GrpcClient::GetSentFrames() { return impl_ ? impl_->GetSentFrames() : 0; }
 uint64_t GrpcClient::GetReceivedResults() { return impl_ ? impl_->GetReceivedResults() : 0; }
@@ -376,4 +970,6 @@ uint64_t GrpcClient::GetReceivedResults() { return impl_ ? impl_->GetReceivedRes
 std::vector<GrpcClient::Detection> GrpcClient::PopDetections() {
     return impl_ ? impl_->PopDetections() : std::vector<Detection>{};
 }
-bool GrpcClient::PopRemoteFrame(cv::Mat &out) { return impl_ ? impl_->PopRemoteFrame(out) : false; }
\ No newline at end of file
+bool GrpcClient::DueRemoteFrame(cv::Mat &out, uint32_t camera_id) {
+    return impl_ ? impl_->DueRemoteFrame(out, camera_id) : false;
+}
\ No newline at end of file
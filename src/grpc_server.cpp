@@ -1,11 +1,15 @@
 #include "grpc_server.h"
+#include "env_config.h"
 #include "service_impl.h"
+#include <algorithm>
 #include <iostream>
 #include <chrono>
+#include <cstdlib>
 #include <thread>
 
 GrpcServer::GrpcServer(const std::string& server_address)
-    : server_address_(server_address), server_(nullptr), cq_(nullptr)
+    : server_address_(server_address), server_(nullptr), cq_(nullptr),
+      shutdown_budget_(std::max(0, env_int("AIPEX_SHUTDOWN_MS", 80)))
 {
     std::cerr << "[grpc] GrpcServer constructed for " << server_address_ << "\n";
 }
@@ -15,63 +19,38 @@ GrpcServer::~GrpcServer() {
 }
 
 void GrpcServer::Shutdown() {
-    // 한 번만 동작하도록 보호
-    bool expected = false;
-    if (!shutting_down_.compare_exchange_strong(expected, true)) {
-        std::cerr << "[grpc] Shutdown() already in progress/finished, returning\n";
-        return;
-    }
+    // 한 번만 동작하도록 보호 (Start 의 Wait 반환 후 호출과 외부 호출이 겹칠 수 있음)
+    std::lock_guard<std::mutex> lk(shutdown_mutex_);
+    if (!server_ || shutting_down_.exchange(true)) return;
 
-    std::cerr << "[grpc] Shutdown() called\n";
+    std::cerr << "[grpc] Shutdown() called (budget " << shutdown_budget_.count() << "ms)\n";
     auto start = std::chrono::steady_clock::now();
+    auto deadline = start + shutdown_budget_;
 
-    // 1) 서버가 있으면 수신 중지 요청
-    if (server_) {
-        std::cerr << "[grpc] calling server_->Shutdown()\n";
-        server_->Shutdown();
-    }
+    // 1) 새 스트림/새 프레임 거절. 열린 스트림은 아직 취소하지 않음 (결과를 보낼 수 있도록)
+    service_.BeginShutdown(deadline);
 
-    // 2) completion queue 종료 요청
-    if (cq_) {
-        std::cerr << "[grpc] calling cq_->Shutdown()\n";
-        cq_->Shutdown();
-    }
+    // 2) 처리 중인 프레임이 끝나 결과가 나가기를 budget 까지 기다림
+    size_t running = service_.WaitDrained(deadline);
 
-    // 3) cq_thread 안전하게 join (timeout fallback)
-    if (cq_thread_.joinable()) {
-        std::cerr << "[grpc] waiting for cq_thread_ to finish (timeout 5s)\n";
-        using namespace std::chrono_literals;
-        auto start = std::chrono::steady_clock::now();
-        while (!cq_thread_exited_) {
-            std::this_thread::sleep_for(50ms);
-            if (std::chrono::steady_clock::now() - start > 3s) {
-                std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
-                std::cerr << "[grpc] cq_thread_ did not exit in time (" << elapsed.count() << "s), detaching to avoid hang\n";
-                try {
-                    cq_thread_.detach();
-                } catch (...) {
-                    std::cerr << "[grpc] detach failed\n";
-                }
-                break;
-            }
-        }
-        // if the thread signalled exit, join it
-        if (cq_thread_.joinable() && cq_thread_exited_) {
-            try { cq_thread_.join(); }
-            catch (...) { std::cerr << "[grpc] join failed\n"; }
-        }
-    }
+    // 3) 열린 스트림 취소. Read 에서 막힌 handler 가 빠져나와 반환할 때까지 남은 budget 안에서 기다림
+    service_.CancelAll();
+    size_t left = service_.WaitIdle(deadline);
 
-    // 4) release resources
-    if (server_) { server_.reset(); std::cerr << "[grpc] server_ reset\n"; }
-    if (cq_)    { cq_.reset();    std::cerr << "[grpc] cq_ reset\n"; }
+    // 4) 수신 중지. deadline 이 지나면 gRPC 가 남은 호출을 취소하고, 모든 handler 가 반환하면 돌아옴
+    auto remaining = std::max(std::chrono::steady_clock::duration::zero(), deadline - std::chrono::steady_clock::now());
+    server_->Shutdown(std::chrono::system_clock::now() +
+                      std::chrono::duration_cast<std::chrono::system_clock::duration>(remaining));
 
+    // 5) completion queue 를 비우고 스레드 join. 서버가 멈췄으므로 Next 가 곧 false 를 반환함
+    if (cq_) cq_->Shutdown();
+    if (cq_thread_.joinable()) cq_thread_.join();
 
-    // 완료까지 오기에 걸리는 시간
-    
-    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
-    std::cerr << "[grpc] Shutdown() took " << elapsed.count() << " seconds\n";
-    std::cerr << "[grpc] Shutdown() complete\n";
+    // server_/cq_ 객체는 Start 스레드가 Wait 에서 빠져나온 뒤에도 참조할 수 있으므로 다음 Start 또는 소멸 시 해제
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    std::cerr << "[grpc] Shutdown() took " << elapsed.count() << " ms"
+              << (running ? " (" + std::to_string(running) + " frame(s) still running at budget)" : std::string())
+              << (left ? " (" + std::to_string(left) + " stream(s) still open at budget)" : std::string()) << "\n";
 }
 
 void GrpcServer::Start() {
@@ -80,6 +59,15 @@ void GrpcServer::Start() {
 }
 
 void GrpcServer::Start(std::promise<void>& ready) {
+    // 재시작: 이전 실행의 서버/큐 정리 (이전 Start 스레드는 호출자가 join 한 상태)
+    {
+        std::lock_guard<std::mutex> lk(shutdown_mutex_);
+        server_.reset();
+        cq_.reset();
+        shutting_down_ = false;
+    }
+    service_.Resume();
+
     grpc::ServerBuilder builder;
 
     // 1) 포트 바인딩 시도 및 확인
@@ -99,14 +87,12 @@ void GrpcServer::Start(std::promise<void>& ready) {
         return;
     }
 
-    // 4) CQ 폴링 스레드: 예외/종료 플래그 처리
-    cq_thread_exited_ = false;
-    shutting_down_ = false; // reset in case reused
+    // 4) CQ 폴링 스레드 (예외 처리)
     cq_thread_ = std::thread([this]() {
         void* tag = nullptr;
         bool ok = false;
         try {
-            while (cq_ && cq_->Next(&tag, &ok)) {
+            while (cq_->Next(&tag, &ok)) {
                 (void)tag; (void)ok;
                 // 실제 async handling 없으면 no-op
             }
@@ -115,7 +101,6 @@ void GrpcServer::Start(std::promise<void>& ready) {
         } catch (...) {
             std::cerr << "[grpc] unknown exception in cq thread\n";
         }
-        cq_thread_exited_ = true;
         std::cerr << "[grpc] cq thread exiting\n";
     });
 
@@ -123,6 +108,6 @@ void GrpcServer::Start(std::promise<void>& ready) {
     try { ready.set_value(); } catch(...) {}
     server_->Wait();
 
-    // Wait 반환 시 cleanup
+    // Wait 반환 시 cleanup (외부에서 Shutdown 한 경우는 바로 반환)
     Shutdown();
-}
\ No newline at end of file
+}
@@ -0,0 +1,272 @@
+#include "hailo_classifier.h"
+#include "env_config.h"
+#include "preprocess.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+using namespace hailort;
+
+CropClassifier::Options CropClassifier::FromEnv() {
+    Options o;
+    const char* hef = std::getenv("AIPEX_CLS_HEF");
+    if (hef) o.hef_path = hef;
+    const char* labels = std::getenv("AIPEX_CLS_LABELS");
+    if (labels) o.labels_path = labels;
+    const char* thr = std::getenv("AIPEX_CLS_SCORE_THRESHOLD");
+    if (thr && *thr) o.score_threshold = static_cast<float>(std::atof(thr));
+    o.max_crops_per_frame = static_cast<size_t>(std::max(0, env_int("AIPEX_CLS_MAX_CROPS", static_cast<int>(o.max_crops_per_frame))));
+    o.batch_size = static_cast<uint16_t>(std::clamp(env_int("AIPEX_CLS_BATCH", o.batch_size), 1, 64));
+    o.batch_wait = std::chrono::milliseconds(env_int("AIPEX_CLS_BATCH_WAIT_MS", static_cast<int>(o.batch_wait.count())));
+    return o;
+}
+
+CropClassifier::CropClassifier(Options opts) : opts_(std::move(opts)) {
+    batch_.batch_size = opts_.batch_size;
+    batch_.max_wait = opts_.batch_wait;
+    if (!opts_.labels_path.empty()) {
+        std::ifstream in(opts_.labels_path);
+        std::string line;
+        while (std::getline(in, line)) {
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            labels_.push_back(line);
+        }
+    }
+}
+
+CropClassifier::~CropClassifier() {
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        running_ = false;
+    }
+    cv_.notify_all();
+    if (worker_.joinable()) worker_.join();
+    for (auto& j : queue_) j->result.set_value({-1, 0.f});
+    configured_.reset();
+    model_.reset();
+}
+
+int CropClassifier::Init(VDevice& vdevice, std::shared_timed_mutex* device_rw) {
+    device_rw_ = device_rw;
+    auto model_exp = vdevice.create_infer_model(opts_.hef_path);
+    if (!model_exp) {
+        std::cerr << "[cls] Failed to create classifier model: " << model_exp.status() << "\n";
+        return -1;
+    }
+    model_ = model_exp.release();
+    model_->set_batch_size(opts_.batch_size);
+
+    auto in = model_->input();
+    auto out = model_->output();
+    if (!in || !out) {
+        std::cerr << "[cls] classifier must have exactly one input and one output\n";
+        return -1;
+    }
+    out->set_format_type(HAILO_FORMAT_TYPE_FLOAT32);
+    input_name_ = in->name();
+    output_name_ = out->name();
+    in_h_ = static_cast<int>(in->shape().height);
+    in_w_ = static_cast<int>(in->shape().width);
+    in_size_ = in->get_frame_size();
+    out_size_ = out->get_frame_size();
+    if (in_size_ != static_cast<size_t>(in_w_) * in_h_ * 3) {
+        std::cerr << "[cls] classifier input must be HxWx3 uint8 (frame size " << in_size_ << ")\n";
+        return -1;
+    }
+
+    auto configured_exp = model_->configure();
+    if (!configured_exp) {
+        std::cerr << "[cls] Failed to configure classifier: " << configured_exp.status() << "\n";
+        return -1;
+    }
+    configured_ = std::make_shared<ConfiguredInferModel>(configured_exp.release());
+
+    running_ = true;
+    ready_.store(true, std::memory_order_release);
+    worker_ = std::thread(&CropClassifier::WorkerLoop, this);
+    std::cerr << "[cls] classifier ready: " << opts_.hef_path << " input=" << in_w_ << "x" << in_h_
+              << " classes=" << out_size_ / sizeof(float) << " batch=" << opts_.batch_size << "\n";
+    return 0;
+}
+
+void CropClassifier::Shutdown() {
+    ready_.store(false, std::memory_order_release);
+    std::deque<std::unique_ptr<Job>> dropped;
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        dropped.swap(queue_);
+    }
+    for (auto& j : dropped) j->result.set_value({-1, 0.f});
+    // device_rw 를 exclusive 로 잡고 있으므로 실행 중인 batch 는 없음
+    configured_.reset();
+    model_.reset();
+}
+
+void CropClassifier::Classify(const cv::Mat& frame, std::vector<Crop>& crops) {
+    if (!Ready() || frame.empty()) return;
+    auto t0 = std::chrono::steady_clock::now();
+
+    // 점수 높은 검출부터 상한 개수까지
+    std::vector<size_t> order;
+    for (size_t i = 0; i < crops.size(); ++i) {
+        if (crops[i].det_score >= opts_.score_threshold) order.push_back(i);
+    }
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return crops[a].det_score > crops[b].det_score; });
+    size_t skipped = 0;
+    if (order.size() > opts_.max_crops_per_frame) {
+        skipped = order.size() - opts_.max_crops_per_frame;
+        order.resize(opts_.max_crops_per_frame);
+    }
+
+    std::vector<std::pair<size_t, std::future<std::pair<int, float>>>> pending;
+    {
+        std::vector<std::unique_ptr<Job>> jobs;
+        for (size_t idx : order) {
+            const auto& c = crops[idx];
+            cv::Rect r(cv::Point(static_cast<int>(c.x_min * frame.cols), static_cast<int>(c.y_min * frame.rows)),
+                       cv::Point(static_cast<int>(std::ceil(c.x_max * frame.cols)), static_cast<int>(std::ceil(c.y_max * frame.rows))));
+            r &= cv::Rect(0, 0, frame.cols, frame.rows);
+            if (r.area() <= 0) continue;
+
+            // crop+resize+BGR->RGB 한 번 순회: ROI view 에서 입력 버퍼로 바로 (중간 crop/resize 복사 없음)
+            auto job = std::make_unique<Job>();
+            job->input.resize(in_size_);
+            preprocess_resize_rgb(frame(r), job->input.data(), in_w_, in_h_);
+            pending.emplace_back(idx, job->result.get_future());
+            jobs.push_back(std::move(job));
+        }
+        if (jobs.empty()) {
+            Account(0, skipped, 0.0);
+            return;
+        }
+        std::lock_guard<std::mutex> lk(mtx_);
+        auto now = std::chrono::steady_clock::now();
+        for (auto& j : jobs) {
+            j->enqueued = now;
+            queue_.push_back(std::move(j));
+        }
+    }
+    cv_.notify_one();
+
+    for (auto& p : pending) {
+        auto res = p.second.get();
+        if (res.first < 0) continue;
+        Crop& c = crops[p.first];
+        c.label = static_cast<size_t>(res.first) < labels_.size() ? labels_[res.first] : "cls" + std::to_string(res.first);
+        c.score = res.second;
+        c.classified = true;
+    }
+    Account(pending.size(), skipped,
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count());
+}
+
+void CropClassifier::SetDispatchBatch(size_t n) {
+    const size_t size = n == 0 ? opts_.batch_size : std::min<size_t>(n, opts_.batch_size);
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        if (batch_.batch_size == size) return;
+        batch_.batch_size = size;
+    }
+    cv_.notify_one(); // 줄어든 batch 로 이미 찬 queue 를 바로 보냄
+    std::cerr << "[cls] dispatch batch=" << size << " (model batch " << opts_.batch_size << ")\n";
+}
+
+void CropClassifier::WorkerLoop() {
+    std::unique_lock<std::mutex> lk(mtx_);
+    while (true) {
+        cv_.wait(lk, [this] { return !running_ || !queue_.empty(); });
+        if (!running_) break;
+        // batch 가 차거나 대기 시간이 지날 때까지 다른 프레임의 crop 을 모음
+        const auto oldest = queue_.front()->enqueued;
+        if (!batch_.ShouldDispatch(queue_.size(), oldest, std::chrono::steady_clock::now())) {
+            cv_.wait_until(lk, batch_.Deadline(oldest), [this] { return !running_ || queue_.size() >= batch_.batch_size; });
+            if (!running_) break;
+        }
+        std::vector<std::unique_ptr<Job>> batch;
+        while (!queue_.empty() && batch.size() < batch_.batch_size) {
+            batch.push_back(std::move(queue_.front()));
+            queue_.pop_front();
+        }
+        lk.unlock();
+        RunBatch(batch);
+        lk.lock();
+    }
+}
+
+void CropClassifier::RunBatch(std::vector<std::unique_ptr<Job>>& batch) {
+    auto fail_all = [&](const char* what, hailo_status st) {
+        std::cerr << "[cls] " << what << ": " << st << "\n";
+        for (auto& j : batch) j->result.set_value({-1, 0.f});
+    };
+
+    // 장치 재생성과 겹치지 않도록 batch 실행 동안 shared lock. 재생성으로 닫힌 모델이면 실행하지 않음
+    std::shared_lock<std::shared_timed_mutex> rd;
+    if (device_rw_) rd = std::shared_lock<std::shared_timed_mutex>(*device_rw_);
+    if (!Ready()) return fail_all("classifier closed by device reset", HAILO_SUCCESS);
+
+    std::vector<std::vector<float>> outputs(batch.size(), std::vector<float>(out_size_ / sizeof(float)));
+    std::vector<ConfiguredInferModel::Bindings> bindings;
+    bindings.reserve(batch.size());
+    for (size_t i = 0; i < batch.size(); ++i) {
+        auto b_exp = configured_->create_bindings();
+        if (!b_exp) return fail_all("Failed to create bindings", b_exp.status());
+        auto b = b_exp.release();
+        hailo_status st = b.input(input_name_)->set_buffer(MemoryView(batch[i]->input.data(), batch[i]->input.size()));
+        if (st == HAILO_SUCCESS) st = b.output(output_name_)->set_buffer(MemoryView(outputs[i].data(), out_size_));
+        if (st != HAILO_SUCCESS) return fail_all("Failed to set buffers", st);
+        bindings.push_back(std::move(b));
+    }
+
+    // crop 전체를 한 번의 비동기 batch 요청으로 제출
+    hailo_status st = configured_->wait_for_async_ready(std::chrono::milliseconds(1000), static_cast<uint32_t>(bindings.size()));
+    if (st != HAILO_SUCCESS) return fail_all("Device not ready", st);
+    auto job_exp = configured_->run_async(bindings);
+    if (!job_exp) return fail_all("run_async failed", job_exp.status());
+    auto job = job_exp.release();
+    st = job.wait(std::chrono::milliseconds(1000));
+    if (st != HAILO_SUCCESS) return fail_all("Classifier inference failed", st);
+
+    for (size_t i = 0; i < batch.size(); ++i) {
+        batch[i]->result.set_value(Decode(outputs[i].data(), outputs[i].size()));
+    }
+    std::lock_guard<std::mutex> lk(stats_mtx_);
+    batches_++;
+    batched_crops_ += batch.size();
+}
+
+std::pair<int, float> CropClassifier::Decode(const float* logits, size_t n) const {
+    if (n == 0) return {-1, 0.f};
+    size_t best = static_cast<size_t>(std::max_element(logits, logits + n) - logits);
+    // 출력이 이미 확률(합 1)이면 그대로, 아니면 softmax
+    float sum = 0.f;
+    bool in_range = true;
+    for (size_t i = 0; i < n; ++i) {
+        sum += logits[i];
+        in_range = in_range && logits[i] >= 0.f && logits[i] <= 1.f;
+    }
+    if (in_range && std::fabs(sum - 1.f) < 0.05f) return {static_cast<int>(best), logits[best]};
+    float denom = 0.f;
+    for (size_t i = 0; i < n; ++i) denom += std::exp(logits[i] - logits[best]);
+    return {static_cast<int>(best), 1.f / denom};
+}
+
+void CropClassifier::Account(size_t frame_crops, size_t skipped, double ms) {
+    std::lock_guard<std::mutex> lk(stats_mtx_);
+    frames_++;
+    crops_ += frame_crops;
+    skipped_ += skipped;
+    if (frame_crops > 0) {
+        total_ms_ += ms;
+        ewma_ms_ = ewma_ms_ <= 0.0 ? ms : 0.9 * ewma_ms_ + 0.1 * ms;
+    }
+    if (frames_ % 100 == 0) {
+        std::cerr << "[cls] frames=" << frames_
+                  << " crops/frame=" << static_cast<double>(crops_) / frames_
+                  << " skipped=" << skipped_
+                  << " avg_batch=" << (batches_ ? static_cast<double>(batched_crops_) / batches_ : 0.0)
+                  << " extra_ms/frame=" << total_ms_ / frames_
+                  << " ewma_ms=" << ewma_ms_ << "\n";
+    }
+}
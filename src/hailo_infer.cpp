@@ -128,26 +128,57 @@ void HailoInfer::run_async(
     std::function<void(const hailort::AsyncInferCompletionInfo&,
                        const std::vector<std::pair<uint8_t*, hailo_vstream_info_t>> &,
                        const std::vector<std::shared_ptr<uint8_t>> &)> callback)
+{
+    submit([callback, output_data_and_infos, input_image_guards, output_guards](const hailort::AsyncInferCompletionInfo& info)
+        {
+            // callback sent by the applicative side
+            callback(info, output_data_and_infos, output_guards);
+        });
+}
+
+bool HailoInfer::submit(std::function<void(const hailort::AsyncInferCompletionInfo&)> done)
 {
     auto status = configured_infer_model.wait_for_async_ready(std::chrono::milliseconds(50000), this->batch_size);
     if (HAILO_SUCCESS != status) {
         std::cerr << "Failed wait_for_async_ready, status = " << status << std::endl;
     }
-    auto job = configured_infer_model.run_async(
-        this->multiple_bindings,
-        [callback, output_data_and_infos, input_image_guards, output_guards](const hailort::AsyncInferCompletionInfo& info)
-        {
-            // callback sent by the applicative side
-            callback(info, output_data_and_infos, output_guards);
-        }
-    );
+    auto job = configured_infer_model.run_async(this->multiple_bindings, std::move(done));
     if (!job) {
         std::cerr << "Failed to start async infer job, status = " << job.status() << std::endl;
+        return false;
     }
     job->detach();
     last_infer_job = std::move(job.release());
+    return true;
 }
 
+#if AIPEX_COROUTINES
+InferAwaitable HailoInfer::infer(std::vector<cv::Mat> input_data, CoroExecutor *resume_on)
+{
+    return InferAwaitable(*this, std::move(input_data), resume_on);
+}
+
+bool InferAwaitable::await_suspend(std::coroutine_handle<> h)
+{
+    handle = h;
+    std::lock_guard<std::mutex> lk(owner.submit_mutex);
+    owner.set_input_buffers(input_data, result.input_guards);
+    result.outputs = owner.prepare_output_buffers(result.output_guards);
+    // this 만 캡처 -> std::function 의 small buffer 에 들어가 job 마다 힙 할당 없음
+    bool started = owner.submit([this](const hailort::AsyncInferCompletionInfo& info) {
+        result.status = info.status;
+        if (executor) executor->Post(handle);
+        else handle.resume();
+    });
+    if (!started) {
+        result.status = HAILO_INTERNAL_FAILURE;
+        return false; // 바로 재개, await_resume 에서 실패 status 반환
+    }
+    // 여기서부터는 callback 이 이미 코루틴을 재개했을 수 있으므로 멤버에 접근하지 않음
+    return true;
+}
+#endif
+
 void HailoInfer::wait_for_last_job()
 {
     auto st = last_infer_job.wait(std::chrono::milliseconds(50000));
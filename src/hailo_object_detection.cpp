@@ -1,27 +1,326 @@
 #include "hailo/hailort.hpp"
+#include "hailo_segmentation.h"
+#include "hailo_classifier.h"
+#include "preprocess.h"
+#include "jpeg_codec.h"
+#include "perf_counters.h"
+#include "cpu_detector.h"
+#include "spillover.h"
+#include "postprocess_plugin.h"
+#include "device_watchdog.h"
+#include "operating_profile.h"
+#if AIPEX_COROUTINES
+#include "coro_datastream.h"
+#endif
 #include <opencv2/opencv.hpp>
 #include <iostream>
+#include <sstream>
 #include <vector>
 #include <memory>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <cstdlib>
+#include <cstring>
 
 #define HEF_FILE "/home/pi/hailo/best.hef"
 
 using namespace hailort;
 
+// configure 한 번의 결과. device_run 은 이것을 복사해 들고 lock 없이 실행하므로, watchdog 이
+// 돌아오지 않는 run 을 버리고 장치를 다시 열어도 그 run 이 쓰는 객체는 run 이 돌아올 때까지 남음
+struct DeviceGeneration {
+    std::shared_ptr<InferModel> infer_model;
+    std::shared_ptr<ConfiguredInferModel> configured;
+    std::timed_mutex run_mtx;          // 장치 실행 직렬화. 세대마다 따로 두어 멈춘 run 이 새 장치를 막지 않음
+    std::atomic<bool> retired{false};  // reset 이 이 세대를 버림. 이후 결과는 쓰지 않음
+};
+
 // Hailo context (using C++ API objects)
 struct HailoContext {
+    std::string hef_path;
     std::unique_ptr<VDevice> vdevice;
     std::shared_ptr<InferModel> infer_model;
-    std::shared_ptr<ConfiguredInferModel> configured_infer_model;
+    std::shared_ptr<DeviceGeneration> gen; // g_device_rw 안에서 교체
     hailo_3d_image_shape_t input_shape;
     size_t input_frame_size = 0;
+    PreprocessKernel preprocess{"generic", &preprocess_generic, false};
+
+    // 출력 구성: NMS 검출기 또는 YOLO-seg (검출 텐서 + prototype 텐서)
+    enum class ModelKind { DETECTION_NMS, SEGMENTATION };
+    ModelKind kind = ModelKind::DETECTION_NMS;
+    std::vector<std::string> output_names;
+    std::vector<size_t> output_sizes;
+    size_t nms_classes = 0;
+    // segmentation
+    std::string seg_det_name, seg_proto_name;
+    size_t seg_rows = 0, seg_row_len = 0, seg_classes = 0;
+    bool seg_transposed = false;
+    int proto_h = 0, proto_w = 0, proto_c = 0;
+    SegConfig seg_cfg;
+    // 후처리 플러그인에 넘길 출력 텐서 정보 (data 는 프레임마다 채움)
+    std::vector<aipex_pp_tensor> pp_tensors;
 };
 
 static HailoContext g_hailo_ctx;
+// 2단계 세분류 (AIPEX_CLS_HEF 설정 시). 1단계 모델과 같은 VDevice 사용
+static std::shared_ptr<CropClassifier> g_classifier; // g_device_rw 안에서 교체, 사용자는 복사본을 들고 사용
+static std::atomic<uint64_t> g_cls_profile_gen{0};  // classifier batch 에 마지막으로 반영한 프로필 generation
+// AIPEX_BACKEND=cpu (또는 auto 에서 Hailo 초기화 실패) 일 때만 생성
+static std::unique_ptr<CpuDetector> g_cpu_detector;
+// AIPEX_SPILL_ONNX 설정 시 Hailo 경로와 함께 사용 (포화 시 작은 CPU 모델로 넘김)
+static std::unique_ptr<SpilloverScheduler> g_spill;
+// AIPEX_PP_PLUGIN / AIPEX_PP_PLUGIN_DIR 로 찾은 후처리 플러그인. 없으면 내장 후처리
+static std::unique_ptr<PostprocessPlugin> g_pp_plugin;
+// 장치 멈춤 감시 (AIPEX_WD_MAX_FAILURES=0 이면 생성하지 않음)
+static std::unique_ptr<DeviceWatchdog> g_watchdog;
+// 장치 객체 (vdevice / infer_model / gen / g_classifier) 보호.
+// 검출 추론은 gen 을 꺼낼 때만, classifier 는 batch 실행 동안 shared. watchdog 의 장치 재생성은 exclusive
+static std::shared_timed_mutex g_device_rw;
 
-// Initialize Hailo device & network group once
-int hailo_init(const char* hef_path) {
-    // 1) Create VDevice
+// HAILO_MOCK 설정 시 장치 없이 고정 결과를 반환 (여러 로컬 서버로 분산/장애조치 테스트용)
+// AIPEX_MOCK_LATENCY_MS 로 장치 지연을 흉내낼 수 있음
+static bool hailo_mock_mode() {
+    const char* m = std::getenv("HAILO_MOCK");
+    return m && *m;
+}
+
+static int hailo_mock_infer(std::string& result_json) {
+    const char* lat = std::getenv("AIPEX_MOCK_LATENCY_MS");
+    if (lat && *lat) std::this_thread::sleep_for(std::chrono::milliseconds(std::atoi(lat)));
+    result_json = "{\"detections\":[{\"class\":\"car\",\"score\":0.90,"
+                  "\"bbox\":{\"x_min\":0.40,\"y_min\":0.40,\"x_max\":0.60,\"y_max\":0.60}}],\"count\":1}";
+    return 0;
+}
+
+// hailo_utils.cpp 의 get_coco_name_from_int 와 같은 매핑 (1-based, 0 = background)
+static std::string class_name(int cls) {
+    switch (cls) {
+        case 1: return "bike";
+        case 2: return "car";
+        case 3: return "person";
+        case 0: return "__background__";
+    }
+    return "N/A";
+}
+
+// 후처리 결과 한 건 (정규화 좌표). subclass 는 2단계 분류 결과
+struct OutDetection {
+    std::string label;
+    float score;
+    float x_min, y_min, x_max, y_max;
+    std::string subclass;
+    float subclass_score = 0.f;
+};
+
+static std::string detections_to_json(const std::vector<OutDetection>& dets) {
+    std::ostringstream os;
+    os << "{\"detections\":[";
+    for (size_t i = 0; i < dets.size(); ++i) {
+        const auto& d = dets[i];
+        if (i > 0) os << ",";
+        os << "{\"class\":\"" << d.label << "\",\"score\":" << d.score;
+        if (!d.subclass.empty()) os << ",\"subclass\":\"" << d.subclass << "\",\"subclass_score\":" << d.subclass_score;
+        os << ",\"bbox\":{\"x_min\":" << d.x_min << ",\"y_min\":" << d.y_min
+           << ",\"x_max\":" << d.x_max << ",\"y_max\":" << d.y_max << "}}";
+    }
+    os << "],\"count\":" << dets.size() << "}";
+    return os.str();
+}
+
+// HAILO_NMS_BY_CLASS float32 출력: class 마다 [count][hailo_bbox_float32_t x count] (parse_nms_data 와 동일 배치)
+static std::vector<OutDetection> nms_decode(const uint8_t* data, size_t size, size_t num_classes, float threshold) {
+    std::vector<OutDetection> dets;
+    size_t offset = 0;
+    for (size_t c = 0; c < num_classes && offset + sizeof(float) <= size; ++c) {
+        float fcount;
+        std::memcpy(&fcount, data + offset, sizeof(float));
+        offset += sizeof(float);
+        for (uint32_t j = 0; j < static_cast<uint32_t>(fcount) && offset + sizeof(hailo_bbox_float32_t) <= size; ++j) {
+            hailo_bbox_float32_t b;
+            std::memcpy(&b, data + offset, sizeof(b));
+            offset += sizeof(b);
+            if (b.score < threshold) continue;
+            dets.push_back({class_name(static_cast<int>(c) + 1), b.score, b.x_min, b.y_min, b.x_max, b.y_max, "", 0.f});
+        }
+    }
+    return dets;
+}
+
+// 다른 추론 경로(coro_datastream.cpp)에서 같은 JSON 형식을 쓰기 위한 진입점
+std::string hailo_nms_to_json(const uint8_t* data, size_t size, size_t num_classes) {
+    return detections_to_json(nms_decode(data, size, num_classes, 0.0f));
+}
+
+// 2단계: 검출 박스를 원본 프레임에서 crop 하여 batch 분류. 전처리가 전체 프레임 resize 이므로
+// 정규화 좌표가 원본 프레임에도 그대로 대응
+static void classify_detections(CropClassifier* classifier, const cv::Mat& frame, std::vector<OutDetection>& dets) {
+    if (!classifier || !classifier->Ready() || dets.empty()) return;
+    std::vector<CropClassifier::Crop> crops;
+    crops.reserve(dets.size());
+    for (const auto& d : dets) crops.push_back({d.x_min, d.y_min, d.x_max, d.y_max, d.score, "", 0.f, false});
+    classifier->Classify(frame, crops);
+    for (size_t i = 0; i < dets.size(); ++i) {
+        if (!crops[i].classified) continue;
+        dets[i].subclass = crops[i].label;
+        dets[i].subclass_score = crops[i].score;
+    }
+}
+
+// 출력 스트림 구성으로 모델 종류 판별. NMS 출력이 없고 (h,w,nm) prototype 출력이 있으면 segmentation
+static bool detect_model_kind() {
+    auto& ctx = g_hailo_ctx;
+    ctx.output_names = ctx.infer_model->get_output_names();
+    ctx.output_sizes.clear();
+
+    // segmentation 은 검출 텐서 하나 (scale 들을 이어 붙여 export) + prototype 하나만 지원.
+    // scale 별 출력이 따로 있는 HEF 를 마지막 출력만으로 잘못 해석하지 않도록 거부
+    const InferModel::InferStream* proto = nullptr;
+    const InferModel::InferStream* det = nullptr;
+    size_t spatial = 0, flat = 0;
+    for (const auto& out : ctx.infer_model->outputs()) {
+        auto order = out.format().order;
+        if (order == HAILO_FORMAT_ORDER_HAILO_NMS || order == HAILO_FORMAT_ORDER_HAILO_NMS_BY_CLASS) {
+            ctx.kind = HailoContext::ModelKind::DETECTION_NMS;
+            ctx.nms_classes = out.get_nms_shape().number_of_classes;
+            return true;
+        }
+        auto sh = out.shape();
+        if (sh.height > 1 && sh.width > 1) {
+            spatial++;
+            if (!proto) proto = &out;
+        } else {
+            flat++;
+            det = &out;
+        }
+    }
+    if (spatial != 1 || flat != 1) {
+        std::cerr << "[hailo] unsupported output layout: " << spatial << " spatial + " << flat
+                  << " flat output(s) (need an NMS output, or exactly one concatenated detection tensor"
+                  << " + one prototype output; per-scale outputs are not decoded)\n";
+        return false;
+    }
+
+    ctx.kind = HailoContext::ModelKind::SEGMENTATION;
+    ctx.seg_proto_name = proto->name();
+    ctx.seg_det_name = det->name();
+    auto ps = proto->shape();
+    ctx.proto_h = static_cast<int>(ps.height);
+    ctx.proto_w = static_cast<int>(ps.width);
+    ctx.proto_c = static_cast<int>(ps.features);
+
+    // 검출 텐서는 (1, N, 4+nc+nm) 또는 (1, 4+nc+nm, N) 로 export 됨. 긴 축이 anchor 축
+    auto ds = det->shape();
+    size_t w = static_cast<size_t>(ds.height) * ds.width, f = ds.features;
+    ctx.seg_rows = std::max(w, f);
+    ctx.seg_row_len = std::min(w, f);
+    ctx.seg_transposed = (f > w);
+    if (ctx.seg_row_len <= 4 + static_cast<size_t>(ctx.proto_c)) {
+        std::cerr << "[hailo] segmentation detection tensor too narrow: " << ctx.seg_row_len << "\n";
+        return false;
+    }
+    ctx.seg_classes = ctx.seg_row_len - 4 - ctx.proto_c;
+    ctx.seg_cfg = seg_config_from_env();
+    std::cerr << "[hailo] segmentation model: anchors=" << ctx.seg_rows << " classes=" << ctx.seg_classes
+              << " proto=" << ctx.proto_h << "x" << ctx.proto_w << "x" << ctx.proto_c
+              << (ctx.seg_transposed ? " (transposed)" : "") << "\n";
+    return true;
+}
+
+// 플러그인 호출 비용 측정용 합성 NMS 출력: class 마다 boxes_per_class 개
+static std::vector<uint8_t> synthetic_nms_output(size_t size, size_t num_classes, size_t boxes_per_class) {
+    std::vector<uint8_t> buf(size, 0);
+    size_t offset = 0;
+    for (size_t c = 0; c < num_classes; ++c) {
+        size_t need = sizeof(float) + boxes_per_class * sizeof(hailo_bbox_float32_t);
+        if (offset + need > size) break;
+        float count = static_cast<float>(boxes_per_class);
+        std::memcpy(buf.data() + offset, &count, sizeof(float));
+        offset += sizeof(float);
+        for (size_t j = 0; j < boxes_per_class; ++j) {
+            hailo_bbox_float32_t b;
+            b.y_min = 0.1f; b.x_min = 0.1f + 0.01f * j; b.y_max = 0.5f; b.x_max = 0.5f + 0.01f * j;
+            b.score = 0.9f;
+            std::memcpy(buf.data() + offset, &b, sizeof(b));
+            offset += sizeof(b);
+        }
+    }
+    return buf;
+}
+
+// 출력 형식 설정 (configure 전). segmentation 후처리는 float 로 수행 (장치측 dequantize)
+static void apply_output_formats() {
+    auto& ctx = g_hailo_ctx;
+    if (ctx.kind != HailoContext::ModelKind::SEGMENTATION) return;
+    for (const auto& name : ctx.output_names) {
+        auto o = ctx.infer_model->output(name);
+        if (o) o->set_format_type(HAILO_FORMAT_TYPE_FLOAT32);
+    }
+}
+
+// 출력 텐서 정보를 채우고 플러그인 선택. HEF network group 이름 -> 출력 형식 순으로 후보
+static int load_postprocess_plugin(const char* hef_path) {
+    auto& ctx = g_hailo_ctx;
+    ctx.pp_tensors.clear();
+    for (size_t i = 0; i < ctx.output_names.size(); ++i) {
+        auto o = ctx.infer_model->output(ctx.output_names[i]);
+        aipex_pp_tensor t;
+        std::memset(&t, 0, sizeof(t));
+        t.name = ctx.output_names[i].c_str();
+        t.size = ctx.output_sizes[i];
+        if (o) {
+            auto fmt = o->format();
+            t.format_type = static_cast<uint32_t>(fmt.type);
+            t.format_order = static_cast<uint32_t>(fmt.order);
+            if (fmt.order == HAILO_FORMAT_ORDER_HAILO_NMS || fmt.order == HAILO_FORMAT_ORDER_HAILO_NMS_BY_CLASS) {
+                auto ns = o->get_nms_shape();
+                t.nms_classes = ns.number_of_classes;
+                t.nms_max_boxes_per_class = ns.max_bboxes_per_class;
+            } else {
+                auto sh = o->shape();
+                t.height = sh.height;
+                t.width = sh.width;
+                t.features = sh.features;
+            }
+            auto q = o->get_quant_infos();
+            if (!q.empty()) {
+                t.qp_zp = q[0].qp_zp;
+                t.qp_scale = q[0].qp_scale;
+            }
+        }
+        ctx.pp_tensors.push_back(t);
+    }
+
+    std::vector<std::string> candidates = ctx.infer_model->hef().get_network_groups_names();
+    candidates.push_back(ctx.kind == HailoContext::ModelKind::DETECTION_NMS ? "nms" : "seg");
+    g_pp_plugin = PostprocessPlugin::FromEnv(candidates);
+    if (!g_pp_plugin) {
+        // 명시적으로 지정했는데 못 열었으면 내장 후처리로 조용히 넘어가지 않음
+        const char* forced = std::getenv("AIPEX_PP_PLUGIN");
+        if (forced && *forced) return -1;
+        return 0;
+    }
+    std::cerr << "[hailo] postprocess plugin " << g_pp_plugin->Name() << " for " << hef_path << "\n";
+
+    const char* bench = std::getenv("AIPEX_PP_BENCH");
+    if (bench && std::atoi(bench) > 0 && ctx.kind == HailoContext::ModelKind::DETECTION_NMS && !ctx.pp_tensors.empty()) {
+        // 빈 출력: 순수 호출 비용, 채운 출력: 파싱 포함
+        for (size_t boxes : {static_cast<size_t>(0), static_cast<size_t>(10)}) {
+            std::vector<uint8_t> buf = synthetic_nms_output(ctx.output_sizes[0], ctx.nms_classes, boxes);
+            std::vector<aipex_pp_tensor> tensors = ctx.pp_tensors;
+            tensors[0].data = buf.data();
+            tensors[0].size = buf.size();
+            benchmark_postprocess_plugin(*g_pp_plugin, tensors, ctx.input_shape.width, ctx.input_shape.height,
+                                         [&] { return nms_decode(buf.data(), buf.size(), ctx.nms_classes, 0.0f).size(); },
+                                         std::atoi(bench));
+        }
+    }
+    return 0;
+}
+
+// 1) VDevice, 2) HEF 로 InferModel 생성. 초기화와 watchdog 장치 재생성이 같이 씀
+static int open_device(const char* hef_path) {
     auto vdevice_exp = VDevice::create();
     if (!vdevice_exp) {
         std::cerr << "[hailo] Failed to create VDevice: " << vdevice_exp.status() << "\n";
@@ -29,13 +328,101 @@ int hailo_init(const char* hef_path) {
     }
     g_hailo_ctx.vdevice = vdevice_exp.release();
 
-    // 2) Create InferModel from HEF
     auto infer_model_exp = g_hailo_ctx.vdevice->create_infer_model(hef_path);
     if (!infer_model_exp) {
         std::cerr << "[hailo] Failed to create infer model: " << infer_model_exp.status() << "\n";
         return -1;
     }
     g_hailo_ctx.infer_model = infer_model_exp.release();
+    return 0;
+}
+
+// 4) batch_size=1 로 configure, 5) 같은 VDevice 에 2단계 분류기 (AIPEX_CLS_HEF, 실패해도 검출만으로 계속)
+static int configure_device() {
+    g_hailo_ctx.infer_model->set_batch_size(1);
+    auto configured_infer_model_exp = g_hailo_ctx.infer_model->configure();
+    if (!configured_infer_model_exp) {
+        std::cerr << "[hailo] Failed to configure infer model: " << configured_infer_model_exp.status() << "\n";
+        return -1;
+    }
+    // release() returns ConfiguredInferModel value, wrap in shared_ptr
+    auto gen = std::make_shared<DeviceGeneration>();
+    gen->infer_model = g_hailo_ctx.infer_model;
+    gen->configured = std::make_shared<ConfiguredInferModel>(configured_infer_model_exp.release());
+    g_hailo_ctx.gen = std::move(gen);
+
+    CropClassifier::Options cls_opts = CropClassifier::FromEnv();
+    if (!cls_opts.hef_path.empty()) {
+        g_classifier = std::make_shared<CropClassifier>(cls_opts);
+        if (g_classifier->Init(*g_hailo_ctx.vdevice, &g_device_rw) != 0) {
+            std::cerr << "[hailo] classifier init failed, running detector only\n";
+            g_classifier.reset();
+        } else {
+            // 재생성된 classifier 에도 현재 프로필의 batch 반영
+            g_cls_profile_gen.store(ProfileManager::Instance().Generation());
+            g_classifier->SetDispatchBatch(ProfileManager::Instance().Current().classifier_batch);
+        }
+    }
+    return 0;
+}
+
+// watchdog 복구: 진행 중인 실행을 busy_wait 까지 기다린 뒤 장치 객체를 모두 닫고 같은 HEF 로 다시 엶.
+// run() 이 타임아웃으로도 돌아오지 않으면 그 run 은 버림 (세대를 retired 로 표시, 돌아와도 결과를 쓰지 않음).
+// 입출력 구성, 전처리 커널, 후처리 플러그인은 HEF 로 정해지므로 그대로 둠
+static bool hailo_reset_device(std::chrono::milliseconds busy_wait) {
+    auto& ctx = g_hailo_ctx;
+    std::shared_ptr<DeviceGeneration> old_gen;
+    {
+        std::shared_lock<std::shared_timed_mutex> rd(g_device_rw);
+        old_gen = ctx.gen;
+    }
+    std::unique_lock<std::timed_mutex> run_lk;
+    if (old_gen) {
+        run_lk = std::unique_lock<std::timed_mutex>(old_gen->run_mtx, std::defer_lock);
+        if (!run_lk.try_lock_for(busy_wait)) {
+            std::cerr << "[hailo] reset: run() not returned after " << busy_wait.count() << "ms, abandoning it\n";
+        }
+        old_gen->retired.store(true); // run_mtx 를 기다리던 실행도 장치에 닿지 않고 SKIPPED
+    }
+
+    // 분류 중인 호출자가 들고 있을 수 있으므로 닫기만 하고 해제는 lock 밖에서 (worker join)
+    std::shared_ptr<CropClassifier> old_classifier;
+    std::unique_lock<std::shared_timed_mutex> lk(g_device_rw, std::defer_lock);
+    if (!lk.try_lock_for(busy_wait)) {
+        // classifier batch 가 돌아오지 않는 상태 (검출 run 은 이 lock 을 잡고 실행하지 않음). 다음 시도로 넘김
+        std::cerr << "[hailo] reset: classifier still busy\n";
+        return false;
+    }
+    old_classifier = std::move(g_classifier);
+    if (old_classifier) old_classifier->Shutdown();
+    ctx.gen.reset();
+    ctx.infer_model.reset();
+    // 남은 참조는 run_mtx 를 기다리다 SKIPPED 로 빠지는 실행뿐이므로 잠깐 기다림.
+    // 버린 run 이 들고 있으면 기다리지 않고 닫음 (장치를 닫으면 남은 전송이 끝나 그 run 도 오류로 돌아옴)
+    if (run_lk.owns_lock()) run_lk.unlock();
+    std::weak_ptr<DeviceGeneration> retired = old_gen;
+    old_gen.reset();
+    const auto deadline = std::chrono::steady_clock::now() + busy_wait;
+    while (!retired.expired() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (!retired.expired()) std::cerr << "[hailo] reset: closing device under an abandoned run\n";
+    ctx.vdevice.reset(); // 같은 장치를 다시 열기 전에 먼저 닫아야 함
+    if (open_device(ctx.hef_path.c_str()) != 0) return false;
+    apply_output_formats();
+    if (configure_device() != 0) {
+        ctx.infer_model.reset();
+        ctx.vdevice.reset();
+        return false;
+    }
+    std::cerr << "[hailo] device reopened\n";
+    return true;
+}
+
+// Initialize Hailo device & network group once
+int hailo_init(const char* hef_path) {
+    g_hailo_ctx.hef_path = hef_path;
+    if (open_device(hef_path) != 0) return -1;
 
     // 3) Get input shape
     auto input_vstream_infos = g_hailo_ctx.infer_model->hef().get_input_vstream_infos();
@@ -52,107 +439,354 @@ int hailo_init(const char* hef_path) {
               << g_hailo_ctx.input_shape.width << "x" << g_hailo_ctx.input_shape.features
               << " (size=" << g_hailo_ctx.input_frame_size << " bytes)\n";
 
-    // 4) Configure model with batch_size=1
-    g_hailo_ctx.infer_model->set_batch_size(1);
-    auto configured_infer_model_exp = g_hailo_ctx.infer_model->configure();
-    if (!configured_infer_model_exp) {
-        std::cerr << "[hailo] Failed to configure infer model: " << configured_infer_model_exp.status() << "\n";
-        return -1;
+    // 입력 shape/format 에 맞는 전처리 커널 선택 (고정 크기는 컴파일 타임 특수화 커널)
+    const auto& in_format = input_vstream_infos->at(0).format;
+    bool nhwc_uint8 = (in_format.order == HAILO_FORMAT_ORDER_NHWC || in_format.order == HAILO_FORMAT_ORDER_AUTO)
+                   && (in_format.type == HAILO_FORMAT_TYPE_UINT8 || in_format.type == HAILO_FORMAT_TYPE_AUTO);
+    g_hailo_ctx.preprocess = select_preprocess_kernel(static_cast<int>(g_hailo_ctx.input_shape.width),
+                                                      static_cast<int>(g_hailo_ctx.input_shape.height),
+                                                      static_cast<int>(g_hailo_ctx.input_shape.features), nhwc_uint8);
+    std::cerr << "[hailo] preprocess kernel: " << g_hailo_ctx.preprocess.name << "\n";
+    const char* bench = std::getenv("AIPEX_PREPROCESS_BENCH");
+    if (bench && std::atoi(bench) > 0) {
+        int w = static_cast<int>(g_hailo_ctx.input_shape.width), h = static_cast<int>(g_hailo_ctx.input_shape.height);
+        benchmark_preprocess(g_hailo_ctx.preprocess, w, h, w, h, std::atoi(bench));       // client 가 미리 resize 한 경우
+        benchmark_preprocess(g_hailo_ctx.preprocess, w, h, 1280, 720, std::atoi(bench));  // 원본 카메라 프레임
     }
-    // release() returns ConfiguredInferModel value, wrap in shared_ptr
-    g_hailo_ctx.configured_infer_model = std::make_shared<ConfiguredInferModel>(configured_infer_model_exp.release());
+    const char* jpeg_bench = std::getenv("AIPEX_JPEG_BENCH");
+    if (jpeg_bench && std::atoi(jpeg_bench) > 0) {
+        benchmark_jpeg_codec(640, 640, std::atoi(jpeg_bench));   // client 전송 크기
+        benchmark_jpeg_codec(1280, 720, std::atoi(jpeg_bench));
+        benchmark_jpeg_codec(1920, 1080, std::atoi(jpeg_bench));
+    }
+
+    if (!detect_model_kind()) return -1;
+    apply_output_formats();
+    if (configure_device() != 0) return -1;
+
+    // 출력 버퍼 크기는 format 설정 이후 값으로 확정
+    for (const auto& name : g_hailo_ctx.output_names) {
+        auto o = g_hailo_ctx.infer_model->output(name);
+        g_hailo_ctx.output_sizes.push_back(o ? o->get_frame_size() : 0);
+    }
+    if (load_postprocess_plugin(hef_path) != 0) return -1;
 
     std::cerr << "[hailo] Initialized successfully\n";
     return 0;
 }
 
 void hailo_cleanup() {
-    g_hailo_ctx.configured_infer_model.reset();
+    g_watchdog.reset(); // 복구 중이면 끝날 때까지 기다림
+    g_classifier.reset();
+    g_spill.reset();
+    g_pp_plugin.reset();
+    g_cpu_detector.reset();
+    g_hailo_ctx.gen.reset();
     g_hailo_ctx.infer_model.reset();
     g_hailo_ctx.vdevice.reset();
     std::cerr << "[hailo] Cleanup complete\n";
 }
 
-// Run inference on a single frame (cv::Mat), return detection JSON or annotated image
-// Returns 0 on success, -1 on failure
-int hailo_infer(const cv::Mat& input_frame, bool return_image, std::string& result_json, cv::Mat& result_image) {
-    // 1) Preprocess: resize to model input size
-    int model_h = g_hailo_ctx.input_shape.height;
-    int model_w = g_hailo_ctx.input_shape.width;
-    
-    cv::Mat resized;
-    cv::resize(input_frame, resized, cv::Size(model_w, model_h));
-    
-    // Convert BGR→RGB if needed
-    cv::Mat rgb;
-    cv::cvtColor(resized, rgb, cv::COLOR_BGR2RGB);
+static int cpu_backend_init() {
+    auto det = std::make_unique<CpuDetector>(CpuDetector::FromEnv());
+    if (det->Init() != 0) return -1;
+    g_cpu_detector = std::move(det);
+    return 0;
+}
 
-    // 2) Prepare input buffer (contiguous)
-    std::vector<uint8_t> input_data(g_hailo_ctx.input_frame_size);
-    if (rgb.isContinuous()) {
-        std::memcpy(input_data.data(), rgb.data, g_hailo_ctx.input_frame_size);
-    } else {
-        size_t offset = 0;
-        for (int r = 0; r < rgb.rows; ++r) {
-            std::memcpy(input_data.data() + offset, rgb.ptr(r), rgb.cols * rgb.elemSize());
-            offset += rgb.cols * rgb.elemSize();
-        }
+// CPU 백엔드 추론. Hailo 경로와 같은 JSON (정규화 박스, 같은 class 이름)
+static int cpu_infer(const cv::Mat& input_frame, bool return_image, std::string& result_json, cv::Mat& result_image) {
+    std::vector<SegDetection> found;
+    {
+        PerfStage stage("infer");
+        if (g_cpu_detector->Detect(input_frame, found) != 0) return -1;
+    }
+    std::vector<OutDetection> dets;
+    for (const auto& d : found) {
+        dets.push_back({class_name(d.class_id + 1), d.score, d.x_min, d.y_min, d.x_max, d.y_max, "", 0.f});
+    }
+    result_json = detections_to_json(dets);
+    if (return_image) {
+        cv::resize(input_frame, result_image, cv::Size(g_cpu_detector->InputWidth(), g_cpu_detector->InputHeight()));
+        cv::putText(result_image, "Inference OK (cpu)", cv::Point(10, 30),
+                    cv::FONT_HERSHEY_SIMPLEX, 1.0, cv::Scalar(0,255,0), 2);
+    }
+    return 0;
+}
+
+static std::vector<SpillBox> to_spill_boxes(const std::vector<SegDetection>& found) {
+    std::vector<SpillBox> out;
+    for (const auto& d : found) out.push_back({class_name(d.class_id + 1), d.score, d.x_min, d.y_min, d.x_max, d.y_max});
+    return out;
+}
+
+static std::vector<SpillBox> to_spill_boxes(const std::vector<OutDetection>& dets) {
+    std::vector<SpillBox> out;
+    for (const auto& d : dets) out.push_back({d.label, d.score, d.x_min, d.y_min, d.x_max, d.y_max});
+    return out;
+}
+
+static double ms_since(std::chrono::steady_clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
+
+// 가속기 대신 spill 용 작은 CPU 모델로 추론
+static int spill_infer(const cv::Mat& input_frame, bool return_image, std::string& result_json, cv::Mat& result_image,
+                       std::chrono::steady_clock::time_point t0) {
+    std::vector<SegDetection> found;
+    {
+        PerfStage stage("infer_cpu");
+        if (g_spill->Detect(input_frame, found) != 0) return -1;
+    }
+    std::vector<OutDetection> dets;
+    for (const auto& d : found) {
+        dets.push_back({class_name(d.class_id + 1), d.score, d.x_min, d.y_min, d.x_max, d.y_max, "", 0.f});
+    }
+    result_json = detections_to_json(dets);
+    g_spill->Record(SpilloverScheduler::Backend::CPU, ms_since(t0), to_spill_boxes(dets));
+    if (return_image) {
+        cv::resize(input_frame, result_image, cv::Size(g_spill->InputWidth(), g_spill->InputHeight()));
+        cv::putText(result_image, "Inference OK (cpu spill)", cv::Point(10, 30),
+                    cv::FONT_HERSHEY_SIMPLEX, 1.0, cv::Scalar(0,255,0), 2);
+    }
+    return 0;
+}
+
+enum class DeviceRun { OK, FAILED, SKIPPED };
+
+// bindings 생성부터 장치 실행까지. 장치 세대를 복사해 들고 실행하므로 watchdog 재생성을 막지 않음
+// SKIPPED: 장치 mutex 를 기다리는 사이 watchdog 이 복구를 시작했거나, 실행 중 reset 이 이 run 을 버림
+static DeviceRun device_run(std::vector<uint8_t>& input_data, std::vector<std::vector<uint8_t>>& output_data) {
+    auto& ctx = g_hailo_ctx;
+    std::shared_ptr<DeviceGeneration> gen;
+    {
+        std::shared_lock<std::shared_timed_mutex> rd(g_device_rw);
+        gen = ctx.gen;
+    }
+    if (!gen) {
+        std::cerr << "[hailo] not initialized\n";
+        return DeviceRun::FAILED;
     }
 
-    // 3) Create bindings for this inference
-    auto bindings_exp = g_hailo_ctx.configured_infer_model->create_bindings();
+    // Create bindings for this inference
+    auto bindings_exp = gen->configured->create_bindings();
     if (!bindings_exp) {
         std::cerr << "[hailo] Failed to create bindings: " << bindings_exp.status() << "\n";
-        return -1;
+        return DeviceRun::FAILED;
     }
     auto bindings = bindings_exp.release();
 
-    // 4) Get input name (assumes single input)
-    auto input_name = g_hailo_ctx.infer_model->get_input_names()[0];
-    
+    // Get input name (assumes single input)
+    auto input_name = gen->infer_model->get_input_names()[0];
+
     // Set input buffer
     hailo_status status = bindings.input(input_name)->set_buffer(MemoryView(input_data.data(), input_data.size()));
     if (status != HAILO_SUCCESS) {
         std::cerr << "[hailo] Failed to set input buffer: " << status << "\n";
-        return -1;
+        return DeviceRun::FAILED;
     }
 
-    // 5) Run inference (synchronous)
+    // Output buffers (one per output stream)
+    for (size_t i = 0; i < ctx.output_names.size(); ++i) {
+        status = bindings.output(ctx.output_names[i])->set_buffer(MemoryView(output_data[i].data(), output_data[i].size()));
+        if (status != HAILO_SUCCESS) {
+            std::cerr << "[hailo] Failed to set output buffer " << ctx.output_names[i] << ": " << status << "\n";
+            return DeviceRun::FAILED;
+        }
+    }
+
+    // Run inference (synchronous)
     // run() is synchronous and returns hailo_status directly
-    status = g_hailo_ctx.configured_infer_model->run(bindings, std::chrono::milliseconds(1000));
+    // 여러 프레임이 executor 에서 동시에 들어오므로 장치 실행만 직렬화 (전처리/후처리는 겹쳐 실행)
+    {
+        if (g_spill) g_spill->DeviceEnter();
+        std::lock_guard<std::timed_mutex> lk(gen->run_mtx);
+        if ((g_watchdog && !g_watchdog->Healthy()) || gen->retired.load()) {
+            if (g_spill) g_spill->DeviceAbort();
+            return DeviceRun::SKIPPED;
+        }
+        auto timeout = g_watchdog ? g_watchdog->GetOptions().run_timeout : std::chrono::milliseconds(1000);
+        auto t_run = std::chrono::steady_clock::now();
+        if (g_watchdog) g_watchdog->RunStarted();
+        {
+            PerfStage stage("infer"); // 장치 대기 시간 (CPU 카운터는 거의 0 이어야 정상)
+            status = gen->configured->run(bindings, timeout);
+        }
+        if (gen->retired.load()) {
+            // reset 이 기다리다 버린 run. 이미 새 장치로 넘어갔으므로 결과도 실패도 watchdog 에 알리지 않음
+            if (g_spill) g_spill->DeviceExit(ms_since(t_run));
+            std::cerr << "[hailo] abandoned run returned after " << ms_since(t_run) << "ms (" << status
+                      << "), result discarded\n";
+            return DeviceRun::SKIPPED;
+        }
+        if (g_watchdog) g_watchdog->RunFinished(status == HAILO_SUCCESS);
+        if (g_spill) g_spill->DeviceExit(ms_since(t_run));
+    }
     if (status != HAILO_SUCCESS) {
         std::cerr << "[hailo] Inference failed: " << status << "\n";
+        return DeviceRun::FAILED;
+    }
+    return DeviceRun::OK;
+}
+
+// hailo_infer 가 kHailoInferDeferred 를 돌려준 프레임: watchdog 대기열에서 복구를 기다렸다가 resume(true),
+// replay_wait 안에 복구되지 않으면 resume(false). resume 은 watchdog 스레드에서 불리므로 다시 제출만 할 것
+void hailo_defer_until_recovered(std::function<void(bool recovered)> resume) {
+    if (!g_watchdog) {
+        resume(false);
+        return;
+    }
+    g_watchdog->CountReplay();
+    g_watchdog->DeferUntilRecovered(std::move(resume));
+}
+
+// Run inference on a single frame (cv::Mat), return detection JSON or annotated image
+// masks 가 주어지고 segmentation 모델이면 인스턴스 마스크(RLE) 도 채움
+// low_priority 프레임은 장치가 밀려 있으면 CPU 로 넘어갈 수 있음. backend 에 실제 실행한 백엔드 이름 기록
+// allow_defer: watchdog REPLAY 정책에서 장치가 복구 중이면 기다리지 않고 kHailoInferDeferred 를 돌려줌
+//              (호출자가 hailo_defer_until_recovered 로 복구 후 다시 제출)
+// Returns 0 on success, -1 on failure, kHailoInferDeferred (1) if deferred
+int hailo_infer(const cv::Mat& input_frame, bool return_image, std::string& result_json, cv::Mat& result_image,
+                std::vector<EncodedMask>* masks, bool low_priority, std::string* backend, bool allow_defer) {
+    if (masks) masks->clear();
+    if (backend) *backend = g_cpu_detector ? "cpu" : "hailo";
+    if (hailo_mock_mode()) return hailo_mock_infer(result_json);
+    if (g_cpu_detector) return cpu_infer(input_frame, return_image, result_json, result_image);
+    if (g_hailo_ctx.input_frame_size == 0) {
+        std::cerr << "[hailo] not initialized\n";
         return -1;
     }
+    auto t_start = std::chrono::steady_clock::now();
+    if (g_spill && g_spill->TrySpill(low_priority)) {
+        if (backend) *backend = "cpu";
+        return spill_infer(input_frame, return_image, result_json, result_image, t_start);
+    }
 
-    // 6) Get output (assumes single output for simplicity)
-    auto output_names = g_hailo_ctx.infer_model->get_output_names();
-    if (output_names.empty()) {
-        std::cerr << "[hailo] No output names found\n";
+    // 1) Preprocess: resize to model input size, BGR→RGB, write into the input buffer
+    int model_h = g_hailo_ctx.input_shape.height;
+    int model_w = g_hailo_ctx.input_shape.width;
+
+    // 2) Prepare input buffer (contiguous)
+    std::vector<uint8_t> input_data(g_hailo_ctx.input_frame_size);
+    {
+        PerfStage stage("preprocess");
+        g_hailo_ctx.preprocess.fn(input_frame, input_data.data(), model_w, model_h);
+    }
+
+    // 3)~6) 장치 실행. watchdog 이 있으면 복구 중인 장치를 피하고, 정책에 따라 실패한 프레임을 한 번 더 실행
+    // (장치가 아직 정상이면 바로, 복구 중이면 호출자에게 미룸. executor worker 는 복구를 기다리지 않음)
+    auto& ctx = g_hailo_ctx;
+    std::vector<std::vector<uint8_t>> output_data(ctx.output_names.size());
+    for (size_t i = 0; i < ctx.output_names.size(); ++i) output_data[i].resize(ctx.output_sizes[i]);
+    bool replayed = false;
+    for (;;) {
+        bool acquired = !g_watchdog || g_watchdog->Acquire();
+        DeviceRun r = acquired ? device_run(input_data, output_data) : DeviceRun::SKIPPED;
+        if (r == DeviceRun::OK) break;
+        if (!g_watchdog) return -1;
+        auto policy = g_watchdog->GetOptions().policy;
+        if (policy == DeviceWatchdog::Policy::REPLAY) {
+            if (!g_watchdog->Healthy()) {
+                if (allow_defer) return kHailoInferDeferred;
+            } else if (acquired && !replayed) {
+                replayed = true;
+                g_watchdog->CountReplay();
+                continue;
+            }
+        }
+        // 장치를 쓸 수 없는 프레임: CPU 정책이고 spill 모델 자리가 있으면 CPU 로, 아니면 실패
+        g_watchdog->CountRejected();
+        if (policy == DeviceWatchdog::Policy::CPU && g_spill && g_spill->TrySpill(low_priority, true)) {
+            if (backend) *backend = "cpu";
+            return spill_infer(input_frame, return_image, result_json, result_image, t_start);
+        }
         return -1;
     }
-    auto output_name = output_names[0];
-    
-    auto output_buffer = bindings.output(output_name)->get_buffer();
-    if (!output_buffer) {
-        std::cerr << "[hailo] Failed to get output buffer\n";
+    if (output_data.empty()) {
+        std::cerr << "[hailo] No output names found\n";
         return -1;
     }
 
     // 7) Postprocess
-    // TODO: parse NMS output properly (integrate parse_nms_data from hailo_utils.cpp)
-    // For now, dummy JSON
-    if (!return_image) {
-        result_json = "{\"detections\":[";
-        size_t preview_len = std::min<size_t>(10, output_buffer.value().size());
-        for (size_t i = 0; i < preview_len; ++i) {
-            if (i > 0) result_json += ",";
-            result_json += std::to_string((int)output_buffer.value().data()[i]);
+    std::vector<OutDetection> dets;
+    std::vector<SegDetection> seg_dets;
+    std::vector<EncodedMask> seg_masks;
+    {
+        PerfStage stage("postprocess");
+        if (g_pp_plugin) {
+            std::vector<aipex_pp_tensor> tensors = ctx.pp_tensors;
+            for (size_t i = 0; i < tensors.size(); ++i) {
+                tensors[i].data = output_data[i].data();
+                tensors[i].size = output_data[i].size();
+            }
+            std::vector<aipex_pp_detection> found;
+            if (g_pp_plugin->Run(tensors, model_w, model_h, found) != 0) return -1;
+            for (const auto& d : found) {
+                dets.push_back({class_name(d.class_id + 1), d.score, d.x_min, d.y_min, d.x_max, d.y_max, "", 0.f});
+            }
+        } else if (ctx.kind == HailoContext::ModelKind::DETECTION_NMS) {
+            dets = nms_decode(output_data[0].data(), output_data[0].size(), ctx.nms_classes, 0.0f);
+        } else {
+            const float* det = nullptr;
+            const float* proto = nullptr;
+            for (size_t i = 0; i < ctx.output_names.size(); ++i) {
+                if (ctx.output_names[i] == ctx.seg_det_name) det = reinterpret_cast<const float*>(output_data[i].data());
+                if (ctx.output_names[i] == ctx.seg_proto_name) proto = reinterpret_cast<const float*>(output_data[i].data());
+            }
+            if (!det || !proto) {
+                std::cerr << "[hailo] segmentation outputs missing\n";
+                return -1;
+            }
+            SegConfig cfg = ctx.seg_cfg;
+            if (!masks) cfg.masks_enabled = false;
+            run_segmentation_postprocess(det, ctx.seg_rows, ctx.seg_row_len, ctx.seg_transposed,
+                                         proto, ctx.proto_h, ctx.proto_w, ctx.proto_c,
+                                         ctx.seg_classes, model_w, model_h, cfg, seg_dets, seg_masks);
+            for (auto& m : seg_masks) m.label = class_name(m.class_id + 1);
+            for (const auto& d : seg_dets) {
+                dets.push_back({class_name(d.class_id + 1), d.score, d.x_min, d.y_min, d.x_max, d.y_max, "", 0.f});
+            }
+        }
+    }
+    {
+        PerfStage stage("classify");
+        // batch 를 기다리는 동안 장치 lock 을 잡지 않음 (batch 실행은 classifier worker 가 shared 로 잡음)
+        std::shared_ptr<CropClassifier> classifier;
+        {
+            std::shared_lock<std::shared_timed_mutex> rd(g_device_rw);
+            if (!g_watchdog || g_watchdog->Healthy()) classifier = g_classifier;
         }
-        result_json += "],\"count\":0}";
+        // 프로필이 바뀐 뒤 첫 프레임에서 classifier batch 갱신
+        const uint64_t gen = ProfileManager::Instance().Generation();
+        if (classifier && g_cls_profile_gen.exchange(gen) != gen) {
+            classifier->SetDispatchBatch(ProfileManager::Instance().Current().classifier_batch);
+        }
+        classify_detections(classifier.get(), input_frame, dets);
+    }
+    result_json = detections_to_json(dets);
+    if (g_spill) {
+        std::vector<SpillBox> boxes = to_spill_boxes(dets);
+        g_spill->Record(SpilloverScheduler::Backend::HAILO, ms_since(t_start), boxes);
+        g_spill->MaybeAudit(input_frame, boxes, &to_spill_boxes);
+    }
+
+    if (!return_image) {
+        if (masks) *masks = std::move(seg_masks);
         return 0;
     } else {
-        result_image = resized.clone();
+        cv::resize(input_frame, result_image, cv::Size(model_w, model_h));
+        for (const auto& m : seg_masks) {
+            cv::Rect r(cv::Point(static_cast<int>(m.x_min * model_w), static_cast<int>(m.y_min * model_h)),
+                       cv::Point(static_cast<int>(m.x_max * model_w), static_cast<int>(m.y_max * model_h)));
+            r &= cv::Rect(0, 0, model_w, model_h);
+            if (r.area() <= 0) continue;
+            cv::Mat alpha;
+            cv::resize(rle_decode(m.counts, m.width, m.height), alpha, r.size(), 0, 0, cv::INTER_NEAREST);
+            cv::Mat roi = result_image(r);
+            cv::Mat tinted;
+            cv::addWeighted(roi, 0.5, cv::Mat(roi.size(), roi.type(), cv::Scalar(0, 255, 0)), 0.5, 0.0, tinted);
+            tinted.copyTo(roi, alpha);
+        }
         cv::putText(result_image, "Inference OK", cv::Point(10, 30), 
                     cv::FONT_HERSHEY_SIMPLEX, 1.0, cv::Scalar(0,255,0), 2);
         return 0;
@@ -161,15 +795,52 @@ int hailo_infer(const cv::Mat& input_frame, bool return_image, std::string& resu
 
 // Entry point for gRPC thread (called from main or service_impl)
 int hailo_object_detection(int argc, char** argv) {
+    if (hailo_mock_mode()) {
+        std::cerr << "[hailo_det] running in MOCK mode (HAILO_MOCK set)\n";
+        return 0;
+    }
+#if AIPEX_COROUTINES
+    if (coro_datastream_enabled()) {
+        // 코루틴 핸들러의 HailoInfer 가 첫 스트림에서 장치를 엶
+        std::cerr << "[hailo_det] coroutine Datastream mode (AIPEX_CORO_INFLIGHT set), skipping sync init\n";
+        return 0;
+    }
+#endif
+
+    // AIPEX_BACKEND: hailo (기본) | cpu | auto (Hailo 초기화 실패 시 CPU 로 전환)
+    const char* be = std::getenv("AIPEX_BACKEND");
+    std::string backend = be && *be ? std::string(be) : std::string("hailo");
+    if (backend == "cpu") {
+        std::cerr << "[hailo_det] CPU backend selected (AIPEX_BACKEND=cpu)\n";
+        return cpu_backend_init();
+    }
+
     const char* hef_path = std::getenv("HEF_PATH");
     if (!hef_path) hef_path = HEF_FILE;
 
     std::cerr << "[hailo_det] Initializing Hailo with HEF: " << hef_path << "\n";
     if (hailo_init(hef_path) != 0) {
         std::cerr << "[hailo_det] Hailo init failed\n";
+        if (backend == "auto") {
+            std::cerr << "[hailo_det] falling back to CPU backend\n";
+            hailo_cleanup();
+            return cpu_backend_init();
+        }
         return -1;
     }
 
+    const char* spill_onnx = std::getenv("AIPEX_SPILL_ONNX");
+    if (spill_onnx && *spill_onnx) {
+        auto spill = std::make_unique<SpilloverScheduler>(SpilloverScheduler::FromEnv());
+        if (spill->Init() == 0) g_spill = std::move(spill);
+        else std::cerr << "[hailo_det] spillover disabled (CPU model load failed)\n";
+    }
+
+    DeviceWatchdog::Options wd = DeviceWatchdog::FromEnv();
+    if (wd.max_failures > 0) {
+        g_watchdog = std::make_unique<DeviceWatchdog>(wd, [busy_wait = wd.hang] { return hailo_reset_device(busy_wait); });
+    }
+
     std::cerr << "[hailo_det] Hailo ready. Waiting for gRPC requests...\n";
     return 0;
 }
\ No newline at end of file
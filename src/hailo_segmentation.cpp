@@ -0,0 +1,220 @@
+#include "hailo_segmentation.h"
+#include "env_config.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+
+SegConfig seg_config_from_env() {
+    SegConfig c;
+    c.score_threshold = static_cast<float>(env_double("AIPEX_SEG_SCORE_THRESHOLD", c.score_threshold));
+    c.mask_threshold = static_cast<float>(env_double("AIPEX_SEG_MASK_THRESHOLD", c.mask_threshold));
+    c.max_masks = static_cast<size_t>(env_double("AIPEX_SEG_MAX_MASKS", static_cast<double>(c.max_masks)));
+    c.budget_ms = env_double("AIPEX_SEG_BUDGET_MS", c.budget_ms);
+    c.masks_enabled = env_bool("AIPEX_SEG_MASKS", true);
+    return c;
+}
+
+static float box_iou(const SegDetection& a, const SegDetection& b) {
+    float x1 = std::max(a.x_min, b.x_min), y1 = std::max(a.y_min, b.y_min);
+    float x2 = std::min(a.x_max, b.x_max), y2 = std::min(a.y_max, b.y_max);
+    float inter = std::max(0.f, x2 - x1) * std::max(0.f, y2 - y1);
+    float uni = (a.x_max - a.x_min) * (a.y_max - a.y_min) + (b.x_max - b.x_min) * (b.y_max - b.y_min) - inter;
+    return uni > 0.f ? inter / uni : 0.f;
+}
+
+std::vector<SegDetection> decode_yolo_seg(const float* data, size_t rows, size_t row_len, bool transposed,
+                                          size_t num_classes, size_t num_coeffs,
+                                          int input_w, int input_h, const SegConfig& cfg)
+{
+    std::vector<SegDetection> cands;
+    if (row_len < 4 + num_classes + num_coeffs) return cands;
+    auto at = [&](size_t i, size_t j) { return transposed ? data[j * rows + i] : data[i * row_len + j]; };
+
+    for (size_t i = 0; i < rows; ++i) {
+        int best_cls = -1;
+        float best = cfg.score_threshold;
+        for (size_t c = 0; c < num_classes; ++c) {
+            float s = at(i, 4 + c);
+            if (s > best) { best = s; best_cls = static_cast<int>(c); }
+        }
+        if (best_cls < 0) continue;
+
+        float cx = at(i, 0), cy = at(i, 1), w = at(i, 2), h = at(i, 3);
+        SegDetection d;
+        d.x_min = std::clamp((cx - w * 0.5f) / input_w, 0.f, 1.f);
+        d.y_min = std::clamp((cy - h * 0.5f) / input_h, 0.f, 1.f);
+        d.x_max = std::clamp((cx + w * 0.5f) / input_w, 0.f, 1.f);
+        d.y_max = std::clamp((cy + h * 0.5f) / input_h, 0.f, 1.f);
+        d.score = best;
+        d.class_id = best_cls;
+        d.coeffs.resize(num_coeffs);
+        for (size_t k = 0; k < num_coeffs; ++k) d.coeffs[k] = at(i, 4 + num_classes + k);
+        cands.push_back(std::move(d));
+    }
+
+    // class-wise greedy NMS
+    std::sort(cands.begin(), cands.end(), [](const SegDetection& a, const SegDetection& b) { return a.score > b.score; });
+    std::vector<SegDetection> keep;
+    std::vector<bool> removed(cands.size(), false);
+    for (size_t i = 0; i < cands.size() && keep.size() < cfg.max_detections; ++i) {
+        if (removed[i]) continue;
+        for (size_t j = i + 1; j < cands.size(); ++j) {
+            if (!removed[j] && cands[j].class_id == cands[i].class_id && box_iou(cands[i], cands[j]) > cfg.iou_threshold) {
+                removed[j] = true;
+            }
+        }
+        keep.push_back(std::move(cands[i]));
+    }
+    return keep;
+}
+
+cv::Mat assemble_instance_mask(const float* proto, int mh, int mw, int nm,
+                               const SegDetection& det, float mask_threshold, cv::Rect& roi)
+{
+    int x0 = std::clamp(static_cast<int>(std::floor(det.x_min * mw)), 0, mw);
+    int y0 = std::clamp(static_cast<int>(std::floor(det.y_min * mh)), 0, mh);
+    int x1 = std::clamp(static_cast<int>(std::ceil(det.x_max * mw)), 0, mw);
+    int y1 = std::clamp(static_cast<int>(std::ceil(det.y_max * mh)), 0, mh);
+    roi = cv::Rect(x0, y0, std::max(0, x1 - x0), std::max(0, y1 - y0));
+    if (roi.width == 0 || roi.height == 0 || static_cast<int>(det.coeffs.size()) != nm) return cv::Mat();
+
+    // sigmoid(x) > t  <=>  x > log(t / (1 - t)) : exp 없이 logit 에서 바로 비교
+    float t = std::clamp(mask_threshold, 1e-4f, 1.f - 1e-4f);
+    float logit_thr = std::log(t / (1.f - t));
+
+    cv::Mat coeff(nm, 1, CV_32F, const_cast<float*>(det.coeffs.data()));
+    cv::Mat mask(roi.height, roi.width, CV_8UC1);
+    for (int y = 0; y < roi.height; ++y) {
+        // proto 한 행의 ROI 구간은 (roi.width x nm) 연속 블록 -> 행렬곱 한 번으로 logits 계산
+        const float* row = proto + (static_cast<size_t>(y0 + y) * mw + x0) * nm;
+        cv::Mat block(roi.width, nm, CV_32F, const_cast<float*>(row));
+        cv::Mat logits = block * coeff;
+        const float* lp = logits.ptr<float>(0);
+        uint8_t* mp = mask.ptr<uint8_t>(y);
+        for (int x = 0; x < roi.width; ++x) mp[x] = lp[x] > logit_thr ? 1 : 0;
+    }
+    return mask;
+}
+
+void rle_encode(const cv::Mat& binary_mask, std::vector<uint32_t>& counts) {
+    counts.clear();
+    uint8_t cur = 0;
+    uint32_t run = 0;
+    for (int y = 0; y < binary_mask.rows; ++y) {
+        const uint8_t* p = binary_mask.ptr<uint8_t>(y);
+        for (int x = 0; x < binary_mask.cols; ++x) {
+            uint8_t v = p[x] ? 1 : 0;
+            if (v != cur) {
+                counts.push_back(run);
+                run = 0;
+                cur = v;
+            }
+            run++;
+        }
+    }
+    counts.push_back(run);
+}
+
+cv::Mat rle_decode(const std::vector<uint32_t>& counts, int width, int height) {
+    cv::Mat out = cv::Mat::zeros(height, width, CV_8UC1);
+    if (width <= 0 || height <= 0) return out;
+    uint8_t* p = out.ptr<uint8_t>(0);
+    size_t total = static_cast<size_t>(width) * height;
+    size_t pos = 0;
+    uint8_t v = 0;
+    for (uint32_t c : counts) {
+        size_t end = std::min(total, pos + c);
+        if (v) std::fill(p + pos, p + end, 255);
+        pos = end;
+        v ^= 1;
+        if (pos >= total) break;
+    }
+    return out;
+}
+
+// 마스크 비용 측정 및 부하 시 gating
+namespace {
+struct SegStats {
+    std::mutex mtx;
+    uint64_t frames = 0;
+    uint64_t gated_frames = 0;
+    uint64_t masks = 0;
+    uint64_t bytes = 0;
+    double total_ms = 0.0;
+    double ewma_ms = 0.0;
+};
+SegStats g_seg_stats;
+
+size_t varint_size(uint32_t v) {
+    size_t n = 1;
+    while (v >= 0x80) { v >>= 7; ++n; }
+    return n;
+}
+} // namespace
+
+void run_segmentation_postprocess(const float* det_data, size_t rows, size_t row_len, bool transposed,
+                                  const float* proto, int mh, int mw, int nm,
+                                  size_t num_classes, int input_w, int input_h, const SegConfig& cfg,
+                                  std::vector<SegDetection>& dets, std::vector<EncodedMask>& masks)
+{
+    dets = decode_yolo_seg(det_data, rows, row_len, transposed, num_classes, static_cast<size_t>(nm), input_w, input_h, cfg);
+    masks.clear();
+
+    bool build = cfg.masks_enabled;
+    uint64_t frame_no;
+    {
+        std::lock_guard<std::mutex> lk(g_seg_stats.mtx);
+        frame_no = g_seg_stats.frames++;
+        // 예산 초과 시 stride 프레임마다 한 번만 마스크 생성
+        if (build && cfg.budget_ms > 0.0 && g_seg_stats.ewma_ms > cfg.budget_ms) {
+            uint64_t stride = static_cast<uint64_t>(std::ceil(g_seg_stats.ewma_ms / cfg.budget_ms));
+            if (frame_no % stride != 0) {
+                build = false;
+                g_seg_stats.gated_frames++;
+            }
+        }
+    }
+    if (!build) return;
+
+    auto t0 = std::chrono::steady_clock::now();
+    size_t bytes = 0;
+    for (size_t i = 0; i < dets.size() && masks.size() < cfg.max_masks; ++i) {
+        cv::Rect roi;
+        cv::Mat m = assemble_instance_mask(proto, mh, mw, nm, dets[i], cfg.mask_threshold, roi);
+        if (m.empty()) continue;
+        EncodedMask em;
+        em.detection_index = static_cast<uint32_t>(i);
+        em.x_min = static_cast<float>(roi.x) / mw;
+        em.y_min = static_cast<float>(roi.y) / mh;
+        em.x_max = static_cast<float>(roi.x + roi.width) / mw;
+        em.y_max = static_cast<float>(roi.y + roi.height) / mh;
+        em.width = static_cast<uint32_t>(roi.width);
+        em.height = static_cast<uint32_t>(roi.height);
+        em.class_id = dets[i].class_id;
+        em.score = dets[i].score;
+        rle_encode(m, em.counts);
+        bytes += 32; // ROI/크기/label 등 고정 필드 대략치
+        for (uint32_t c : em.counts) bytes += varint_size(c);
+        masks.push_back(std::move(em));
+    }
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+    std::lock_guard<std::mutex> lk(g_seg_stats.mtx);
+    g_seg_stats.masks += masks.size();
+    g_seg_stats.bytes += bytes;
+    g_seg_stats.total_ms += ms;
+    g_seg_stats.ewma_ms = g_seg_stats.ewma_ms <= 0.0 ? ms : 0.9 * g_seg_stats.ewma_ms + 0.1 * ms;
+    if (g_seg_stats.frames % 100 == 0) {
+        double built = static_cast<double>(g_seg_stats.frames - g_seg_stats.gated_frames);
+        std::cerr << "[seg] frames=" << g_seg_stats.frames
+                  << " masks/frame=" << (built > 0 ? g_seg_stats.masks / built : 0.0)
+                  << " bytes/frame=" << (built > 0 ? g_seg_stats.bytes / built : 0.0)
+                  << " cpu_ms/frame=" << (built > 0 ? g_seg_stats.total_ms / built : 0.0)
+                  << " ewma_ms=" << g_seg_stats.ewma_ms
+                  << " gated=" << g_seg_stats.gated_frames << "\n";
+    }
+}
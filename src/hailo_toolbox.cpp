@@ -1,5 +1,6 @@
 #include "hailo_toolbox.h"
 #include "hailo_infer.h"
+#include "perf_counters.h"
 namespace hailo_utils {
 hailo_status check_status(const hailo_status &status, const std::string &message) {
     if (HAILO_SUCCESS != status) {
@@ -270,7 +271,10 @@ void preprocess_video_frames(cv::VideoCapture &capture,
         
         if (org_frames.size() == batch_size) {
             preprocessed_frames.clear();
-            preprocess_callback(org_frames, preprocessed_frames, width, height);
+            {
+                PerfStage stage("preprocess", org_frames.size());
+                preprocess_callback(org_frames, preprocessed_frames, width, height);
+            }
             preprocessed_batch_queue->push(std::make_pair(org_frames, preprocessed_frames));
             org_frames.clear();
         }
@@ -284,7 +288,10 @@ void preprocess_image_frames(const std::string &input_path,
     cv::Mat org_frame = cv::imread(input_path);
     std::vector<cv::Mat> org_frames = {org_frame}; 
     std::vector<cv::Mat> preprocessed_frames;
-    preprocess_callback(org_frames, preprocessed_frames, width, height);
+    {
+        PerfStage stage("preprocess", org_frames.size());
+        preprocess_callback(org_frames, preprocessed_frames, width, height);
+    }
     preprocessed_batch_queue->push(std::make_pair(org_frames, preprocessed_frames));
     
     preprocessed_batch_queue->stop();
@@ -305,7 +312,10 @@ void preprocess_directory_of_images(const std::string &input_path,
                 
                 if (org_frames.size() == batch_size) {
                     preprocessed_frames.clear();
-                    preprocess_callback(org_frames, preprocessed_frames, width, height);
+                    {
+                        PerfStage stage("preprocess", org_frames.size());
+                        preprocess_callback(org_frames, preprocessed_frames, width, height);
+                    }
                     preprocessed_batch_queue->push(std::make_pair(org_frames, preprocessed_frames));
                     org_frames.clear();
                 }
@@ -340,6 +350,7 @@ hailo_status run_post_process(
         auto& frame_to_draw = output_item.org_frame;
 
         if (!output_item.output_data_and_infos.empty() && postprocess_callback) {
+            PerfStage stage("postprocess");
             postprocess_callback(frame_to_draw, output_item.output_data_and_infos);
         }
         
@@ -394,6 +405,7 @@ hailo_status run_inference_async(HailoInfer& model,
         model.wait_for_last_job();
     }
     results_queue->stop();
+    perf_counters_report();
     auto end_time = std::chrono::high_resolution_clock::now();
 
     inference_time = end_time - start_time;
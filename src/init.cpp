@@ -1,9 +1,13 @@
 #include "init.h"
 #include "grpc_server.h"
+#include <chrono>
 #include <future>
 #include <iostream>
 
-bool init_system(GrpcServer &server, std::thread &server_thread) {
+// hailo_object_detection.cpp
+extern int hailo_object_detection(int argc, char** argv);
+
+static bool start_server(GrpcServer &server, std::thread &server_thread) {
     std::promise<void> started;
     auto started_fut = started.get_future();
 
@@ -21,8 +25,16 @@ bool init_system(GrpcServer &server, std::thread &server_thread) {
         if (server_thread.joinable()) server_thread.join();
         return false;
     }
+    return true;
+}
+
+bool init_system(GrpcServer &server, std::thread &server_thread) {
+    if (!start_server(server, server_thread)) return false;
 
-    // Hailo 초기화
+    // Hailo 초기화 (실패해도 서버는 유지, 추론 요청은 에러로 응답)
+    if (hailo_object_detection(0, nullptr) != 0) {
+        std::cerr << "Hailo init failed, inference unavailable\n";
+    }
     return true;
 }
 
@@ -30,4 +42,14 @@ void shutdown_system(GrpcServer &server, std::thread &server_thread) {
     // 역순으로 정리
     server.Shutdown();
     if (server_thread.joinable()) server_thread.join();
-}
\ No newline at end of file
+}
+
+bool restart_server(GrpcServer &server, std::thread &server_thread) {
+    // 서버만 내렸다 올림. Hailo 장치/configured model 은 프로세스 전역이라 다시 초기화하지 않음
+    auto t0 = std::chrono::steady_clock::now();
+    shutdown_system(server, server_thread);
+    bool ok = start_server(server, server_thread);
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - t0;
+    std::cerr << "[init] server restart " << (ok ? "done" : "failed") << " in " << elapsed.count() << " ms\n";
+    return ok;
+}
@@ -0,0 +1,218 @@
+#include "jpeg_codec.h"
+#include "env_config.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#if AIPEX_TURBOJPEG
+#include <turbojpeg.h>
+#endif
+
+JpegEncodeOptions JpegEncodeOptions::FromEnv() {
+    JpegEncodeOptions o;
+    o.quality = std::min(100, std::max(1, env_int("AIPEX_JPEG_QUALITY", o.quality)));
+    int s = env_int("AIPEX_JPEG_SUBSAMP", o.subsampling);
+    o.subsampling = (s == 444 || s == 422) ? s : 420;
+    o.fast_dct = env_bool("AIPEX_JPEG_FAST_DCT", false);
+    return o;
+}
+
+#if AIPEX_TURBOJPEG
+
+namespace {
+
+// 스레드 종료 시 handle 정리
+struct TjHandle {
+    tjhandle h = nullptr;
+    ~TjHandle() {
+        if (h) tjDestroy(h);
+    }
+};
+
+tjhandle decompressor() {
+    thread_local TjHandle t;
+    if (!t.h) t.h = tjInitDecompress();
+    return t.h;
+}
+
+tjhandle compressor() {
+    thread_local TjHandle t;
+    if (!t.h) t.h = tjInitCompress();
+    return t.h;
+}
+
+int tj_subsamp(int s) {
+    return s == 444 ? TJSAMP_444 : s == 422 ? TJSAMP_422 : TJSAMP_420;
+}
+
+// 크기를 이미 확인한 데이터 디코드 (헤더는 다시 확인하지 않음)
+bool tj_decode(const uint8_t* data, size_t size, uint8_t* dst, int width, int height, size_t pitch,
+               PixelOrder order, bool fast_dct) {
+    int flags = fast_dct ? TJFLAG_FASTDCT : 0;
+    if (tjDecompress2(decompressor(), data, static_cast<unsigned long>(size), dst, width, static_cast<int>(pitch),
+                      height, order == PixelOrder::RGB ? TJPF_RGB : TJPF_BGR, flags) != 0) {
+        std::cerr << "[jpeg] decode failed: " << tjGetErrorStr2(decompressor()) << "\n";
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+bool jpeg_dimensions(const uint8_t* data, size_t size, int& width, int& height) {
+    tjhandle h = decompressor();
+    int subsamp = 0, colorspace = 0;
+    return h && tjDecompressHeader3(h, data, static_cast<unsigned long>(size), &width, &height, &subsamp,
+                                    &colorspace) == 0;
+}
+
+bool jpeg_decode_into(const uint8_t* data, size_t size, uint8_t* dst, int width, int height, size_t pitch,
+                      PixelOrder order, bool fast_dct) {
+    int w = 0, h = 0;
+    if (!jpeg_dimensions(data, size, w, h) || w != width || h != height) return false;
+    return tj_decode(data, size, dst, width, height, pitch, order, fast_dct);
+}
+
+bool jpeg_encode(const cv::Mat& bgr, JpegBuffer& out, const JpegEncodeOptions& opts) {
+    if (bgr.empty() || bgr.type() != CV_8UC3) return false;
+    tjhandle h = compressor();
+    if (!h) return false;
+    int subsamp = tj_subsamp(opts.subsampling);
+    size_t max_size = tjBufSize(bgr.cols, bgr.rows, subsamp);
+    if (out.buf_.size() < max_size) out.buf_.resize(max_size);
+    unsigned char* dst = out.buf_.data();
+    unsigned long jpeg_size = static_cast<unsigned long>(out.buf_.size());
+    int flags = TJFLAG_NOREALLOC | (opts.fast_dct ? TJFLAG_FASTDCT : 0);
+    if (tjCompress2(h, bgr.data, bgr.cols, static_cast<int>(bgr.step[0]), bgr.rows, TJPF_BGR, &dst, &jpeg_size,
+                    subsamp, opts.quality, flags) != 0) {
+        std::cerr << "[jpeg] encode failed: " << tjGetErrorStr2(h) << "\n";
+        out.size_ = 0;
+        return false;
+    }
+    out.size_ = jpeg_size;
+    return true;
+}
+
+bool jpeg_decode(const uint8_t* data, size_t size, cv::Mat& out, PixelOrder order, bool fast_dct) {
+    int w = 0, h = 0;
+    if (!data || size == 0 || !jpeg_dimensions(data, size, w, h)) return false;
+    // 이전 결과를 다른 곳(결과 이미지, audit 등)이 아직 참조하면 덮어쓰지 않고 새로 할당
+    if (out.u && out.u->refcount > 1) out.release();
+    out.create(h, w, CV_8UC3);
+    return tj_decode(data, size, out.data, w, h, out.step[0], order, fast_dct);
+}
+
+#else // OpenCV 경로
+
+// SOF 세그먼트까지 marker 만 따라가며 크기를 읽음 (이미지 데이터는 디코드하지 않음)
+bool jpeg_dimensions(const uint8_t* data, size_t size, int& width, int& height) {
+    if (!data || size < 4 || data[0] != 0xFF || data[1] != 0xD8) return false;
+    size_t pos = 2;
+    while (pos + 4 <= size) {
+        if (data[pos] != 0xFF) return false;
+        uint8_t marker = data[pos + 1];
+        if (marker == 0xFF) { // fill byte
+            pos++;
+            continue;
+        }
+        if (marker == 0xD8 || marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7)) { // 길이 없는 marker
+            pos += 2;
+            continue;
+        }
+        size_t len = (static_cast<size_t>(data[pos + 2]) << 8) | data[pos + 3];
+        if (len < 2 || pos + 2 + len > size) return false;
+        // SOF0..SOF15 (DHT C4, JPG C8, DAC CC 제외)
+        if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC) {
+            if (len < 7) return false;
+            height = (data[pos + 5] << 8) | data[pos + 6];
+            width = (data[pos + 7] << 8) | data[pos + 8];
+            return width > 0 && height > 0;
+        }
+        if (marker == 0xDA || marker == 0xD9) return false; // SOF 없이 scan/끝
+        pos += 2 + len;
+    }
+    return false;
+}
+
+bool jpeg_decode_into(const uint8_t* data, size_t size, uint8_t* dst, int width, int height, size_t pitch,
+                      PixelOrder order, bool) {
+    cv::Mat img = cv::imdecode(cv::Mat(1, static_cast<int>(size), CV_8UC1, const_cast<uint8_t*>(data)),
+                               cv::IMREAD_COLOR);
+    if (img.empty() || img.cols != width || img.rows != height) return false;
+    cv::Mat view(height, width, CV_8UC3, dst, pitch);
+    if (order == PixelOrder::RGB) cv::cvtColor(img, view, cv::COLOR_BGR2RGB);
+    else img.copyTo(view);
+    return true;
+}
+
+bool jpeg_encode(const cv::Mat& bgr, JpegBuffer& out, const JpegEncodeOptions& opts) {
+    std::vector<uint8_t> enc;
+    if (bgr.empty() || !cv::imencode(".jpg", bgr, enc, {cv::IMWRITE_JPEG_QUALITY, opts.quality})) {
+        out.size_ = 0;
+        return false;
+    }
+    if (out.buf_.size() < enc.size()) out.buf_.resize(enc.size());
+    std::memcpy(out.buf_.data(), enc.data(), enc.size());
+    out.size_ = enc.size();
+    return true;
+}
+
+// 디코드는 한 번만. imdecode 가 dst 를 create 하므로 같은 크기면 out 의 메모리를 다시 씀
+bool jpeg_decode(const uint8_t* data, size_t size, cv::Mat& out, PixelOrder order, bool) {
+    if (!data || size == 0) return false;
+    if (out.u && out.u->refcount > 1) out.release();
+    cv::Mat buf(1, static_cast<int>(size), CV_8UC1, const_cast<uint8_t*>(data));
+    if (order == PixelOrder::BGR) {
+        cv::imdecode(buf, cv::IMREAD_COLOR, &out);
+        return !out.empty();
+    }
+    thread_local cv::Mat bgr;
+    cv::imdecode(buf, cv::IMREAD_COLOR, &bgr);
+    if (bgr.empty()) return false;
+    cv::cvtColor(bgr, out, cv::COLOR_BGR2RGB);
+    return true;
+}
+
+#endif
+
+void benchmark_jpeg_codec(int width, int height, int iterations) {
+    if (iterations <= 0) return;
+    // 실제 영상에 가까운 압축률이 나오도록 잡음을 흐려 씀
+    cv::Mat src(height, width, CV_8UC3);
+    cv::randu(src, cv::Scalar::all(0), cv::Scalar::all(255));
+    cv::GaussianBlur(src, src, cv::Size(9, 9), 0);
+    const JpegEncodeOptions opts = JpegEncodeOptions::FromEnv();
+
+    auto time_us = [&](auto&& fn) {
+        fn(); // warm-up (handle/버퍼 생성 포함)
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) fn();
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / iterations;
+    };
+
+    std::vector<uint8_t> cv_buf;
+    double enc_cv = time_us([&] { cv::imencode(".jpg", src, cv_buf, {cv::IMWRITE_JPEG_QUALITY, opts.quality}); });
+    JpegBuffer jbuf;
+    double enc_codec = time_us([&] { jpeg_encode(src, jbuf, opts); });
+
+    cv::Mat rgb;
+    double dec_cv = time_us([&] {
+        cv::Mat bgr = cv::imdecode(cv_buf, cv::IMREAD_COLOR);
+        cv::cvtColor(bgr, rgb, cv::COLOR_BGR2RGB);
+    });
+    cv::Mat reused;
+    double dec_codec = time_us([&] { jpeg_decode(jbuf.data(), jbuf.size(), reused, PixelOrder::RGB, opts.fast_dct); });
+
+    std::cerr << "[jpeg] bench " << width << "x" << height << " q=" << opts.quality << " subsamp=" << opts.subsampling
+              << " fast_dct=" << opts.fast_dct
+#if AIPEX_TURBOJPEG
+              << " codec=turbojpeg"
+#else
+              << " codec=opencv"
+#endif
+              << " | encode imencode=" << enc_cv << "us codec=" << enc_codec << "us"
+              << " (" << cv_buf.size() << " / " << jbuf.size() << " bytes)"
+              << " | decode imdecode+cvtColor=" << dec_cv << "us codec(rgb)=" << dec_codec << "us\n";
+}
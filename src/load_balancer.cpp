@@ -0,0 +1,148 @@
+#include "load_balancer.h"
+#include <algorithm>
+#include <limits>
+
+// 지연 EWMA 가중치 (최근 값 비중)
+static constexpr double kLatencyAlpha = 0.2;
+
+LoadBalancer::LoadBalancer(Policy policy) : policy_(policy) {}
+
+LoadBalancer::Policy LoadBalancer::PolicyFromString(const std::string& s) {
+    if (s == "latency" || s == "lowest_latency") return Policy::LOWEST_LATENCY;
+    return Policy::LEAST_OUTSTANDING;
+}
+
+size_t LoadBalancer::AddBackend(const std::string& target) {
+    std::lock_guard<std::mutex> lk(mtx_);
+    Entry e;
+    e.stats.target = target;
+    e.last_activity = std::chrono::steady_clock::now();
+    entries_.push_back(std::move(e));
+    return entries_.size() - 1;
+}
+
+size_t LoadBalancer::Size() const {
+    std::lock_guard<std::mutex> lk(mtx_);
+    return entries_.size();
+}
+
+double LoadBalancer::CostLocked(const Entry& e) const {
+    double outstanding = static_cast<double>(e.inflight.size());
+    // 아직 측정값이 없으면 heartbeat RTT 를, 그것도 없으면 0 으로 시작
+    double lat = e.stats.ewma_latency_ms > 0.0 ? e.stats.ewma_latency_ms : e.stats.heartbeat_rtt_ms;
+    if (policy_ == Policy::LOWEST_LATENCY) {
+        // 큐에 쌓인 만큼 기다려야 하므로 (outstanding + 1) 배
+        return (lat + 1.0) * (outstanding + 1.0);
+    }
+    // least outstanding: 동률이면 지연이 낮은 쪽
+    return outstanding * 1e6 + lat;
+}
+
+int LoadBalancer::Pick(int exclude) const {
+    std::lock_guard<std::mutex> lk(mtx_);
+    int best = -1;
+    double best_cost = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        if (!entries_[i].stats.healthy || static_cast<int>(i) == exclude) continue;
+        double c = CostLocked(entries_[i]);
+        if (c < best_cost) {
+            best_cost = c;
+            best = static_cast<int>(i);
+        }
+    }
+    return best;
+}
+
+void LoadBalancer::OnSent(size_t idx, uint64_t frame_id, std::chrono::steady_clock::time_point now) {
+    std::lock_guard<std::mutex> lk(mtx_);
+    if (idx >= entries_.size()) return;
+    auto& e = entries_[idx];
+    if (e.inflight.empty()) e.last_activity = now;
+    e.inflight[frame_id] = now;
+    e.stats.outstanding = e.inflight.size();
+}
+
+double LoadBalancer::OnResult(size_t idx, uint64_t frame_id, std::chrono::steady_clock::time_point now) {
+    std::lock_guard<std::mutex> lk(mtx_);
+    if (idx >= entries_.size()) return -1.0;
+    auto& e = entries_[idx];
+    e.last_activity = now;
+    auto it = e.inflight.find(frame_id);
+    if (it == e.inflight.end()) return -1.0;
+    double ms = std::chrono::duration<double, std::milli>(now - it->second).count();
+    e.inflight.erase(it);
+    e.stats.outstanding = e.inflight.size();
+    e.stats.completed++;
+    e.stats.ewma_latency_ms = e.stats.ewma_latency_ms <= 0.0
+        ? ms : (1.0 - kLatencyAlpha) * e.stats.ewma_latency_ms + kLatencyAlpha * ms;
+    return ms;
+}
+
+void LoadBalancer::OnFailed(size_t idx, uint64_t frame_id) {
+    std::lock_guard<std::mutex> lk(mtx_);
+    if (idx >= entries_.size()) return;
+    auto& e = entries_[idx];
+    e.inflight.erase(frame_id);
+    e.stats.outstanding = e.inflight.size();
+}
+
+void LoadBalancer::OnHeartbeatRtt(size_t idx, double rtt_ms) {
+    std::lock_guard<std::mutex> lk(mtx_);
+    if (idx >= entries_.size()) return;
+    auto& e = entries_[idx];
+    e.last_activity = std::chrono::steady_clock::now();
+    e.stats.heartbeat_rtt_ms = e.stats.heartbeat_rtt_ms <= 0.0
+        ? rtt_ms : (1.0 - kLatencyAlpha) * e.stats.heartbeat_rtt_ms + kLatencyAlpha * rtt_ms;
+}
+
+void LoadBalancer::OnActivity(size_t idx) {
+    std::lock_guard<std::mutex> lk(mtx_);
+    if (idx < entries_.size()) entries_[idx].last_activity = std::chrono::steady_clock::now();
+}
+
+void LoadBalancer::SetHealthy(size_t idx, bool healthy) {
+    std::lock_guard<std::mutex> lk(mtx_);
+    if (idx >= entries_.size()) return;
+    entries_[idx].stats.healthy = healthy;
+    if (healthy) entries_[idx].last_activity = std::chrono::steady_clock::now();
+}
+
+bool LoadBalancer::IsHealthy(size_t idx) const {
+    std::lock_guard<std::mutex> lk(mtx_);
+    return idx < entries_.size() && entries_[idx].stats.healthy;
+}
+
+std::vector<size_t> LoadBalancer::FindStalled(std::chrono::milliseconds dead_after) const {
+    std::lock_guard<std::mutex> lk(mtx_);
+    std::vector<size_t> out;
+    auto now = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        const auto& e = entries_[i];
+        if (!e.stats.healthy || e.inflight.empty()) continue;
+        // 미완료 프레임이 있는데 heartbeat 응답도 결과도 없이 dead_after 가 지나면 멈춘 것으로 판단.
+        // 한가하던 보드는 가장 오래된 미완료 프레임을 보낸 시각부터 셈
+        auto oldest = e.inflight.begin()->second;
+        for (const auto& kv : e.inflight) oldest = std::min(oldest, kv.second);
+        if (now - std::max(e.last_activity, oldest) > dead_after) out.push_back(i);
+    }
+    return out;
+}
+
+std::vector<uint64_t> LoadBalancer::TakeOutstanding(size_t idx) {
+    std::lock_guard<std::mutex> lk(mtx_);
+    std::vector<uint64_t> out;
+    if (idx >= entries_.size()) return out;
+    auto& e = entries_[idx];
+    for (const auto& kv : e.inflight) out.push_back(kv.first);
+    e.inflight.clear();
+    e.stats.outstanding = 0;
+    e.stats.failures++;
+    return out;
+}
+
+std::vector<LoadBalancer::BackendStats> LoadBalancer::Stats() const {
+    std::lock_guard<std::mutex> lk(mtx_);
+    std::vector<BackendStats> out;
+    for (const auto& e : entries_) out.push_back(e.stats);
+    return out;
+}
@@ -2,6 +2,11 @@
 #include "grpc_client.h"
 #include "power_control.h"
 #include "init.h"
+#include "service_discovery.h"
+#include "rate_governor.h"
+#include "box_predictor.h"
+#include "executor.h"
+#include "perf_counters.h"
 #include <iostream>
 #include <string>
 #include <thread>
@@ -9,62 +14,62 @@
 #include <chrono>
 #include <atomic>
 #include <csignal>
-#include <netdb.h>
-#include <arpa/inet.h>
-#include <cstdio>
 #include <memory>
-#include <array>
+#include <vector>
+#include <sstream>
 #include <opencv2/opencv.hpp>
 
 static std::atomic<bool> g_terminate{false};
 static void signal_handler(int) { g_terminate.store(true); }
+// SIGHUP: gRPC 서버만 재시작 (추론 장치는 유지)
+static std::atomic<bool> g_restart_server{false};
+static void restart_handler(int) { g_restart_server.store(true); }
 
-// helper: try getaddrinfo for hostname (without :port). returns IP string or empty.
-static std::string resolve_hostname(const std::string& host) {
-    addrinfo hints{}, *res = nullptr;
-    hints.ai_family = AF_UNSPEC;
-    hints.ai_socktype = SOCK_STREAM;
-    if (getaddrinfo(host.c_str(), nullptr, &hints, &res) != 0) return "";
-
-    char buf[INET6_ADDRSTRLEN] = {0};
-    for (addrinfo* p = res; p != nullptr; p = p->ai_next) {
-        void* addr = nullptr;
-        if (p->ai_family == AF_INET) {
-            addr = &((sockaddr_in*)p->ai_addr)->sin_addr;
-        } else if (p->ai_family == AF_INET6) {
-            addr = &((sockaddr_in6*)p->ai_addr)->sin6_addr;
-        }
-        if (addr && inet_ntop(p->ai_family, addr, buf, sizeof(buf))) {
-            std::string ip(buf);
-            freeaddrinfo(res);
-            return ip;
-        }
+// AIPEX_DISCOVERY_HOSTS="AipexFW.local,AipexFW-2.local" 형태의 목록 파싱
+static std::vector<std::string> split_csv(const std::string& s) {
+    std::vector<std::string> out;
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) out.push_back(item);
     }
-    freeaddrinfo(res);
-    return "";
+    return out;
 }
 
-// fallback: call avahi-resolve -n <name>
-static std::string avahi_resolve(const std::string& name) {
-    std::array<char, 256> buf;
-    std::string cmd = "avahi-resolve -n " + name + " 2>/dev/null";
-    std::string out;
-    std::unique_ptr<FILE, decltype(&pclose)> pipe(popen(cmd.c_str(), "r"), pclose);
-    if (!pipe) return "";
-    while (fgets(buf.data(), (int)buf.size(), pipe.get()) != nullptr) out += buf.data();
-    // avahi-resolve returns "name<TAB>ip\n" on success
-    if (out.empty()) return "";
-    size_t tab = out.find('\t');
-    if (tab == std::string::npos) return "";
-    std::string ip = out.substr(tab + 1);
-    // trim newline
-    if (!ip.empty() && ip.back() == '\n') ip.pop_back();
-    return ip;
+// 움직임 점수: 축소 grayscale 프레임의 평균 변화율 (0..1)
+static void observe_motion(const cv::Mat& frame, cv::Mat& prev, RateGovernor& governor) {
+    cv::Mat small;
+    cv::resize(frame, small, cv::Size(64, 64), 0, 0, cv::INTER_AREA);
+    cv::cvtColor(small, small, cv::COLOR_BGR2GRAY);
+    if (!prev.empty()) {
+        cv::Mat diff;
+        cv::absdiff(small, prev, diff);
+        governor.ObserveMotion(cv::mean(diff)[0] / 255.0);
+    }
+    prev = small;
 }
 
+// 보조(후방) 카메라: 같은 스트림에 camera_id=1 로 섞어 보냄. 전송률/움직임/박스 예측 상태는 카메라별
+struct RearCamera {
+    static constexpr uint32_t kCameraId = 1;
+    cv::VideoCapture cap;
+    RateGovernor governor;
+    BoxPredictor predictor{BoxPredictor::FromEnv()};
+    cv::Mat motion_prev;
+    cv::Mat frame; // 최근 로컬 프레임 (원격 프레임이 없을 때 PIP 로 표시)
+    explicit RearCamera(double fps) : governor(RateGovernor::FromEnv(fps)) {}
+};
+
 int main() {
     std::signal(SIGINT, signal_handler);
     std::signal(SIGTERM, signal_handler);
+    std::signal(SIGHUP, restart_handler);
+
+    // 병렬 작업은 공용 executor 가 담당. OpenCV 자체 스레드 풀까지 코어 수만큼 돌면 과구독되므로 기본 1
+    {
+        const char* cvt = std::getenv("AIPEX_CV_THREADS");
+        cv::setNumThreads(cvt && *cvt ? std::atoi(cvt) : 1);
+    }
 
     const char* p = std::getenv("GRPC_PORT");
     std::string addr = "0.0.0.0:50051";
@@ -74,24 +79,42 @@ int main() {
     std::string default_target = std::string("AipexFW.local:") + (p && *p ? std::string(p) : std::string("50051"));
     std::string target = t && *t ? std::string(t) : default_target;
 
-    // if target uses .local, try native getaddrinfo then avahi-resolve fallback
-    auto colon = target.find(':');
+    // .local 타겟이면 ServiceDiscovery 사용: 디스크 캐시로 즉시 시작하고 mDNS 는 백그라운드 갱신
+    std::unique_ptr<ServiceDiscovery> discovery;
+    auto colon = target.rfind(':');
     if (colon != std::string::npos) {
         std::string host = target.substr(0, colon);
         std::string port = target.substr(colon + 1);
-        if (host.size() > 6 && host.rfind(".local") == host.size() - 6) {
-            std::string ip = resolve_hostname(host);
-            if (ip.empty()) {
-                std::cerr << "[main] getaddrinfo failed for " << host << ", trying avahi-resolve\n";
-                ip = avahi_resolve(host);
+        const char* dfile = std::getenv("AIPEX_DISCOVERY_FILE");
+        bool is_local = host.size() > 6 && host.rfind(".local") == host.size() - 6;
+        if (is_local || (dfile && *dfile)) {
+            ServiceDiscovery::Options dopts;
+            const char* cache = std::getenv("AIPEX_DISCOVERY_CACHE");
+            dopts.cache_path = cache && *cache ? std::string(cache) : std::string("/var/tmp/aipex_discovery.cache");
+            discovery = std::make_unique<ServiceDiscovery>(dopts);
+
+            if (dfile && *dfile) {
+                discovery->AddSource(std::make_unique<StaticFileSource>(dfile));
             } else {
-                std::cerr << "[main] resolved " << host << " -> " << ip << " via getaddrinfo\n";
+                std::vector<std::string> hosts{host};
+                const char* extra = std::getenv("AIPEX_DISCOVERY_HOSTS");
+                if (extra && *extra) {
+                    for (auto& h : split_csv(extra)) if (h != host) hosts.push_back(h);
+                }
+                discovery->AddSource(std::make_unique<MdnsSource>("_aipex._tcp.local", hosts,
+                                                                  static_cast<uint16_t>(std::atoi(port.c_str()))));
             }
-            if (!ip.empty()) {
-                target = ip + ":" + port;
-                std::cerr << "[main] using target " << target << " (resolved from " << host << ")\n";
-            } else {
-                std::cerr << "[main] failed to resolve " << host << ", leaving target as " << target << "\n";
+
+            discovery->LoadCache();
+            discovery->Start();
+            // 캐시가 비어 있을 때(최초 부팅)만 첫 탐색 결과를 잠깐 기다림
+            if (discovery->Endpoints().empty() && !discovery->WaitForEndpoints(std::chrono::milliseconds(2000))) {
+                std::cerr << "[main] no endpoint discovered for " << host << ", leaving target as " << target << "\n";
+            }
+            auto eps = discovery->Endpoints();
+            if (!eps.empty()) {
+                target = eps.front();
+                std::cerr << "[main] using target " << target << " (" << eps.size() << " endpoint(s) known)\n";
             }
         }
     }
@@ -122,7 +145,39 @@ int main() {
     int frame_delay_ms = static_cast<int>(1000.0 / video_fps);
     std::cerr << "[main] Video FPS: " << video_fps << ", frame delay: " << frame_delay_ms << "ms\n";
 
+    // 장면 적응형 전송률: 검출/움직임이 없으면 min_fps 까지 감속
+    RateGovernor governor(RateGovernor::FromEnv(video_fps));
+    std::cerr << "[main] rate governor " << (governor.options().enabled ? "on" : "off")
+              << " min=" << governor.options().min_fps << "fps max=" << governor.options().max_fps << "fps\n";
+    cv::Mat motion_prev;
+    auto last_rate_report = std::chrono::steady_clock::now();
+    size_t results_total = 0, results_cpu = 0; // 서버 spillover 비율 확인용
+
+    // 지연 보상: 결과 박스를 round trip 만큼 앞으로 외삽하여 표시
+    BoxPredictor predictor(BoxPredictor::FromEnv());
+    // segmentation 마스크: 최신 결과를 predictor 의 max_age 동안 유지
+    std::vector<GrpcClient::Mask> last_masks;
+    auto last_masks_at = std::chrono::steady_clock::now();
+
+    // AIPEX_REAR_VIDEO: 두 번째 영상(또는 장치) 을 camera_id=1 로 함께 전송, 화면 우하단 PIP
+    std::unique_ptr<RearCamera> rear;
+    if (const char* rv = std::getenv("AIPEX_REAR_VIDEO"); rv && *rv) {
+        cv::VideoCapture rcap(rv);
+        if (rcap.isOpened()) {
+            double rfps = rcap.get(cv::CAP_PROP_FPS);
+            rear = std::make_unique<RearCamera>(rfps > 0 ? rfps : video_fps);
+            rear->cap = std::move(rcap);
+            std::cerr << "[main] rear camera: " << rv << " (camera_id=" << RearCamera::kCameraId << ")\n";
+        } else {
+            std::cerr << "[main] Failed to open rear video: " << rv << "\n";
+        }
+    }
+
     GrpcClient client(target);
+    if (discovery) {
+        client.SetEndpoints(discovery->Endpoints());
+        discovery->SetListener([&client](const std::vector<std::string>& eps) { client.SetEndpoints(eps); });
+    }
     client.StartStreaming();
 
     std::cerr << "[main] streaming started to " << target << " — sending frames from video\n";
@@ -136,6 +191,7 @@ int main() {
     client.SendRequest("wakeup");
     while (!g_terminate.load() && cap.read(frame)) {
         if (frame.empty()) break;
+        if (g_restart_server.exchange(false) && !restart_server(server, server_thread)) break;
         
         // Rotate 90 degrees clockwise to correct orientation
         cv::Mat frame_rotated;
@@ -145,8 +201,26 @@ int main() {
         cv::Mat frame_resized;
         cv::resize(frame_rotated, frame_resized, cv::Size(target_size, target_size));
         
-        bool ok = client.SendFrame(frame_resized);
-        if (!ok) break;
+        observe_motion(frame_resized, motion_prev, governor);
+
+        if (governor.ShouldSend()) {
+            bool ok = client.SendFrame(frame_resized);
+            if (!ok) break;
+        }
+
+        // 후방 카메라는 영상이 끝나면 처음부터 다시 (주 영상이 루프 수명을 결정)
+        if (rear) {
+            cv::Mat rf;
+            if (!rear->cap.read(rf) || rf.empty()) {
+                rear->cap.set(cv::CAP_PROP_POS_FRAMES, 0);
+                rear->cap.read(rf);
+            }
+            if (!rf.empty()) {
+                cv::resize(rf, rear->frame, cv::Size(target_size, target_size));
+                observe_motion(rear->frame, rear->motion_prev, rear->governor);
+                if (rear->governor.ShouldSend() && !client.SendFrame(rear->frame, RearCamera::kCameraId)) break;
+            }
+        }
 
         // 색상 맵 및 텍스트/두께 스케일링 헬퍼 (전송 루프 바로 위에 위치)
         std::map<std::string, cv::Scalar> class_colors = {
@@ -191,6 +265,7 @@ int main() {
             std::ostringstream ss;
             if (!b.label.empty()) ss << b.label << " ";
             ss << std::fixed << std::setprecision(2) << b.score;
+            if (!b.subclass.empty()) ss << " " << b.subclass << " " << b.subclass_score;
             std::string text = ss.str();
 
             int baseline = 0;
@@ -203,22 +278,78 @@ int main() {
             cv::putText(img, text, cv::Point(tx + 3, ty + tsize.height + 1), cv::FONT_HERSHEY_COMPLEX, font_scale, cv::Scalar(255,255,255), std::max(1, thickness/2), cv::LINE_AA);
         };
 
+        // 인스턴스 마스크 overlay: ROI 로 확대한 마스크 영역만 class 색으로 반투명 합성
+        // 마스크별 확대/색 합성은 executor 에서 병렬로 계산하고, 화면 버퍼에 복사는 이 스레드에서 순서대로
+        auto draw_masks_on = [&](cv::Mat &img, const std::vector<GrpcClient::Mask> &masks){
+            struct Overlay { cv::Rect r; cv::Mat tinted, alpha; };
+            std::vector<Overlay> overlays(masks.size());
+            Executor::Instance().ParallelFor(masks.size(), [&](size_t i) {
+                const auto &m = masks[i];
+                if (m.width <= 0 || m.height <= 0 || m.alpha.size() != static_cast<size_t>(m.width) * m.height) return;
+                cv::Rect r(cv::Point(static_cast<int>(std::round(m.x_min * img.cols)), static_cast<int>(std::round(m.y_min * img.rows))),
+                           cv::Point(static_cast<int>(std::round(m.x_max * img.cols)), static_cast<int>(std::round(m.y_max * img.rows))));
+                r &= cv::Rect(0, 0, img.cols, img.rows);
+                if (r.area() <= 0) return;
+                cv::Mat alpha(m.height, m.width, CV_8UC1, const_cast<uint8_t*>(m.alpha.data()));
+                cv::resize(alpha, overlays[i].alpha, r.size(), 0, 0, cv::INTER_NEAREST);
+                cv::Mat roi = img(r);
+                cv::addWeighted(roi, 0.55, cv::Mat(roi.size(), roi.type(), pick_color(m.label)), 0.45, 0.0, overlays[i].tinted);
+                overlays[i].r = r;
+            }, Executor::Priority::HIGH);
+            for (auto &o : overlays) {
+                if (o.tinted.empty()) continue;
+                cv::Mat roi = img(o.r);
+                o.tinted.copyTo(roi, o.alpha);
+            }
+        };
+
         // 수신된 디텍션을 한 번만 꺼냄 (동일 루프에서 재사용)
         auto dets = client.PopDetections();
         // debug logs intentionally suppressed for cleaner output
+        size_t det_boxes = 0, rear_boxes = 0;
+        for (const auto &det : dets) (det.camera_id == 0 ? det_boxes : rear_boxes) += det.boxes.size();
+        governor.ObserveDetections(det_boxes);
+        if (rear) rear->governor.ObserveDetections(rear_boxes);
+
+        auto now_tp = std::chrono::steady_clock::now();
+        const uint64_t now_ms = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+        for (const auto &det : dets) {
+            // 결과가 대응하는 프레임 시각 = 수신 후 경과 + 해당 프레임의 round trip
+            double age_ms = static_cast<double>(now_ms > det.timestamp_ms ? now_ms - det.timestamp_ms : 0) + det.latency_ms;
+            auto observed_at = now_tp - std::chrono::microseconds(static_cast<int64_t>(age_ms * 1000.0));
+            results_total++;
+            if (det.backend == "cpu") results_cpu++;
+            if (det.camera_id != 0) {
+                if (rear && det.camera_id == RearCamera::kCameraId) rear->predictor.Update(det.boxes, observed_at);
+                continue;
+            }
+            predictor.Update(det.boxes, observed_at);
+            last_masks = det.masks;
+            last_masks_at = now_tp;
+        }
+        auto boxes_to_draw = predictor.Predict(now_tp);
+        if (now_tp - last_masks_at > predictor.options().max_age) last_masks.clear();
+        if (now_tp - last_rate_report > std::chrono::seconds(5)) {
+            std::cerr << "[rate] effective=" << governor.EffectiveRate() << "fps measured="
+                      << governor.MeasuredSendRate() << "fps results=" << results_total
+                      << " cpu=" << results_cpu << "\n";
+            results_total = results_cpu = 0;
+            last_rate_report = now_tp;
+        }
 
          // 서버가 포워딩한 프레임이 있으면 그걸 우선 표시
          cv::Mat remote_frame;
-        if (client.PopRemoteFrame(remote_frame)) {
+        cv::Mat disp;
+        if (client.DueRemoteFrame(remote_frame)) {
             // Show remote frame at its native size (incoming 크기). draw on a copy.
-            cv::Mat disp = remote_frame.clone();
-            for (const auto &det : dets) for (const auto &b : det.boxes) draw_bbox_on(disp, b);
-            cv::imshow("Aipex Preview", disp);
+            disp = remote_frame.clone();
+            draw_masks_on(disp, last_masks);
+            for (const auto &b : boxes_to_draw) draw_bbox_on(disp, b);
         } else {
             // Local frame: shrink if too large for comfortable viewing while preserving aspect
             const int max_w = 1280;
             const int max_h = 720;
-            cv::Mat disp;
             double sx = static_cast<double>(frame_rotated.cols) / max_w;
             double sy = static_cast<double>(frame_rotated.rows) / max_h;
             double max_scale = std::max(1.0, std::max(sx, sy));
@@ -229,15 +360,36 @@ int main() {
             } else {
                 disp = frame_rotated.clone();
             }
-            for (const auto &det : dets) for (const auto &b : det.boxes) draw_bbox_on(disp, b);
-            cv::imshow("Aipex Preview", disp);
+            draw_masks_on(disp, last_masks);
+            for (const auto &b : boxes_to_draw) draw_bbox_on(disp, b);
+        }
+        // 후방 카메라 PIP: 원격 프레임(없으면 로컬 프레임) 에 그 카메라의 박스를 그려 우하단에 1/4 크기로
+        if (rear) {
+            cv::Mat rear_disp;
+            if (!client.DueRemoteFrame(rear_disp, RearCamera::kCameraId)) rear_disp = rear->frame;
+            if (!rear_disp.empty()) {
+                cv::Mat pip;
+                cv::resize(rear_disp, pip, cv::Size(std::max(1, disp.cols / 4), std::max(1, disp.rows / 4)));
+                for (const auto &b : rear->predictor.Predict(now_tp)) draw_bbox_on(pip, b);
+                cv::Rect r(disp.cols - pip.cols - 8, disp.rows - pip.rows - 8, pip.cols, pip.rows);
+                if (r.x >= 0 && r.y >= 0) pip.copyTo(disp(r));
+            }
         }
+        cv::imshow("Aipex Preview", disp);
 
         int key = cv::waitKey(1);
         if (key == 'w' || key == 'W') {
             std::cerr << "[main] key 'w' pressed -> sending START_STREAMING command\n";
             client.SendRequest("start_streaming");
         }
+        if (key == 'p' || key == 'P') {
+            // 운영 프로필 순환 (auto -> 수동 4종 -> auto)
+            static const char* kProfiles[] = {"low_latency", "balanced", "high_throughput", "power_save", "auto"};
+            static size_t next_profile = 0;
+            const char* name = kProfiles[next_profile++ % (sizeof(kProfiles) / sizeof(kProfiles[0]))];
+            std::cerr << "[main] key 'p' pressed -> profile " << name << "\n";
+            client.SetProfile(name);
+        }
         if (key == 27) { // ESC to break
             break;
         }
@@ -253,9 +405,13 @@ int main() {
     double send_fps = elapsed_sec > 0.0 ? (double)sent / elapsed_sec : 0.0;
     double recv_fps = elapsed_sec > 0.0 ? (double)recv / elapsed_sec : 0.0;
     std::cerr << "[perf] elapsed=" << elapsed_sec << "s sent=" << sent << " send_fps=" << send_fps
-              << " recv=" << recv << " recv_fps=" << recv_fps << "\n";
+              << " recv=" << recv << " recv_fps=" << recv_fps
+              << " source_fps=" << video_fps << " final_rate=" << governor.EffectiveRate() << "\n";
+    Executor::Instance().LogStats();
+    perf_counters_report();
 
     client.StopStreaming();
+    if (discovery) discovery->Stop();
     shutdown_system(server, server_thread);
     return 0;
 }
\ No newline at end of file
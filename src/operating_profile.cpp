@@ -0,0 +1,197 @@
+#include "operating_profile.h"
+#include "env_config.h"
+#include "jpeg_codec.h"
+#include <opencv2/opencv.hpp>
+#include <dirent.h>
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+static bool read_line(const std::string& path, std::string& out) {
+    std::ifstream f(path);
+    return f && std::getline(f, out) && !out.empty();
+}
+
+// 첫 번째 배터리 (/sys/class/power_supply/BAT*)
+static std::string find_battery_dir() {
+    const char* base = "/sys/class/power_supply";
+    DIR* d = opendir(base);
+    if (!d) return "";
+    std::string found;
+    while (dirent* e = readdir(d)) {
+        if (std::string(e->d_name).rfind("BAT", 0) == 0) {
+            found = std::string(base) + "/" + e->d_name;
+            break;
+        }
+    }
+    closedir(d);
+    return found;
+}
+
+ProfileManager& ProfileManager::Instance() {
+    static ProfileManager mgr;
+    return mgr;
+}
+
+std::vector<std::string> ProfileManager::Names() {
+    return {"low_latency", "balanced", "high_throughput", "power_save"};
+}
+
+ProfileManager::ProfileManager() {
+    // balanced 는 기존 개별 설정을 따름 (프로필을 쓰지 않던 배포와 같은 동작)
+    OperatingProfile balanced;
+    balanced.name = "balanced";
+    FrameAdmission env_admission = FrameAdmission::FromEnv();
+    balanced.stream_inflight = env_admission.max_inflight;
+    balanced.admission = env_admission.mode;
+    balanced.jpeg_quality = JpegEncodeOptions::FromEnv().quality;
+    balanced.cv_threads = env_int("AIPEX_CV_THREADS", 1);
+
+    // low_latency: 분류기는 다른 프레임의 crop 을 기다리지 않고 1 개씩 보냄
+    OperatingProfile low_latency{"low_latency", 1, FrameAdmission::Mode::DROP_NEWEST, 75, 1, 1, 1};
+    OperatingProfile high_throughput{"high_throughput", 4, FrameAdmission::Mode::BLOCK, 85, 2, 1};
+    OperatingProfile power_save{"power_save", 1, FrameAdmission::Mode::DROP_NEWEST, 70, 1, 3};
+    profiles_ = {low_latency, balanced, high_throughput, power_save};
+
+    triggers_.temp_hot_c = env_double("AIPEX_PROFILE_TEMP_HOT_C", triggers_.temp_hot_c);
+    triggers_.battery_low_pct = env_double("AIPEX_PROFILE_BATTERY_LOW", triggers_.battery_low_pct);
+    triggers_.busy_streams = env_int("AIPEX_PROFILE_BUSY_STREAMS", triggers_.busy_streams);
+    if (const char* t = std::getenv("AIPEX_PROFILE_TEMP_FILE"); t && *t) triggers_.temp_file = t;
+    const char* b = std::getenv("AIPEX_PROFILE_BATTERY_DIR");
+    triggers_.battery_dir = (b && *b) ? std::string(b) : find_battery_dir();
+    triggers_.poll = std::chrono::milliseconds(std::max(100, env_int("AIPEX_PROFILE_POLL_MS", 2000)));
+
+    const char* p = std::getenv("AIPEX_PROFILE");
+    OperatingProfile base;
+    base_name_ = (p && *p && Lookup(p, base)) ? std::string(p) : std::string("balanced");
+
+    std::lock_guard<std::mutex> lk(mtx_);
+    ReadSensorsLocked();
+    Lookup(base_name_, base);
+    ApplyLocked(base, "startup");
+    EvaluateLocked();
+    thread_ = std::thread(&ProfileManager::Loop, this);
+}
+
+ProfileManager::~ProfileManager() {
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        running_ = false;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) thread_.join();
+}
+
+bool ProfileManager::Lookup(const std::string& name, OperatingProfile& out) const {
+    for (const auto& p : profiles_) {
+        if (p.name == name) {
+            out = p;
+            return true;
+        }
+    }
+    return false;
+}
+
+OperatingProfile ProfileManager::Current() const {
+    std::lock_guard<std::mutex> lk(mtx_);
+    return status_.profile;
+}
+
+ProfileManager::Status ProfileManager::GetStatus() const {
+    std::lock_guard<std::mutex> lk(mtx_);
+    return status_;
+}
+
+bool ProfileManager::Select(const std::string& name, std::string& message) {
+    std::lock_guard<std::mutex> lk(mtx_);
+    if (name == "auto") {
+        status_.automatic = true;
+        EvaluateLocked();
+        message = "profile=" + status_.profile.name + " (auto)";
+        return true;
+    }
+    OperatingProfile p;
+    if (!Lookup(name, p)) {
+        message = "unknown profile: " + name;
+        return false;
+    }
+    status_.automatic = false;
+    if (status_.profile.name != p.name) ApplyLocked(p, "manual");
+    message = "profile=" + p.name;
+    return true;
+}
+
+void ProfileManager::StreamOpened() {
+    std::lock_guard<std::mutex> lk(mtx_);
+    status_.active_streams++;
+    EvaluateLocked();
+}
+
+void ProfileManager::StreamClosed() {
+    std::lock_guard<std::mutex> lk(mtx_);
+    status_.active_streams = std::max(0, status_.active_streams - 1);
+    EvaluateLocked();
+}
+
+void ProfileManager::Loop() {
+    std::unique_lock<std::mutex> lk(mtx_);
+    while (running_) {
+        cv_.wait_for(lk, triggers_.poll, [this] { return !running_; });
+        if (!running_) break;
+        ReadSensorsLocked();
+        EvaluateLocked();
+    }
+}
+
+void ProfileManager::ReadSensorsLocked() {
+    std::string line;
+    if (read_line(triggers_.temp_file, line)) {
+        double t = std::atof(line.c_str());
+        status_.temperature_c = t > 1000.0 ? t / 1000.0 : t; // sysfs 는 m°C
+    }
+    if (!triggers_.battery_dir.empty() && read_line(triggers_.battery_dir + "/capacity", line)) {
+        status_.battery_pct = std::atof(line.c_str());
+        status_.discharging = read_line(triggers_.battery_dir + "/status", line) && line == "Discharging";
+    }
+}
+
+void ProfileManager::EvaluateLocked() {
+    if (!status_.automatic) return;
+    const Triggers& t = triggers_;
+    if (t.temp_hot_c > 0.0 && status_.temperature_c >= 0.0) {
+        if (status_.temperature_c >= t.temp_hot_c) hot_ = true;
+        else if (status_.temperature_c < t.temp_hot_c - t.temp_hysteresis_c) hot_ = false;
+    }
+
+    std::string want = base_name_;
+    std::ostringstream reason;
+    if (hot_) {
+        want = "power_save";
+        reason << "temperature " << status_.temperature_c << "C";
+    } else if (t.battery_low_pct > 0.0 && status_.discharging && status_.battery_pct >= 0.0 &&
+               status_.battery_pct <= t.battery_low_pct) {
+        want = "power_save";
+        reason << "battery " << status_.battery_pct << "%";
+    } else if (t.busy_streams > 0 && status_.active_streams >= t.busy_streams) {
+        want = "high_throughput";
+        reason << status_.active_streams << " active streams";
+    } else {
+        reason << "default";
+    }
+    if (want == status_.profile.name) return;
+    OperatingProfile p;
+    if (Lookup(want, p)) ApplyLocked(p, reason.str());
+}
+
+void ProfileManager::ApplyLocked(const OperatingProfile& p, const std::string& reason) {
+    status_.profile = p;
+    status_.reason = reason;
+    cv::setNumThreads(p.cv_threads);
+    generation_.fetch_add(1, std::memory_order_acq_rel);
+    std::cerr << "[profile] -> " << p.name << " (" << reason << ") inflight=" << p.stream_inflight
+              << " admission=" << (p.admission == FrameAdmission::Mode::BLOCK ? "block" : "drop")
+              << " jpeg_q=" << p.jpeg_quality << " cv_threads=" << p.cv_threads << " stride=" << p.infer_stride
+              << " cls_batch=" << (p.classifier_batch ? std::to_string(p.classifier_batch) : std::string("default")) << "\n";
+}
@@ -0,0 +1,196 @@
+#include "perf_counters.h"
+#include "env_config.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const char* kCounterNames[PerfStage::kCounters] = {"cycles", "instructions", "cache_misses", "branch_misses", "ctx_switches"};
+
+#if defined(__linux__)
+struct EventSpec { uint32_t type; uint64_t config; };
+const EventSpec kEvents[PerfStage::kCounters] = {
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES},
+};
+
+// 커널 모드 포함으로 먼저 시도하고, 권한이 없으면 user 모드만 측정
+int open_event(const EventSpec& ev) {
+    for (int exclude_kernel = 0; exclude_kernel <= 1; ++exclude_kernel) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = ev.type;
+        attr.config = ev.config;
+        attr.exclude_kernel = exclude_kernel;
+        attr.exclude_hv = 1;
+        // 카운터가 multiplexing 되면 enabled/running 비율로 보정
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0 /* 이 스레드 */, -1, -1, 0));
+        if (fd >= 0) return fd;
+        if (errno != EACCES && errno != EPERM) break;
+    }
+    return -1;
+}
+#endif
+
+// 스레드별 카운터. 스레드가 처음 PerfStage 를 만들 때 열고 스레드 종료 시 닫음
+struct ThreadCounters {
+    int fds[PerfStage::kCounters];
+
+    ThreadCounters() {
+        std::fill(std::begin(fds), std::end(fds), -1);
+#if defined(__linux__)
+        int opened = 0;
+        int first_errno = 0;
+        for (int i = 0; i < PerfStage::kCounters; ++i) {
+            fds[i] = open_event(kEvents[i]);
+            if (fds[i] >= 0) opened++;
+            else if (!first_errno) first_errno = errno;
+        }
+        static std::once_flag warn_once;
+        if (opened < PerfStage::kCounters) {
+            std::call_once(warn_once, [&] {
+                std::cerr << "[perfctr] " << (PerfStage::kCounters - opened) << "/" << PerfStage::kCounters
+                          << " counters unavailable (" << std::strerror(first_errno)
+                          << "), reporting n/a for them\n";
+            });
+        }
+#endif
+    }
+
+    ~ThreadCounters() {
+#if defined(__linux__)
+        for (int fd : fds) if (fd >= 0) close(fd);
+#endif
+    }
+
+    bool read(int i, uint64_t& out) const {
+#if defined(__linux__)
+        if (fds[i] < 0) return false;
+        uint64_t v[3]; // value, time_enabled, time_running
+        if (::read(fds[i], v, sizeof(v)) != static_cast<ssize_t>(sizeof(v))) return false;
+        if (v[2] == 0) { out = 0; return true; }
+        out = v[2] < v[1] ? static_cast<uint64_t>(static_cast<double>(v[0]) * v[1] / v[2]) : v[0];
+        return true;
+#else
+        (void)i; (void)out;
+        return false;
+#endif
+    }
+};
+
+ThreadCounters& thread_counters() {
+    static thread_local ThreadCounters tc;
+    return tc;
+}
+
+struct StageStats {
+    uint64_t samples = 0;
+    uint64_t frames = 0;
+    double wall_ms = 0.0;
+    uint64_t sum[PerfStage::kCounters] = {0, 0, 0, 0, 0};
+    uint64_t valid_samples[PerfStage::kCounters] = {0, 0, 0, 0, 0};
+    uint64_t valid_frames[PerfStage::kCounters] = {0, 0, 0, 0, 0};
+};
+
+std::mutex g_stats_mtx;
+std::map<std::string, StageStats> g_stats;
+// AIPEX_PERF_SAMPLES: 프레임당 단계 시간을 "stage ms" 줄로 기록 (aipex_sim --stages 입력)
+std::ofstream g_samples;
+bool g_samples_opened = false;
+auto g_last_report = std::chrono::steady_clock::now();
+
+void log_stats_locked() {
+    for (const auto& kv : g_stats) {
+        const StageStats& s = kv.second;
+        if (s.frames == 0) continue;
+        auto per_frame = [&](int i) -> double {
+            return s.valid_frames[i] ? static_cast<double>(s.sum[i]) / s.valid_frames[i] : 0.0;
+        };
+        std::cerr << "[perfctr] stage=" << kv.first << " frames=" << s.frames
+                  << " ms/frame=" << s.wall_ms / s.frames;
+        if (s.valid_samples[0] && s.valid_samples[1] && s.sum[0] > 0) {
+            std::cerr << " IPC=" << static_cast<double>(s.sum[1]) / s.sum[0];
+        } else {
+            std::cerr << " IPC=n/a";
+        }
+        for (int i = 0; i < PerfStage::kCounters; ++i) {
+            std::cerr << " " << kCounterNames[i] << "/frame=";
+            if (s.valid_samples[i]) std::cerr << per_frame(i);
+            else std::cerr << "n/a";
+        }
+        std::cerr << "\n";
+    }
+}
+
+} // namespace
+
+bool perf_counters_enabled() {
+    static const bool enabled = env_bool("AIPEX_PERF_COUNTERS", false);
+    return enabled;
+}
+
+PerfStage::PerfStage(const char* stage, uint64_t frames)
+    : stage_(stage), frames_(frames), active_(perf_counters_enabled()) {
+    if (!active_) return;
+    ThreadCounters& tc = thread_counters();
+    for (int i = 0; i < kCounters; ++i) valid_[i] = tc.read(i, start_[i]);
+    t0_ = std::chrono::steady_clock::now(); // 카운터 읽기 비용은 시간에서 제외
+}
+
+PerfStage::~PerfStage() {
+    if (!active_) return;
+    auto t1 = std::chrono::steady_clock::now();
+    ThreadCounters& tc = thread_counters();
+    uint64_t end[kCounters];
+    bool valid[kCounters];
+    for (int i = 0; i < kCounters; ++i) valid[i] = valid_[i] && tc.read(i, end[i]) && end[i] >= start_[i];
+
+    static const auto interval = std::chrono::seconds(std::max(1, env_int("AIPEX_PERF_REPORT_S", 10)));
+    std::lock_guard<std::mutex> lk(g_stats_mtx);
+    StageStats& s = g_stats[stage_];
+    s.samples++;
+    s.frames += frames_;
+    s.wall_ms += std::chrono::duration<double, std::milli>(t1 - t0_).count();
+    if (!g_samples_opened) {
+        g_samples_opened = true;
+        const char* path = std::getenv("AIPEX_PERF_SAMPLES");
+        if (path && *path) g_samples.open(path, std::ios::app);
+    }
+    if (g_samples.is_open() && frames_ > 0) {
+        g_samples << stage_ << " " << std::chrono::duration<double, std::milli>(t1 - t0_).count() / frames_ << "\n";
+    }
+    for (int i = 0; i < kCounters; ++i) {
+        if (!valid[i]) continue;
+        s.sum[i] += end[i] - start_[i];
+        s.valid_samples[i]++;
+        s.valid_frames[i] += frames_;
+    }
+    if (t1 - g_last_report >= interval) {
+        g_last_report = t1;
+        log_stats_locked();
+    }
+}
+
+void perf_counters_report() {
+    if (!perf_counters_enabled()) return;
+    std::lock_guard<std::mutex> lk(g_stats_mtx);
+    log_stats_locked();
+}
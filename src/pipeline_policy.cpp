@@ -0,0 +1,19 @@
+#include "pipeline_policy.h"
+#include "env_config.h"
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+
+FrameAdmission FrameAdmission::FromEnv() {
+    FrameAdmission a;
+    a.max_inflight = static_cast<size_t>(std::max(1, env_int("AIPEX_EXEC_STREAM_INFLIGHT", static_cast<int>(a.max_inflight))));
+    if (env_str("AIPEX_ADMISSION") == "drop") a.mode = Mode::DROP_NEWEST;
+    return a;
+}
+
+SpillPolicy SpillPolicy::FromEnv() {
+    SpillPolicy p;
+    p.wait_threshold_ms = env_double("AIPEX_SPILL_WAIT_MS", p.wait_threshold_ms);
+    p.hard_threshold_ms = env_double("AIPEX_SPILL_HARD_WAIT_MS", p.hard_threshold_ms);
+    return p;
+}
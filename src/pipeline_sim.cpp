@@ -0,0 +1,367 @@
+#include "pipeline_sim.h"
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <sstream>
+
+LatencyDist LatencyDist::Constant(double ms) {
+    LatencyDist d;
+    d.kind_ = Kind::CONSTANT;
+    d.mean_ = std::max(0.0, ms);
+    return d;
+}
+
+LatencyDist LatencyDist::LogNormal(double mean_ms, double cv) {
+    if (mean_ms <= 0.0 || cv <= 0.0) return Constant(mean_ms);
+    LatencyDist d;
+    d.kind_ = Kind::LOGNORMAL;
+    d.mean_ = mean_ms;
+    double s2 = std::log(1.0 + cv * cv);
+    d.sigma_ = std::sqrt(s2);
+    d.mu_ = std::log(mean_ms) - s2 / 2.0;
+    return d;
+}
+
+LatencyDist LatencyDist::Empirical(std::vector<double> samples_ms) {
+    if (samples_ms.empty()) return Constant(0.0);
+    LatencyDist d;
+    d.kind_ = Kind::EMPIRICAL;
+    d.mean_ = std::accumulate(samples_ms.begin(), samples_ms.end(), 0.0) / samples_ms.size();
+    d.samples_ = std::move(samples_ms);
+    return d;
+}
+
+double LatencyDist::Sample(std::mt19937_64& rng) const {
+    switch (kind_) {
+    case Kind::LOGNORMAL: return std::lognormal_distribution<double>(mu_, sigma_)(rng);
+    case Kind::EMPIRICAL: return samples_[std::uniform_int_distribution<size_t>(0, samples_.size() - 1)(rng)];
+    default: return mean_;
+    }
+}
+
+double DeviceCurve::LatencyMs(size_t batch) const {
+    if (points.empty()) return 0.0;
+    if (points.size() == 1) return points[0].second * batch / std::max<size_t>(1, points[0].first);
+    size_t i = 1;
+    while (i + 1 < points.size() && points[i].first < batch) ++i;
+    const auto& a = points[i - 1];
+    const auto& b = points[i];
+    double slope = (b.second - a.second) / static_cast<double>(b.first - a.first);
+    return std::max(0.0, a.second + slope * (static_cast<double>(batch) - a.first));
+}
+
+bool LoadStageLatencies(const std::string& path, SimConfig& cfg) {
+    std::ifstream in(path);
+    if (!in) return false;
+    std::map<std::string, std::vector<double>> samples;
+    std::vector<std::pair<size_t, double>> curve;
+    std::string line;
+    while (std::getline(in, line)) {
+        auto hash = line.find('#');
+        if (hash != std::string::npos) line.resize(hash);
+        std::istringstream ss(line);
+        std::string stage;
+        if (!(ss >> stage)) continue;
+        if (stage == "device") {
+            size_t b;
+            double ms;
+            if (ss >> b >> ms && b > 0) curve.emplace_back(b, ms);
+        } else {
+            double ms;
+            if (ss >> ms) samples[stage].push_back(ms);
+        }
+    }
+    auto take = [&](const char* name, LatencyDist& d) {
+        auto it = samples.find(name);
+        if (it != samples.end()) d = LatencyDist::Empirical(std::move(it->second));
+    };
+    take("uplink", cfg.uplink);
+    take("decode", cfg.decode);
+    take("preprocess", cfg.preprocess);
+    take("infer", cfg.infer);
+    take("postprocess", cfg.postprocess);
+    take("classify", cfg.classify);
+    take("encode", cfg.encode);
+    take("downlink", cfg.downlink);
+    if (!curve.empty()) {
+        // 같은 batch 측정점은 평균
+        std::map<size_t, std::pair<double, int>> acc;
+        for (const auto& p : curve) { acc[p.first].first += p.second; acc[p.first].second++; }
+        cfg.device.points.clear();
+        for (const auto& kv : acc) cfg.device.points.emplace_back(kv.first, kv.second.first / kv.second.second);
+    } else if (cfg.infer.Mean() > 0.0) {
+        cfg.device.points = {{1, cfg.infer.Mean()}};
+    }
+    return true;
+}
+
+double SimResult::Percentile(double p) const {
+    if (e2e_ms.empty()) return 0.0;
+    size_t i = static_cast<size_t>(std::clamp(p, 0.0, 1.0) * (e2e_ms.size() - 1));
+    return e2e_ms[i];
+}
+
+namespace {
+
+using SteadyClock = std::chrono::steady_clock;
+
+// 가상 시계 이벤트 루프. 시간 단위는 ms, 정책 객체에는 base + 경과 시간의 time_point 로 전달
+class EventLoop {
+public:
+    explicit EventLoop(SteadyClock::time_point base) : base_(base) {}
+
+    double Now() const { return now_; }
+    SteadyClock::time_point Clock(double ms) const {
+        return base_ + std::chrono::duration_cast<SteadyClock::duration>(std::chrono::duration<double, std::milli>(ms));
+    }
+    SteadyClock::time_point Clock() const { return Clock(now_); }
+
+    void At(double t, std::function<void()> fn) { q_.push(Event{std::max(t, now_), seq_++, std::move(fn)}); }
+    void After(double d, std::function<void()> fn) { At(now_ + std::max(0.0, d), std::move(fn)); }
+
+    void Run(double until) {
+        while (!q_.empty() && q_.top().t <= until) {
+            Event e = q_.top();
+            q_.pop();
+            now_ = e.t;
+            e.fn();
+        }
+        now_ = until;
+    }
+
+private:
+    struct Event {
+        double t;
+        uint64_t seq;   // 같은 시각이면 등록 순서대로
+        std::function<void()> fn;
+        bool operator>(const Event& o) const { return t != o.t ? t > o.t : seq > o.seq; }
+    };
+    SteadyClock::time_point base_;
+    double now_ = 0.0;
+    uint64_t seq_ = 0;
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>> q_;
+};
+
+struct Frame {
+    uint64_t id;
+    size_t board;
+    double captured;
+    double arrived = 0.0, admitted = 0.0, started = 0.0, device_enq = 0.0;
+};
+
+struct Board {
+    size_t inflight = 0;
+    std::deque<std::shared_ptr<Frame>> blocked;     // BLOCK: admission 대기 (서버 Read 가 멈춘 상태)
+    size_t free_workers = 0;
+    std::deque<std::shared_ptr<Frame>> worker_queue;
+    std::deque<std::shared_ptr<Frame>> device_queue;
+    bool device_busy = false;
+    double device_check_at = -1.0;
+    double device_busy_ms = 0.0;
+    uint64_t batches = 0, batched_frames = 0;
+};
+
+class Sim {
+public:
+    explicit Sim(const SimConfig& cfg)
+        : cfg_(cfg), loop_(SteadyClock::now()), rng_(cfg.seed), lb_(cfg.lb_policy),
+          governor_(cfg.rate), boards_(std::max<size_t>(1, cfg.boards)) {
+        for (size_t i = 0; i < boards_.size(); ++i) {
+            lb_.AddBackend("sim-board-" + std::to_string(i));
+            lb_.SetHealthy(i, true);
+            boards_[i].free_workers = std::max<size_t>(1, cfg.cpu_workers);
+        }
+    }
+
+    SimResult Run() {
+        const double period = 1000.0 / std::max(0.1, cfg_.source_fps);
+        const double end = cfg_.duration_s * 1000.0;
+        for (double t = 0.0; t < end; t += period) loop_.At(t, [this] { Capture(); });
+        // 마지막 캡처 이후 처리 중인 프레임이 끝날 여유
+        loop_.Run(end + 10000.0);
+
+        r_.sim_seconds = cfg_.duration_s;
+        r_.throughput_fps = r_.completed / cfg_.duration_s;
+        std::sort(r_.e2e_ms.begin(), r_.e2e_ms.end());
+        if (r_.completed) {
+            r_.admission_wait_ms = admission_wait_sum_ / r_.completed;
+            r_.worker_wait_ms = worker_wait_sum_ / r_.completed;
+            r_.device_wait_ms = device_wait_sum_ / r_.completed;
+        }
+        uint64_t batches = 0, batched = 0;
+        double busy = 0.0;
+        for (const auto& b : boards_) { batches += b.batches; batched += b.batched_frames; busy += b.device_busy_ms; }
+        r_.avg_batch = batches ? static_cast<double>(batched) / batches : 0.0;
+        r_.device_util = std::min(1.0, busy / (boards_.size() * end));
+        r_.cpu_seconds = cpu_ms_ / 1000.0;
+        return r_;
+    }
+
+private:
+    void Capture() {
+        r_.generated++;
+        if (cfg_.use_rate_governor && !governor_.ShouldSend(loop_.Clock())) return;
+        int idx = lb_.Pick();
+        if (idx < 0) return;
+        auto f = std::make_shared<Frame>();
+        f->id = next_id_++;
+        f->board = static_cast<size_t>(idx);
+        f->captured = loop_.Now();
+        lb_.OnSent(f->board, f->id, loop_.Clock());
+        r_.sent++;
+        loop_.After(cfg_.uplink.Sample(rng_), [this, f] { Arrive(f); });
+    }
+
+    void Arrive(const std::shared_ptr<Frame>& f) {
+        Board& b = boards_[f->board];
+        f->arrived = loop_.Now();
+        if (!b.blocked.empty()) { b.blocked.push_back(f); return; } // 앞 프레임이 대기 중이면 순서 유지
+        switch (cfg_.admission.Admit(b.inflight)) {
+        case FrameAdmission::Decision::ADMIT: Admit(f); break;
+        case FrameAdmission::Decision::WAIT: b.blocked.push_back(f); break;
+        case FrameAdmission::Decision::DROP:
+            r_.dropped++;
+            // 서버가 빈 결과로 응답 (service_impl 과 동일)
+            loop_.After(cfg_.downlink.Sample(rng_), [this, f] { lb_.OnResult(f->board, f->id, loop_.Clock()); });
+            break;
+        }
+    }
+
+    void Admit(const std::shared_ptr<Frame>& f) {
+        Board& b = boards_[f->board];
+        b.inflight++;
+        f->admitted = loop_.Now();
+        if (b.free_workers > 0) {
+            b.free_workers--;
+            Start(f);
+        } else {
+            b.worker_queue.push_back(f);
+        }
+    }
+
+    // 실제 서버처럼 프레임 하나가 executor worker 하나를 장치 대기 포함 끝까지 점유
+    void Start(const std::shared_ptr<Frame>& f) {
+        f->started = loop_.Now();
+        double cpu = cfg_.decode.Sample(rng_) + cfg_.preprocess.Sample(rng_);
+        cpu_ms_ += cpu;
+        loop_.After(cpu, [this, f] {
+            Board& b = boards_[f->board];
+            f->device_enq = loop_.Now();
+            b.device_queue.push_back(f);
+            TryDispatchDevice(f->board);
+        });
+    }
+
+    void TryDispatchDevice(size_t bi) {
+        Board& b = boards_[bi];
+        if (b.device_busy || b.device_queue.empty()) return;
+        double oldest = b.device_queue.front()->device_enq;
+        if (!cfg_.batch.ShouldDispatch(b.device_queue.size(), loop_.Clock(oldest), loop_.Clock())) {
+            double at = oldest + std::chrono::duration<double, std::milli>(cfg_.batch.max_wait).count();
+            if (b.device_check_at != at) {
+                b.device_check_at = at;
+                loop_.At(at, [this, bi] { TryDispatchDevice(bi); });
+            }
+            return;
+        }
+        std::vector<std::shared_ptr<Frame>> batch;
+        while (!b.device_queue.empty() && batch.size() < std::max<size_t>(1, cfg_.batch.batch_size)) {
+            batch.push_back(b.device_queue.front());
+            b.device_queue.pop_front();
+        }
+        double ms = cfg_.device.LatencyMs(batch.size());
+        if (cfg_.infer.Mean() > 0.0) ms *= cfg_.infer.Sample(rng_) / cfg_.infer.Mean();
+        b.device_busy = true;
+        b.device_busy_ms += ms;
+        b.batches++;
+        b.batched_frames += batch.size();
+        for (const auto& f : batch) device_wait_sum_ += loop_.Now() - f->device_enq;
+        loop_.After(ms, [this, bi, batch] {
+            boards_[bi].device_busy = false;
+            for (const auto& f : batch) Postprocess(f);
+            TryDispatchDevice(bi);
+        });
+    }
+
+    void Postprocess(const std::shared_ptr<Frame>& f) {
+        double cpu = cfg_.postprocess.Sample(rng_) + cfg_.classify.Sample(rng_) + cfg_.encode.Sample(rng_);
+        cpu_ms_ += cpu;
+        loop_.After(cpu, [this, f] { Finish(f); });
+    }
+
+    void Finish(const std::shared_ptr<Frame>& f) {
+        Board& b = boards_[f->board];
+        admission_wait_sum_ += f->admitted - f->arrived;
+        worker_wait_sum_ += f->started - f->admitted;
+        // worker 반납 -> 다음 프레임
+        if (!b.worker_queue.empty()) {
+            auto next = b.worker_queue.front();
+            b.worker_queue.pop_front();
+            Start(next);
+        } else {
+            b.free_workers++;
+        }
+        b.inflight--;
+        while (!b.blocked.empty() && cfg_.admission.Admit(b.inflight) == FrameAdmission::Decision::ADMIT) {
+            auto next = b.blocked.front();
+            b.blocked.pop_front();
+            Admit(next);
+        }
+        loop_.After(cfg_.downlink.Sample(rng_), [this, f] { Receive(f); });
+    }
+
+    void Receive(const std::shared_ptr<Frame>& f) {
+        lb_.OnResult(f->board, f->id, loop_.Clock());
+        bool active = std::uniform_real_distribution<double>(0.0, 1.0)(rng_) < cfg_.activity;
+        governor_.ObserveDetections(active ? 1 : 0, loop_.Clock());
+        r_.completed++;
+        r_.e2e_ms.push_back(loop_.Now() - f->captured);
+    }
+
+    const SimConfig& cfg_;
+    EventLoop loop_;
+    std::mt19937_64 rng_;
+    LoadBalancer lb_;
+    RateGovernor governor_;
+    std::vector<Board> boards_;
+    uint64_t next_id_ = 1;
+    double cpu_ms_ = 0.0;
+    double admission_wait_sum_ = 0.0, worker_wait_sum_ = 0.0, device_wait_sum_ = 0.0;
+    SimResult r_;
+};
+
+} // namespace
+
+SimResult RunPipelineSim(const SimConfig& cfg) {
+    Sim sim(cfg);
+    return sim.Run();
+}
+
+void PrintSimResult(const SimConfig& cfg, const SimResult& r, std::ostream& os) {
+    os << std::fixed << std::setprecision(2)
+       << "inflight=" << cfg.admission.max_inflight
+       << " admission=" << (cfg.admission.mode == FrameAdmission::Mode::BLOCK ? "block" : "drop")
+       << " batch=" << cfg.batch.batch_size
+       << " batch_wait=" << std::chrono::duration<double, std::milli>(cfg.batch.max_wait).count() << "ms"
+       << " workers=" << cfg.cpu_workers << " boards=" << cfg.boards
+       << " | sent=" << r.sent << " done=" << r.completed << " dropped=" << r.dropped
+       << " fps=" << r.throughput_fps
+       << std::setprecision(4)
+       << " | e2e_s p50=" << r.Percentile(0.50) / 1000.0 << " p90=" << r.Percentile(0.90) / 1000.0
+       << " p99=" << r.Percentile(0.99) / 1000.0
+       << " max=" << (r.e2e_ms.empty() ? 0.0 : r.e2e_ms.back() / 1000.0)
+       << std::setprecision(2)
+       << " | wait_ms admission=" << r.admission_wait_ms << " worker=" << r.worker_wait_ms
+       << " device=" << r.device_wait_ms
+       << " | cpu_s=" << r.cpu_seconds
+       << std::setprecision(4) << " cpu_s/frame=" << (r.completed ? r.cpu_seconds / r.completed : 0.0)
+       << std::setprecision(2) << " device_util=" << r.device_util * 100.0 << "% avg_batch=" << r.avg_batch << "\n";
+}
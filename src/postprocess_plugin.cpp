@@ -0,0 +1,114 @@
+#include "postprocess_plugin.h"
+#include <dlfcn.h>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <unistd.h>
+
+PostprocessPlugin::~PostprocessPlugin() {
+    if (api_ && state_) api_->destroy(state_);
+    if (lib_handle_) dlclose(lib_handle_);
+}
+
+std::unique_ptr<PostprocessPlugin> PostprocessPlugin::Load(const std::string& path, const std::string& config) {
+    void* h = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (!h) {
+        std::cerr << "[pp] dlopen(" << path << ") failed: " << dlerror() << "\n";
+        return nullptr;
+    }
+    std::unique_ptr<PostprocessPlugin> p(new PostprocessPlugin());
+    p->lib_handle_ = h;
+    p->path_ = path;
+
+    auto entry = reinterpret_cast<aipex_pp_entry_fn>(dlsym(h, AIPEX_PP_ENTRY_SYMBOL));
+    if (!entry) {
+        std::cerr << "[pp] " << path << ": symbol " << AIPEX_PP_ENTRY_SYMBOL << " not found\n";
+        return nullptr;
+    }
+    p->api_ = entry();
+    if (!p->api_ || p->api_->abi_version != AIPEX_PP_ABI_VERSION) {
+        std::cerr << "[pp] " << path << ": ABI version " << (p->api_ ? p->api_->abi_version : 0)
+                  << " (expected " << AIPEX_PP_ABI_VERSION << ")\n";
+        p->api_ = nullptr;
+        return nullptr;
+    }
+    if (!p->api_->create || !p->api_->destroy || !p->api_->run) {
+        std::cerr << "[pp] " << path << ": incomplete function table\n";
+        p->api_ = nullptr;
+        return nullptr;
+    }
+    p->name_ = p->api_->name ? p->api_->name : "?";
+    p->state_ = p->api_->create(config.c_str());
+    if (!p->state_) {
+        std::cerr << "[pp] " << p->name_ << ": create(\"" << config << "\") failed\n";
+        p->api_ = nullptr;
+        return nullptr;
+    }
+    std::cerr << "[pp] loaded plugin " << p->name_ << " from " << path << "\n";
+    return p;
+}
+
+std::unique_ptr<PostprocessPlugin> PostprocessPlugin::FromEnv(const std::vector<std::string>& candidates) {
+    const char* cfg_env = std::getenv("AIPEX_PP_CONFIG");
+    std::string config = cfg_env ? cfg_env : "";
+    const char* dir_env = std::getenv("AIPEX_PP_PLUGIN_DIR");
+    std::string dir = dir_env && *dir_env ? dir_env : "";
+
+    const char* plugin = std::getenv("AIPEX_PP_PLUGIN");
+    if (plugin && *plugin) {
+        std::string p(plugin);
+        // 경로가 아니면 이름으로 보고 플러그인 디렉터리에서 찾음
+        if (p.find('/') == std::string::npos && !dir.empty()) p = dir + "/libaipex_pp_" + p + ".so";
+        return Load(p, config);
+    }
+    if (dir.empty()) return nullptr;
+    for (const auto& name : candidates) {
+        if (name.empty()) continue;
+        std::string p = dir + "/libaipex_pp_" + name + ".so";
+        if (access(p.c_str(), R_OK) == 0) return Load(p, config);
+    }
+    return nullptr;
+}
+
+int PostprocessPlugin::Run(const std::vector<aipex_pp_tensor>& tensors, uint32_t model_w, uint32_t model_h,
+                           std::vector<aipex_pp_detection>& out) {
+    if (out.capacity() < 64) out.reserve(64);
+    out.resize(out.capacity());
+    size_t count = 0;
+    int rc = api_->run(state_, tensors.data(), tensors.size(), model_w, model_h, out.data(), out.size(), &count);
+    if (rc == AIPEX_PP_TRUNCATED && count > out.size()) {
+        out.resize(count);
+        rc = api_->run(state_, tensors.data(), tensors.size(), model_w, model_h, out.data(), out.size(), &count);
+    }
+    if (rc != AIPEX_PP_OK) {
+        std::cerr << "[pp] " << name_ << " run failed rc=" << rc << "\n";
+        out.clear();
+        return -1;
+    }
+    out.resize(count);
+    return 0;
+}
+
+void benchmark_postprocess_plugin(PostprocessPlugin& plugin, const std::vector<aipex_pp_tensor>& tensors,
+                                  uint32_t model_w, uint32_t model_h,
+                                  const std::function<size_t()>& builtin, int iters) {
+    using clock = std::chrono::steady_clock;
+    std::vector<aipex_pp_detection> out;
+    plugin.Run(tensors, model_w, model_h, out); // 버퍼 확보
+
+    size_t plugin_dets = 0, builtin_dets = 0;
+    auto t0 = clock::now();
+    for (int i = 0; i < iters; ++i) {
+        plugin.Run(tensors, model_w, model_h, out);
+        plugin_dets += out.size();
+    }
+    auto t1 = clock::now();
+    for (int i = 0; i < iters; ++i) builtin_dets += builtin();
+    auto t2 = clock::now();
+
+    double plugin_us = std::chrono::duration<double, std::micro>(t1 - t0).count() / iters;
+    double builtin_us = std::chrono::duration<double, std::micro>(t2 - t1).count() / iters;
+    std::cerr << "[pp] bench " << plugin.Name() << ": plugin=" << plugin_us << "us/call builtin=" << builtin_us
+              << "us/call overhead=" << (plugin_us - builtin_us) << "us dets/call=" << plugin_dets / iters
+              << " (builtin " << builtin_dets / iters << ")\n";
+}
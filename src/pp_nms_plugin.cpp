@@ -0,0 +1,74 @@
+// 장치측 NMS 출력 (HAILO_NMS_BY_CLASS, float32) 파서 플러그인 -> libaipex_pp_nms.so
+// 내장 nms_decode 와 같은 배치: class 마다 [count][bbox x count], bbox = (y_min, x_min, y_max, x_max, score)
+// config: "threshold=0.3" (기본 0)
+#include "aipex_postprocess.h"
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace {
+
+struct NmsState {
+    float threshold = 0.0f;
+};
+
+struct NmsBox {
+    float y_min, x_min, y_max, x_max, score;
+};
+
+const uint32_t kFormatFloat32 = 3;
+
+void* nms_create(const char* config) {
+    auto* st = new NmsState();
+    std::string cfg = config ? config : "";
+    size_t pos = 0;
+    while (pos < cfg.size()) {
+        size_t end = cfg.find(',', pos);
+        if (end == std::string::npos) end = cfg.size();
+        std::string kv = cfg.substr(pos, end - pos);
+        size_t eq = kv.find('=');
+        if (eq != std::string::npos && kv.substr(0, eq) == "threshold") {
+            st->threshold = static_cast<float>(std::atof(kv.c_str() + eq + 1));
+        }
+        pos = end + 1;
+    }
+    return st;
+}
+
+void nms_destroy(void* state) {
+    delete static_cast<NmsState*>(state);
+}
+
+int nms_run(void* state, const aipex_pp_tensor* tensors, size_t num_tensors, uint32_t, uint32_t,
+            aipex_pp_detection* out, size_t capacity, size_t* out_count) {
+    const NmsState* st = static_cast<const NmsState*>(state);
+    *out_count = 0;
+    if (num_tensors < 1 || tensors[0].format_type != kFormatFloat32) return AIPEX_PP_ERROR;
+    const uint8_t* data = static_cast<const uint8_t*>(tensors[0].data);
+    size_t size = tensors[0].size;
+    size_t n = 0;
+    size_t offset = 0;
+    for (uint32_t c = 0; c < tensors[0].nms_classes && offset + sizeof(float) <= size; ++c) {
+        float fcount;
+        std::memcpy(&fcount, data + offset, sizeof(float));
+        offset += sizeof(float);
+        for (uint32_t j = 0; j < static_cast<uint32_t>(fcount) && offset + sizeof(NmsBox) <= size; ++j) {
+            NmsBox b;
+            std::memcpy(&b, data + offset, sizeof(b));
+            offset += sizeof(b);
+            if (b.score < st->threshold) continue;
+            if (n < capacity) out[n] = {static_cast<int32_t>(c), b.score, b.x_min, b.y_min, b.x_max, b.y_max};
+            n++;
+        }
+    }
+    *out_count = n;
+    return n > capacity ? AIPEX_PP_TRUNCATED : AIPEX_PP_OK;
+}
+
+const aipex_pp_plugin kPlugin = {AIPEX_PP_ABI_VERSION, "nms", nms_create, nms_destroy, nms_run};
+
+} // namespace
+
+extern "C" __attribute__((visibility("default"))) const aipex_pp_plugin* aipex_postprocess_plugin(void) {
+    return &kPlugin;
+}
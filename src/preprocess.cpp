@@ -0,0 +1,195 @@
+#include "preprocess.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+constexpr int kFracBits = 11;               // cv::resize INTER_LINEAR 와 같은 고정소수점 정밀도
+constexpr int kOne = 1 << kFracBits;
+
+// 소스 크기별 보간 테이블. 고정 크기 커널은 출력 크기가 컴파일 타임 상수라 std::array,
+// 임의 크기(분류기 crop 등)는 std::vector
+template <typename XTable, typename YTable>
+struct ResizeTablesT {
+    int src_w = -1, src_h = -1;
+    XTable x0, x1;      // 소스 픽셀 바이트 offset (x * 3)
+    XTable ax;          // x1 가중치 (0..kOne)
+    YTable y0, y1;
+    YTable ay;
+
+    void Build(int sw, int sh, int W, int H) {
+        src_w = sw;
+        src_h = sh;
+        const float sx = static_cast<float>(sw) / W;
+        const float sy = static_cast<float>(sh) / H;
+        for (int x = 0; x < W; ++x) {
+            float fx = (x + 0.5f) * sx - 0.5f;
+            int ix = static_cast<int>(std::floor(fx));
+            float w = fx - ix;
+            if (ix < 0) { ix = 0; w = 0.f; }
+            if (ix >= sw - 1) { ix = sw - 1; w = 0.f; }
+            x0[x] = ix * 3;
+            x1[x] = std::min(ix + 1, sw - 1) * 3;
+            ax[x] = static_cast<int>(std::lround(w * kOne));
+        }
+        for (int y = 0; y < H; ++y) {
+            float fy = (y + 0.5f) * sy - 0.5f;
+            int iy = static_cast<int>(std::floor(fy));
+            float w = fy - iy;
+            if (iy < 0) { iy = 0; w = 0.f; }
+            if (iy >= sh - 1) { iy = sh - 1; w = 0.f; }
+            y0[y] = iy;
+            y1[y] = std::min(iy + 1, sh - 1);
+            ay[y] = static_cast<int>(std::lround(w * kOne));
+        }
+    }
+};
+
+template <int W, int H>
+using ResizeTables = ResizeTablesT<std::array<int, W>, std::array<int, H>>;
+
+struct DynamicResizeTables : ResizeTablesT<std::vector<int>, std::vector<int>> {
+    int dst_w = -1, dst_h = -1;
+
+    void Prepare(int sw, int sh, int dw, int dh) {
+        if (src_w == sw && src_h == sh && dst_w == dw && dst_h == dh) return;
+        x0.resize(dw); x1.resize(dw); ax.resize(dw);
+        y0.resize(dh); y1.resize(dh); ay.resize(dh);
+        dst_w = dw;
+        dst_h = dh;
+        Build(sw, sh, dw, dh);
+    }
+};
+
+// bilinear resize + BGR->RGB + NHWC 기록 한 번의 순회. 고정 크기 커널에서는 W/H 가 상수로 inline 됨
+template <typename Tables>
+inline void resize_bgr_to_rgb(const cv::Mat& bgr, uint8_t* dst, int W, int H, const Tables& t) {
+    const int dst_stride = W * 3;
+    for (int y = 0; y < H; ++y) {
+        const uint8_t* r0 = bgr.ptr<uint8_t>(t.y0[y]);
+        const uint8_t* r1 = bgr.ptr<uint8_t>(t.y1[y]);
+        const int wy1 = t.ay[y];
+        const int wy0 = kOne - wy1;
+        uint8_t* d = dst + y * dst_stride;
+#pragma GCC unroll 4
+        for (int x = 0; x < W; ++x) {
+            const uint8_t* a = r0 + t.x0[x];
+            const uint8_t* b = r0 + t.x1[x];
+            const uint8_t* c = r1 + t.x0[x];
+            const uint8_t* e = r1 + t.x1[x];
+            const int wx1 = t.ax[x];
+            const int wx0 = kOne - wx1;
+            // 채널 3개 수동 전개, 출력은 RGB 순서
+            int top0 = a[0] * wx0 + b[0] * wx1, bot0 = c[0] * wx0 + e[0] * wx1;
+            int top1 = a[1] * wx0 + b[1] * wx1, bot1 = c[1] * wx0 + e[1] * wx1;
+            int top2 = a[2] * wx0 + b[2] * wx1, bot2 = c[2] * wx0 + e[2] * wx1;
+            constexpr int kRound = 1 << (2 * kFracBits - 1);
+            d[x * 3 + 2] = static_cast<uint8_t>((top0 * wy0 + bot0 * wy1 + kRound) >> (2 * kFracBits));
+            d[x * 3 + 1] = static_cast<uint8_t>((top1 * wy0 + bot1 * wy1 + kRound) >> (2 * kFracBits));
+            d[x * 3 + 0] = static_cast<uint8_t>((top2 * wy0 + bot2 * wy1 + kRound) >> (2 * kFracBits));
+        }
+    }
+}
+
+// 고정 크기 NHWC uint8 커널: resize + BGR->RGB + 버퍼 기록을 한 번의 순회로
+template <int W, int H>
+void preprocess_fixed(const cv::Mat& bgr, uint8_t* dst, int, int) {
+    constexpr int kDstStride = W * 3;
+    if (bgr.type() != CV_8UC3) return preprocess_generic(bgr, dst, W, H);
+
+    // 이미 모델 크기면 (client 가 미리 resize 해서 보내는 경우) 채널 순서만 바꿈
+    if (bgr.cols == W && bgr.rows == H) {
+        for (int y = 0; y < H; ++y) {
+            const uint8_t* s = bgr.ptr<uint8_t>(y);
+            uint8_t* d = dst + y * kDstStride;
+#pragma GCC unroll 8
+            for (int x = 0; x < W; ++x) {
+                d[x * 3 + 0] = s[x * 3 + 2];
+                d[x * 3 + 1] = s[x * 3 + 1];
+                d[x * 3 + 2] = s[x * 3 + 0];
+            }
+        }
+        return;
+    }
+
+    // 소스 크기가 바뀔 때만 테이블 재계산 (스트림 처리 스레드마다 하나)
+    thread_local ResizeTables<W, H> t;
+    if (t.src_w != bgr.cols || t.src_h != bgr.rows) t.Build(bgr.cols, bgr.rows, W, H);
+    resize_bgr_to_rgb(bgr, dst, W, H, t);
+}
+
+// 배포 중인 입력 크기
+template <int W, int H>
+constexpr PreprocessKernel make_kernel(const char* name) {
+    return PreprocessKernel{name, &preprocess_fixed<W, H>, true};
+}
+constexpr PreprocessKernel kFixedKernels[] = {
+    make_kernel<640, 640>("nhwc_u8_640x640"),
+    make_kernel<320, 320>("nhwc_u8_320x320"),
+};
+constexpr int kFixedSizes[][2] = {{640, 640}, {320, 320}};
+
+} // namespace
+
+void preprocess_generic(const cv::Mat& bgr, uint8_t* dst, int width, int height) {
+    if (bgr.empty()) {
+        // cv::resize 는 빈 입력에 예외를 던짐. 모델 입력은 검은 화면으로
+        std::memset(dst, 0, static_cast<size_t>(width) * height * 3);
+        return;
+    }
+    cv::Mat resized;
+    cv::resize(bgr, resized, cv::Size(width, height));
+    cv::Mat rgb;
+    cv::cvtColor(resized, rgb, cv::COLOR_BGR2RGB);
+    const size_t row_bytes = static_cast<size_t>(width) * 3;
+    if (rgb.isContinuous()) {
+        std::memcpy(dst, rgb.data, row_bytes * height);
+    } else {
+        for (int r = 0; r < rgb.rows; ++r) std::memcpy(dst + r * row_bytes, rgb.ptr(r), row_bytes);
+    }
+}
+
+void preprocess_resize_rgb(const cv::Mat& bgr, uint8_t* dst, int width, int height) {
+    if (bgr.empty() || bgr.type() != CV_8UC3) return preprocess_generic(bgr, dst, width, height);
+    thread_local DynamicResizeTables t;
+    t.Prepare(bgr.cols, bgr.rows, width, height);
+    resize_bgr_to_rgb(bgr, dst, width, height, t);
+}
+
+PreprocessKernel select_preprocess_kernel(int width, int height, int features, bool nhwc_uint8) {
+    if (nhwc_uint8 && features == 3) {
+        for (size_t i = 0; i < sizeof(kFixedSizes) / sizeof(kFixedSizes[0]); ++i) {
+            if (kFixedSizes[i][0] == width && kFixedSizes[i][1] == height) return kFixedKernels[i];
+        }
+    }
+    return PreprocessKernel{"generic", &preprocess_generic, false};
+}
+
+void benchmark_preprocess(const PreprocessKernel& kernel, int width, int height, int src_w, int src_h, int iterations) {
+    if (iterations <= 0) return;
+    cv::Mat src(src_h, src_w, CV_8UC3);
+    cv::randu(src, cv::Scalar::all(0), cv::Scalar::all(255));
+    std::vector<uint8_t> a(static_cast<size_t>(width) * height * 3), b(a.size());
+
+    auto run = [&](PreprocessFn fn, std::vector<uint8_t>& out) {
+        fn(src, out.data(), width, height); // warm-up (테이블 생성 포함)
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) fn(src, out.data(), width, height);
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / iterations;
+    };
+    double us_kernel = run(kernel.fn, a);
+    double us_generic = run(&preprocess_generic, b);
+
+    int max_diff = 0;
+    for (size_t i = 0; i < a.size(); ++i) max_diff = std::max(max_diff, std::abs(static_cast<int>(a[i]) - static_cast<int>(b[i])));
+    std::cerr << "[preprocess] bench " << src_w << "x" << src_h << " -> " << width << "x" << height
+              << " kernel=" << kernel.name << " " << us_kernel << "us"
+              << " generic=" << us_generic << "us"
+              << " speedup=" << (us_kernel > 0.0 ? us_generic / us_kernel : 0.0)
+              << " max_diff=" << max_diff << "\n";
+}
@@ -0,0 +1,82 @@
+#include "rate_governor.h"
+#include "env_config.h"
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+
+RateGovernor::Options RateGovernor::FromEnv(double source_fps) {
+    Options o;
+    const char* en = std::getenv("AIPEX_RATE_ADAPTIVE");
+    o.enabled = !(en && std::string(en) == "0");
+    o.max_fps = env_double("AIPEX_RATE_MAX_FPS", source_fps > 0.0 ? source_fps : o.max_fps);
+    o.min_fps = std::min(env_double("AIPEX_RATE_MIN_FPS", o.min_fps), o.max_fps);
+    o.idle_hold = std::chrono::milliseconds(static_cast<int64_t>(env_double("AIPEX_RATE_IDLE_HOLD_MS", 1000)));
+    o.ramp_down = std::chrono::milliseconds(static_cast<int64_t>(env_double("AIPEX_RATE_RAMP_DOWN_MS", 3000)));
+    o.ramp_up = std::chrono::milliseconds(static_cast<int64_t>(env_double("AIPEX_RATE_RAMP_UP_MS", 0)));
+    o.motion_threshold = env_double("AIPEX_RATE_MOTION_THRESH", o.motion_threshold);
+    return o;
+}
+
+RateGovernor::RateGovernor(Options opts)
+    : opts_(opts), current_fps_(opts.max_fps),
+      last_activity_(Clock::now()), last_update_(Clock::now()), window_start_(Clock::now())
+{}
+
+void RateGovernor::ObserveDetections(size_t count, Clock::time_point now) {
+    if (count > 0) last_activity_ = std::max(last_activity_, now);
+}
+
+void RateGovernor::ObserveMotion(double score, Clock::time_point now) {
+    if (score >= opts_.motion_threshold) last_activity_ = std::max(last_activity_, now);
+}
+
+double RateGovernor::TargetRate(Clock::time_point now) const {
+    auto idle = now - last_activity_;
+    if (idle <= opts_.idle_hold) return opts_.max_fps;
+    if (opts_.ramp_down.count() <= 0) return opts_.min_fps;
+    double t = std::chrono::duration<double>(idle - opts_.idle_hold).count()
+             / std::chrono::duration<double>(opts_.ramp_down).count();
+    t = std::min(1.0, t);
+    return opts_.max_fps - (opts_.max_fps - opts_.min_fps) * t;
+}
+
+bool RateGovernor::ShouldSend(Clock::time_point now) {
+    double dt = std::chrono::duration<double>(now - last_update_).count();
+    last_update_ = now;
+
+    if (!opts_.enabled) {
+        current_fps_ = opts_.max_fps;
+        credit_ = 1.0;
+    } else {
+        double target = TargetRate(now);
+        if (target >= current_fps_) {
+            // 활동 감지 -> 복귀. ramp_up 이 0 이면 즉시 최대 전송률
+            if (opts_.ramp_up.count() <= 0) {
+                current_fps_ = target;
+                credit_ = 1.0; // 다음 프레임은 바로 보냄
+            } else {
+                double step = (opts_.max_fps - opts_.min_fps) * dt
+                            / std::chrono::duration<double>(opts_.ramp_up).count();
+                current_fps_ = std::min(target, current_fps_ + step);
+            }
+        } else {
+            current_fps_ = target; // 감속은 TargetRate 자체가 ramp
+        }
+        credit_ = std::min(1.0, credit_ + dt * current_fps_);
+    }
+
+    // 최대 전송률에서는 소스 프레임 간격의 jitter 와 무관하게 모든 프레임 전송
+    bool send = current_fps_ >= opts_.max_fps || credit_ >= 0.999;
+    if (send) {
+        credit_ = std::max(0.0, credit_ - 1.0);
+        window_sent_++;
+    }
+
+    double win = std::chrono::duration<double>(now - window_start_).count();
+    if (win >= 1.0) {
+        measured_fps_ = window_sent_ / win;
+        window_sent_ = 0;
+        window_start_ = now;
+    }
+    return send;
+}
@@ -0,0 +1,100 @@
+#include "result_writer.h"
+#include "env_config.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+ResultWriter::Options ResultWriter::FromEnv() {
+    Options o;
+    o.cap = std::chrono::milliseconds(std::max(0, env_int("AIPEX_RESULT_COALESCE_MS", 0)));
+    o.max_batch = static_cast<size_t>(std::max(1, env_int("AIPEX_RESULT_BATCH_MAX", 16)));
+    return o;
+}
+
+ResultWriter::ResultWriter(Options opts, Stream* stream, std::mutex& write_mtx)
+    : opts_(opts), stream_(stream), write_mtx_(write_mtx) {
+    if (Enabled()) thread_ = std::thread([this] { Loop(); });
+}
+
+ResultWriter::~ResultWriter() {
+    Close();
+}
+
+bool ResultWriter::Push(data_types::DetectionResult&& result, bool urgent) {
+    auto now = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        if (failed_ || closing_) return false;
+        pending_.push_back({std::move(result), urgent ? now : now + opts_.cap});
+    }
+    cv_.notify_one();
+    return true;
+}
+
+void ResultWriter::Close() {
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        if (closing_) return;
+        closing_ = true;
+    }
+    cv_.notify_one();
+    if (thread_.joinable()) thread_.join();
+    if (messages_) {
+        std::cerr << "[results] coalesced stream: results=" << results_ << " messages=" << messages_
+                  << " results/msg=" << static_cast<double>(results_) / messages_ << " largest=" << largest_
+                  << " buffer_hint=" << hinted_ << "\n";
+    }
+}
+
+void ResultWriter::Loop() {
+    std::unique_lock<std::mutex> lk(mtx_);
+    for (;;) {
+        // 보낼 때가 된 결과가 있을 때까지 대기. 가장 이른 due 는 급한 결과가 들어오면 앞당겨짐
+        auto earliest = [this] {
+            auto t = std::chrono::steady_clock::time_point::max();
+            for (const auto& it : pending_) t = std::min(t, it.due);
+            return t;
+        };
+        while (!closing_ && (pending_.empty() || earliest() > std::chrono::steady_clock::now())) {
+            if (pending_.empty()) cv_.wait(lk);
+            else cv_.wait_until(lk, earliest());
+        }
+        if (pending_.empty()) break; // closing
+        if (failed_) {
+            pending_.clear();
+            continue;
+        }
+
+        // 모인 결과를 완료 순서대로 최대 max_batch 개
+        size_t n = std::min(pending_.size(), opts_.max_batch);
+        data_types::ServerMessage sm;
+        if (n == 1) {
+            *sm.mutable_detection_result() = std::move(pending_.front().result);
+        } else {
+            auto* batch = sm.mutable_result_batch();
+            for (size_t i = 0; i < n; ++i) *batch->add_results() = std::move(pending_[i].result);
+        }
+        pending_.erase(pending_.begin(), pending_.begin() + static_cast<std::ptrdiff_t>(n));
+        // 바로 이어서 쓸 결과가 있으면 전송을 다음 Write 와 합쳐도 됨 (다음 Write 가 flush)
+        const bool more = !pending_.empty() && earliest() <= std::chrono::steady_clock::now();
+        lk.unlock();
+
+        bool ok;
+        {
+            std::lock_guard<std::mutex> wlk(write_mtx_);
+            grpc::WriteOptions wo;
+            if (more) wo.set_buffer_hint();
+            ok = stream_->Write(sm, wo);
+        }
+
+        lk.lock();
+        messages_++;
+        results_ += n;
+        hinted_ += more ? 1 : 0;
+        largest_ = std::max(largest_, n);
+        if (!ok) {
+            std::cerr << "[results] Write failed, client disconnected\n";
+            failed_ = true;
+        }
+    }
+}
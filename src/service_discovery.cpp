@@ -0,0 +1,407 @@
+#include "service_discovery.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <map>
+#include <set>
+#include <cstring>
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+static uint64_t now_epoch_ms() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+static std::string to_lower(std::string s) {
+    std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) { return std::tolower(c); });
+    return s;
+}
+
+// ---------------------------------------------------------------------------
+// StaticFileSource
+// ---------------------------------------------------------------------------
+
+StaticFileSource::StaticFileSource(const std::string& path) : path_(path) {}
+
+std::vector<DiscoveredEndpoint> StaticFileSource::Browse(std::chrono::milliseconds) {
+    std::vector<DiscoveredEndpoint> out;
+    std::ifstream ifs(path_);
+    if (!ifs) {
+        std::cerr << "[discovery] static file not found: " << path_ << "\n";
+        return out;
+    }
+    uint64_t now = now_epoch_ms();
+    std::string line;
+    while (std::getline(ifs, line)) {
+        auto hash = line.find('#');
+        if (hash != std::string::npos) line.erase(hash);
+        std::istringstream ss(line);
+        std::string a, b;
+        if (!(ss >> a)) continue;
+        DiscoveredEndpoint ep;
+        if (ss >> b) { ep.name = a; ep.address = b; }
+        else         { ep.name = a; ep.address = a; }
+        ep.last_seen_ms = now;
+        out.push_back(std::move(ep));
+    }
+    return out;
+}
+
+// ---------------------------------------------------------------------------
+// MdnsSource: 최소한의 DNS 메시지 인코딩/디코딩 (RFC 1035 / RFC 6762)
+// ---------------------------------------------------------------------------
+
+namespace {
+
+constexpr uint16_t kTypeA = 1;
+constexpr uint16_t kTypePTR = 12;
+constexpr uint16_t kTypeSRV = 33;
+constexpr uint16_t kClassIN = 1;
+constexpr uint16_t kUnicastResponse = 0x8000;
+
+void put_u16(std::vector<uint8_t>& b, uint16_t v) {
+    b.push_back(static_cast<uint8_t>(v >> 8));
+    b.push_back(static_cast<uint8_t>(v & 0xff));
+}
+
+void put_name(std::vector<uint8_t>& b, const std::string& name) {
+    size_t start = 0;
+    while (start < name.size()) {
+        size_t dot = name.find('.', start);
+        if (dot == std::string::npos) dot = name.size();
+        size_t len = std::min<size_t>(dot - start, 63);
+        b.push_back(static_cast<uint8_t>(len));
+        b.insert(b.end(), name.begin() + start, name.begin() + start + len);
+        start = dot + 1;
+    }
+    b.push_back(0);
+}
+
+struct Reader {
+    const uint8_t* data;
+    size_t size;
+    size_t pos;
+
+    bool u16(uint16_t& v) {
+        if (pos + 2 > size) return false;
+        v = static_cast<uint16_t>((data[pos] << 8) | data[pos + 1]);
+        pos += 2;
+        return true;
+    }
+    bool u32(uint32_t& v) {
+        uint16_t hi, lo;
+        if (!u16(hi) || !u16(lo)) return false;
+        v = (static_cast<uint32_t>(hi) << 16) | lo;
+        return true;
+    }
+    // 압축 포인터를 따라가며 이름을 읽음. pos는 원래 위치 기준으로 전진
+    bool name(std::string& out) {
+        out.clear();
+        size_t p = pos;
+        bool jumped = false;
+        int hops = 0;
+        while (true) {
+            if (p >= size) return false;
+            uint8_t len = data[p];
+            if ((len & 0xC0) == 0xC0) {
+                if (p + 1 >= size || ++hops > 16) return false;
+                size_t target = ((len & 0x3F) << 8) | data[p + 1];
+                if (!jumped) pos = p + 2;
+                jumped = true;
+                p = target;
+                continue;
+            }
+            if (len == 0) {
+                if (!jumped) pos = p + 1;
+                break;
+            }
+            if (p + 1 + len > size) return false;
+            if (!out.empty()) out.push_back('.');
+            out.append(reinterpret_cast<const char*>(data + p + 1), len);
+            p += 1 + len;
+        }
+        out = to_lower(out);
+        return true;
+    }
+};
+
+} // namespace
+
+MdnsSource::MdnsSource(const std::string& service_type, std::vector<std::string> hostnames, uint16_t default_port)
+    : service_type_(to_lower(service_type)), hostnames_(std::move(hostnames)), default_port_(default_port)
+{
+    for (auto& h : hostnames_) h = to_lower(h);
+}
+
+std::vector<DiscoveredEndpoint> MdnsSource::Browse(std::chrono::milliseconds timeout) {
+    std::vector<DiscoveredEndpoint> out;
+
+    // 1) 질의 패킷 구성: PTR(service) + A(hostnames)
+    std::vector<uint8_t> q;
+    uint16_t qcount = static_cast<uint16_t>((service_type_.empty() ? 0 : 1) + hostnames_.size());
+    if (qcount == 0) return out;
+    put_u16(q, 0); put_u16(q, 0); put_u16(q, qcount); put_u16(q, 0); put_u16(q, 0); put_u16(q, 0);
+    if (!service_type_.empty()) {
+        put_name(q, service_type_);
+        put_u16(q, kTypePTR);
+        put_u16(q, kClassIN | kUnicastResponse);
+    }
+    for (const auto& h : hostnames_) {
+        put_name(q, h);
+        put_u16(q, kTypeA);
+        put_u16(q, kClassIN | kUnicastResponse);
+    }
+
+    // 2) ephemeral 포트에서 전송 -> 응답자는 legacy unicast 로 회신 (RFC 6762 6.7)
+    int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) {
+        std::cerr << "[discovery] mdns socket failed: " << std::strerror(errno) << "\n";
+        return out;
+    }
+    unsigned char ttl = 255;
+    setsockopt(fd, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl));
+    sockaddr_in dst{};
+    dst.sin_family = AF_INET;
+    dst.sin_port = htons(5353);
+    inet_pton(AF_INET, "224.0.0.251", &dst.sin_addr);
+    if (::sendto(fd, q.data(), q.size(), 0, reinterpret_cast<sockaddr*>(&dst), sizeof(dst)) < 0) {
+        std::cerr << "[discovery] mdns sendto failed: " << std::strerror(errno) << "\n";
+        ::close(fd);
+        return out;
+    }
+
+    // 3) timeout 동안 들어오는 모든 응답 수집 (여러 보드가 각자 응답)
+    std::map<std::string, std::string> a_records;                  // host -> ip
+    std::map<std::string, std::pair<std::string, uint16_t>> srv;   // instance -> (target, port)
+    std::set<std::string> instances;
+
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    std::vector<uint8_t> buf(9000);
+    while (true) {
+        auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        if (left.count() <= 0) break;
+        pollfd pfd{fd, POLLIN, 0};
+        int pr = ::poll(&pfd, 1, static_cast<int>(left.count()));
+        if (pr <= 0) break;
+        ssize_t n = ::recv(fd, buf.data(), buf.size(), 0);
+        if (n < 12) continue;
+
+        Reader r{buf.data(), static_cast<size_t>(n), 0};
+        uint16_t id, flags, qd, an, ns, ar;
+        if (!r.u16(id) || !r.u16(flags) || !r.u16(qd) || !r.u16(an) || !r.u16(ns) || !r.u16(ar)) continue;
+        if (!(flags & 0x8000)) continue; // not a response
+
+        bool ok = true;
+        std::string name;
+        for (uint16_t i = 0; i < qd && ok; ++i) {
+            uint16_t t, c;
+            ok = r.name(name) && r.u16(t) && r.u16(c);
+        }
+        uint32_t rr_count = static_cast<uint32_t>(an) + ns + ar;
+        for (uint32_t i = 0; i < rr_count && ok; ++i) {
+            uint16_t type, cls, rdlen;
+            uint32_t rr_ttl;
+            if (!(r.name(name) && r.u16(type) && r.u16(cls) && r.u32(rr_ttl) && r.u16(rdlen))) { ok = false; break; }
+            size_t rd_end = r.pos + rdlen;
+            if (rd_end > r.size) { ok = false; break; }
+            if (type == kTypeA && rdlen == 4) {
+                char ip[INET_ADDRSTRLEN] = {0};
+                inet_ntop(AF_INET, r.data + r.pos, ip, sizeof(ip));
+                a_records[name] = ip;
+            } else if (type == kTypePTR && name == service_type_) {
+                std::string inst;
+                Reader sub{r.data, r.size, r.pos};
+                if (sub.name(inst)) instances.insert(inst);
+            } else if (type == kTypeSRV && rdlen > 6) {
+                Reader sub{r.data, r.size, r.pos};
+                uint16_t prio, weight, port;
+                std::string target;
+                if (sub.u16(prio) && sub.u16(weight) && sub.u16(port) && sub.name(target)) {
+                    srv[name] = {target, port};
+                }
+            }
+            r.pos = rd_end;
+        }
+    }
+    ::close(fd);
+
+    // 4) 결과 조합: DNS-SD 인스턴스 우선, 그 다음 호스트명 A 레코드
+    uint64_t now = now_epoch_ms();
+    std::set<std::string> seen;
+    for (const auto& kv : srv) {
+        if (!instances.empty() && !instances.count(kv.first)) continue;
+        auto it = a_records.find(kv.second.first);
+        if (it == a_records.end()) continue;
+        std::string addr = it->second + ":" + std::to_string(kv.second.second);
+        if (!seen.insert(addr).second) continue;
+        out.push_back({kv.second.first, addr, now});
+    }
+    for (const auto& h : hostnames_) {
+        auto it = a_records.find(h);
+        if (it == a_records.end()) continue;
+        std::string addr = it->second + ":" + std::to_string(default_port_);
+        if (!seen.insert(addr).second) continue;
+        out.push_back({h, addr, now});
+    }
+    return out;
+}
+
+// ---------------------------------------------------------------------------
+// ServiceDiscovery
+// ---------------------------------------------------------------------------
+
+ServiceDiscovery::ServiceDiscovery(Options opts) : opts_(std::move(opts)) {}
+
+ServiceDiscovery::~ServiceDiscovery() { Stop(); }
+
+void ServiceDiscovery::AddSource(std::unique_ptr<DiscoverySource> src) {
+    std::lock_guard<std::mutex> lk(mtx_);
+    sources_.push_back(std::move(src));
+}
+
+void ServiceDiscovery::SetListener(Listener listener) {
+    std::lock_guard<std::mutex> lk(mtx_);
+    listener_ = std::move(listener);
+}
+
+size_t ServiceDiscovery::LoadCache() {
+    if (opts_.cache_path.empty()) return 0;
+    std::ifstream ifs(opts_.cache_path);
+    if (!ifs) return 0;
+
+    std::vector<DiscoveredEndpoint> loaded;
+    std::string line;
+    while (std::getline(ifs, line)) {
+        std::istringstream ss(line);
+        DiscoveredEndpoint ep;
+        if (ss >> ep.name >> ep.address >> ep.last_seen_ms) loaded.push_back(std::move(ep));
+    }
+    size_t n = loaded.size();
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        entries_ = std::move(loaded);
+    }
+    std::cerr << "[discovery] loaded " << n << " cached endpoint(s) from " << opts_.cache_path << "\n";
+    cv_.notify_all();
+    if (n > 0) NotifyListener();
+    return n;
+}
+
+void ServiceDiscovery::SaveCacheLocked() const {
+    if (opts_.cache_path.empty()) return;
+    // tmp 파일에 쓰고 rename 하여 부분 기록된 캐시를 읽는 일이 없도록 함
+    std::string tmp = opts_.cache_path + ".tmp";
+    {
+        std::ofstream ofs(tmp, std::ofstream::trunc);
+        if (!ofs) return;
+        for (const auto& ep : entries_) {
+            ofs << ep.name << "\t" << ep.address << "\t" << ep.last_seen_ms << "\n";
+        }
+    }
+    if (std::rename(tmp.c_str(), opts_.cache_path.c_str()) != 0) {
+        std::cerr << "[discovery] failed to write cache " << opts_.cache_path << "\n";
+    }
+}
+
+bool ServiceDiscovery::RefreshOnce() {
+    std::vector<DiscoverySource*> srcs;
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        for (auto& s : sources_) srcs.push_back(s.get());
+    }
+
+    // 네트워크 대기는 lock 밖에서 수행
+    std::vector<DiscoveredEndpoint> found;
+    for (auto* s : srcs) {
+        auto r = s->Browse(opts_.browse_timeout);
+        found.insert(found.end(), r.begin(), r.end());
+    }
+
+    bool changed = false;
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        std::vector<std::string> before;
+        for (const auto& e : entries_) before.push_back(e.address);
+
+        for (const auto& f : found) {
+            auto it = std::find_if(entries_.begin(), entries_.end(),
+                                   [&](const DiscoveredEndpoint& e) { return e.address == f.address; });
+            if (it != entries_.end()) *it = f;
+            else entries_.push_back(f);
+        }
+        uint64_t now = now_epoch_ms();
+        uint64_t ttl = static_cast<uint64_t>(opts_.entry_ttl.count());
+        entries_.erase(std::remove_if(entries_.begin(), entries_.end(),
+                                      [&](const DiscoveredEndpoint& e) { return now > e.last_seen_ms + ttl; }),
+                       entries_.end());
+        std::stable_sort(entries_.begin(), entries_.end(),
+                         [](const DiscoveredEndpoint& a, const DiscoveredEndpoint& b) { return a.last_seen_ms > b.last_seen_ms; });
+
+        std::vector<std::string> after;
+        for (const auto& e : entries_) after.push_back(e.address);
+        std::vector<std::string> sb = before, sa = after;
+        std::sort(sb.begin(), sb.end());
+        std::sort(sa.begin(), sa.end());
+        changed = (sb != sa);
+        if (!found.empty()) SaveCacheLocked();
+    }
+    cv_.notify_all();
+    if (changed) {
+        std::cerr << "[discovery] endpoint list changed (" << found.size() << " found this round)\n";
+        NotifyListener();
+    }
+    return changed;
+}
+
+void ServiceDiscovery::NotifyListener() {
+    Listener l;
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        l = listener_;
+    }
+    if (l) l(Endpoints());
+}
+
+void ServiceDiscovery::Start() {
+    if (running_.exchange(true)) return;
+    refresh_thread_ = std::thread(&ServiceDiscovery::RefreshLoop, this);
+}
+
+void ServiceDiscovery::Stop() {
+    if (!running_.exchange(false)) return;
+    cv_.notify_all();
+    if (refresh_thread_.joinable()) refresh_thread_.join();
+}
+
+void ServiceDiscovery::RefreshLoop() {
+    while (running_.load()) {
+        RefreshOnce();
+        std::unique_lock<std::mutex> lk(mtx_);
+        cv_.wait_for(lk, opts_.refresh_interval, [this] { return !running_.load(); });
+    }
+}
+
+std::vector<std::string> ServiceDiscovery::Endpoints() const {
+    std::lock_guard<std::mutex> lk(mtx_);
+    std::vector<std::string> out;
+    for (const auto& e : entries_) out.push_back(e.address);
+    return out;
+}
+
+std::vector<DiscoveredEndpoint> ServiceDiscovery::Snapshot() const {
+    std::lock_guard<std::mutex> lk(mtx_);
+    return entries_;
+}
+
+bool ServiceDiscovery::WaitForEndpoints(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lk(mtx_);
+    return cv_.wait_for(lk, timeout, [this] { return !entries_.empty(); });
+}
@@ -1,15 +1,36 @@
 #include "service_impl.h"
+#include "env_config.h"
 #include <iostream>
 #include <csignal>
 #include <chrono>
 #include <opencv2/opencv.hpp>
+#include "hailo_segmentation.h"
+#include "executor.h"
+#include "perf_counters.h"
+#include "pipeline_policy.h"
+#include "frame_assembler.h"
+#include "result_writer.h"
+#include "session_negotiation.h"
+#include "jpeg_codec.h"
+#include "operating_profile.h"
+#include "device_watchdog.h"
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <cstdlib>
+#if AIPEX_COROUTINES
+#include "coro_datastream.h"
+#endif
 // wakeup client
 #include "wakeup.grpc.pb.h"
 #include "wakeup.pb.h"
 #include <grpcpp/grpcpp.h>
 
 // forward declaration from hailo_object_detection.cpp
-extern int hailo_infer(const cv::Mat& input_frame, bool return_image, std::string& result_json, cv::Mat& result_image);
+extern int hailo_infer(const cv::Mat& input_frame, bool return_image, std::string& result_json, cv::Mat& result_image,
+                       std::vector<EncodedMask>* masks, bool low_priority = false, std::string* backend = nullptr,
+                       bool allow_defer = false);
+extern void hailo_defer_until_recovered(std::function<void(bool recovered)> resume);
 // Helper: get target from env or use provided default
 static std::string get_wakeup_target_or_default(const std::string& fallback) {
     const char* wt = std::getenv("WAKEUP_TARGET");
@@ -36,25 +57,349 @@ static bool send_wakeup_to_target(const std::string &target) {
 
 
 
-grpc::Status ComputeServiceImpl::Datastream(::grpc::ServerContext* context,
-                                            ::grpc::ServerReaderWriter<data_types::ServerMessage, data_types::Command>* stream) {
+// AIPEX_SERVICE_VERBOSE=1: 받은 명령/프레임마다 로그 (프레임 payload 는 출력하지 않음)
+static const bool g_verbose = env_bool("AIPEX_SERVICE_VERBOSE", false);
+
+// 프레임 하나 처리: 디코드 -> 추론(전처리/후처리 포함) -> 응답 메시지 구성. executor worker 에서 실행
+// deferred 가 주어지면 장치 복구 중인 프레임은 실패 대신 *deferred = true (복구 후 다시 처리)
+static bool build_frame_response(const InboundFrame& in, data_types::ServerMessage& sm, bool* deferred = nullptr) {
+    const data_types::CameraFrame& cf = in.meta;
+    // Decode image_data to cv::Mat. "BGR" 은 복사 없이 수신 버퍼를 그대로 감쌈
+    cv::Mat frame;
+    {
+        PerfStage stage("decode");
+        uint8_t* bytes = const_cast<uint8_t*>(in.data());
+        if (cf.format() == "BGR") {
+            if (in.size() == static_cast<size_t>(cf.width()) * cf.height() * 3) {
+                frame = cv::Mat(static_cast<int>(cf.height()), static_cast<int>(cf.width()), CV_8UC3, bytes);
+            }
+        } else {
+            // worker 스레드마다 디코드 버퍼를 재사용 (크기가 같으면 할당 없음)
+            // 모델 입력은 RGB 지만 BGR 로 디코드: 채널 순서 변경은 전처리 커널이 resize 와 같은 순회에서 하고,
+            // CPU/spill 백엔드, crop 분류기, 결과 이미지 그리기는 BGR 프레임을 받음
+            thread_local cv::Mat decoded;
+            if (jpeg_decode(bytes, in.size(), decoded)) frame = decoded;
+        }
+    }
+    if (frame.empty()) {
+        std::cerr << "[service] Failed to decode image\n";
+        return false;
+    }
+
+    // Run inference
+    std::string result_json;
+    cv::Mat result_image;
+    std::vector<EncodedMask> masks;
+    std::string backend;
+    bool return_image = false; // set true if you want annotated image back
+    int ret = hailo_infer(frame, return_image, result_json, result_image, &masks, cf.low_priority(), &backend,
+                          deferred != nullptr);
+    if (ret == kHailoInferDeferred && deferred) {
+        *deferred = true;
+        return false;
+    }
+    if (ret != 0) {
+        std::cerr << "[service] hailo_infer failed\n";
+        return false;
+    }
+
+    PerfStage stage("encode");
+    if (!return_image) {
+        // Send JSON detection result
+        auto dr = sm.mutable_detection_result();
+        dr->set_json(result_json);
+        dr->set_frame_id(cf.frame_id());
+        dr->set_backend(backend);
+        dr->set_camera_id(cf.camera_id());
+        for (const auto& m : masks) {
+            auto* im = dr->add_masks();
+            im->set_detection_index(m.detection_index);
+            im->set_x_min(m.x_min);
+            im->set_y_min(m.y_min);
+            im->set_x_max(m.x_max);
+            im->set_y_max(m.y_max);
+            im->set_width(m.width);
+            im->set_height(m.height);
+            im->mutable_counts()->Add(m.counts.begin(), m.counts.end());
+            im->set_label(m.label);
+            im->set_score(m.score);
+        }
+        auto ts = dr->mutable_frame_timestamp();
+        auto now = std::chrono::system_clock::now();
+        ts->set_seconds(std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count());
+    } else {
+        // Send annotated image as CameraFrame
+        auto out_cf = sm.mutable_camera_frame();
+        static const JpegEncodeOptions env_jpeg_opts = JpegEncodeOptions::FromEnv();
+        JpegEncodeOptions jpeg_opts = env_jpeg_opts;
+        jpeg_opts.quality = ProfileManager::Instance().Current().jpeg_quality;
+        thread_local JpegBuffer enc_buf;
+        if (!jpeg_encode(result_image, enc_buf, jpeg_opts)) return false;
+        out_cf->set_image_data(enc_buf.data(), enc_buf.size());
+        out_cf->set_width(result_image.cols);
+        out_cf->set_height(result_image.rows);
+        out_cf->set_format("JPEG");
+        out_cf->set_camera_id(cf.camera_id());
+        // 원본 프레임의 캡처 시각을 그대로 전달 (client playout 버퍼가 캡처 간격으로 재생)
+        if (cf.has_timestamp()) {
+            *out_cf->mutable_timestamp() = cf.timestamp();
+        } else {
+            auto ts = out_cf->mutable_timestamp();
+            auto since = std::chrono::system_clock::now().time_since_epoch();
+            auto secs = std::chrono::duration_cast<std::chrono::seconds>(since);
+            ts->set_seconds(secs.count());
+            ts->set_nanos(static_cast<int32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(since - secs).count()));
+        }
+    }
+    return true;
+}
+
+// 처리하지 않은 프레임(admission drop, 디코드/추론 실패, 종료 중)의 응답. client 의 미완료/재정렬 상태가
+// 이 frame 을 기다리지 않게 함. backend 가 비어 있으면 client 는 "장면이 비었음" 으로 취급하지 않음
+static void fill_empty_result(const data_types::CameraFrame& cf, data_types::ServerMessage& sm) {
+    sm.Clear();
+    auto* dr = sm.mutable_detection_result();
+    dr->set_json("{\"detections\":[]}");
+    dr->set_frame_id(cf.frame_id());
+    dr->set_camera_id(cf.camera_id());
+}
+
+// 현재 운영 프로필/센서 상태를 DeviceStatus 로
+static void fill_device_status(data_types::DeviceStatus* ds) {
+    auto st = ProfileManager::Instance().GetStatus();
+    ds->set_state(data_types::DeviceStatus::GRPC_READY);
+    ds->set_cpu_temperature_c(static_cast<float>(st.temperature_c));
+    ds->set_profile(st.profile.name);
+    ds->set_profile_auto(st.automatic);
+    ds->set_profile_reason(st.reason);
+    ds->set_battery_percent(static_cast<float>(st.battery_pct));
+    ds->set_active_streams(static_cast<uint32_t>(st.active_streams));
+    ds->set_jpeg_quality(static_cast<uint32_t>(st.profile.jpeg_quality));
+}
+
+namespace {
+using ComputeStream = ::grpc::ServerReaderWriter<data_types::ServerMessage, data_types::Command>;
+
+// 한 스트림에 여러 카메라(camera_id) 프레임이 섞여 옴. 처리 중 상한은 카메라별로 적용하고,
+// 상한에 닿은 카메라는 최신 프레임 1장을 보관해 두어 다른 카메라 프레임의 Read 를 막지 않음
+struct CameraState {
+    size_t inflight = 0;
+    std::shared_ptr<InboundFrame> parked;
+    uint64_t frames = 0;
+    uint64_t dropped = 0;
+    uint64_t skipped = 0; // infer_stride 로 건너뜀
+};
+
+// Datastream 하나의 상태. executor 작업이 shared_ptr 로 함께 가지므로 handler 는 처리 중인 프레임이
+// 남아 있어도 deadline 에 반환할 수 있음 (반환 전에 stream 을 떼어 내고, 늦게 끝난 작업은 결과를 버림)
+struct DatastreamState : std::enable_shared_from_this<DatastreamState> {
     std::mutex write_mtx;
+    ComputeStream* stream = nullptr; // write_mtx 로 보호. handler 반환 전에 nullptr
     std::atomic<bool> running{true};
+    std::atomic<bool> stopped{false}; // handler 가 Read 를 끝냄: 아직 시작하지 않은 프레임은 추론하지 않음
+    // AIPEX_RESULT_COALESCE_MS 설정 시 검출 결과는 writer 스레드가 묶어서 보냄.
+    // ResultBatch 를 모르는 구버전 client 도 있으므로 hello 로 result_batch 를 합의한 스트림에서만 생성
+    // (hello 는 첫 메시지이므로 프레임 작업이 시작된 뒤에는 바뀌지 않음)
+    std::unique_ptr<ResultWriter> results;
+    std::shared_ptr<StreamLiveness> live; // inflight 를 registry 에도 알림 (서버 종료 시 drain)
+
+    std::mutex inflight_mtx;
+    std::condition_variable inflight_cv;
+    size_t inflight = 0;
+    bool closing = false;
+    std::map<uint32_t, CameraState> cameras; // inflight_mtx 로 보호
+
+    // stream 이 떼어졌거나 Write 가 실패하면 false
+    bool Write(const data_types::ServerMessage& sm) {
+        std::lock_guard<std::mutex> lk(write_mtx);
+        if (!stream || !running.load()) return false;
+        if (stream->Write(sm)) return true;
+        std::cerr << "[service] Write failed, client disconnected\n";
+        running.store(false);
+        return false;
+    }
+
+    // 디코드/전처리/추론/후처리/JPEG 인코딩은 공용 executor 에서. 다음 프레임 Read 와 겹쳐 실행됨
+    // 결과 순서는 client 가 frame_id 로 재정렬. 끝나면 그 카메라에 보관된 프레임을 이어서 실행
+    // resumed: 장치 복구를 기다렸다가 다시 제출된 프레임 (또 복구 중이면 기다리지 않고 실패)
+    void Launch(std::shared_ptr<InboundFrame> in, bool resumed) {
+        auto self = shared_from_this();
+        Executor::Instance().Submit([self, in, resumed] { self->Process(in, resumed); }, Executor::Priority::NORMAL);
+    }
+
+    void Process(const std::shared_ptr<InboundFrame>& in, bool resumed) {
+        data_types::ServerMessage sm;
+        // 스트림이 끝났으면(client 종료, 취소, 서버 종료) 아직 시작하지 않은 프레임은 추론하지 않음
+        // 추론하지 않았거나 실패한 프레임도 빈 결과로 응답
+        bool deferred = false;
+        const bool ok = !stopped.load() && build_frame_response(*in, sm, resumed ? nullptr : &deferred);
+        if (deferred) {
+            // 장치 복구 중: 자리(inflight)를 쥔 채 watchdog 대기열로. worker 는 바로 다른 작업으로
+            auto self = shared_from_this();
+            hailo_defer_until_recovered([self, in](bool) { self->Launch(in, true); });
+            return;
+        }
+        if (!ok) fill_empty_result(in->meta, sm);
+        if (results && sm.has_detection_result()) {
+            if (!results->Push(std::move(*sm.mutable_detection_result()), ok)) running.store(false);
+        } else {
+            Write(sm); // handler 가 반환한 뒤 끝난 작업이면 stream 이 없으므로 버려짐
+        }
+        std::shared_ptr<InboundFrame> next;
+        {
+            std::lock_guard<std::mutex> lk(inflight_mtx);
+            CameraState& cam = cameras[in->meta.camera_id()];
+            if (cam.parked && !closing) {
+                next = std::move(cam.parked); // 자리를 그대로 넘겨받음
+            } else {
+                cam.inflight--;
+                inflight--;
+                live->inflight.fetch_sub(1);
+            }
+            inflight_cv.notify_all();
+        }
+        if (next) Launch(std::move(next), false);
+    }
+
+    // 처리하지 않는 프레임에 빈 결과로 응답 (급하지 않으므로 결과 묶음에서는 다음 결과와 함께 보냄)
+    void ReplyEmpty(const data_types::CameraFrame& cf) {
+        data_types::ServerMessage sm;
+        fill_empty_result(cf, sm);
+        if (results) {
+            if (!results->Push(std::move(*sm.mutable_detection_result()), false)) running.store(false);
+            return;
+        }
+        Write(sm);
+    }
+};
+} // namespace
+
+grpc::Status ComputeServiceImpl::Datastream(::grpc::ServerContext* context,
+                                            ::grpc::ServerReaderWriter<data_types::ServerMessage, data_types::Command>* stream) {
+    std::shared_ptr<StreamLiveness> live = streams_.Register(context);
+    if (!live) return grpc::Status(grpc::StatusCode::UNAVAILABLE, "server shutting down");
+    struct Registration {
+        StreamRegistry& registry;
+        ::grpc::ServerContext* context;
+        ~Registration() { registry.Unregister(context); }
+    } registration{streams_, context};
+#if AIPEX_COROUTINES
+    if (coro_datastream_enabled()) return CoroDatastream(context, stream, live.get());
+#endif
+    auto st = std::make_shared<DatastreamState>();
+    st->stream = stream;
+    st->live = live;
+    bool negotiated = false;
+    size_t client_inflight = 0; // hello 로 합의한 카메라별 동시 처리 수 (0 = 프로필 값 그대로)
+    // 동시 처리 수/admission/추론 간격은 운영 프로필에서 프레임마다 읽음 (실행 중 전환 반영)
+    ProfileManager& profiles = ProfileManager::Instance();
+    profiles.StreamOpened();
+    uint64_t profile_gen = 0; // client 에 마지막으로 보낸 DeviceStatus 의 프로필 세대
+    uint64_t dropped = 0;
+
+    // 카메라별 동시 처리 프레임 수 제한
+    // BLOCK: 1장은 보관하고 계속 Read, 보관 자리도 차 있으면 Read 를 멈춰 client 에 backpressure
+    // DROP_NEWEST: 이 프레임을 버리고 빈 결과로 응답
+    auto admit = [&](std::shared_ptr<InboundFrame> in) {
+        const data_types::CameraFrame& cf = in->meta;
+        if (g_verbose) {
+            std::cerr << "[service] camera_frame received: camera=" << cf.camera_id() << " "
+                      << cf.width() << "x" << cf.height() << "\n";
+        }
+        if (streams_.Draining()) {
+            // 서버 종료 중: 처리 중인 프레임만 마저 끝내고 새 프레임은 시작하지 않음
+            st->ReplyEmpty(cf);
+            return;
+        }
+        const OperatingProfile profile = profiles.Current();
+        FrameAdmission admission = profile.Admission();
+        if (client_inflight) admission.max_inflight = std::min(admission.max_inflight, client_inflight);
+        std::unique_lock<std::mutex> lk(st->inflight_mtx);
+        CameraState& cam = st->cameras[cf.camera_id()];
+        const bool skip = profile.infer_stride > 1 && cam.frames % profile.infer_stride != 0;
+        cam.frames++;
+        FrameAdmission::Decision d = skip ? FrameAdmission::Decision::DROP : admission.Admit(cam.inflight);
+        if (d == FrameAdmission::Decision::DROP) {
+            if (skip) {
+                cam.skipped++;
+                lk.unlock();
+            } else {
+                cam.dropped++;
+                lk.unlock();
+                if (++dropped % 100 == 1) std::cerr << "[service] frames dropped at admission: " << dropped << "\n";
+            }
+            st->ReplyEmpty(cf);
+            return;
+        }
+        while (d == FrameAdmission::Decision::WAIT) {
+            if (!cam.parked) break;
+            st->inflight_cv.wait(lk);
+            d = admission.Admit(cam.inflight);
+        }
+        if (d == FrameAdmission::Decision::WAIT) {
+            cam.parked = std::move(in);
+            return;
+        }
+        cam.inflight++;
+        st->inflight++;
+        live->inflight.fetch_add(1);
+        lk.unlock();
+        st->Launch(std::move(in), false);
+    };
+
+    // 분할 전송된 프레임 조립. chunk 사이에 다른 명령(heartbeat 등)이 끼어도 됨
+    FrameAssembler assembler(FrameAssembler::FromEnv());
 
     data_types::Command cmd;
-    while (running.load()) {
+    uint64_t messages = 0;
+    while (st->running.load()) {
         if (context->IsCancelled()) {
             std::cerr << "[service] context cancelled, exiting\n";
             break;
         }
 
+        live->ResumeReading();
         bool ok = stream->Read(&cmd);
+        live->PauseReading(); // 처리/admission 대기 중에는 생존 확인을 멈춤
         if (!ok) {
-            std::cerr << "[service] client closed stream\n";
+            std::cerr << "[service] " << (live->reaped.load() ? "stream reaped (idle)" : "client closed stream") << "\n";
             break;
         }
+        const bool frame = cmd.has_camera_frame() || cmd.has_frame_header() || cmd.has_frame_chunk();
+        if (frame || cmd.has_heartbeat()) live->Touch(frame);
+        messages++;
+
+        if (g_verbose && !cmd.has_frame_chunk() && !cmd.has_camera_frame()) {
+            std::cerr << "[service recv] cmd:\n" << cmd.DebugString() << "\n";
+        }
+
+        // 전송 방식 합의. 압축은 initial metadata 와 함께 정해지므로 첫 Write 전에 처리
+        if (cmd.has_hello()) {
+            if (negotiated || messages != 1) {
+                std::cerr << "[service] hello ignored: must be the first message of the stream\n";
+                continue;
+            }
+            negotiated = true;
+            ResultWriter::Options ro = ResultWriter::FromEnv();
+            data_types::Capabilities server = server_capabilities(profiles.Current().stream_inflight, ro.cap.count() > 0);
+            data_types::ServerMessage resp;
+            data_types::SessionConfig& sc = *resp.mutable_session_config();
+            sc = negotiate_session(cmd.hello(), server);
+            if (sc.result_batch()) st->results = std::make_unique<ResultWriter>(ro, stream, st->write_mtx);
+            client_inflight = sc.max_inflight();
+            if (sc.compression() == "gzip") context->set_compression_algorithm(GRPC_COMPRESS_GZIP);
+            else if (sc.compression() == "deflate") context->set_compression_algorithm(GRPC_COMPRESS_DEFLATE);
+            std::cerr << "[service] negotiated with " << context->peer() << ": " << describe_session(sc) << "\n";
+            if (!st->Write(resp)) break;
+        }
 
-        std::cerr << "[service recv] cmd:\n" << cmd.DebugString() << "\n";
+        // 프로필이 바뀌었으면(스트림 시작 포함) DeviceStatus 로 알림
+        if (profiles.Generation() != profile_gen) {
+            profile_gen = profiles.Generation();
+            data_types::ServerMessage status;
+            fill_device_status(status.mutable_device_status());
+            if (!st->Write(status)) break;
+        }
 
         // Handle incoming Command
         if (cmd.has_control_action()) {
@@ -69,68 +414,101 @@ grpc::Status ComputeServiceImpl::Datastream(::grpc::ServerContext* context,
                 send_wakeup_to_target(tgt);
             } else if (action == data_types::ControlAction::STOP_STREAMING) {
                 std::cerr << "[service] STOP_STREAMING\n";
-                running.store(false);
-            } 
-        } else if (cmd.has_heartbeat()) {
-            std::cerr << "[service] heartbeat received\n";
-        } else if (cmd.has_camera_frame()) {
-            // NEW: handle incoming camera frame for inference
-            auto& cf = cmd.camera_frame();
-            std::cerr << "[service] camera_frame received: " << cf.width() << "x" << cf.height() << "\n";
-
-            // Decode image_data to cv::Mat
-            std::vector<uint8_t> img_bytes(cf.image_data().begin(), cf.image_data().end());
-            cv::Mat frame = cv::imdecode(img_bytes, cv::IMREAD_COLOR);
-            if (frame.empty()) {
-                std::cerr << "[service] Failed to decode image\n";
-                continue;
-            }
-
-            // Run inference
-            std::string result_json;
-            cv::Mat result_image;
-            bool return_image = false; // set true if you want annotated image back
-            int ret = hailo_infer(frame, return_image, result_json, result_image);
-            if (ret != 0) {
-                std::cerr << "[service] hailo_infer failed\n";
-                continue;
+                break; // 처리 중인 프레임의 결과는 AIPEX_STREAM_DRAIN_MS 안에 끝나면 마저 보냄
+            } else if (action == data_types::ControlAction::SET_PROFILE) {
+                std::string msg;
+                bool ok_sel = profiles.Select(cmd.control_action().profile(), msg);
+                data_types::ServerMessage resp;
+                resp.mutable_config_response()->set_success(ok_sel);
+                resp.mutable_config_response()->set_message(msg);
+                if (!st->Write(resp)) break;
             }
-
-            // Send response
-            data_types::ServerMessage sm;
-            if (!return_image) {
-                // Send JSON detection result
-                auto dr = sm.mutable_detection_result();
-                dr->set_json(result_json);
-                auto ts = dr->mutable_frame_timestamp();
-                auto now = std::chrono::system_clock::now();
-                ts->set_seconds(std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count());
-            } else {
-                // Send annotated image as CameraFrame
-                auto out_cf = sm.mutable_camera_frame();
-                std::vector<uint8_t> enc_buf;
-                cv::imencode(".jpg", result_image, enc_buf);
-                out_cf->set_image_data(enc_buf.data(), enc_buf.size());
-                out_cf->set_width(result_image.cols);
-                out_cf->set_height(result_image.rows);
-                out_cf->set_format("JPEG");
-                auto ts = out_cf->mutable_timestamp();
-                auto now = std::chrono::system_clock::now();
-                ts->set_seconds(std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count());
+        } else if (cmd.has_config_request()) {
+            const auto& cr = cmd.config_request();
+            data_types::ServerMessage resp;
+            resp.mutable_config_response()->set_success(true);
+            if (!cr.profile().empty()) {
+                std::string msg;
+                resp.mutable_config_response()->set_success(profiles.Select(cr.profile(), msg));
+                resp.mutable_config_response()->set_message(msg);
             }
-
-            {
-                std::lock_guard<std::mutex> lk(write_mtx);
-                bool write_ok = stream->Write(sm);
-                if (!write_ok) {
-                    std::cerr << "[service] Write failed, client disconnected\n";
-                    running.store(false);
-                    break;
-                }
+            if (!st->Write(resp)) break;
+        } else if (cmd.has_heartbeat()) {
+            // client 의 RTT 측정을 위해 그대로 돌려보냄
+            data_types::ServerMessage hb;
+            hb.mutable_heartbeat()->CopyFrom(cmd.heartbeat());
+            if (!st->Write(hb)) break;
+        } else if (cmd.has_camera_frame()) {
+            auto in = std::make_shared<InboundFrame>();
+            in->meta = std::move(*cmd.mutable_camera_frame());
+            admit(std::move(in));
+        } else if (cmd.has_frame_header()) {
+            std::string err;
+            if (!assembler.OnHeader(*cmd.mutable_frame_header(), err)) std::cerr << "[service] " << err << "\n";
+            for (const auto& cf : assembler.TakeAborted()) st->ReplyEmpty(cf);
+        } else if (cmd.has_frame_chunk()) {
+            std::shared_ptr<InboundFrame> in;
+            std::string err;
+            if (assembler.OnChunk(*cmd.mutable_frame_chunk(), in, err)) {
+                admit(std::move(in));
+            } else if (!err.empty()) {
+                std::cerr << "[service] " << err << "\n";
+                for (const auto& cf : assembler.TakeAborted()) st->ReplyEmpty(cf);
             }
         }
     }
+    {
+        const auto& s = assembler.GetStats();
+        if (s.assembled || s.aborted || s.duplicates) {
+            std::cerr << "[service] chunked frames: assembled=" << s.assembled << " aborted=" << s.aborted
+                      << " duplicate_headers=" << s.duplicates
+                      << " MB=" << s.bytes / (1024.0 * 1024.0)
+                      << " assemble_ms avg=" << (s.assembled ? s.assemble_ms_sum / s.assembled : 0.0)
+                      << " max=" << s.assemble_ms_max << "\n";
+        }
+    }
 
+    // 보관 중인 프레임은 처리하지 않고 빈 결과로 응답. 처리 중인 프레임은 AIPEX_STREAM_DRAIN_MS 까지 기다려
+    // 결과를 보냄 (서버 종료 중이면 shutdown deadline 까지, 취소된 스트림이면 보낼 수 없으므로 기다리지 않음).
+    // 그 뒤에 끝나는 작업은 state 를 함께 가지므로 handler 는 먼저 반환하고, 그 결과는 stream 을 떼어 낸 뒤라 버려짐
+    st->stopped.store(true);
+    std::vector<std::shared_ptr<InboundFrame>> discarded;
+    size_t left = 0;
+    {
+        static const auto drain = std::chrono::milliseconds(std::max(0, env_int("AIPEX_STREAM_DRAIN_MS", 2000)));
+        auto deadline = std::chrono::steady_clock::now() + drain;
+        if (streams_.Draining()) deadline = std::min(deadline, streams_.ShutdownDeadline());
+        std::unique_lock<std::mutex> lk(st->inflight_mtx);
+        st->closing = true;
+        for (auto& kv : st->cameras) {
+            if (!kv.second.parked) continue;
+            discarded.push_back(std::move(kv.second.parked)); // 보관 자리는 inflight 에 들어 있지 않음
+        }
+        lk.unlock();
+        for (const auto& in : discarded) st->ReplyEmpty(in->meta);
+        lk.lock();
+        while (st->inflight > 0 && !context->IsCancelled()) {
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) break;
+            // 취소를 알아채도록 짧게 나눠 기다림
+            st->inflight_cv.wait_until(lk, std::min(deadline, now + std::chrono::milliseconds(20)));
+        }
+        left = st->inflight;
+        for (const auto& kv : st->cameras) {
+            std::cerr << "[service] camera " << kv.first << ": frames=" << kv.second.frames
+                      << " dropped=" << kv.second.dropped << " skipped=" << kv.second.skipped << "\n";
+        }
+    }
+    if (left || !discarded.empty()) {
+        std::cerr << "[service] stream closed with " << left << " frame(s) still running (results discarded), "
+                  << discarded.size() << " parked frame(s) answered empty\n";
+    }
+    if (st->results) st->results->Close(); // 모아 둔 결과 전송. 이후 Push 는 false
+    {
+        std::lock_guard<std::mutex> lk(st->write_mtx);
+        st->stream = nullptr;
+    }
+    profiles.StreamClosed();
     std::cerr << "[service] Datastream handler exiting\n";
     return grpc::Status::OK;
 }
@@ -0,0 +1,77 @@
+#include "session_negotiation.h"
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+
+// gRPC 기본 수신 상한(4MB) 안에 chunk 와 메시지 헤더가 들어가도록
+static constexpr uint32_t kServerMaxChunkBytes = (4u << 20) - (64u << 10);
+
+static bool contains(const google::protobuf::RepeatedPtrField<std::string>& list, const std::string& v) {
+    return std::find(list.begin(), list.end(), v) != list.end();
+}
+
+data_types::Capabilities server_capabilities(size_t max_inflight, bool result_batch) {
+    data_types::Capabilities c;
+    c.set_protocol_version(kSessionProtocolVersion);
+    c.add_frame_formats("JPEG");
+    c.add_frame_formats("BGR");
+    c.add_result_encodings("json");
+    c.set_result_batch(result_batch);
+    c.set_chunked_frames(true);
+    c.set_max_chunk_bytes(kServerMaxChunkBytes);
+    c.set_max_inflight(static_cast<uint32_t>(max_inflight));
+    // JPEG 프레임/짧은 JSON 은 거의 줄지 않으므로 설정했을 때만 (마스크가 큰 segmentation 용)
+    const char* comp = std::getenv("AIPEX_STREAM_COMPRESSION");
+    if (comp && (std::string(comp) == "gzip" || std::string(comp) == "deflate")) c.add_compression(comp);
+    return c;
+}
+
+data_types::SessionConfig negotiate_session(const data_types::Capabilities& client,
+                                            const data_types::Capabilities& server) {
+    data_types::SessionConfig s;
+    s.set_protocol_version(std::min(client.protocol_version(), server.protocol_version()));
+
+    s.set_frame_format("JPEG");
+    for (const auto& f : client.frame_formats()) {
+        if (contains(server.frame_formats(), f)) {
+            s.set_frame_format(f);
+            break;
+        }
+    }
+    s.set_result_encoding("json");
+    for (const auto& e : client.result_encodings()) {
+        if (contains(server.result_encodings(), e)) {
+            s.set_result_encoding(e);
+            break;
+        }
+    }
+
+    s.set_result_batch(client.result_batch() && server.result_batch());
+    if (client.chunked_frames() && server.chunked_frames() && client.max_chunk_bytes() > 0) {
+        s.set_chunked_frames(true);
+        s.set_chunk_bytes(std::min(client.max_chunk_bytes(), server.max_chunk_bytes()));
+    }
+
+    uint32_t inflight = server.max_inflight();
+    if (client.max_inflight() > 0 && (inflight == 0 || client.max_inflight() < inflight)) inflight = client.max_inflight();
+    s.set_max_inflight(inflight);
+
+    // server 가 선호하는 순서로 client 도 받는 첫 번째
+    for (const auto& c : server.compression()) {
+        if (contains(client.compression(), c)) {
+            s.set_compression(c);
+            break;
+        }
+    }
+    return s;
+}
+
+std::string describe_session(const data_types::SessionConfig& s) {
+    std::ostringstream os;
+    os << "v" << s.protocol_version() << " frames=" << s.frame_format() << " results=" << s.result_encoding()
+       << (s.result_batch() ? "+batch" : "") << " chunked=";
+    if (s.chunked_frames()) os << s.chunk_bytes() / 1024 << "KB";
+    else os << "off";
+    os << " max_inflight=" << s.max_inflight() << " compression=" << (s.compression().empty() ? "none" : s.compression());
+    return os.str();
+}
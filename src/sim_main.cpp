@@ -0,0 +1,87 @@
+// aipex_sim: 스케줄링 정책 조합을 가상 시계로 평가
+// 예) ./aipex_sim --stages stages.txt --fps 30 --duration 120 --inflight 1,2,4 --admission block,drop --batch 1,4 --batch-wait-ms 0,2
+// 쉼표로 나열한 값들의 모든 조합을 실행하고 조합마다 한 줄 출력
+#include "pipeline_sim.h"
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static std::string get_option(int argc, char** argv, const std::string& name, const std::string& def) {
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (name == argv[i]) return argv[i + 1];
+    }
+    return def;
+}
+
+static bool has_flag(int argc, char** argv, const std::string& name) {
+    for (int i = 1; i < argc; ++i) {
+        if (name == argv[i]) return true;
+    }
+    return false;
+}
+
+static std::vector<std::string> split_list(const std::string& s) {
+    std::vector<std::string> out;
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) out.push_back(item);
+    }
+    return out;
+}
+
+int main(int argc, char** argv) {
+    if (has_flag(argc, argv, "--help")) {
+        std::cout << "usage: aipex_sim [--stages FILE] [--fps 30] [--duration 60] [--seed 1]\n"
+                     "                 [--boards 1] [--workers 4] [--lb least|latency] [--rate] [--activity 1.0]\n"
+                     "                 [--inflight 2[,..]] [--admission block[,drop]] [--batch 1[,..]] [--batch-wait-ms 0[,..]]\n"
+                     "stages FILE: \"<stage> <ms>\" samples (AIPEX_PERF_SAMPLES output) and \"device <batch> <ms>\" lines\n";
+        return 0;
+    }
+
+    SimConfig base;
+    std::string stages = get_option(argc, argv, "--stages", "");
+    if (!stages.empty() && !LoadStageLatencies(stages, base)) {
+        std::cerr << "[sim] cannot read " << stages << "\n";
+        return 1;
+    }
+    base.source_fps = std::atof(get_option(argc, argv, "--fps", "30").c_str());
+    base.duration_s = std::atof(get_option(argc, argv, "--duration", "60").c_str());
+    base.seed = std::strtoull(get_option(argc, argv, "--seed", "1").c_str(), nullptr, 10);
+    base.boards = static_cast<size_t>(std::max(1, std::atoi(get_option(argc, argv, "--boards", "1").c_str())));
+    base.cpu_workers = static_cast<size_t>(std::max(1, std::atoi(get_option(argc, argv, "--workers", "4").c_str())));
+    base.lb_policy = LoadBalancer::PolicyFromString(get_option(argc, argv, "--lb", "least"));
+    base.use_rate_governor = has_flag(argc, argv, "--rate");
+    base.rate = RateGovernor::FromEnv(base.source_fps);
+    base.activity = std::atof(get_option(argc, argv, "--activity", "1.0").c_str());
+
+    auto inflights = split_list(get_option(argc, argv, "--inflight", "2"));
+    auto admissions = split_list(get_option(argc, argv, "--admission", "block"));
+    auto batches = split_list(get_option(argc, argv, "--batch", "1"));
+    auto waits = split_list(get_option(argc, argv, "--batch-wait-ms", "0"));
+
+    std::cerr << "[sim] device curve:";
+    for (const auto& p : base.device.points) std::cerr << " b" << p.first << "=" << p.second << "ms";
+    std::cerr << " | stage means ms: decode=" << base.decode.Mean() << " preprocess=" << base.preprocess.Mean()
+              << " postprocess=" << base.postprocess.Mean() << " classify=" << base.classify.Mean()
+              << " encode=" << base.encode.Mean() << " uplink=" << base.uplink.Mean()
+              << " downlink=" << base.downlink.Mean() << "\n";
+
+    for (const auto& in : inflights) {
+        for (const auto& ad : admissions) {
+            for (const auto& b : batches) {
+                for (const auto& w : waits) {
+                    SimConfig cfg = base;
+                    cfg.admission.max_inflight = static_cast<size_t>(std::max(1, std::atoi(in.c_str())));
+                    cfg.admission.mode = ad == "drop" ? FrameAdmission::Mode::DROP_NEWEST : FrameAdmission::Mode::BLOCK;
+                    cfg.batch.batch_size = static_cast<size_t>(std::max(1, std::atoi(b.c_str())));
+                    cfg.batch.max_wait = std::chrono::microseconds(static_cast<int64_t>(std::atof(w.c_str()) * 1000.0));
+                    PrintSimResult(cfg, RunPipelineSim(cfg), std::cout);
+                }
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,178 @@
+#include "spillover.h"
+#include "env_config.h"
+#include "executor.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+SpilloverScheduler::Options SpilloverScheduler::FromEnv() {
+    Options o;
+    // 임계값/NMS 등은 CPU 백엔드 설정을 따르고 모델/입력 크기/Net 수만 spill 전용으로
+    o.cpu = CpuDetector::FromEnv();
+    o.cpu.bench_frames = 0;
+    const char* onnx = std::getenv("AIPEX_SPILL_ONNX");
+    o.cpu.onnx_path = onnx ? onnx : "";
+    o.cpu.input_w = o.cpu.input_h = 320;
+    const char* in = std::getenv("AIPEX_SPILL_INPUT");
+    if (in && *in) {
+        int w = 0, h = 0;
+        if (std::sscanf(in, "%dx%d", &w, &h) == 2 && w > 0 && h > 0) {
+            o.cpu.input_w = w;
+            o.cpu.input_h = h;
+        } else if (std::atoi(in) > 0) {
+            o.cpu.input_w = o.cpu.input_h = std::atoi(in);
+        }
+    }
+    o.cpu.nets = static_cast<size_t>(std::max(1, env_int("AIPEX_SPILL_NETS", 2)));
+    o.policy = SpillPolicy::FromEnv();
+    o.audit_every = std::max(0, env_int("AIPEX_SPILL_AUDIT_EVERY", 50));
+    return o;
+}
+
+SpilloverScheduler::SpilloverScheduler(Options opts)
+    : opts_(std::move(opts)), cpu_(opts_.cpu), window_start_(std::chrono::steady_clock::now()) {}
+
+SpilloverScheduler::~SpilloverScheduler() {
+    std::unique_lock<std::mutex> lk(audit_mtx_);
+    audit_cv_.wait(lk, [this] { return audits_inflight_ == 0; });
+}
+
+int SpilloverScheduler::Init() {
+    if (cpu_.Init() != 0) return -1;
+    cpu_slots_ = opts_.cpu.nets;
+    std::cerr << "[spill] enabled: wait_threshold=" << opts_.policy.wait_threshold_ms
+              << "ms hard_threshold=" << opts_.policy.hard_threshold_ms
+              << "ms cpu_slots=" << cpu_slots_ << " audit_every=" << opts_.audit_every << "\n";
+    return 0;
+}
+
+void SpilloverScheduler::DeviceExit(double run_ms) {
+    device_waiters_.fetch_sub(1, std::memory_order_relaxed);
+    // 장치 실행은 mutex 로 직렬화되어 있으므로 갱신이 겹치지 않음
+    double prev = device_run_ewma_ms_.load(std::memory_order_relaxed);
+    device_run_ewma_ms_.store(prev == 0.0 ? run_ms : 0.8 * prev + 0.2 * run_ms, std::memory_order_relaxed);
+}
+
+double SpilloverScheduler::ExpectedWaitMs() const {
+    return device_waiters_.load(std::memory_order_relaxed) * device_run_ewma_ms_.load(std::memory_order_relaxed);
+}
+
+bool SpilloverScheduler::TakeCpuSlot() {
+    size_t cur = cpu_inflight_.load(std::memory_order_relaxed);
+    while (cur < cpu_slots_) {
+        if (cpu_inflight_.compare_exchange_weak(cur, cur + 1, std::memory_order_relaxed)) return true;
+    }
+    return false;
+}
+
+bool SpilloverScheduler::TrySpill(bool low_priority, bool device_down) {
+    if (!device_down && !opts_.policy.ShouldSpill(ExpectedWaitMs(), low_priority)) return false;
+    return TakeCpuSlot();
+}
+
+int SpilloverScheduler::Detect(const cv::Mat& bgr, std::vector<SegDetection>& out) {
+    int ret = cpu_.Detect(bgr, out);
+    cpu_inflight_.fetch_sub(1, std::memory_order_relaxed);
+    return ret;
+}
+
+void SpilloverScheduler::Record(Backend backend, double latency_ms, const std::vector<SpillBox>& dets) {
+    std::lock_guard<std::mutex> lk(stats_mtx_);
+    BackendStats& s = stats_[static_cast<int>(backend)];
+    s.frames++;
+    s.latency_ms += latency_ms;
+    s.detections += dets.size();
+    for (const auto& d : dets) s.score_sum += d.score;
+    MaybeLog(std::chrono::steady_clock::now());
+}
+
+static float box_iou(const SpillBox& a, const SpillBox& b) {
+    float ix = std::max(0.f, std::min(a.x_max, b.x_max) - std::max(a.x_min, b.x_min));
+    float iy = std::max(0.f, std::min(a.y_max, b.y_max) - std::max(a.y_min, b.y_min));
+    float inter = ix * iy;
+    float uni = (a.x_max - a.x_min) * (a.y_max - a.y_min) + (b.x_max - b.x_min) * (b.y_max - b.y_min) - inter;
+    return uni > 0.f ? inter / uni : 0.f;
+}
+
+// 점수 높은 Hailo 박스부터 아직 짝이 없는 같은 class CPU 박스 중 IoU 최대와 짝지음
+static size_t match_boxes(std::vector<SpillBox> ref, const std::vector<SpillBox>& cand) {
+    std::sort(ref.begin(), ref.end(), [](const SpillBox& a, const SpillBox& b) { return a.score > b.score; });
+    std::vector<bool> used(cand.size(), false);
+    size_t matched = 0;
+    for (const auto& r : ref) {
+        int best = -1;
+        float best_iou = 0.5f;
+        for (size_t j = 0; j < cand.size(); ++j) {
+            if (used[j] || cand[j].label != r.label) continue;
+            float iou = box_iou(r, cand[j]);
+            if (iou >= best_iou) {
+                best_iou = iou;
+                best = static_cast<int>(j);
+            }
+        }
+        if (best >= 0) {
+            used[best] = true;
+            matched++;
+        }
+    }
+    return matched;
+}
+
+void SpilloverScheduler::MaybeAudit(const cv::Mat& frame, const std::vector<SpillBox>& reference,
+                                    std::vector<SpillBox> (*to_boxes)(const std::vector<SegDetection>&)) {
+    if (opts_.audit_every <= 0) return;
+    if (hailo_frames_seen_.fetch_add(1, std::memory_order_relaxed) % opts_.audit_every != 0) return;
+    // 장치가 밀려 있으면 CPU 는 spill 용으로 남겨 둠
+    if (ExpectedWaitMs() > 0.0 || cpu_inflight_.load(std::memory_order_relaxed) > 0) return;
+    {
+        std::lock_guard<std::mutex> lk(audit_mtx_);
+        if (audits_inflight_ > 0) return;
+        // audit 도 CPU net 하나를 쓰므로 spill 과 같은 자리를 차지 (없으면 건너뜀)
+        if (!TakeCpuSlot()) return;
+        audits_inflight_++;
+    }
+    cv::Mat copy = frame.clone();
+    Executor::Instance().Submit([this, copy, reference, to_boxes] {
+        std::vector<SegDetection> found;
+        // Detect 가 자리를 반납
+        if (Detect(copy, found) == 0) {
+            std::vector<SpillBox> cand = to_boxes(found);
+            size_t matched = match_boxes(reference, cand);
+            std::lock_guard<std::mutex> lk(stats_mtx_);
+            audits_++;
+            audit_ref_ += reference.size();
+            audit_cpu_ += cand.size();
+            audit_matched_ += matched;
+        }
+        std::lock_guard<std::mutex> lk(audit_mtx_);
+        audits_inflight_--;
+        audit_cv_.notify_all();
+    }, Executor::Priority::LOW);
+}
+
+void SpilloverScheduler::MaybeLog(std::chrono::steady_clock::time_point now) {
+    double elapsed = std::chrono::duration<double>(now - window_start_).count();
+    if (elapsed < 10.0) return;
+    static const char* kNames[2] = {"hailo", "cpu"};
+    std::cerr << "[spill] expected_wait_ms=" << ExpectedWaitMs();
+    for (int i = 0; i < 2; ++i) {
+        const BackendStats& s = stats_[i];
+        std::cerr << " " << kNames[i] << "={frames=" << s.frames;
+        if (s.frames) {
+            std::cerr << " latency_ms=" << s.latency_ms / s.frames
+                      << " dets/frame=" << static_cast<double>(s.detections) / s.frames
+                      << " avg_score=" << (s.detections ? s.score_sum / s.detections : 0.0);
+        }
+        std::cerr << "}";
+        stats_[i] = BackendStats();
+    }
+    // 정답 라벨이 없으므로 Hailo 결과를 기준으로 한 CPU 모델 일치율
+    if (audits_) {
+        std::cerr << " audit={frames=" << audits_
+                  << " recall=" << (audit_ref_ ? static_cast<double>(audit_matched_) / audit_ref_ : 1.0)
+                  << " precision=" << (audit_cpu_ ? static_cast<double>(audit_matched_) / audit_cpu_ : 1.0) << "}";
+    }
+    std::cerr << "\n";
+    window_start_ = now;
+}
@@ -0,0 +1,132 @@
+#include "stream_registry.h"
+#include "env_config.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+static int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void StreamLiveness::Touch(bool frame) {
+    int64_t now = now_ns();
+    live_ns.store(now, std::memory_order_relaxed);
+    if (frame) last_frame_ns.store(now, std::memory_order_relaxed);
+}
+
+void StreamLiveness::PauseReading() {
+    paused_ns.store(now_ns(), std::memory_order_relaxed);
+}
+
+void StreamLiveness::ResumeReading() {
+    int64_t paused = paused_ns.exchange(0, std::memory_order_relaxed);
+    if (paused == 0) return;
+    // 멈춰 있던 시간은 client 탓이 아니므로 그만큼 생존 시각을 뒤로 밂
+    int64_t now = now_ns();
+    int64_t live = live_ns.load(std::memory_order_relaxed);
+    live_ns.store(std::min(now, live + (now - paused)), std::memory_order_relaxed);
+}
+
+StreamRegistry::Options StreamRegistry::FromEnv() {
+    Options o;
+    o.idle_timeout = std::chrono::milliseconds(std::max(0, env_int("AIPEX_STREAM_IDLE_MS", 30000)));
+    return o;
+}
+
+StreamRegistry::StreamRegistry(Options opts) : opts_(opts) {
+    if (opts_.idle_timeout.count() > 0) thread_ = std::thread([this] { Loop(); });
+}
+
+StreamRegistry::~StreamRegistry() {
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        running_ = false;
+    }
+    loop_cv_.notify_all();
+    if (thread_.joinable()) thread_.join();
+}
+
+std::shared_ptr<StreamLiveness> StreamRegistry::Register(::grpc::ServerContext* context) {
+    std::lock_guard<std::mutex> lk(mtx_);
+    if (draining_.load()) return nullptr;
+    auto live = std::make_shared<StreamLiveness>();
+    live->Touch(false);
+    streams_[context] = live;
+    return live;
+}
+
+void StreamRegistry::Unregister(::grpc::ServerContext* context) {
+    std::lock_guard<std::mutex> lk(mtx_);
+    streams_.erase(context);
+    cv_.notify_all();
+}
+
+void StreamRegistry::BeginShutdown(std::chrono::steady_clock::time_point deadline) {
+    std::lock_guard<std::mutex> lk(mtx_);
+    shutdown_deadline_ = deadline;
+    draining_.store(true);
+    size_t inflight = 0;
+    for (auto& kv : streams_) inflight += kv.second->inflight.load();
+    std::cerr << "[service] shutdown: draining " << streams_.size() << " stream(s), " << inflight
+              << " frame(s) running\n";
+}
+
+size_t StreamRegistry::WaitDrained(std::chrono::steady_clock::time_point deadline) {
+    // 프레임 완료마다 알림을 받지 않고 짧게 나눠 확인 (종료 때만 쓰임)
+    std::unique_lock<std::mutex> lk(mtx_);
+    while (true) {
+        size_t inflight = 0;
+        for (auto& kv : streams_) inflight += kv.second->inflight.load();
+        const auto now = std::chrono::steady_clock::now();
+        if (inflight == 0 || now >= deadline) return inflight;
+        cv_.wait_until(lk, std::min(deadline, now + std::chrono::milliseconds(5)));
+    }
+}
+
+void StreamRegistry::CancelAll() {
+    std::lock_guard<std::mutex> lk(mtx_);
+    for (auto& kv : streams_) kv.first->TryCancel();
+    std::cerr << "[service] shutdown: cancelled " << streams_.size() << " stream(s)\n";
+}
+
+std::chrono::steady_clock::time_point StreamRegistry::ShutdownDeadline() {
+    std::lock_guard<std::mutex> lk(mtx_);
+    return shutdown_deadline_;
+}
+
+size_t StreamRegistry::WaitIdle(std::chrono::steady_clock::time_point deadline) {
+    std::unique_lock<std::mutex> lk(mtx_);
+    cv_.wait_until(lk, deadline, [this] { return streams_.empty(); });
+    return streams_.size();
+}
+
+void StreamRegistry::Resume() {
+    std::lock_guard<std::mutex> lk(mtx_);
+    draining_.store(false);
+}
+
+void StreamRegistry::Loop() {
+    // 확인 주기: timeout 의 1/4 (최소 100ms). 끊는 시점이 timeout 보다 그만큼 늦을 수 있음
+    const auto period = std::max(std::chrono::milliseconds(100), opts_.idle_timeout / 4);
+    const int64_t timeout_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(opts_.idle_timeout).count();
+    std::unique_lock<std::mutex> lk(mtx_);
+    while (running_) {
+        loop_cv_.wait_for(lk, period, [this] { return !running_; });
+        if (!running_) break;
+        int64_t now = now_ns();
+        for (auto& kv : streams_) {
+            StreamLiveness& live = *kv.second;
+            if (live.paused_ns.load(std::memory_order_relaxed) != 0) continue; // 서버가 Read 하지 않는 중
+            int64_t idle = now - live.live_ns.load(std::memory_order_relaxed);
+            if (idle < timeout_ns || live.reaped.load(std::memory_order_relaxed)) continue;
+            live.reaped.store(true, std::memory_order_relaxed);
+            reaped_++;
+            int64_t last_frame = live.last_frame_ns.load(std::memory_order_relaxed);
+            std::cerr << "[service] reaping stream " << kv.first->peer() << ": idle " << idle / 1000000 << "ms"
+                      << " (last frame " << (last_frame ? std::to_string((now - last_frame) / 1000000) + "ms ago" : "never")
+                      << ", reaped total " << reaped_ << ")\n";
+            kv.first->TryCancel();
+        }
+    }
+}
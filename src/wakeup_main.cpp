@@ -0,0 +1,47 @@
+// 출력 보드용 WakeUpService 서버 (wakeup.py 로 보내는 TriggerScript / IsDisplayOn 수신)
+// 로컬 확인 예:
+//   AIPEX_WAKEUP_SCRIPT=/tmp/on.sh AIPEX_DISPLAY_PROBE='cat /tmp/display 2>/dev/null' ./aipex_wakeup
+//   (/tmp/on.sh 는 `echo "Monitor is On" > /tmp/display` 하는 더미 스크립트)
+#include "wakeup_service.h"
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+static std::atomic<bool> g_terminate{false};
+static void signal_handler(int) { g_terminate.store(true); }
+
+int main() {
+    std::signal(SIGINT, signal_handler);
+    std::signal(SIGTERM, signal_handler);
+    std::signal(SIGPIPE, SIG_IGN);
+
+    // helper fork 는 gRPC/확인 스레드가 생기기 전에
+    ScriptRunner runner;
+    if (!runner.Start()) {
+        std::cerr << "[wakeup] failed to start script runner\n";
+        return 1;
+    }
+    DisplayStateCache display(DisplayStateCache::FromEnv());
+    display.Start();
+
+    const char* p = std::getenv("WAKEUP_PORT");
+    std::string addr = std::string("0.0.0.0:") + (p && *p ? p : "50050");
+    WakeUpServiceImpl service(runner, display);
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort(addr, grpc::InsecureServerCredentials());
+    builder.RegisterService(&service);
+    std::unique_ptr<grpc::Server> server = builder.BuildAndStart();
+    if (!server) {
+        std::cerr << "[wakeup] failed to listen on " << addr << "\n";
+        return 1;
+    }
+    std::cerr << "[wakeup] WakeUpService listening on " << addr << "\n";
+
+    while (!g_terminate.load()) std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    server->Shutdown(std::chrono::system_clock::now() + std::chrono::milliseconds(500));
+    display.Stop();
+    std::cerr << "[wakeup] stopped\n";
+    return 0;
+}
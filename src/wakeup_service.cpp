@@ -0,0 +1,379 @@
+#include "wakeup_service.h"
+#include "env_config.h"
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+
+namespace {
+
+bool write_full(int fd, const void* buf, size_t n) {
+    const char* p = static_cast<const char*>(buf);
+    while (n > 0) {
+        ssize_t w = ::write(fd, p, n);
+        if (w < 0 && errno == EINTR) continue;
+        if (w <= 0) return false;
+        p += w;
+        n -= static_cast<size_t>(w);
+    }
+    return true;
+}
+
+bool read_full(int fd, void* buf, size_t n) {
+    char* p = static_cast<char*>(buf);
+    while (n > 0) {
+        ssize_t r = ::read(fd, p, n);
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0) return false;
+        p += r;
+        n -= static_cast<size_t>(r);
+    }
+    return true;
+}
+
+// exec 직전 상태로 대기하는 자식. 경로와 인자("path\0arg\0...")를 받으면 바로 exec
+pid_t arm_child(int& cmd_fd, int helper_req_fd, int helper_resp_fd) {
+    int fds[2];
+    if (pipe(fds) != 0) return -1;
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        return -1;
+    }
+    if (pid == 0) {
+        close(fds[1]);
+        close(helper_req_fd);
+        close(helper_resp_fd);
+        std::string payload;
+        char buf[4096];
+        ssize_t r;
+        while ((r = ::read(fds[0], buf, sizeof(buf))) != 0) {
+            if (r < 0) {
+                if (errno == EINTR) continue;
+                _exit(1);
+            }
+            payload.append(buf, static_cast<size_t>(r));
+        }
+        if (payload.empty()) _exit(0); // helper 종료
+        std::vector<char*> argv;
+        for (size_t pos = 0; pos < payload.size(); pos += std::strlen(&payload[pos]) + 1) argv.push_back(&payload[pos]);
+        argv.push_back(nullptr);
+        signal(SIGCHLD, SIG_DFL); // helper 의 SIG_IGN 이 스크립트로 넘어가지 않게
+        execv(argv[0], argv.data());
+        _exit(127);
+    }
+    close(fds[0]);
+    cmd_fd = fds[1];
+    return pid;
+}
+
+// helper 프로세스 본체: 요청마다 대기 중인 자식에게 넘기고 pid 회신, 다음 자식을 다시 준비
+[[noreturn]] void helper_main(int req_fd, int resp_fd) {
+    prctl(PR_SET_PDEATHSIG, SIGTERM);
+    signal(SIGCHLD, SIG_IGN); // 실행된 스크립트는 자동 회수
+    int armed_fd = -1;
+    pid_t armed = arm_child(armed_fd, req_fd, resp_fd);
+    for (;;) {
+        uint32_t len = 0;
+        if (!read_full(req_fd, &len, sizeof(len))) break;
+        std::string payload(len, '\0');
+        if (!read_full(req_fd, &payload[0], len)) break;
+        int32_t reply = -1;
+        if (armed < 0) armed = arm_child(armed_fd, req_fd, resp_fd);
+        if (armed > 0 && write_full(armed_fd, payload.data(), payload.size())) reply = static_cast<int32_t>(armed);
+        if (armed_fd >= 0) close(armed_fd);
+        armed_fd = -1;
+        if (!write_full(resp_fd, &reply, sizeof(reply))) break;
+        armed = arm_child(armed_fd, req_fd, resp_fd);
+    }
+    if (armed_fd >= 0) close(armed_fd); // 빈 payload -> 대기 중인 자식 종료
+    _exit(0);
+}
+
+} // namespace
+
+// ---------------- ScriptRunner ----------------
+
+ScriptRunner::~ScriptRunner() {
+    if (req_fd_ >= 0) close(req_fd_);
+    if (resp_fd_ >= 0) close(resp_fd_);
+    if (helper_pid_ > 0) waitpid(helper_pid_, nullptr, 0);
+}
+
+bool ScriptRunner::Start() {
+    int req[2], resp[2];
+    if (pipe(req) != 0) return false;
+    if (pipe(resp) != 0) {
+        close(req[0]);
+        close(req[1]);
+        return false;
+    }
+    pid_t pid = fork();
+    if (pid < 0) {
+        std::cerr << "[wakeup] fork failed: " << std::strerror(errno) << "\n";
+        close(req[0]); close(req[1]); close(resp[0]); close(resp[1]);
+        return false;
+    }
+    if (pid == 0) {
+        close(req[1]);
+        close(resp[0]);
+        helper_main(req[0], resp[1]);
+    }
+    close(req[0]);
+    close(resp[1]);
+    fcntl(req[1], F_SETFD, FD_CLOEXEC);
+    fcntl(resp[0], F_SETFD, FD_CLOEXEC);
+    req_fd_ = req[1];
+    resp_fd_ = resp[0];
+    helper_pid_ = pid;
+    std::cerr << "[wakeup] script runner ready (helper pid=" << pid << ")\n";
+    return true;
+}
+
+pid_t ScriptRunner::Run(const std::string& path, const std::vector<std::string>& args, std::string& err) {
+    std::string payload = path;
+    payload.push_back('\0');
+    for (const auto& a : args) {
+        payload += a;
+        payload.push_back('\0');
+    }
+    uint32_t len = static_cast<uint32_t>(payload.size());
+    int32_t pid = -1;
+    std::lock_guard<std::mutex> lk(mtx_);
+    if (req_fd_ < 0) {
+        err = "runner not started";
+        return -1;
+    }
+    if (!write_full(req_fd_, &len, sizeof(len)) || !write_full(req_fd_, payload.data(), payload.size()) ||
+        !read_full(resp_fd_, &pid, sizeof(pid))) {
+        err = "runner helper gone";
+        return -1;
+    }
+    if (pid < 0) err = "runner could not fork";
+    return pid;
+}
+
+// ---------------- DisplayStateCache ----------------
+
+DisplayStateCache::Options DisplayStateCache::FromEnv() {
+    Options o;
+    const char* probe = std::getenv("AIPEX_DISPLAY_PROBE");
+    if (probe && *probe) o.probe = probe;
+    const char* pat = std::getenv("AIPEX_DISPLAY_ON_PATTERN");
+    if (pat && *pat) o.on_pattern = pat;
+    o.idle_interval = std::chrono::milliseconds(std::max(50, env_int("AIPEX_DISPLAY_POLL_MS", 1000)));
+    return o;
+}
+
+DisplayStateCache::DisplayStateCache(Options opts) : opts_(std::move(opts)) {}
+
+DisplayStateCache::~DisplayStateCache() { Stop(); }
+
+void DisplayStateCache::Start() {
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        if (running_) return;
+        running_ = true;
+    }
+    thread_ = std::thread([this] { Loop(); });
+}
+
+void DisplayStateCache::Stop() {
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        running_ = false;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) thread_.join();
+}
+
+bool DisplayStateCache::On(std::string& info) const {
+    std::lock_guard<std::mutex> lk(mtx_);
+    info = info_;
+    return on_;
+}
+
+void DisplayStateCache::NoteTrigger(std::chrono::steady_clock::time_point t) {
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        pending_trigger_ = true;
+        was_on_at_trigger_ = on_;
+        trigger_at_ = t;
+    }
+    cv_.notify_all();
+}
+
+// 멀티스레드 프로세스이므로 fork 대신 posix_spawn 으로 확인 명령 실행
+bool DisplayStateCache::Probe(std::string& info) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        info = "probe pipe failed";
+        return false;
+    }
+    posix_spawn_file_actions_t fa;
+    posix_spawn_file_actions_init(&fa);
+    posix_spawn_file_actions_adddup2(&fa, fds[1], STDOUT_FILENO);
+    posix_spawn_file_actions_adddup2(&fa, fds[1], STDERR_FILENO);
+    posix_spawn_file_actions_addclose(&fa, fds[0]);
+    const char* argv[] = {"/bin/sh", "-c", opts_.probe.c_str(), nullptr};
+    pid_t pid = -1;
+    int rc = posix_spawn(&pid, "/bin/sh", &fa, nullptr, const_cast<char* const*>(argv), environ);
+    posix_spawn_file_actions_destroy(&fa);
+    close(fds[1]);
+    std::string out;
+    if (rc == 0) {
+        char buf[1024];
+        ssize_t r;
+        while ((r = ::read(fds[0], buf, sizeof(buf))) != 0) {
+            if (r < 0) {
+                if (errno == EINTR) continue;
+                break;
+            }
+            out.append(buf, static_cast<size_t>(r));
+        }
+        waitpid(pid, nullptr, 0);
+    }
+    close(fds[0]);
+    if (rc != 0) {
+        info = std::string("probe spawn failed: ") + std::strerror(rc);
+        return false;
+    }
+    bool on = out.find(opts_.on_pattern) != std::string::npos;
+    // 패턴이 있는 줄을 설명으로 (없으면 첫 줄)
+    std::istringstream is(out);
+    std::string line, first;
+    info.clear();
+    while (std::getline(is, line)) {
+        size_t b = line.find_first_not_of(" \t");
+        if (b == std::string::npos) continue;
+        line = line.substr(b);
+        if (first.empty()) first = line;
+        if (line.find(opts_.on_pattern) != std::string::npos) {
+            info = line;
+            break;
+        }
+    }
+    if (info.empty()) info = first.empty() ? "probe returned no output" : first;
+    return on;
+}
+
+void DisplayStateCache::Loop() {
+    std::unique_lock<std::mutex> lk(mtx_);
+    while (running_) {
+        lk.unlock();
+        std::string info;
+        auto started = std::chrono::steady_clock::now();
+        bool on = Probe(info);
+        auto now = std::chrono::steady_clock::now();
+        lk.lock();
+        if (on != on_) std::cerr << "[wakeup] display " << (on ? "on" : "off") << " (" << info << ")\n";
+        on_ = on;
+        info_ = info;
+        // trigger 전에 시작한 확인의 결과는 trigger 이후 상태가 아니므로 지연 측정에 쓰지 않음
+        if (pending_trigger_ && started >= trigger_at_) {
+            double ms = std::chrono::duration<double, std::milli>(now - trigger_at_).count();
+            if (on && was_on_at_trigger_) {
+                pending_trigger_ = false;
+                std::cerr << "[wakeup] trigger while display already on\n";
+            } else if (on) {
+                pending_trigger_ = false;
+                wakeups_++;
+                wake_ms_sum_ += ms;
+                wake_ms_max_ = std::max(wake_ms_max_, ms);
+                std::cerr << "[wakeup] trigger -> display on " << ms << "ms (+/-" << opts_.fast_interval.count()
+                          << "ms) avg=" << wake_ms_sum_ / wakeups_ << "ms max=" << wake_ms_max_
+                          << "ms n=" << wakeups_ << "\n";
+            } else if (now - trigger_at_ > opts_.fast_window) {
+                pending_trigger_ = false;
+                std::cerr << "[wakeup] display still off " << ms << "ms after trigger, giving up measurement\n";
+            }
+        }
+        auto interval = pending_trigger_ ? opts_.fast_interval : opts_.idle_interval;
+        // trigger 가 들어오면 바로 깨어나 빠른 주기로 전환
+        bool pending_before = pending_trigger_;
+        cv_.wait_for(lk, interval, [&] { return !running_ || (pending_trigger_ && !pending_before); });
+    }
+}
+
+// ---------------- WakeUpServiceImpl ----------------
+
+WakeUpServiceImpl::WakeUpServiceImpl(ScriptRunner& runner, DisplayStateCache& display)
+    : runner_(runner), display_(display) {
+    const char* s = std::getenv("AIPEX_WAKEUP_SCRIPT");
+    if (s) default_script_ = s;
+    const char* d = std::getenv("AIPEX_WAKEUP_SCRIPT_DIR");
+    if (d) script_dir_ = d;
+}
+
+bool WakeUpServiceImpl::ResolveScript(const std::string& name, std::string& path, std::string& err) const {
+    if (name.empty() || name == "wakeup") {
+        if (default_script_.empty()) {
+            err = "AIPEX_WAKEUP_SCRIPT not set";
+            return false;
+        }
+        path = default_script_;
+    } else {
+        // 디렉터리 밖의 파일은 실행하지 않음
+        if (name.find('/') != std::string::npos || name.find("..") != std::string::npos || script_dir_.empty()) {
+            err = "unknown script: " + name;
+            return false;
+        }
+        path = script_dir_ + "/" + name;
+        if (access(path.c_str(), X_OK) != 0) path += ".sh";
+    }
+    if (access(path.c_str(), X_OK) != 0) {
+        err = "not executable: " + path;
+        return false;
+    }
+    return true;
+}
+
+grpc::Status WakeUpServiceImpl::TriggerScript(grpc::ServerContext*, const wakemeup::WakeUpRequest* request,
+                                              wakemeup::WakeUpResponse* response) {
+    auto t0 = std::chrono::steady_clock::now();
+    std::string path, err;
+    if (!ResolveScript(request->script_name(), path, err)) {
+        std::cerr << "[wakeup] TriggerScript rejected: " << err << "\n";
+        response->set_success(false);
+        response->set_message(err);
+        return grpc::Status::OK;
+    }
+    std::vector<std::string> args;
+    std::istringstream is(request->args());
+    std::string a;
+    while (is >> a) args.push_back(a);
+
+    pid_t pid = runner_.Run(path, args, err);
+    if (pid < 0) {
+        std::cerr << "[wakeup] TriggerScript failed: " << err << "\n";
+        response->set_success(false);
+        response->set_message(err);
+        return grpc::Status::OK;
+    }
+    display_.NoteTrigger(t0);
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+    std::cerr << "[wakeup] started " << path << " pid=" << pid << " dispatch=" << us << "us\n";
+    response->set_success(true);
+    response->set_message("started " + path);
+    response->set_process_id(static_cast<int32_t>(pid));
+    return grpc::Status::OK;
+}
+
+grpc::Status WakeUpServiceImpl::IsDisplayOn(grpc::ServerContext*, const google::protobuf::Empty*,
+                                            wakemeup::DisplayState* response) {
+    std::string info;
+    response->set_on(display_.On(info));
+    response->set_info(info);
+    return grpc::Status::OK;
+}
@@ -0,0 +1,22 @@
+// 단위 테스트용 검사 매크로 (테스트 프레임워크 없이 ctest 로 실행)
+// 실패해도 계속 진행하고, main 은 test_exit_code() 를 반환
+#pragma once
+#include <iostream>
+
+inline int& test_failures() {
+    static int n = 0;
+    return n;
+}
+
+inline int test_exit_code() {
+    if (test_failures()) std::cerr << test_failures() << " check(s) failed\n";
+    return test_failures() ? 1 : 0;
+}
+
+#define CHECK(cond)                                                                    \
+    do {                                                                               \
+        if (!(cond)) {                                                                 \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK(" #cond ") failed\n"; \
+            test_failures()++;                                                         \
+        }                                                                              \
+    } while (0)
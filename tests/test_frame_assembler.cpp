@@ -0,0 +1,144 @@
+// FrameAssembler: 분할 전송 프레임 조립과 잘못된 입력 처리
+#include "frame_assembler.h"
+#include "check.h"
+#include <cstring>
+#include <thread>
+
+static data_types::FrameHeader header(uint64_t frame_id, size_t total, uint32_t camera_id = 1) {
+    data_types::FrameHeader h;
+    h.mutable_frame()->set_frame_id(frame_id);
+    h.mutable_frame()->set_camera_id(camera_id);
+    h.mutable_frame()->set_format("BGR");
+    h.set_total_size(total);
+    return h;
+}
+
+static data_types::FrameChunk chunk(uint64_t frame_id, size_t offset, const std::string& data) {
+    data_types::FrameChunk c;
+    c.set_frame_id(frame_id);
+    c.set_offset(offset);
+    c.set_data(data);
+    return c;
+}
+
+static bool same_bytes(const InboundFrame& f, const std::string& want) {
+    return f.size() == want.size() && std::memcmp(f.data(), want.data(), want.size()) == 0;
+}
+
+static void reassembles_interleaved_frames() {
+    FrameAssembler fa(FrameAssembler::Options{});
+    std::string err;
+    auto h1 = header(1, 6, 3);
+    auto h2 = header(2, 4, 4);
+    CHECK(fa.OnHeader(h1, err));
+    CHECK(fa.OnHeader(h2, err));
+
+    std::shared_ptr<InboundFrame> out;
+    auto c = chunk(1, 0, "abc");
+    CHECK(!fa.OnChunk(c, out, err) && err.empty());
+    c = chunk(2, 0, "wxyz");
+    CHECK(fa.OnChunk(c, out, err));
+    CHECK(out && out->meta.frame_id() == 2 && out->meta.camera_id() == 4 && same_bytes(*out, "wxyz"));
+    c = chunk(1, 3, "def");
+    CHECK(fa.OnChunk(c, out, err));
+    CHECK(out && out->meta.frame_id() == 1 && out->meta.format() == "BGR" && same_bytes(*out, "abcdef"));
+
+    CHECK(fa.GetStats().assembled == 2);
+    CHECK(fa.GetStats().bytes == 10);
+    CHECK(fa.TakeAborted().empty());
+}
+
+static void out_of_order_chunk_aborts_the_frame() {
+    FrameAssembler fa(FrameAssembler::Options{});
+    std::string err;
+    std::shared_ptr<InboundFrame> out;
+    auto h = header(5, 6, 9);
+    CHECK(fa.OnHeader(h, err));
+    auto c = chunk(5, 3, "def");
+    CHECK(!fa.OnChunk(c, out, err) && !err.empty());
+    auto aborted = fa.TakeAborted();
+    CHECK(aborted.size() == 1 && aborted[0].frame_id() == 5 && aborted[0].camera_id() == 9);
+    CHECK(fa.GetStats().aborted == 1);
+
+    // 버린 프레임의 나머지 chunk 는 모르는 프레임 (다시 응답하지 않음)
+    err.clear();
+    c = chunk(5, 0, "abc");
+    CHECK(!fa.OnChunk(c, out, err) && !err.empty());
+    CHECK(fa.TakeAborted().empty());
+
+    // 선언한 크기를 넘는 chunk
+    h = header(6, 2);
+    CHECK(fa.OnHeader(h, err));
+    c = chunk(6, 0, "abc");
+    CHECK(!fa.OnChunk(c, out, err));
+    CHECK(fa.TakeAborted().size() == 1);
+}
+
+static void duplicate_header_keeps_the_first_frame() {
+    FrameAssembler fa(FrameAssembler::Options{});
+    std::string err;
+    std::shared_ptr<InboundFrame> out;
+    auto h = header(7, 4, 1);
+    CHECK(fa.OnHeader(h, err));
+    auto c = chunk(7, 0, "ab");
+    CHECK(!fa.OnChunk(c, out, err));
+
+    auto again = header(7, 4, 2);
+    err.clear();
+    CHECK(!fa.OnHeader(again, err) && !err.empty());
+    CHECK(fa.GetStats().duplicates == 1);
+    CHECK(fa.TakeAborted().empty());
+
+    c = chunk(7, 2, "cd");
+    CHECK(fa.OnChunk(c, out, err));
+    CHECK(out && out->meta.camera_id() == 1 && same_bytes(*out, "abcd"));
+}
+
+static void evicts_the_oldest_partial_frame() {
+    FrameAssembler::Options opts;
+    opts.max_partial = 2;
+    FrameAssembler fa(opts);
+    std::string err;
+    // frame_id 순서와 도착 순서가 다름: 먼저 헤더를 받은 10 이 버려져야 함
+    auto h10 = header(10, 4);
+    auto h5 = header(5, 4);
+    auto h7 = header(7, 4);
+    CHECK(fa.OnHeader(h10, err));
+    std::this_thread::sleep_for(std::chrono::milliseconds(1)); // 헤더 수신 시각이 같지 않도록
+    CHECK(fa.OnHeader(h5, err));
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    CHECK(fa.OnHeader(h7, err));
+    auto aborted = fa.TakeAborted();
+    CHECK(aborted.size() == 1 && aborted[0].frame_id() == 10);
+
+    std::shared_ptr<InboundFrame> out;
+    auto c = chunk(5, 0, "abcd");
+    CHECK(fa.OnChunk(c, out, err) && out->meta.frame_id() == 5);
+}
+
+static void rejects_invalid_headers() {
+    FrameAssembler::Options opts;
+    opts.max_frame_bytes = 16;
+    FrameAssembler fa(opts);
+    std::string err;
+    auto empty = header(3, 0);
+    CHECK(!fa.OnHeader(empty, err) && !err.empty());
+    auto huge = header(4, 17);
+    CHECK(!fa.OnHeader(huge, err));
+    auto aborted = fa.TakeAborted();
+    CHECK(aborted.size() == 2 && aborted[0].frame_id() == 3 && aborted[1].frame_id() == 4);
+
+    // frame_id 0 은 응답할 대상이 없으므로 aborted 에 넣지 않음
+    auto no_id = header(0, 8);
+    CHECK(!fa.OnHeader(no_id, err));
+    CHECK(fa.TakeAborted().empty());
+}
+
+int main() {
+    reassembles_interleaved_frames();
+    out_of_order_chunk_aborts_the_frame();
+    duplicate_header_keeps_the_first_frame();
+    evicts_the_oldest_partial_frame();
+    rejects_invalid_headers();
+    return test_exit_code();
+}
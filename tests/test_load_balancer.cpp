@@ -0,0 +1,115 @@
+// LoadBalancer 선택/장애 조치와 ReorderBuffer 재정렬
+#include "load_balancer.h"
+#include "check.h"
+#include <thread>
+
+using Clock = std::chrono::steady_clock;
+using std::chrono::milliseconds;
+
+static void add_boards(LoadBalancer& lb, size_t boards) {
+    for (size_t i = 0; i < boards; ++i) {
+        lb.AddBackend("board" + std::to_string(i));
+        lb.SetHealthy(i, true);
+    }
+}
+
+static void pick_prefers_fewest_outstanding() {
+    LoadBalancer lb(LoadBalancer::Policy::LEAST_OUTSTANDING);
+    add_boards(lb, 3);
+    lb.OnSent(0, 1);
+    lb.OnSent(0, 2);
+    lb.OnSent(1, 3);
+    CHECK(lb.Pick() == 2);
+    lb.OnSent(2, 4);
+    lb.OnSent(2, 5);
+    CHECK(lb.Pick() == 1);
+}
+
+static void pick_skips_unhealthy_and_excluded() {
+    LoadBalancer lb(LoadBalancer::Policy::LEAST_OUTSTANDING);
+    add_boards(lb, 2);
+    lb.SetHealthy(0, false);
+    CHECK(lb.Pick() == 1);
+    // 쓰기에 실패한 보드를 빼고 다시 고르면 남은 보드가 없음
+    CHECK(lb.Pick(1) == -1);
+    lb.SetHealthy(0, true);
+    CHECK(lb.Pick(1) == 0);
+
+    LoadBalancer none(LoadBalancer::Policy::LEAST_OUTSTANDING);
+    none.AddBackend("down");
+    CHECK(none.Pick() == -1);
+}
+
+static void lowest_latency_weighs_queue_depth() {
+    LoadBalancer lb(LoadBalancer::Policy::LOWEST_LATENCY);
+    add_boards(lb, 2);
+    const auto t0 = Clock::now();
+    lb.OnSent(0, 1, t0);
+    lb.OnResult(0, 1, t0 + milliseconds(10));
+    lb.OnSent(1, 2, t0);
+    lb.OnResult(1, 2, t0 + milliseconds(30));
+    CHECK(lb.Pick() == 0);
+    // 빠른 보드라도 밀려 있으면 (10+1)*4 > (30+1)*1
+    for (uint64_t id = 10; id < 13; ++id) lb.OnSent(0, id, t0);
+    CHECK(lb.Pick() == 1);
+}
+
+static void failed_write_only_releases_the_slot() {
+    LoadBalancer lb(LoadBalancer::Policy::LEAST_OUTSTANDING);
+    add_boards(lb, 1);
+    const auto t0 = Clock::now();
+    lb.OnSent(0, 1, t0);
+    CHECK(lb.OnResult(0, 1, t0 + milliseconds(20)) == 20.0);
+    lb.OnSent(0, 2, t0);
+    lb.OnFailed(0, 2);
+    auto s = lb.Stats()[0];
+    CHECK(s.outstanding == 0);
+    CHECK(s.completed == 1);
+    CHECK(s.ewma_latency_ms == 20.0);
+    CHECK(s.failures == 0);
+    CHECK(lb.OnResult(0, 2) < 0); // 이미 뺀 프레임의 늦은 결과
+}
+
+static void stalled_board_hands_over_outstanding_frames() {
+    LoadBalancer lb(LoadBalancer::Policy::LEAST_OUTSTANDING);
+    add_boards(lb, 2);
+    const auto now = Clock::now();
+    lb.OnSent(0, 7, now - milliseconds(5000));
+    lb.OnSent(0, 8, now - milliseconds(4000));
+    lb.OnSent(1, 9, now);
+    auto stalled = lb.FindStalled(milliseconds(1000));
+    CHECK(stalled.size() == 1 && stalled[0] == 0);
+
+    auto ids = lb.TakeOutstanding(0);
+    CHECK(ids.size() == 2 && ids[0] == 7 && ids[1] == 8);
+    CHECK(lb.Stats()[0].outstanding == 0);
+    CHECK(lb.Stats()[0].failures == 1);
+    CHECK(lb.FindStalled(milliseconds(1000)).empty());
+}
+
+static void reorder_buffer_releases_in_frame_order() {
+    ReorderBuffer<int> rb(milliseconds(0));
+    CHECK(rb.Push(2, 20).empty());
+    auto out = rb.Push(1, 10);
+    CHECK(out.size() == 2 && out[0] == 10 && out[1] == 20);
+
+    // 3 이 오지 않으면 max_wait 뒤 건너뜀. 늦게 온 3 은 버림
+    CHECK(rb.Push(4, 40).empty());
+    std::this_thread::sleep_for(milliseconds(2));
+    out = rb.Flush();
+    CHECK(out.size() == 1 && out[0] == 40);
+    CHECK(rb.Skipped() == 1);
+    CHECK(rb.Push(3, 30).empty());
+    out = rb.Push(5, 50);
+    CHECK(out.size() == 1 && out[0] == 50);
+}
+
+int main() {
+    pick_prefers_fewest_outstanding();
+    pick_skips_unhealthy_and_excluded();
+    lowest_latency_weighs_queue_depth();
+    failed_write_only_releases_the_slot();
+    stalled_board_hands_over_outstanding_frames();
+    reorder_buffer_releases_in_frame_order();
+    return test_exit_code();
+}
@@ -0,0 +1,95 @@
+// PlayoutBuffer: 캡처 시각 순 재생, 지난 프레임 건너뛰기, 늦은 프레임 집계
+#include "playout_buffer.h"
+#include "check.h"
+
+using Buffer = PlayoutBuffer<int>;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+// 송신측 캡처 시각(us) 과 고정 전송 지연 5ms 로 도착한 로컬 시각
+static const Buffer::Clock::time_point kEpoch{std::chrono::seconds(1000)};
+static Buffer::Clock::time_point arrival_of(int64_t capture_us, milliseconds extra = milliseconds(0)) {
+    return kEpoch + microseconds(capture_us) + milliseconds(5) + extra;
+}
+
+static Buffer::Options options() {
+    Buffer::Options o;
+    o.min_delay = milliseconds(20);
+    o.max_frames = 100;
+    return o;
+}
+
+static void releases_in_capture_order() {
+    Buffer pb(options());
+    // 네트워크에서 순서가 바뀌어 도착 (33ms 프레임이 66ms 프레임보다 늦게 Push)
+    pb.Push(0, arrival_of(0), 0);
+    pb.Push(66000, arrival_of(66000), 2);
+    pb.Push(33000, arrival_of(33000), 1);
+
+    int out = -1;
+    // 재생 시각 = 캡처 + 5ms(기준 지연) + 20ms(목표 지연)
+    CHECK(!pb.Due(arrival_of(0, milliseconds(19)), out));
+    CHECK(pb.Due(arrival_of(0, milliseconds(20)), out) && out == 0);
+    CHECK(!pb.Due(arrival_of(0, milliseconds(21)), out));
+    CHECK(pb.Due(arrival_of(33000, milliseconds(20)), out) && out == 1);
+    CHECK(pb.Due(arrival_of(66000, milliseconds(20)), out) && out == 2);
+
+    auto s = pb.GetStats();
+    CHECK(s.released == 3);
+    CHECK(s.skipped == 0);
+    CHECK(s.late == 0);
+    CHECK(s.buffered == 0);
+}
+
+static void skips_frames_the_display_missed() {
+    Buffer pb(options());
+    for (int i = 0; i < 4; ++i) pb.Push(i * 33000, arrival_of(i * 33000), i);
+    int out = -1;
+    // 표시 루프가 멈췄다가 돌아오면 가장 최근에 재생 시각이 지난 프레임만 냄
+    CHECK(pb.Due(arrival_of(2 * 33000, milliseconds(20)), out) && out == 2);
+    auto s = pb.GetStats();
+    CHECK(s.released == 1);
+    CHECK(s.skipped == 2);
+    CHECK(s.buffered == 1);
+}
+
+static void counts_late_frames() {
+    Buffer pb(options());
+    int64_t capture = 0;
+    for (int i = 0; i < 40; ++i, capture += 33000) pb.Push(capture, arrival_of(capture), i);
+    // jitter percentile 밖의 한 프레임: 재생 시각이 지난 뒤 도착했지만 버리지는 않음
+    pb.Push(capture, arrival_of(capture, milliseconds(50)), 40);
+    auto s = pb.GetStats();
+    CHECK(s.late == 1);
+    CHECK(s.target_delay_ms == 20.0);
+    CHECK(s.buffered == 41);
+
+    int out = -1;
+    CHECK(pb.Due(arrival_of(capture, milliseconds(50)), out) && out == 40);
+    // 이미 재생한 프레임보다 오래된 캡처는 late 로 세고 버림
+    pb.Push(capture - 1000, arrival_of(capture, milliseconds(60)), 99);
+    s = pb.GetStats();
+    CHECK(s.late == 2);
+    CHECK(s.buffered == 0);
+    CHECK(!pb.Due(arrival_of(capture, milliseconds(100)), out));
+}
+
+static void target_delay_follows_jitter() {
+    Buffer pb(options());
+    int64_t capture = 0;
+    // 절반은 40ms 늦게 도착: percentile jitter 40ms 로 목표 지연이 바로 늘어남
+    for (int i = 0; i < 20; ++i, capture += 33000) {
+        pb.Push(capture, arrival_of(capture, milliseconds(i % 2 ? 40 : 0)), i);
+    }
+    auto s = pb.GetStats();
+    CHECK(s.jitter_ms == 40.0);
+    CHECK(s.target_delay_ms == 40.0);
+}
+
+int main() {
+    releases_in_capture_order();
+    skips_frames_the_display_missed();
+    counts_late_frames();
+    target_delay_follows_jitter();
+    return test_exit_code();
+}
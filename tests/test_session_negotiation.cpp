@@ -0,0 +1,127 @@
+// hello -> session_config 합의
+#include "session_negotiation.h"
+#include "check.h"
+#include <cstdlib>
+
+static data_types::Capabilities full_server() {
+    data_types::Capabilities s;
+    s.set_protocol_version(kSessionProtocolVersion);
+    s.add_frame_formats("JPEG");
+    s.add_frame_formats("BGR");
+    s.add_result_encodings("json");
+    s.set_result_batch(true);
+    s.set_chunked_frames(true);
+    s.set_max_chunk_bytes(1u << 20);
+    s.set_max_inflight(3);
+    return s;
+}
+
+static void empty_hello_gets_legacy_mode() {
+    auto sc = negotiate_session(data_types::Capabilities(), full_server());
+    CHECK(sc.protocol_version() == 0);
+    CHECK(sc.frame_format() == "JPEG");
+    CHECK(sc.result_encoding() == "json");
+    CHECK(!sc.result_batch());
+    CHECK(!sc.chunked_frames());
+    CHECK(sc.chunk_bytes() == 0);
+    CHECK(sc.max_inflight() == 3);
+    CHECK(sc.compression().empty());
+}
+
+static void frame_format_follows_client_preference() {
+    data_types::Capabilities client;
+    client.set_protocol_version(kSessionProtocolVersion);
+    client.add_frame_formats("BGR");
+    client.add_frame_formats("JPEG");
+    CHECK(negotiate_session(client, full_server()).frame_format() == "BGR");
+
+    // 서버가 모르는 형식은 건너뜀
+    client.clear_frame_formats();
+    client.add_frame_formats("PNG");
+    client.add_frame_formats("JPEG");
+    CHECK(negotiate_session(client, full_server()).frame_format() == "JPEG");
+
+    data_types::Capabilities jpeg_only = full_server();
+    jpeg_only.clear_frame_formats();
+    jpeg_only.add_frame_formats("JPEG");
+    client.clear_frame_formats();
+    client.add_frame_formats("BGR");
+    CHECK(negotiate_session(client, jpeg_only).frame_format() == "JPEG");
+}
+
+static void chunking_and_batching_need_both_sides() {
+    data_types::Capabilities client;
+    client.set_chunked_frames(true);
+    client.set_max_chunk_bytes(256u << 10);
+    client.set_result_batch(true);
+    auto sc = negotiate_session(client, full_server());
+    CHECK(sc.chunked_frames());
+    CHECK(sc.chunk_bytes() == (256u << 10));
+    CHECK(sc.result_batch());
+
+    // 크기를 알리지 않은 client 는 분할하지 않음
+    client.set_max_chunk_bytes(0);
+    CHECK(!negotiate_session(client, full_server()).chunked_frames());
+
+    data_types::Capabilities server = full_server();
+    server.set_result_batch(false);
+    server.set_chunked_frames(false);
+    client.set_max_chunk_bytes(8u << 20);
+    sc = negotiate_session(client, server);
+    CHECK(!sc.result_batch());
+    CHECK(!sc.chunked_frames());
+}
+
+static void inflight_takes_the_smaller_limit() {
+    data_types::Capabilities client;
+    client.set_max_inflight(1);
+    CHECK(negotiate_session(client, full_server()).max_inflight() == 1);
+    client.set_max_inflight(8);
+    CHECK(negotiate_session(client, full_server()).max_inflight() == 3);
+
+    data_types::Capabilities server = full_server();
+    server.set_max_inflight(0);
+    client.set_max_inflight(2);
+    CHECK(negotiate_session(client, server).max_inflight() == 2);
+}
+
+static void compression_follows_server_order() {
+    data_types::Capabilities server = full_server();
+    server.add_compression("deflate");
+    server.add_compression("gzip");
+    data_types::Capabilities client;
+    client.add_compression("gzip");
+    client.add_compression("deflate");
+    CHECK(negotiate_session(client, server).compression() == "deflate");
+
+    client.clear_compression();
+    CHECK(negotiate_session(client, server).compression().empty());
+}
+
+static void server_capabilities_reflect_environment() {
+    unsetenv("AIPEX_STREAM_COMPRESSION");
+    auto caps = server_capabilities(2, false);
+    CHECK(caps.max_inflight() == 2);
+    CHECK(!caps.result_batch());
+    CHECK(caps.chunked_frames());
+    CHECK(caps.max_chunk_bytes() > 0 && caps.max_chunk_bytes() < (4u << 20));
+    CHECK(caps.compression_size() == 0);
+
+    setenv("AIPEX_STREAM_COMPRESSION", "gzip", 1);
+    caps = server_capabilities(2, true);
+    CHECK(caps.result_batch());
+    CHECK(caps.compression_size() == 1 && caps.compression(0) == "gzip");
+    setenv("AIPEX_STREAM_COMPRESSION", "brotli", 1);
+    CHECK(server_capabilities(2, true).compression_size() == 0);
+    unsetenv("AIPEX_STREAM_COMPRESSION");
+}
+
+int main() {
+    empty_hello_gets_legacy_mode();
+    frame_format_follows_client_preference();
+    chunking_and_batching_need_both_sides();
+    inflight_takes_the_smaller_limit();
+    compression_follows_server_order();
+    server_capabilities_reflect_environment();
+    return test_exit_code();
+}